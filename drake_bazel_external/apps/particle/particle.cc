@@ -2,6 +2,8 @@
 
 #include "particle.h"
 
+#include <drake/common/drake_throw.h>
+#include <drake/common/eigen_types.h>
 #include <drake/systems/framework/framework_common.h>
 #include <drake/systems/framework/vector_base.h>
 
@@ -9,8 +11,15 @@ namespace drake_external_examples {
 namespace particles {
 
 template <typename T>
-Particle<T>::Particle() {
-  // A 1D input vector for acceleration.
+Particle<T>::Particle() : Particle(1.0) {}
+
+template <typename T>
+Particle<T>::Particle(double mass)
+    : drake::systems::LeafSystem<T>(
+          drake::systems::SystemTypeTag<Particle>{}),
+      default_mass_(mass) {
+  DRAKE_THROW_UNLESS(mass > 0.0);
+  // A 1D input vector for force.
   this->DeclareInputPort(drake::systems::kUseDefaultName,
                          drake::systems::kVectorValued, 1);
   // Adding one generalized position and one generalized velocity.
@@ -19,6 +28,21 @@ Particle<T>::Particle() {
   this->DeclareVectorOutputPort(drake::systems::kUseDefaultName,
                                 drake::systems::BasicVector<T>(2),
                                 &Particle::CopyStateOut);
+  // A 1D parameter vector for mass.
+  this->DeclareNumericParameter(
+      drake::systems::BasicVector<T>(drake::Vector1<T>(mass)));
+}
+
+template <typename T>
+const T& Particle<T>::get_mass(
+    const drake::systems::Context<T>& context) const {
+  return context.get_numeric_parameter(0).GetAtIndex(0);
+}
+
+template <typename T>
+void Particle<T>::set_mass(drake::systems::Context<T>* context,
+                           const T& mass) const {
+  context->get_mutable_numeric_parameter(0).SetAtIndex(0, mass);
 }
 
 template <typename T>
@@ -41,16 +65,18 @@ void Particle<T>::DoCalcTimeDerivatives(
   // Obtain the structure we need to write into.
   drake::systems::VectorBase<T>& derivatives_vector =
       derivatives->get_mutable_vector();
-  // Get current input acceleration value.
+  // Get current input force value.
   const drake::systems::BasicVector<T>* input_vector =
       this->EvalVectorInput(context, 0);
   // Set the derivatives. The first one is
   // velocity and the second one is acceleration.
   derivatives_vector.SetAtIndex(0, continuous_state_vector.GetAtIndex(1));
-  derivatives_vector.SetAtIndex(1, input_vector->GetAtIndex(0));
+  derivatives_vector.SetAtIndex(
+      1, input_vector->GetAtIndex(0) / get_mass(context));
 }
 
-template class Particle<double>;
-
 }  // namespace particles
 }  // namespace drake_external_examples
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake_external_examples::particles::Particle);
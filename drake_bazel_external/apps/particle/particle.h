@@ -2,36 +2,60 @@
 
 #pragma once
 
+#include <drake/common/default_scalars.h>
 #include <drake/common/drake_copyable.h>
 #include <drake/systems/framework/basic_vector.h>
 #include <drake/systems/framework/context.h>
 #include <drake/systems/framework/continuous_state.h>
 #include <drake/systems/framework/leaf_system.h>
+#include <drake/systems/framework/system_type_tag.h>
 
 namespace drake_external_examples {
 namespace particles {
 
 /// A linear 1DOF particle system.
 ///
-/// With very simple dynamics @f$ \ddot x = a @f$, this system can be
+/// With very simple dynamics @f$ \ddot x = f / m @f$, this system can be
 /// described in terms of its:
 ///
 /// - Inputs:
-///   - linear acceleration (input index 0), in @f$ m/s^2 @f$ units.
+///   - linear force (input index 0), in @f$ N @f$ units. With the default
+///     unit mass, this is the linear acceleration in @f$ m/s^2 @f$ units.
 /// - States/Outputs:
 ///   - linear position (state/output index 0), in @f$ m @f$ units.
 ///   - linear velocity (state/output index 1), in @f$ m/s @f$ units.
+/// - Parameters:
+///   - mass (numeric parameter index 0), in @f$ kg @f$ units.
 ///
-/// @tparam_double_only
+/// @tparam_default_scalar
 ///
 template <typename T>
 class Particle final : public drake::systems::LeafSystem<T> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Particle);
 
-  /// A constructor that initializes the system.
+  /// A constructor that initializes the system, with unit mass.
   Particle();
 
+  /// A constructor that initializes the system, with a mass parameter that
+  /// defaults to @p mass.
+  /// @throws std::exception unless @p mass is positive.
+  explicit Particle(double mass);
+
+  /// Scalar-converting copy constructor. See @ref system_scalar_conversion.
+  template <typename U>
+  explicit Particle(const Particle<U>& other)
+      : Particle(other.default_mass()) {}
+
+  /// Returns the mass that new contexts are initialized with.
+  double default_mass() const { return default_mass_; }
+
+  /// Returns the mass parameter stored in @p context.
+  const T& get_mass(const drake::systems::Context<T>& context) const;
+
+  /// Sets the mass parameter stored in @p context.
+  void set_mass(drake::systems::Context<T>* context, const T& mass) const;
+
  protected:
   void CopyStateOut(const drake::systems::Context<T>& context,
                     drake::systems::BasicVector<T>* output) const;
@@ -39,7 +63,13 @@ class Particle final : public drake::systems::LeafSystem<T> {
   void DoCalcTimeDerivatives(
       const drake::systems::Context<T>& context,
       drake::systems::ContinuousState<T>* derivatives) const override;
+
+ private:
+  const double default_mass_;
 };
 
 }  // namespace particles
 }  // namespace drake_external_examples
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake_external_examples::particles::Particle);
@@ -0,0 +1,24 @@
+# SPDX-License-Identifier: MIT-0
+
+"""
+Provides the SimpleAdder system bound in C++ by the `_simple_adder` extension
+module.
+
+Importing this module is cheap: the extension module, which imports pydrake's
+systems framework as it loads, is imported only when SimpleAdder is first
+used (e.g., by `from simple_adder import SimpleAdder`).
+"""
+
+import importlib
+
+__all__ = ["SimpleAdder", "SimpleAdder_"]
+
+
+def __getattr__(name):
+    # Called only for names that are not (yet) module globals; see PEP 562.
+    if name not in __all__:
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+    # The import system serializes concurrent imports of the same module.
+    value = getattr(importlib.import_module("_simple_adder"), name)
+    globals()[name] = value
+    return value
@@ -3,7 +3,8 @@
 /**
  * @file
  * Provides an example of binding a simple Drake C++ system in pybind11, to be
- * used with pydrake.
+ * used with pydrake. Python code imports these through the simple_adder.py
+ * module, which loads this extension module on first use.
  */
 
 #include <pybind11/pybind11.h>
@@ -23,7 +24,7 @@ using drake::systems::LeafSystem;
 namespace drake_external_examples {
 namespace {
 
-PYBIND11_MODULE(simple_adder, m) {
+PYBIND11_MODULE(_simple_adder, m) {
   m.doc() = "Example module interfacing with pydrake and Drake C++";
 
   py::module::import("pydrake.systems.framework");
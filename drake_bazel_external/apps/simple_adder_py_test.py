@@ -6,6 +6,10 @@ Provides an example of using pybind11-bound Drake C++ system with pydrake.
 
 from __future__ import print_function
 
+import os
+import subprocess
+import sys
+
 from simple_adder import SimpleAdder, SimpleAdder_
 
 import numpy as np
@@ -20,7 +24,18 @@ from pydrake.systems.primitives import (
 )
 
 
+def check_lazy_import():
+    # Importing simple_adder alone must not import pydrake.
+    env = dict(os.environ, PYTHONPATH=os.pathsep.join(sys.path))
+    subprocess.run([
+        sys.executable, "-c",
+        "import sys, simple_adder; assert 'pydrake' not in sys.modules",
+    ], env=env, check=True)
+
+
 def main():
+    check_lazy_import()
+
     # Simulate with doubles.
     builder = DiagramBuilder()
     source = builder.AddSystem(ConstantVectorSource([10.]))
@@ -0,0 +1,414 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "derivatives_codegen.h"
+
+#include <cmath>
+#include <iomanip>
+#include <locale>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <drake/common/eigen_types.h>
+#include <drake/common/symbolic/expression.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/input_port.h>
+
+namespace drake_external_examples {
+namespace symbolic_codegen {
+namespace {
+
+using drake::MatrixX;
+using drake::VectorX;
+using drake::symbolic::Expression;
+using drake::symbolic::ExpressionKind;
+using drake::symbolic::Variable;
+using drake::systems::Context;
+using drake::systems::PortDataType;
+using drake::systems::System;
+
+// Formats `value` as a C++ double literal that round-trips. Negative values
+// are parenthesized, so that the literal may be used as an operand.
+std::string Literal(double value) {
+  if (!std::isfinite(value)) {
+    throw std::runtime_error(
+        "GenerateDerivatives() cannot generate code for a non-finite "
+        "constant");
+  }
+  std::ostringstream out;
+  out.imbue(std::locale::classic());
+  out << std::setprecision(17) << value;
+  std::string text = out.str();
+  if (text.find_first_of(".e") == std::string::npos) {
+    text += ".0";
+  }
+  return (value < 0) ? "(" + text + ")" : text;
+}
+
+struct ExpressionEqualTo {
+  bool operator()(const Expression& a, const Expression& b) const {
+    return a.EqualTo(b);
+  }
+};
+
+// Emits straight-line code that evaluates expressions: each distinct
+// composite subexpression is assigned to a `const double` local exactly once,
+// and is referred to by name thereafter.
+class StraightLineEmitter {
+ public:
+  // `arguments` names the code for each variable, e.g. x0 -> "x[0]".
+  explicit StraightLineEmitter(
+      const std::vector<std::pair<Variable, std::string>>& arguments) {
+    for (const auto& [variable, code] : arguments) {
+      operands_.emplace(Expression(variable), code);
+    }
+  }
+
+  // Returns an operand (a literal, an argument, or a local) that holds the
+  // value of `e`, emitting the locals that it needs.
+  std::string Emit(const Expression& e) {
+    if (const auto found = operands_.find(e); found != operands_.end()) {
+      return found->second;
+    }
+    std::string value;
+    switch (e.get_kind()) {
+      case ExpressionKind::kConstant:
+        return Literal(drake::symbolic::get_constant_value(e));
+      case ExpressionKind::kVar:
+        throw std::runtime_error(
+            "GenerateDerivatives() found the derivatives depend on " +
+            e.to_string() + ", which is not one of t, x, u or p");
+      case ExpressionKind::kAdd: {
+        const double constant = drake::symbolic::get_constant_in_addition(e);
+        if (constant != 0.0) {
+          value = Literal(constant);
+        }
+        for (const auto& [term, coefficient] :
+             drake::symbolic::get_expr_to_coeff_map_in_addition(e)) {
+          AppendTerm(coefficient, Emit(term), &value);
+        }
+        break;
+      }
+      case ExpressionKind::kMul: {
+        const double constant =
+            drake::symbolic::get_constant_in_multiplication(e);
+        if (constant == -1.0) {
+          value = "-";
+        } else if (constant != 1.0) {
+          value = Literal(constant) + " * ";
+        }
+        std::string factors;
+        for (const auto& [base, exponent] :
+             drake::symbolic::get_base_to_exponent_map_in_multiplication(e)) {
+          factors += (factors.empty() ? "" : " * ") +
+                     EmitPower(Emit(base), exponent);
+        }
+        value += factors;
+        break;
+      }
+      case ExpressionKind::kDiv:
+        value = Emit(drake::symbolic::get_first_argument(e)) + " / " +
+                Emit(drake::symbolic::get_second_argument(e));
+        break;
+      case ExpressionKind::kPow:
+        return EmitPower(Emit(drake::symbolic::get_first_argument(e)),
+                         drake::symbolic::get_second_argument(e));
+      case ExpressionKind::kLog:
+        value = Call("std::log", e);
+        break;
+      case ExpressionKind::kAbs:
+        value = Call("std::abs", e);
+        break;
+      case ExpressionKind::kExp:
+        value = Call("std::exp", e);
+        break;
+      case ExpressionKind::kSqrt:
+        value = Call("std::sqrt", e);
+        break;
+      case ExpressionKind::kSin:
+        value = Call("std::sin", e);
+        break;
+      case ExpressionKind::kCos:
+        value = Call("std::cos", e);
+        break;
+      case ExpressionKind::kTan:
+        value = Call("std::tan", e);
+        break;
+      case ExpressionKind::kAsin:
+        value = Call("std::asin", e);
+        break;
+      case ExpressionKind::kAcos:
+        value = Call("std::acos", e);
+        break;
+      case ExpressionKind::kAtan:
+        value = Call("std::atan", e);
+        break;
+      case ExpressionKind::kAtan2:
+        value = Call("std::atan2", e);
+        break;
+      case ExpressionKind::kSinh:
+        value = Call("std::sinh", e);
+        break;
+      case ExpressionKind::kCosh:
+        value = Call("std::cosh", e);
+        break;
+      case ExpressionKind::kTanh:
+        value = Call("std::tanh", e);
+        break;
+      case ExpressionKind::kMin:
+        value = Call("std::min", e);
+        break;
+      case ExpressionKind::kMax:
+        value = Call("std::max", e);
+        break;
+      case ExpressionKind::kCeil:
+        value = Call("std::ceil", e);
+        break;
+      case ExpressionKind::kFloor:
+        value = Call("std::floor", e);
+        break;
+      default:
+        throw std::runtime_error(
+            "GenerateDerivatives() cannot generate code for " +
+            e.to_string());
+    }
+    // A product or sum of a single operand is that operand.
+    const std::string operand =
+        (value.find_first_of(" -(") == std::string::npos) ? value
+                                                          : NewLocal(value);
+    operands_.emplace(e, operand);
+    return operand;
+  }
+
+  // The statements that define the locals, in order.
+  const std::string& statements() const { return statements_; }
+
+ private:
+  std::string NewLocal(const std::string& value) {
+    std::string name = "v" + std::to_string(num_locals_++);
+    statements_ += "  const double " + name + " = " + value + ";\n";
+    return name;
+  }
+
+  // Appends `coefficient * operand` to the sum in `value`.
+  static void AppendTerm(double coefficient, const std::string& operand,
+                         std::string* value) {
+    const bool first = value->empty();
+    const double magnitude = std::abs(coefficient);
+    const std::string product =
+        (magnitude == 1.0) ? operand : Literal(magnitude) + " * " + operand;
+    if (coefficient < 0) {
+      *value += first ? "-" + product : " - " + product;
+    } else {
+      *value += first ? product : " + " + product;
+    }
+  }
+
+  // Returns the call of `function` on the arguments of `e`.
+  std::string Call(const std::string& function, const Expression& e) {
+    switch (e.get_kind()) {
+      case ExpressionKind::kAtan2:
+      case ExpressionKind::kMin:
+      case ExpressionKind::kMax:
+        return function + "(" + Emit(drake::symbolic::get_first_argument(e)) +
+               ", " + Emit(drake::symbolic::get_second_argument(e)) + ")";
+      default:
+        return function + "(" + Emit(drake::symbolic::get_argument(e)) + ")";
+    }
+  }
+
+  // Returns an operand that holds `base` raised to `exponent`. Small integer
+  // exponents, the common case in dynamics, are computed by squaring and
+  // multiplying; std::pow() would not be inlined without -ffast-math.
+  std::string EmitPower(const std::string& base, const Expression& exponent) {
+    if (drake::symbolic::is_constant(exponent)) {
+      const double n = drake::symbolic::get_constant_value(exponent);
+      if (n == 0.5) {
+        return NewLocal("std::sqrt(" + base + ")");
+      }
+      if (n == std::round(n) && std::abs(n) <= 64) {
+        const int k = static_cast<int>(n);
+        if (k == 0) {
+          return "1.0";
+        }
+        return (k > 0) ? EmitIntegerPower(base, k)
+                       : NewLocal("1.0 / " + EmitIntegerPower(base, -k));
+      }
+    }
+    return NewLocal("std::pow(" + base + ", " + Emit(exponent) + ")");
+  }
+
+  std::string EmitIntegerPower(const std::string& base, int k) {
+    if (k == 1) {
+      return base;
+    }
+    const auto key = std::make_pair(base, k);
+    if (const auto found = powers_.find(key); found != powers_.end()) {
+      return found->second;
+    }
+    std::string value;
+    if (k % 2 == 0) {
+      const std::string half = EmitIntegerPower(base, k / 2);
+      value = half + " * " + half;
+    } else {
+      value = EmitIntegerPower(base, k - 1) + " * " + base;
+    }
+    const std::string local = NewLocal(value);
+    powers_.emplace(key, local);
+    return local;
+  }
+
+  std::unordered_map<Expression, std::string, std::hash<Expression>,
+                     ExpressionEqualTo>
+      operands_;
+  std::map<std::pair<std::string, int>, std::string> powers_;
+  std::string statements_;
+  int num_locals_{0};
+};
+
+// Returns the definition of `Derivatives::<function>`, which writes
+// `outputs` to the array `output`.
+std::string EmitFunction(
+    const std::string& function, const std::string& output,
+    const std::vector<Expression>& outputs,
+    const std::vector<std::pair<Variable, std::string>>& arguments) {
+  StraightLineEmitter emitter(arguments);
+  std::string assignments;
+  for (int i = 0; i < static_cast<int>(outputs.size()); ++i) {
+    assignments += "  " + output + "[" + std::to_string(i) +
+                   "] = " + emitter.Emit(outputs[i]) + ";\n";
+  }
+  return "void Derivatives::" + function +
+         "([[maybe_unused]] double t, [[maybe_unused]] const double* x,\n"
+         "    [[maybe_unused]] const double* u,"
+         " [[maybe_unused]] const double* p, double* " +
+         output + ") {\n" + emitter.statements() + assignments + "}\n";
+}
+
+}  // namespace
+
+GeneratedDerivatives GenerateDerivatives(const System<double>& system,
+                                         const std::string& name,
+                                         const std::string& header_path) {
+  const std::unique_ptr<Context<double>> defaults =
+      system.CreateDefaultContext();
+  if (defaults->num_discrete_state_groups() > 0 ||
+      defaults->num_abstract_states() > 0) {
+    throw std::logic_error(
+        "GenerateDerivatives() requires a system with only continuous "
+        "state");
+  }
+  const std::unique_ptr<System<Expression>> symbolic =
+      System<double>::ToSymbolic(system);
+  const std::unique_ptr<Context<Expression>> context =
+      symbolic->CreateDefaultContext();
+
+  // Replace the time, state, inputs and parameters with variables, and name
+  // the code for each.
+  std::vector<std::pair<Variable, std::string>> arguments;
+  const auto add_argument = [&arguments](const std::string& array, int index) {
+    const Variable variable(array + std::to_string(index));
+    arguments.emplace_back(variable,
+                           array + "[" + std::to_string(index) + "]");
+    return variable;
+  };
+  const Variable t("t");
+  arguments.emplace_back(t, "t");
+  context->SetTime(t);
+
+  const int num_states = context->num_continuous_states();
+  std::vector<Variable> x;
+  VectorX<Expression> x_expression(num_states);
+  for (int i = 0; i < num_states; ++i) {
+    x.push_back(add_argument("x", i));
+    x_expression[i] = x.back();
+  }
+  context->SetContinuousState(x_expression);
+
+  int num_inputs = 0;
+  for (int i = 0; i < symbolic->num_input_ports(); ++i) {
+    const auto& port = symbolic->get_input_port(i);
+    if (port.get_data_type() != PortDataType::kVectorValued) {
+      throw std::logic_error(
+          "GenerateDerivatives() requires vector-valued input ports, but " +
+          port.get_name() + " is abstract-valued");
+    }
+    VectorX<Expression> u(port.size());
+    for (int j = 0; j < port.size(); ++j) {
+      u[j] = add_argument("u", num_inputs++);
+    }
+    port.FixValue(context.get(), u);
+  }
+
+  std::vector<double> default_parameters;
+  for (int i = 0; i < defaults->num_numeric_parameter_groups(); ++i) {
+    const Eigen::VectorXd values =
+        defaults->get_numeric_parameter(i).CopyToVector();
+    VectorX<Expression> p(values.size());
+    for (int j = 0; j < values.size(); ++j) {
+      p[j] = add_argument("p", static_cast<int>(default_parameters.size()));
+      default_parameters.push_back(values[j]);
+    }
+    context->get_mutable_numeric_parameter(i).SetFromVector(p);
+  }
+
+  const VectorX<Expression> xdot =
+      symbolic->EvalTimeDerivatives(*context).CopyToVector();
+  const MatrixX<Expression> jacobian = drake::symbolic::Jacobian(xdot, x);
+  const std::vector<Expression> xdot_entries(xdot.data(),
+                                             xdot.data() + xdot.size());
+  // Eigen's default storage order is column-major.
+  const std::vector<Expression> jacobian_entries(
+      jacobian.data(), jacobian.data() + jacobian.size());
+
+  std::string parameter_values;
+  for (const double value : default_parameters) {
+    parameter_values += (parameter_values.empty() ? "" : ", ") + Literal(value);
+  }
+  const std::string preamble =
+      "// Generated by derivatives_codegen from " + system.GetSystemType() +
+      ".\n// Do not edit.\n";
+  const std::string namespaces_begin =
+      "namespace drake_external_examples {\n"
+      "namespace symbolic_codegen {\n"
+      "namespace " + name + " {\n";
+  const std::string namespaces_end =
+      "}  // namespace " + name + "\n"
+      "}  // namespace symbolic_codegen\n"
+      "}  // namespace drake_external_examples\n";
+
+  GeneratedDerivatives result;
+  result.header =
+      preamble + "\n#pragma once\n\n#include <array>\n\n" + namespaces_begin +
+      "\n/// The time derivatives xdot = f(t, x, u, p) of " +
+      system.GetSystemType() +
+      ",\n/// and their Jacobian ∂f/∂x in column-major order.\n"
+      "struct Derivatives {\n"
+      "  static constexpr int kNumStates = " + std::to_string(num_states) +
+      ";\n"
+      "  static constexpr int kNumInputs = " + std::to_string(num_inputs) +
+      ";\n"
+      "  static constexpr int kNumParameters = " +
+      std::to_string(default_parameters.size()) + ";\n"
+      "  static constexpr std::array<double, kNumParameters> "
+      "kDefaultParameters{\n      {" + parameter_values + "}};\n\n"
+      "  static void Calc(double t, const double* x, const double* u,\n"
+      "                   const double* p, double* xdot);\n\n"
+      "  static void CalcJacobian(double t, const double* x, const double* u,"
+      "\n                           const double* p, double* dxdot_dx);\n"
+      "};\n\n" + namespaces_end;
+  result.source =
+      preamble + "\n#include \"" + header_path +
+      "\"\n\n#include <algorithm>\n#include <cmath>\n\n" + namespaces_begin +
+      "\n" + EmitFunction("Calc", "xdot", xdot_entries, arguments) + "\n" +
+      EmitFunction("CalcJacobian", "dxdot_dx", jacobian_entries, arguments) +
+      "\n" + namespaces_end;
+  return result;
+}
+
+}  // namespace symbolic_codegen
+}  // namespace drake_external_examples
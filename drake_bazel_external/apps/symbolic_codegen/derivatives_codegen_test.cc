@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "derivatives_codegen.h"  // IWYU pragma: associated
+
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/primitives/zero_order_hold.h>
+
+#include "generated_system.h"
+#include "particle/particle.h"
+#include "particle_derivatives.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+#include "simple_continuous_time_system_derivatives.h"
+
+namespace drake_external_examples {
+namespace symbolic_codegen {
+namespace {
+
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+using GeneratedParticle = GeneratedSystem<particle_derivatives::Derivatives>;
+using GeneratedSimpleContinuousTimeSystem =
+    GeneratedSystem<simple_continuous_time_system_derivatives::Derivatives>;
+
+constexpr double kTolerance = 1e-14;
+
+/// Makes sure the generated code computes the same derivatives as the
+/// hand-written system, and the Jacobian −1 + 3x².
+TEST(DerivativesCodegenTest, SimpleContinuousTimeSystem) {
+  const SimpleContinuousTimeSystem<double> expected_system;
+  const GeneratedSimpleContinuousTimeSystem dut;
+  auto expected_context = expected_system.CreateDefaultContext();
+  auto context = dut.CreateDefaultContext();
+  for (const double x : {-1.5, -0.3, 0.0, 0.9, 2.0}) {
+    expected_context->SetContinuousState(drake::Vector1d(x));
+    context->SetContinuousState(drake::Vector1d(x));
+    const Eigen::VectorXd expected =
+        expected_system.EvalTimeDerivatives(*expected_context).CopyToVector();
+    EXPECT_NEAR(dut.EvalTimeDerivatives(*context)[0], expected[0], kTolerance);
+    EXPECT_NEAR(dut.CalcJacobian(*context)(0, 0), -1.0 + 3.0 * x * x,
+                kTolerance);
+  }
+}
+
+/// Makes sure the generated code computes the same derivatives as the
+/// hand-written Particle, given its force input and mass parameter, and
+/// that the mass defaults to the Particle's.
+TEST(DerivativesCodegenTest, Particle) {
+  const Particle<double> expected_system;
+  const GeneratedParticle dut;
+  auto expected_context = expected_system.CreateDefaultContext();
+  auto context = dut.CreateDefaultContext();
+  EXPECT_EQ(context->get_numeric_parameter(0)[0],
+            expected_system.default_mass());
+
+  const Eigen::Vector2d x(0.5, -2.0);
+  expected_context->SetContinuousState(x);
+  context->SetContinuousState(x);
+  expected_system.get_input_port(0).FixValue(expected_context.get(),
+                                            drake::Vector1d(3.0));
+  dut.get_input_port(0).FixValue(context.get(), drake::Vector1d(3.0));
+  expected_system.set_mass(expected_context.get(), 2.0);
+  context->get_mutable_numeric_parameter(0).SetAtIndex(0, 2.0);
+
+  const Eigen::VectorXd expected =
+      expected_system.EvalTimeDerivatives(*expected_context).CopyToVector();
+  const Eigen::VectorXd xdot = dut.EvalTimeDerivatives(*context).CopyToVector();
+  EXPECT_TRUE(xdot.isApprox(expected, kTolerance));
+  const Eigen::Matrix2d expected_jacobian =
+      (Eigen::Matrix2d() << 0.0, 1.0, 0.0, 0.0).finished();
+  EXPECT_TRUE(dut.CalcJacobian(*context).isApprox(expected_jacobian));
+}
+
+/// Makes sure integer powers are computed by multiplication, not std::pow().
+TEST(DerivativesCodegenTest, IntegerPowers) {
+  const SimpleContinuousTimeSystem<double> system;
+  const GeneratedDerivatives generated =
+      GenerateDerivatives(system, "scts", "scts.h");
+  EXPECT_NE(generated.header.find("namespace scts {"), std::string::npos);
+  EXPECT_NE(generated.source.find("#include \"scts.h\""), std::string::npos);
+  EXPECT_EQ(generated.source.find("pow("), std::string::npos);
+}
+
+/// Makes sure systems with discrete state are rejected.
+TEST(DerivativesCodegenTest, DiscreteStateThrows) {
+  const drake::systems::ZeroOrderHold<double> system(0.1, 1);
+  EXPECT_THROW(GenerateDerivatives(system, "zoh", "zoh.h"), std::logic_error);
+}
+
+}  // namespace
+}  // namespace symbolic_codegen
+}  // namespace drake_external_examples
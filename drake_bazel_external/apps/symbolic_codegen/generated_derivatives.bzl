@@ -0,0 +1,28 @@
+# SPDX-License-Identifier: MIT-0
+
+load("@rules_cc//cc:cc_library.bzl", "cc_library")
+
+def drake_example_generated_derivatives(name, system, **kwargs):
+    """Generates <name>.h and <name>.cc, which compute the time derivatives of
+    the given example system and their Jacobian (see GenerateDerivatives() in
+    derivatives_codegen.h), and compiles them into the cc_library <name>. Wrap
+    the generated Derivatives in a GeneratedSystem to use them as a system.
+
+    Must be called from the package that defines :derivatives_codegen.
+    """
+    native.genrule(
+        name = name + "_genrule",
+        outs = [name + ".h", name + ".cc"],
+        cmd = ("$(execpath :derivatives_codegen) --system={} --name={} " +
+               "--output_dir=$(RULEDIR)").format(system, name),
+        tools = [":derivatives_codegen"],
+    )
+
+    # The generated code does not use Drake.
+    cc_library(
+        name = name,
+        srcs = [name + ".cc"],
+        hdrs = [name + ".h"],
+        includes = ["."],
+        **kwargs
+    )
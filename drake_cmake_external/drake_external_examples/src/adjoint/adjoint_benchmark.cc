@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures how the cost of CalcAdjointGradients() grows with the number of
+/// parameters of a system whose state size is fixed: a Particle driven by a
+/// chain of `SimpleAdder` stages, each of which adds its own parameter, so
+/// that the diagram has the Particle's 2 states and as many parameters as
+/// stages, plus 2. For each chain length this reports the time of a forward
+/// simulation alone, the time of the gradients (a forward pass, which keeps
+/// the trajectory, and the backward pass), and their ratio.
+///
+/// Each evaluation of the backward right-hand side forms the full Jacobian
+/// of the time derivatives on an AutoDiffXd copy of the diagram, so the
+/// ratio grows with the number of parameters instead of staying near 2.
+///
+/// Usage: adjoint_benchmark [--max_stages=<count>] [--json_output=<path>]
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/primitives/constant_vector_source.h>
+
+#include "adjoint.h"
+#include "benchmark_harness/benchmark_fixture.h"
+#include "particle/particle.h"
+#include "simple_bindings/simple_adder.h"
+
+namespace drake_external_examples {
+namespace adjoint {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::systems::ConstantVectorSource;
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+using particles::Particle;
+
+constexpr double kFinalTime = 2.0;
+constexpr double kAccuracy = 1e-8;
+constexpr int kRepetitions = 5;
+
+// A constant force, raised by each of @p num_stages adders, on a Particle.
+std::unique_ptr<Diagram<double>> MakeDiagram(int num_stages) {
+  DiagramBuilder<double> builder;
+  const drake::systems::OutputPort<double>* force =
+      &builder.AddSystem<ConstantVectorSource<double>>(drake::Vector1d(1.0))
+           ->get_output_port();
+  for (int i = 0; i < num_stages; ++i) {
+    auto* adder = builder.AddSystem<SimpleAdder<double>>(1e-3);
+    builder.Connect(*force, adder->get_input_port(0));
+    force = &adder->get_output_port(0);
+  }
+  auto* particle = builder.AddSystem<Particle<double>>();
+  builder.Connect(*force, particle->get_input_port(0));
+  return builder.Build();
+}
+
+// L = q(T), so ∂L/∂x(T) = [1, 0].
+Eigen::VectorXd PositionGradient(const Eigen::VectorXd&) {
+  return Eigen::Vector2d(1.0, 0.0);
+}
+
+void MeasureStages(BenchmarkFixture* fixture, int num_stages) {
+  const auto diagram = MakeDiagram(num_stages);
+  const auto context = diagram->CreateDefaultContext();
+  context->SetContinuousState(Eigen::Vector2d(0.0, 1.0));
+  int num_parameters = 0;
+  for (int i = 0; i < context->num_numeric_parameter_groups(); ++i) {
+    num_parameters += context->get_numeric_parameter(i).size();
+  }
+  const std::string size = ", " + std::to_string(num_parameters) +
+                           " parameters";
+
+  std::unique_ptr<Simulator<double>> simulator;
+  BenchmarkResult& forward = fixture->MeasureRepeated(
+      "forward" + size, kRepetitions, 1,
+      [&]() {
+        simulator = std::make_unique<Simulator<double>>(*diagram,
+                                                        context->Clone());
+        simulator->get_mutable_integrator().set_target_accuracy(kAccuracy);
+        simulator->Initialize();
+      },
+      [&]() { simulator->AdvanceTo(kFinalTime); });
+
+  AdjointOptions options;
+  options.num_checkpoints = 0;
+  options.target_accuracy = kAccuracy;
+  BenchmarkResult& gradients = fixture->MeasureRepeated(
+      "gradients" + size, kRepetitions, 1, []() {},
+      [&]() {
+        CalcAdjointGradients(*diagram, *context, kFinalTime,
+                             &PositionGradient, options);
+      });
+
+  const double ratio = gradients.seconds / forward.seconds;
+  gradients.values["parameters"] = num_parameters;
+  gradients.values["forward_ratio"] = ratio;
+  std::cout << "  " << ratio << "x the time of a forward simulation"
+            << std::endl;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("adjoint_benchmark", &argc, argv);
+  int max_stages = 300;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--max_stages=")) {
+      max_stages = std::stoi(std::string(arg.substr(13)));
+    } else {
+      throw std::logic_error("Unknown argument " + std::string(arg));
+    }
+  }
+  for (const int num_stages : {0, 3, 10, 30, 100, 300, 1000}) {
+    if (num_stages <= max_stages) {
+      MeasureStages(&fixture, num_stages);
+    }
+  }
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace adjoint
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::adjoint::DoMain(argc, argv);
+}
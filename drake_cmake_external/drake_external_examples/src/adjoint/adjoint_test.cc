@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "adjoint.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/primitives/constant_vector_source.h>
+
+#include "particle/particle.h"
+#include "simple_bindings/simple_adder.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace adjoint {
+namespace {
+
+using drake::systems::ConstantVectorSource;
+using drake::systems::DiagramBuilder;
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+constexpr double kTolerance = 1e-6;
+
+AdjointOptions MakeOptions(int num_checkpoints) {
+  AdjointOptions options;
+  options.num_checkpoints = num_checkpoints;
+  options.target_accuracy = 1e-10;
+  return options;
+}
+
+// L = x(T), so ∂L/∂x(T) = 1.
+Eigen::VectorXd FinalValueGradient(const Eigen::VectorXd& x) {
+  return Eigen::VectorXd::Ones(x.size());
+}
+
+// L = ½ q(T)² on the Particle's position q, so ∂L/∂x(T) = [q(T), 0].
+Eigen::VectorXd HalfSquaredPositionGradient(const Eigen::VectorXd& x) {
+  return Eigen::Vector2d(x[0], 0.0);
+}
+
+/// Makes sure the gradient of x(T) with respect to x(0) matches the
+/// derivative of the closed-form solution x(T) = x₀ / √D, which is
+/// e²ᵀ / D^1.5 with D = x₀² + (1 − x₀²) e²ᵀ.
+TEST(AdjointTest, SimpleContinuousTimeSystem) {
+  const double x0 = 0.9;
+  const double t_final = 2.0;
+  const SimpleContinuousTimeSystem<double> system;
+  auto context = system.CreateDefaultContext();
+  context->get_mutable_continuous_state()[0] = x0;
+
+  const double e = std::exp(2.0 * t_final);
+  const double denominator = x0 * x0 + (1.0 - x0 * x0) * e;
+  for (const int num_checkpoints : {0, 1, 8}) {
+    const AdjointResult result =
+        CalcAdjointGradients(system, *context, t_final, &FinalValueGradient,
+                             MakeOptions(num_checkpoints));
+    EXPECT_NEAR(result.final_state[0], x0 / std::sqrt(denominator),
+                kTolerance);
+    ASSERT_EQ(result.initial_state_gradient.size(), 1);
+    EXPECT_NEAR(result.initial_state_gradient[0],
+                e / std::pow(denominator, 1.5), kTolerance);
+    EXPECT_TRUE(result.parameter_gradients.empty());
+  }
+}
+
+/// Makes sure the gradients with respect to a Particle's initial state and
+/// mass parameter match the closed form. With force u and mass m,
+/// q(T) = q₀ + v₀ T + u T² / (2 m).
+TEST(AdjointTest, ParticleMass) {
+  const double mass = 2.0;
+  const double force = 3.0;
+  const double t_final = 2.0;
+  const Particle<double> particle(mass);
+  auto context = particle.CreateDefaultContext();
+  particle.get_input_port(0).FixValue(context.get(), drake::Vector1d(force));
+  context->SetContinuousState(Eigen::Vector2d(1.0, -1.0));
+
+  const double q = 1.0 - t_final + force * t_final * t_final / (2.0 * mass);
+  const AdjointResult result =
+      CalcAdjointGradients(particle, *context, t_final,
+                           &HalfSquaredPositionGradient, MakeOptions(4));
+  EXPECT_NEAR(result.final_state[0], q, kTolerance);
+  EXPECT_NEAR(result.initial_state_gradient[0], q, kTolerance);
+  EXPECT_NEAR(result.initial_state_gradient[1], q * t_final, kTolerance);
+  ASSERT_EQ(result.parameter_gradients.size(), 1);
+  EXPECT_NEAR(result.parameter_gradients[0][0],
+              -q * force * t_final * t_final / (2.0 * mass * mass),
+              kTolerance);
+}
+
+/// Makes sure gradients flow through a diagram, to the parameters of every
+/// subsystem: a constant source u feeding a SimpleAdder (adding c) feeding a
+/// Particle of mass m, so that q(T) = (u + c) T² / (2 m) from rest.
+TEST(AdjointTest, SimpleAdderDrivingParticle) {
+  const double u = 1.0;
+  const double c = 0.5;
+  const double mass = 3.0;
+  const double t_final = 2.0;
+  DiagramBuilder<double> builder;
+  auto source = builder.AddSystem<ConstantVectorSource<double>>(
+      drake::Vector1d(u));
+  auto adder = builder.AddSystem<SimpleAdder<double>>(c);
+  auto particle = builder.AddSystem<Particle<double>>(mass);
+  builder.Connect(source->get_output_port(), adder->get_input_port(0));
+  builder.Connect(adder->get_output_port(0), particle->get_input_port(0));
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+
+  const double q = (u + c) * t_final * t_final / (2.0 * mass);
+  const double dq_du = t_final * t_final / (2.0 * mass);
+  const AdjointResult result =
+      CalcAdjointGradients(*diagram, *context, t_final,
+                           &HalfSquaredPositionGradient, MakeOptions(4));
+  // The diagram's parameter groups follow the order the systems were added.
+  ASSERT_EQ(result.parameter_gradients.size(), 3);
+  EXPECT_NEAR(result.parameter_gradients[0][0], q * dq_du, kTolerance);
+  EXPECT_NEAR(result.parameter_gradients[1][0], q * dq_du, kTolerance);
+  EXPECT_NEAR(result.parameter_gradients[2][0], -q * q / mass, kTolerance);
+}
+
+/// Makes sure invalid arguments are rejected.
+TEST(AdjointTest, RejectsBadArguments) {
+  const SimpleContinuousTimeSystem<double> system;
+  auto context = system.CreateDefaultContext();
+  EXPECT_THROW(CalcAdjointGradients(system, *context, 0.0,
+                                    &FinalValueGradient, MakeOptions(1)),
+               std::logic_error);
+  EXPECT_THROW(CalcAdjointGradients(system, *context, 1.0,
+                                    &FinalValueGradient, MakeOptions(-1)),
+               std::logic_error);
+  EXPECT_THROW(CalcAdjointGradients(
+                   system, *context, 1.0,
+                   [](const Eigen::VectorXd&) { return Eigen::VectorXd(2); },
+                   MakeOptions(1)),
+               std::logic_error);
+}
+
+}  // namespace
+}  // namespace adjoint
+}  // namespace drake_external_examples
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "batch_simulation.h"
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <drake/systems/analysis/simulator.h>
+
+#include "arena.h"
+#include "thread_pool/thread_pool.h"
+
+namespace drake_external_examples {
+namespace arena_allocation {
+
+using drake::systems::Simulator;
+using drake::systems::System;
+
+namespace {
+
+// Simulates one rollout, and writes its final state into @p result, which
+// already has the right size, so that it is not reallocated within an arena.
+void Simulate(const System<double>& system, const Eigen::VectorXd& initial,
+              double end_time, Eigen::VectorXd* result) {
+  Simulator<double> simulator(system);
+  simulator.get_mutable_context().SetContinuousState(initial);
+  simulator.AdvanceTo(end_time);
+  simulator.get_context().get_continuous_state_vector().CopyToPreSizedVector(
+      result);
+}
+
+}  // namespace
+
+std::vector<Eigen::VectorXd> SimulateBatch(
+    const System<double>& system,
+    const std::vector<Eigen::VectorXd>& initial_states, double end_time,
+    const BatchOptions& options) {
+  const int num_states = system.num_continuous_states();
+  for (const Eigen::VectorXd& initial : initial_states) {
+    if (initial.size() != num_states) {
+      throw std::logic_error("SimulateBatch: initial states must have size " +
+                             std::to_string(num_states));
+    }
+  }
+  std::vector<Eigen::VectorXd> results(initial_states.size(),
+                                       Eigen::VectorXd(num_states));
+  if (initial_states.empty()) {
+    return results;
+  }
+  Simulate(system, initial_states[0], end_time, &results[0]);
+
+  parallel::ThreadPool pool(options.num_threads);
+  std::vector<std::unique_ptr<Arena>> arenas;
+  if (options.use_arenas) {
+    for (int i = 0; i < pool.num_threads(); ++i) {
+      arenas.push_back(std::make_unique<Arena>(options.arena_capacity));
+    }
+  }
+  pool.ParallelFor(
+      static_cast<int64_t>(initial_states.size()) - 1,
+      [&](int64_t index, int thread) {
+        const Eigen::VectorXd& initial = initial_states[index + 1];
+        Eigen::VectorXd* const result = &results[index + 1];
+        if (!options.use_arenas) {
+          Simulate(system, initial, end_time, result);
+          return;
+        }
+        Arena& arena = *arenas[thread];
+        try {
+          ArenaScope scope(&arena);
+          Simulate(system, initial, end_time, result);
+        } catch (const std::exception& e) {
+          // The exception's message may live in the arena, which will be
+          // gone by the time it is caught; rethrow it from the heap.
+          throw std::runtime_error(e.what());
+        }
+        arena.Reset();
+      });
+  return results;
+}
+
+}  // namespace arena_allocation
+}  // namespace drake_external_examples
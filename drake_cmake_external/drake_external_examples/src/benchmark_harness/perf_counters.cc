@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "perf_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace drake_external_examples {
+namespace benchmarking {
+
+#ifdef __linux__
+
+namespace {
+
+// Opens one user-space hardware event of the calling thread, on any CPU. The
+// group leader starts disabled; the other members follow it.
+int OpenEvent(uint64_t config, int group_fd) {
+  perf_event_attr attr{};
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = (group_fd == -1) ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1,
+                                  group_fd, PERF_FLAG_FD_CLOEXEC));
+}
+
+}  // namespace
+
+PerfCounters::PerfCounters() {
+  constexpr uint64_t kConfigs[kNumEvents] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+  group_fd_ = OpenEvent(kConfigs[0], -1);
+  if (group_fd_ < 0) {
+    const int error = errno;
+    unavailable_reason_ = std::string("perf_event_open failed: ") +
+                          std::strerror(error);
+    if (error == EACCES || error == EPERM) {
+      unavailable_reason_ +=
+          " (see /proc/sys/kernel/perf_event_paranoid, or the container's "
+          "seccomp profile)";
+    }
+    return;
+  }
+  fds_[0] = group_fd_;
+  // Events the CPU does not support are simply left out.
+  for (int i = 1; i < kNumEvents; ++i) {
+    fds_[i] = OpenEvent(kConfigs[i], group_fd_);
+  }
+}
+
+PerfCounters::~PerfCounters() {
+  for (const int fd : fds_) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+}
+
+void PerfCounters::Start() {
+  if (!available()) {
+    return;
+  }
+  ioctl(group_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(group_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounterValues PerfCounters::Stop() {
+  PerfCounterValues result;
+  if (!available()) {
+    return result;
+  }
+  ioctl(group_fd_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  // The group read format is {nr, time_enabled, time_running, value[nr]},
+  // with the values in the order the events joined the group.
+  std::vector<uint64_t> buffer(3 + kNumEvents);
+  const ssize_t size =
+      read(group_fd_, buffer.data(), buffer.size() * sizeof(uint64_t));
+  if (size < static_cast<ssize_t>(3 * sizeof(uint64_t))) {
+    return result;
+  }
+  const uint64_t time_enabled = buffer[1];
+  const uint64_t time_running = buffer[2];
+  if (time_running == 0) {
+    // The events never got a hardware counter.
+    return result;
+  }
+  const double scale = static_cast<double>(time_enabled) / time_running;
+  std::optional<double>* const outputs[kNumEvents] = {
+      &result.cycles, &result.instructions, &result.cache_misses,
+      &result.branch_misses};
+  uint64_t next = 0;
+  for (int i = 0; i < kNumEvents; ++i) {
+    if (fds_[i] >= 0 && next < buffer[0]) {
+      *outputs[i] = static_cast<double>(buffer[3 + next]) * scale;
+      ++next;
+    }
+  }
+  return result;
+}
+
+#else  // __linux__
+
+PerfCounters::PerfCounters()
+    : unavailable_reason_("hardware counters are only supported on Linux") {}
+
+PerfCounters::~PerfCounters() = default;
+
+void PerfCounters::Start() {}
+
+PerfCounterValues PerfCounters::Stop() { return {}; }
+
+#endif  // __linux__
+
+}  // namespace benchmarking
+}  // namespace drake_external_examples
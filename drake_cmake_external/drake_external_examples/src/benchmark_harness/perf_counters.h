@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include <drake/common/drake_copyable.h>
+
+namespace drake_external_examples {
+namespace benchmarking {
+
+/// Hardware event counts over a measured region. An event is unset when it
+/// could not be counted.
+struct PerfCounterValues {
+  std::optional<double> cycles;
+  std::optional<double> instructions;
+  std::optional<double> cache_misses;
+  std::optional<double> branch_misses;
+};
+
+/// Counts CPU cycles, instructions, last-level cache misses, and branch
+/// mispredictions of the calling thread with Linux's perf_event_open(2).
+///
+/// Counters are often unavailable: on other operating systems, in containers
+/// whose seccomp profile blocks the system call, when
+/// /proc/sys/kernel/perf_event_paranoid forbids unprivileged use, or in
+/// virtual machines without a virtualized PMU. Construction never fails;
+/// instead available() is false, unavailable_reason() says why, and Stop()
+/// returns unset values. Only user-space events are counted, which the
+/// default paranoid level allows.
+///
+/// When the kernel multiplexes more events than there are hardware counters,
+/// counts are scaled up by the fraction of the region they were running.
+///
+/// Threads other than the caller (e.g., of a thread pool) are not counted.
+class PerfCounters {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PerfCounters);
+
+  PerfCounters();
+  ~PerfCounters();
+
+  /// Returns whether at least the cycle counter could be opened.
+  bool available() const { return group_fd_ >= 0; }
+
+  /// Returns why the counters are unavailable, or an empty string.
+  const std::string& unavailable_reason() const { return unavailable_reason_; }
+
+  /// Resets the counters to zero and starts counting.
+  void Start();
+
+  /// Stops counting and returns the counts since Start().
+  PerfCounterValues Stop();
+
+ private:
+  static constexpr int kNumEvents = 4;
+
+  // The group leader (cycles), or -1.
+  int group_fd_{-1};
+  // The file descriptor of each event, or -1 if it could not be opened, in
+  // the order of PerfCounterValues.
+  int fds_[kNumEvents]{-1, -1, -1, -1};
+  std::string unavailable_reason_;
+};
+
+}  // namespace benchmarking
+}  // namespace drake_external_examples
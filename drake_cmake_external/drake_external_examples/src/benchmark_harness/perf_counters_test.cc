@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "perf_counters.h"  // IWYU pragma: associated
+
+#include <gtest/gtest.h>
+
+namespace drake_external_examples {
+namespace benchmarking {
+namespace {
+
+/// Makes sure the counters either count a busy loop, or report why they are
+/// unavailable and return no values; both are valid outcomes on a test host.
+TEST(PerfCountersTest, CountsOrFallsBack) {
+  PerfCounters counters;
+  counters.Start();
+  volatile double sum = 0.0;
+  for (int i = 0; i < 1000000; ++i) {
+    sum = sum + i;
+  }
+  const PerfCounterValues values = counters.Stop();
+  if (counters.available()) {
+    EXPECT_TRUE(counters.unavailable_reason().empty());
+    ASSERT_TRUE(values.cycles.has_value());
+    EXPECT_GT(*values.cycles, 0.0);
+    if (values.instructions.has_value()) {
+      EXPECT_GT(*values.instructions, 1e6);
+    }
+  } else {
+    EXPECT_FALSE(counters.unavailable_reason().empty());
+    EXPECT_FALSE(values.cycles.has_value());
+    EXPECT_FALSE(values.instructions.has_value());
+    EXPECT_FALSE(values.cache_misses.has_value());
+    EXPECT_FALSE(values.branch_misses.has_value());
+  }
+}
+
+/// Makes sure the counters restart from zero.
+TEST(PerfCountersTest, Restarts) {
+  PerfCounters counters;
+  counters.Start();
+  volatile double sum = 0.0;
+  for (int i = 0; i < 1000000; ++i) {
+    sum = sum + i;
+  }
+  const PerfCounterValues long_region = counters.Stop();
+  counters.Start();
+  const PerfCounterValues short_region = counters.Stop();
+  if (long_region.instructions.has_value() &&
+      short_region.instructions.has_value()) {
+    EXPECT_LT(*short_region.instructions, *long_region.instructions);
+  }
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace drake_external_examples
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/system.h>
+
+namespace drake_external_examples {
+namespace bulk_diagram {
+
+/// A port of a system of a DiagramTable, by the system's index in the table
+/// and the port's index in the system.
+struct TablePort {
+  int system{};
+  int port{};
+};
+
+/// A connection from an output port to an input port.
+struct TableConnection {
+  TablePort output;
+  TablePort input;
+};
+
+/// The structure of a diagram as tables over the indices of its systems, so
+/// that generated diagrams can be described once, without the systems, and
+/// built by BuildDiagram() as often as needed.
+struct DiagramTable {
+  /// Sizes the tables for @p num_connections connections, @p num_inputs
+  /// exported inputs, and @p num_outputs exported outputs.
+  void Reserve(int num_connections, int num_inputs = 0, int num_outputs = 0) {
+    connections.reserve(num_connections);
+    exported_inputs.reserve(num_inputs);
+    exported_outputs.reserve(num_outputs);
+  }
+
+  std::vector<TableConnection> connections;
+  /// The ports exported as the diagram's input and output ports, in order.
+  std::vector<TablePort> exported_inputs;
+  std::vector<TablePort> exported_outputs;
+};
+
+/// Builds the diagram of @p systems wired as @p table says, in one pass over
+/// each table: the table is validated against the systems first, so that an
+/// error names the row at fault and nothing is added to a DiagramBuilder
+/// until the whole table is known to be valid; then the systems are added,
+/// connected and exported, and the diagram is built.
+///
+/// Systems without a name are named `system_<index>`, which is much cheaper
+/// for large diagrams than the default names DiagramBuilder gives them, which
+/// are derived from each system's type and address.
+///
+/// @throws std::logic_error if @p systems has a null entry, or a row of
+///   @p table refers to a system or a port that does not exist, or connects
+///   ports whose data types, sizes or value types differ, or an input port
+///   is connected or exported more than once.
+std::unique_ptr<drake::systems::Diagram<double>> BuildDiagram(
+    std::vector<std::unique_ptr<drake::systems::System<double>>> systems,
+    const DiagramTable& table);
+
+/// Returns the table of a binary tree of @p num_systems stages with one input
+/// and one output each (e.g., SimpleAdder): the input of stage 0 is the
+/// diagram's input, every other stage i is fed by stage (i − 1) / 2, and the
+/// output of the last stage is the diagram's output. Unlike a chain, its
+/// depth grows as log₂(@p num_systems), so that diagrams of any size have
+/// short paths of direct feedthrough.
+/// @throws std::logic_error if @p num_systems is not positive.
+DiagramTable MakeTreeTable(int num_systems);
+
+}  // namespace bulk_diagram
+}  // namespace drake_external_examples
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures how the cost of building a diagram, and of creating its context,
+/// grows with its number of systems, from 10 to 100000 `SimpleAdder` stages
+/// wired as a binary tree:
+///
+/// - "builder": the systems are added to a DiagramBuilder one by one, with
+///   their default names, and connected port by port, as most code does;
+/// - "table": the same diagram is built by BuildDiagram() from a table made
+///   once by MakeTreeTable(); and
+/// - "context": a default context is created for the diagram.
+///
+/// Each measurement reports the time per system, and the resident memory per
+/// system of one diagram and of one context of the largest size measured is
+/// reported with it, so that the sizes a machine can afford can be planned.
+/// Both depend on the Drake version and the machine, which are printed
+/// first, to be recorded with them.
+///
+/// Usage: bulk_diagram_benchmark [--max_systems=<count>] [--json_output=<path>]
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <drake/systems/framework/diagram_builder.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "bulk_diagram.h"
+#include "simple_bindings/simple_adder.h"
+
+namespace drake_external_examples {
+namespace bulk_diagram {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::systems::Context;
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::System;
+
+int64_t ResidentBytes() {
+  std::ifstream statm("/proc/self/statm");
+  int64_t size = 0;
+  int64_t resident = 0;
+  statm >> size >> resident;
+  return resident * ::sysconf(_SC_PAGESIZE);
+}
+
+// Returns the model name of the first CPU, or "unknown CPU".
+std::string CpuModel() {
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.starts_with("model name")) {
+      const size_t colon = line.find(':');
+      if (colon != std::string::npos && colon + 2 <= line.size()) {
+        return line.substr(colon + 2);
+      }
+    }
+  }
+  return "unknown CPU";
+}
+
+void PrintRate(BenchmarkResult* result, int num_systems) {
+  const double ns_per_system = 1e9 * result->seconds / result->num_operations;
+  result->values["systems"] = num_systems;
+  result->values["ns_per_system"] = ns_per_system;
+  std::cout << "  " << ns_per_system << " ns per system" << std::endl;
+}
+
+void PrintMemory(BenchmarkResult* result, int64_t bytes, int num_systems) {
+  const double per_system = static_cast<double>(bytes) / num_systems;
+  result->values["resident_bytes_per_system"] = per_system;
+  std::cout << "  " << per_system << " resident bytes per system" << std::endl;
+}
+
+// Builds the tree of @p num_systems stages system by system.
+std::unique_ptr<Diagram<double>> BuildWithBuilder(int num_systems) {
+  DiagramBuilder<double> builder;
+  std::vector<SimpleAdder<double>*> added;
+  added.reserve(num_systems);
+  for (int i = 0; i < num_systems; ++i) {
+    added.push_back(builder.AddSystem<SimpleAdder<double>>(1.0));
+  }
+  for (int i = 1; i < num_systems; ++i) {
+    builder.Connect(added[(i - 1) / 2]->get_output_port(0),
+                    added[i]->get_input_port(0));
+  }
+  builder.ExportInput(added[0]->get_input_port(0));
+  builder.ExportOutput(added[num_systems - 1]->get_output_port(0));
+  return builder.Build();
+}
+
+// Builds the tree of @p num_systems stages from @p table.
+std::unique_ptr<Diagram<double>> BuildWithTable(int num_systems,
+                                                const DiagramTable& table) {
+  std::vector<std::unique_ptr<System<double>>> systems;
+  systems.reserve(num_systems);
+  for (int i = 0; i < num_systems; ++i) {
+    systems.push_back(std::make_unique<SimpleAdder<double>>(1.0));
+  }
+  return BuildDiagram(std::move(systems), table);
+}
+
+void MeasureSize(BenchmarkFixture* fixture, int num_systems,
+                 bool measure_memory) {
+  const std::string size = ", " + std::to_string(num_systems) + " systems";
+  // Small diagrams are built repeatedly, so that each measurement spans at
+  // least 10000 systems.
+  const int repetitions = std::max(1, 10'000 / num_systems);
+  const DiagramTable table = MakeTreeTable(num_systems);
+  std::unique_ptr<Diagram<double>> diagram;
+  std::unique_ptr<Context<double>> context;
+
+  // The previous diagram is destroyed outside the measured region.
+  const auto reset = [&]() {
+    context.reset();
+    diagram.reset();
+  };
+  BenchmarkResult& builder = fixture->MeasureRepeated(
+      "builder" + size, repetitions, num_systems, reset, [&]() {
+        diagram = BuildWithBuilder(num_systems);
+      });
+  PrintRate(&builder, num_systems);
+
+  BenchmarkResult& from_table = fixture->MeasureRepeated(
+      "table" + size, repetitions, num_systems, reset, [&]() {
+        diagram = BuildWithTable(num_systems, table);
+      });
+  PrintRate(&from_table, num_systems);
+  std::cout << "  " << builder.seconds / from_table.seconds
+            << "x the speed of the builder" << std::endl;
+  from_table.values["speedup"] = builder.seconds / from_table.seconds;
+
+  BenchmarkResult& create = fixture->MeasureRepeated(
+      "context" + size, repetitions, num_systems,
+      [&]() { context.reset(); },
+      [&]() { context = diagram->CreateDefaultContext(); });
+  PrintRate(&create, num_systems);
+
+  if (measure_memory) {
+    reset();
+    const int64_t before = ResidentBytes();
+    diagram = BuildWithTable(num_systems, table);
+    const int64_t built = ResidentBytes();
+    context = diagram->CreateDefaultContext();
+    PrintMemory(&from_table, built - before, num_systems);
+    PrintMemory(&create, ResidentBytes() - built, num_systems);
+  }
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("bulk_diagram_benchmark", &argc, argv);
+  int max_systems = 100'000;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--max_systems=")) {
+      max_systems = std::stoi(std::string(arg.substr(14)));
+    } else {
+      throw std::logic_error("Unknown argument " + std::string(arg));
+    }
+  }
+  if (max_systems < 10) {
+    throw std::logic_error("The maximum number of systems must be at least 10");
+  }
+
+  std::cout << "Drake " << BULK_DIAGRAM_DRAKE_VERSION << " on " << CpuModel()
+            << std::endl;
+  int num_systems = 10;
+  for (; num_systems * 10 <= max_systems; num_systems *= 10) {
+    MeasureSize(&fixture, num_systems, false);
+  }
+  // The memory of the largest diagram is the least distorted by what the
+  // allocator kept from the smaller ones.
+  MeasureSize(&fixture, num_systems, true);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace bulk_diagram
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::bulk_diagram::DoMain(argc, argv);
+}
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/system.h>
+
+namespace drake_external_examples {
+namespace context_forking {
+
+/// Forks many rollouts from one template context of a closed system (one
+/// without input ports), e.g., a diagram simulated to a state of interest.
+///
+/// A fork starts out with the template's time, state and parameters. The
+/// first forks are clones of the template; forks handed back with Release()
+/// are recycled for later ones by overwriting them with the template, which
+/// reuses their storage instead of allocating a new context. Either way,
+/// values the system stores as CopyOnWrite abstract parameters or abstract
+/// state are shared with the template, and copied only by forks that write
+/// them; everything else (e.g., numeric parameters) is copied in full.
+///
+/// A forker is not thread-safe; to fork from many threads, fork the contexts
+/// on one thread and hand them out, or use a forker per thread.
+class ContextForker {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ContextForker);
+
+  /// Forks from a copy of @p template_context, a context for @p system. The
+  /// system must outlive the forker.
+  /// @throws std::exception if @p system has input ports, or
+  /// @p template_context is not one of its contexts.
+  ContextForker(const drake::systems::System<double>& system,
+                const drake::systems::Context<double>& template_context);
+
+  const drake::systems::Context<double>& template_context() const {
+    return *template_;
+  }
+
+  /// Returns a new fork of the template.
+  std::unique_ptr<drake::systems::Context<double>> Fork();
+
+  /// Hands @p fork, which must have come from this forker, back to be
+  /// recycled by a later Fork().
+  /// @throws std::exception if @p fork is not a context for the system.
+  void Release(std::unique_ptr<drake::systems::Context<double>> fork);
+
+  /// Returns the number of released forks waiting to be recycled.
+  int num_released() const { return static_cast<int>(released_.size()); }
+
+ private:
+  const drake::systems::System<double>& system_;
+  const std::unique_ptr<const drake::systems::Context<double>> template_;
+  std::vector<std::unique_ptr<drake::systems::Context<double>>> released_;
+};
+
+}  // namespace context_forking
+}  // namespace drake_external_examples
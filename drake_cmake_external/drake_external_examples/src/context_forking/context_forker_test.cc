@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "context_forker.h"  // IWYU pragma: associated
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+
+#include "copy_on_write.h"
+#include "force_profile.h"
+#include "particle/particle.h"
+
+namespace drake_external_examples {
+namespace context_forking {
+namespace {
+
+using drake::systems::Context;
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+using particles::Particle;
+
+/// Makes sure copies share a value until one of them writes it, and that a
+/// copy writes in place only to a value it made itself.
+TEST(CopyOnWriteTest, SharesUntilWritten) {
+  CopyOnWrite<std::vector<int>> original(std::vector<int>{1, 2, 3});
+  EXPECT_FALSE(original.is_shared());
+  original.get_mutable()[0] = 4;
+
+  CopyOnWrite<std::vector<int>> copy = original;
+  EXPECT_TRUE(original.is_shared());
+  EXPECT_EQ(&copy.get(), &original.get());
+
+  copy.get_mutable()[1] = 5;
+  EXPECT_FALSE(copy.is_shared());
+  EXPECT_EQ(original.get(), std::vector<int>({4, 2, 3}));
+  EXPECT_EQ(copy.get(), std::vector<int>({4, 5, 3}));
+
+  // The original was copied from, so it makes its own value on its next
+  // write, even though nothing shares it any more, and then owns it.
+  EXPECT_TRUE(original.is_shared());
+  const std::vector<int>* before = &original.get();
+  original.get_mutable()[2] = 6;
+  EXPECT_NE(&original.get(), before);
+  EXPECT_FALSE(original.is_shared());
+  EXPECT_EQ(copy.get(), std::vector<int>({4, 5, 3}));
+
+  // A moved copy keeps owning its value.
+  CopyOnWrite<std::vector<int>> moved = std::move(original);
+  EXPECT_FALSE(moved.is_shared());
+  EXPECT_EQ(moved.get(), std::vector<int>({4, 2, 6}));
+}
+
+/// Makes sure ForceProfile interpolates its samples the same way with either
+/// storage, and rejects bad arguments.
+TEST(ForceProfileTest, Interpolates) {
+  for (const ParameterStorage storage :
+       {ParameterStorage::kNumeric, ParameterStorage::kCopyOnWrite}) {
+    const ForceProfile profile(2.0, Eigen::Vector3d(1.0, 3.0, -1.0), storage);
+    auto context = profile.CreateDefaultContext();
+    for (const auto& [t, force] : std::vector<std::pair<double, double>>{
+             {-1.0, 1.0}, {0.0, 1.0}, {0.5, 2.0}, {1.5, 1.0}, {3.0, -1.0}}) {
+      context->SetTime(t);
+      EXPECT_DOUBLE_EQ(profile.get_output_port(0).Eval(*context)[0], force)
+          << "t = " << t;
+    }
+    profile.set_sample(context.get(), 2, 5.0);
+    EXPECT_DOUBLE_EQ(profile.get_output_port(0).Eval(*context)[0], 5.0);
+    EXPECT_EQ(profile.get_samples(*context), Eigen::Vector3d(1.0, 3.0, 5.0));
+    EXPECT_THROW(profile.set_sample(context.get(), 3, 0.0), std::exception);
+  }
+  EXPECT_THROW(ForceProfile(0.0, Eigen::Vector2d::Zero(),
+                            ParameterStorage::kNumeric),
+               std::exception);
+  EXPECT_THROW(ForceProfile(1.0, Eigen::VectorXd::Zero(1),
+                            ParameterStorage::kCopyOnWrite),
+               std::exception);
+}
+
+class ContextForkerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    profile_ = builder.AddSystem<ForceProfile>(
+        10.0, Eigen::VectorXd::LinSpaced(1000, -1.0, 1.0),
+        ParameterStorage::kCopyOnWrite);
+    particle_ = builder.AddSystem<Particle<double>>();
+    builder.Connect(profile_->get_output_port(0), particle_->get_input_port(0));
+    diagram_ = builder.Build();
+
+    // The template is a rollout at t = 5 s.
+    Simulator<double> simulator(*diagram_);
+    simulator.AdvanceTo(5.0);
+    template_ = simulator.get_context().Clone();
+  }
+
+  const double* samples_data(const Context<double>& root) const {
+    return profile_->get_samples(profile_->GetMyContextFromRoot(root)).data();
+  }
+
+  // Returns the Particle state after simulating @p context to t = 6 s.
+  Eigen::VectorXd Rollout(std::unique_ptr<Context<double>> context) const {
+    Simulator<double> simulator(*diagram_, std::move(context));
+    simulator.AdvanceTo(6.0);
+    return particle_->GetMyContextFromRoot(simulator.get_context())
+        .get_continuous_state_vector()
+        .CopyToVector();
+  }
+
+  const ForceProfile* profile_{};
+  const Particle<double>* particle_{};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> template_;
+};
+
+/// Makes sure forks share the template's samples until they write them, and
+/// roll out exactly like deep copies of the template.
+TEST_F(ContextForkerTest, ForksShareUntilWritten) {
+  ContextForker forker(*diagram_, *template_);
+  auto fork = forker.Fork();
+  auto perturbed = forker.Fork();
+  EXPECT_EQ(fork->get_time(), 5.0);
+  EXPECT_EQ(samples_data(*fork), samples_data(forker.template_context()));
+  EXPECT_EQ(samples_data(*perturbed), samples_data(*fork));
+
+  profile_->set_sample(&profile_->GetMyMutableContextFromRoot(perturbed.get()),
+                       550, 10.0);
+  EXPECT_NE(samples_data(*perturbed), samples_data(*fork));
+  EXPECT_EQ(samples_data(*fork), samples_data(forker.template_context()));
+  EXPECT_EQ(profile_->get_samples(profile_->GetMyContextFromRoot(*fork))(550),
+            profile_->get_samples(profile_->GetMyContextFromRoot(*template_))(
+                550));
+
+  auto perturbed_copy = template_->Clone();
+  profile_->set_sample(
+      &profile_->GetMyMutableContextFromRoot(perturbed_copy.get()), 550, 10.0);
+  const Eigen::VectorXd expected = Rollout(template_->Clone());
+  const Eigen::VectorXd expected_perturbed = Rollout(std::move(perturbed_copy));
+  EXPECT_NE(expected, expected_perturbed);
+  EXPECT_EQ(Rollout(std::move(fork)), expected);
+  EXPECT_EQ(Rollout(std::move(perturbed)), expected_perturbed);
+}
+
+/// Makes sure released forks are recycled, and come back as the template no
+/// matter what was done to them.
+TEST_F(ContextForkerTest, RecyclesReleasedForks) {
+  ContextForker forker(*diagram_, *template_);
+  auto fork = forker.Fork();
+  const Context<double>* const address = fork.get();
+  fork->SetTime(7.0);
+  fork->SetContinuousState(Eigen::Vector2d(1.0, 2.0));
+  profile_->set_sample(&profile_->GetMyMutableContextFromRoot(fork.get()), 0,
+                       3.0);
+  forker.Release(std::move(fork));
+  EXPECT_EQ(forker.num_released(), 1);
+
+  fork = forker.Fork();
+  EXPECT_EQ(forker.num_released(), 0);
+  EXPECT_EQ(fork.get(), address);
+  EXPECT_EQ(fork->get_time(), 5.0);
+  EXPECT_EQ(fork->get_continuous_state_vector().CopyToVector(),
+            template_->get_continuous_state_vector().CopyToVector());
+  EXPECT_EQ(samples_data(*fork), samples_data(forker.template_context()));
+}
+
+/// Makes sure contexts of other systems, and systems with inputs, are
+/// rejected.
+TEST_F(ContextForkerTest, RejectsBadContexts) {
+  ContextForker forker(*diagram_, *template_);
+  const Particle<double> other;
+  EXPECT_THROW(forker.Release(other.CreateDefaultContext()), std::exception);
+  EXPECT_THROW(forker.Release(nullptr), std::exception);
+  EXPECT_THROW(ContextForker(other, *other.CreateDefaultContext()),
+               std::exception);
+  EXPECT_THROW(ContextForker(*diagram_, *other.CreateDefaultContext()),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace context_forking
+}  // namespace drake_external_examples
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures the cost, in time and heap memory, of forking many rollouts from
+/// one mid-simulation context of a ForceProfile driving a Particle, whose
+/// profile has a large sample vector, stored either as a numeric parameter or
+/// as a CopyOnWrite abstract parameter.
+///
+/// For each storage this reports the time and the heap bytes retained per
+/// fork for: cloning the template; recycling released forks with a
+/// ContextForker; and then writing one sample in each fork, which is when
+/// copy-on-write forks pay for their own copy.
+///
+/// Usage: context_forking_benchmark [num_forks] [num_samples]
+///            [--json_output=<path>]
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "benchmark_harness/counting_allocator.h"
+#include "context_forker.h"
+#include "force_profile.h"
+#include "particle/particle.h"
+
+namespace drake_external_examples {
+namespace context_forking {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::systems::Context;
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+using particles::Particle;
+
+constexpr double kDuration = 10.0;
+constexpr double kForkTime = 5.0;
+
+// Measures @p region over @p num_forks forks, and records the heap bytes it
+// retains per fork.
+void MeasureForks(BenchmarkFixture* fixture, const std::string& name,
+                  int num_forks, const std::function<void()>& region) {
+  int64_t retained_bytes = 0;
+  BenchmarkResult& result = fixture->Measure(name, num_forks, [&]() {
+    const int64_t bytes_before = benchmarking::LiveHeapBytes();
+    region();
+    retained_bytes = benchmarking::LiveHeapBytes() - bytes_before;
+  });
+  result.values["retained_bytes_per_fork"] =
+      static_cast<double>(retained_bytes) / num_forks;
+  std::cout << "  " << result.values["retained_bytes_per_fork"]
+            << " bytes retained per fork" << std::endl;
+}
+
+void BenchmarkStorage(BenchmarkFixture* fixture, ParameterStorage storage,
+                      int num_forks, int num_samples) {
+  const std::string label = (storage == ParameterStorage::kNumeric)
+                                ? "numeric parameter"
+                                : "copy-on-write parameter";
+  DiagramBuilder<double> builder;
+  auto profile = builder.AddSystem<ForceProfile>(
+      kDuration, Eigen::VectorXd::LinSpaced(num_samples, -1.0, 1.0), storage);
+  auto particle = builder.AddSystem<Particle<double>>();
+  builder.Connect(profile->get_output_port(0), particle->get_input_port(0));
+  const std::unique_ptr<Diagram<double>> diagram = builder.Build();
+  Simulator<double> simulator(*diagram);
+  simulator.AdvanceTo(kForkTime);
+  const Context<double>& template_context = simulator.get_context();
+
+  std::vector<std::unique_ptr<Context<double>>> forks;
+  forks.reserve(num_forks);
+  MeasureForks(fixture, "clone, " + label, num_forks, [&]() {
+    for (int i = 0; i < num_forks; ++i) {
+      forks.push_back(template_context.Clone());
+    }
+  });
+
+  ContextForker forker(*diagram, template_context);
+  for (auto& fork : forks) {
+    forker.Release(std::move(fork));
+  }
+  forks.clear();
+  MeasureForks(fixture, "recycled fork, " + label, num_forks, [&]() {
+    for (int i = 0; i < num_forks; ++i) {
+      forks.push_back(forker.Fork());
+    }
+  });
+
+  MeasureForks(fixture, "write one sample, " + label, num_forks, [&]() {
+    for (int i = 0; i < num_forks; ++i) {
+      profile->set_sample(&profile->GetMyMutableContextFromRoot(forks[i].get()),
+                          i % num_samples, 0.0);
+    }
+  });
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("context_forking_benchmark", &argc, argv);
+  const int num_forks = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 10000;
+  const int num_samples =
+      (argc > 2) ? std::max(2, std::atoi(argv[2])) : 4096;
+  std::cout << num_forks << " forks of a profile with " << num_samples
+            << " samples (" << 8.0 * num_samples / 1024
+            << " KiB per copy)" << std::endl;
+  BenchmarkStorage(&fixture, ParameterStorage::kNumeric, num_forks,
+                   num_samples);
+  BenchmarkStorage(&fixture, ParameterStorage::kCopyOnWrite, num_forks,
+                   num_samples);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace context_forking
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::context_forking::DoMain(argc, argv);
+}
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "force_profile.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <drake/common/value.h>
+
+#include "copy_on_write.h"
+
+namespace drake_external_examples {
+namespace context_forking {
+
+using SharedSamples = CopyOnWrite<Eigen::VectorXd>;
+
+ForceProfile::ForceProfile(double duration, Eigen::VectorXd samples,
+                           ParameterStorage storage)
+    : duration_(duration),
+      num_samples_(static_cast<int>(samples.size())),
+      storage_(storage) {
+  if (!(duration_ > 0.0) || num_samples_ < 2) {
+    throw std::logic_error(
+        "ForceProfile: need a positive duration and at least two samples");
+  }
+  if (storage_ == ParameterStorage::kNumeric) {
+    this->DeclareNumericParameter(
+        drake::systems::BasicVector<double>(std::move(samples)));
+  } else {
+    this->DeclareAbstractParameter(
+        drake::Value<SharedSamples>(SharedSamples(std::move(samples))));
+  }
+  this->DeclareVectorOutputPort(
+      drake::systems::kUseDefaultName, 1, &ForceProfile::CalcForce,
+      {this->time_ticket(), this->all_parameters_ticket()});
+}
+
+Eigen::Ref<const Eigen::VectorXd> ForceProfile::get_samples(
+    const drake::systems::Context<double>& context) const {
+  this->ValidateContext(context);
+  if (storage_ == ParameterStorage::kNumeric) {
+    return context.get_numeric_parameter(0).value();
+  }
+  return context.get_abstract_parameter(0).get_value<SharedSamples>().get();
+}
+
+void ForceProfile::set_sample(drake::systems::Context<double>* context, int i,
+                              double value) const {
+  this->ValidateContext(*context);
+  if (i < 0 || i >= num_samples_) {
+    throw std::out_of_range("ForceProfile: no sample " + std::to_string(i));
+  }
+  if (storage_ == ParameterStorage::kNumeric) {
+    context->get_mutable_numeric_parameter(0).SetAtIndex(i, value);
+  } else {
+    context->get_mutable_abstract_parameter(0)
+        .get_mutable_value<SharedSamples>()
+        .get_mutable()(i) = value;
+  }
+}
+
+void ForceProfile::CalcForce(
+    const drake::systems::Context<double>& context,
+    drake::systems::BasicVector<double>* output) const {
+  const Eigen::Ref<const Eigen::VectorXd> samples = get_samples(context);
+  const double position =
+      std::clamp(context.get_time() / duration_, 0.0, 1.0) *
+      (num_samples_ - 1);
+  const int i = std::min(static_cast<int>(position), num_samples_ - 2);
+  const double s = position - i;
+  output->SetAtIndex(0, (1.0 - s) * samples(i) + s * samples(i + 1));
+}
+
+}  // namespace context_forking
+}  // namespace drake_external_examples
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <drake/common/drake_copyable.h>
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/leaf_system.h>
+
+namespace drake_external_examples {
+namespace context_forking {
+
+/// How a ForceProfile stores its samples in a context.
+enum class ParameterStorage {
+  /// As a numeric parameter, which every context clone copies in full.
+  kNumeric,
+  /// As an abstract parameter holding a CopyOnWrite vector, which context
+  /// clones share until one of them writes it.
+  kCopyOnWrite,
+};
+
+/// Outputs a scalar force (output index 0) that varies over time, e.g., to
+/// drive a Particle: the samples (parameter index 0) are spaced evenly over
+/// [0, duration], interpolated linearly between, and held outside.
+///
+/// The samples are a parameter, rather than a member, so that rollouts forked
+/// from one context may each perturb their own copy; with
+/// ParameterStorage::kCopyOnWrite, forks that leave them alone share them.
+///
+/// @tparam_double_only
+class ForceProfile final : public drake::systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ForceProfile);
+
+  /// Creates a profile over [0, @p duration] whose samples default to
+  /// @p samples, stored in contexts as @p storage.
+  /// @throws std::exception unless @p duration is positive and there are at
+  /// least two samples.
+  ForceProfile(double duration, Eigen::VectorXd samples,
+               ParameterStorage storage);
+
+  double duration() const { return duration_; }
+
+  int num_samples() const { return num_samples_; }
+
+  ParameterStorage storage() const { return storage_; }
+
+  /// Returns the samples stored in @p context.
+  Eigen::Ref<const Eigen::VectorXd> get_samples(
+      const drake::systems::Context<double>& context) const;
+
+  /// Sets sample @p i stored in @p context to @p value. With
+  /// ParameterStorage::kCopyOnWrite, this first copies the samples if
+  /// @p context may share them with other contexts (see CopyOnWrite).
+  /// @throws std::exception if @p i is out of range.
+  void set_sample(drake::systems::Context<double>* context, int i,
+                  double value) const;
+
+ private:
+  void CalcForce(const drake::systems::Context<double>& context,
+                 drake::systems::BasicVector<double>* output) const;
+
+  const double duration_;
+  const int num_samples_;
+  const ParameterStorage storage_;
+};
+
+}  // namespace context_forking
+}  // namespace drake_external_examples
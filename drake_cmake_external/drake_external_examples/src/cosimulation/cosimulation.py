@@ -0,0 +1,99 @@
+# SPDX-License-Identifier: MIT-0
+
+"""
+Provides the peer's end of a SharedMemoryMailbox (see
+shared_memory_mailbox.h), so that a controller written in Python can be
+co-simulated, in its own process, with a C++ simulation that holds a
+CosimulationSystem.
+
+The simulation launches the peer with the extra arguments
+`--mailbox_fd=<fd> --request_fd=<fd> --reply_fd=<fd>`, which serve() and
+MailboxPeer.from_args() parse. This module does not need pydrake.
+
+Run as a program, it echoes every request (for benchmarks).
+"""
+
+import argparse
+import array
+import mmap
+import os
+import struct
+import sys
+
+_MAGIC = 0x44434F53
+# The magic number, request size, reply size, closed flag and request time.
+_HEADER = struct.Struct("=IIIId")
+_REQUEST_OFFSET = 32
+
+
+class MailboxPeer:
+    """The peer's end of a mailbox."""
+
+    def __init__(self, mailbox_fd, request_fd, reply_fd):
+        self._mailbox = mmap.mmap(mailbox_fd, 0)
+        magic, self.request_size, self.reply_size, _, _ = (
+            _HEADER.unpack_from(self._mailbox))
+        if magic != _MAGIC:
+            raise ValueError("The file is not a cosimulation mailbox")
+        reply_offset = _REQUEST_OFFSET + 8 * self.request_size
+        view = memoryview(self._mailbox)
+        self._request = view[_REQUEST_OFFSET:reply_offset].cast("d")
+        self._reply = view[
+            reply_offset:reply_offset + 8 * self.reply_size].cast("d")
+        self._request_fd = request_fd
+        self._reply_fd = reply_fd
+
+    @classmethod
+    def from_args(cls, argv=None):
+        """Attaches to the mailbox given in `argv` (by default, sys.argv),
+        ignoring any other arguments."""
+        parser = argparse.ArgumentParser()
+        for name in ("--mailbox_fd", "--request_fd", "--reply_fd"):
+            parser.add_argument(name, type=int, required=True)
+        args, _ = parser.parse_known_args(
+            sys.argv[1:] if argv is None else argv)
+        return cls(args.mailbox_fd, args.request_fd, args.reply_fd)
+
+    def receive(self):
+        """Blocks until the next request, and returns its time and values (a
+        list of floats), or returns None if the mailbox was closed instead."""
+        os.eventfd_read(self._request_fd)
+        _, _, _, closed, time = _HEADER.unpack_from(self._mailbox)
+        if closed:
+            return None
+        return time, self._request.tolist()
+
+    def reply(self, values):
+        """Posts `values` (a sequence of `reply_size` floats) to the last
+        request."""
+        self._reply[:] = array.array("d", values)
+        os.eventfd_write(self._reply_fd, 1)
+
+
+def serve(controller, argv=None):
+    """Attaches to the mailbox given in `argv` (by default, sys.argv), and
+    replies to each request at time t with values y with controller(t, y),
+    until the mailbox is closed."""
+    peer = MailboxPeer.from_args(argv)
+    while (request := peer.receive()) is not None:
+        peer.reply(controller(*request))
+
+
+def system_controller(system):
+    """Returns a controller for serve() that evaluates output port 0 of the
+    pydrake `system` with input port 0 fixed to the request, at the request's
+    time. Stateful systems keep their default state."""
+    context = system.CreateDefaultContext()
+    input_port = system.get_input_port(0)
+    output_port = system.get_output_port(0)
+
+    def controller(time, values):
+        context.SetTime(time)
+        input_port.FixValue(context, values)
+        return output_port.Eval(context)
+
+    return controller
+
+
+if __name__ == "__main__":
+    serve(lambda time, values: values)
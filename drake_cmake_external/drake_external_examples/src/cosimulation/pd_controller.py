@@ -0,0 +1,25 @@
+# SPDX-License-Identifier: MIT-0
+
+"""
+A proportional-derivative controller u = -kp * x - kd * v of a Particle's
+position x and velocity v, co-simulated with a C++ simulation through
+cosimulation.py; see cosimulation_test.cc.
+
+Usage: pd_controller.py --kp=<gain> --kd=<gain> <mailbox arguments>
+"""
+
+import argparse
+
+from cosimulation import serve
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--kp", type=float, default=1.0)
+    parser.add_argument("--kd", type=float, default=1.0)
+    args, mailbox_args = parser.parse_known_args()
+    serve(lambda time, y: [-args.kp * y[0] - args.kd * y[1]], mailbox_args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <memory>
+
+#include <drake/common/trajectories/piecewise_polynomial.h>
+#include <drake/systems/analysis/simulator.h>
+
+namespace drake_external_examples {
+namespace dense_output {
+
+/// Advances @p simulator to @p t_final while the integrator records its dense
+/// output, and returns that output as a continuous trajectory of the
+/// continuous state.
+///
+/// The trajectory is a piecewise cubic Hermite polynomial with one segment per
+/// integration step, so its size scales with the number of steps the
+/// integrator takes rather than with any output rate. It may be evaluated at
+/// any time in [t₀, @p t_final], where t₀ is the context time on entry.
+///
+/// Per-step publishing is turned off on @p simulator. The trajectory replaces
+/// sample-by-sample logging, so diagrams simulated this way should not contain
+/// log sinks.
+///
+/// @pre @p simulator is non-null and has a context with continuous state.
+/// @pre @p t_final is strictly greater than the current context time.
+/// @throws std::exception if either precondition is violated.
+std::unique_ptr<drake::trajectories::PiecewisePolynomial<double>>
+AdvanceToWithDenseOutput(drake::systems::Simulator<double>* simulator,
+                         double t_final);
+
+}  // namespace dense_output
+}  // namespace drake_external_examples
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "dense_output.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/trajectories/piecewise_polynomial.h>
+#include <drake/systems/analysis/simulator.h>
+
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace dense_output {
+namespace {
+
+using drake::systems::Simulator;
+using drake::trajectories::PiecewisePolynomial;
+using systems::SimpleContinuousTimeSystem;
+
+constexpr double kX0 = 0.9;
+
+/// The closed-form solution of xdot = -x + x³ from x(0) = x0, obtained with
+/// the substitution y = x⁻², which turns it into the linear ydot = 2y - 2.
+double ExactSolution(double x0, double t) {
+  return x0 / std::sqrt(x0 * x0 + (1.0 - x0 * x0) * std::exp(2.0 * t));
+}
+
+///
+/// A test fixture simulating a SimpleContinuousTimeSystem from x(0) = kX0.
+///
+class DenseOutputTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    simulator_ = std::make_unique<Simulator<double>>(system_);
+    simulator_->get_mutable_context().get_mutable_continuous_state()[0] = kX0;
+    simulator_->get_mutable_integrator().set_target_accuracy(1.0e-8);
+  }
+
+  SimpleContinuousTimeSystem<double> system_;
+  std::unique_ptr<Simulator<double>> simulator_;
+};
+
+/// Makes sure the trajectory spans the simulated interval and ends at the
+/// simulator's final state.
+TEST_F(DenseOutputTest, SpansSimulation) {
+  const std::unique_ptr<PiecewisePolynomial<double>> trajectory =
+      AdvanceToWithDenseOutput(simulator_.get(), 10.0);
+  ASSERT_NE(trajectory, nullptr);
+  EXPECT_EQ(trajectory->rows(), 1);
+  EXPECT_EQ(trajectory->cols(), 1);
+  EXPECT_EQ(trajectory->start_time(), 0.0);
+  EXPECT_EQ(trajectory->end_time(), 10.0);
+  EXPECT_NEAR(trajectory->value(0.0)(0), kX0, 1.0e-12);
+  EXPECT_NEAR(trajectory->value(10.0)(0),
+              simulator_->get_context().get_continuous_state()[0], 1.0e-12);
+}
+
+/// Makes sure the trajectory matches the exact solution at times that are
+/// not integration step boundaries.
+TEST_F(DenseOutputTest, MatchesExactSolution) {
+  const std::unique_ptr<PiecewisePolynomial<double>> trajectory =
+      AdvanceToWithDenseOutput(simulator_.get(), 10.0);
+  for (double t = 0.0; t <= 10.0; t += 0.0137) {
+    EXPECT_NEAR(trajectory->value(t)(0), ExactSolution(kX0, t), 1.0e-6)
+        << "at t = " << t;
+  }
+}
+
+/// Makes sure the trajectory grows with integration steps, not output rate.
+TEST_F(DenseOutputTest, SegmentsPerStep) {
+  const std::unique_ptr<PiecewisePolynomial<double>> trajectory =
+      AdvanceToWithDenseOutput(simulator_.get(), 10.0);
+  const int num_steps = simulator_->get_integrator().get_num_steps_taken();
+  EXPECT_GT(trajectory->get_number_of_segments(), 0);
+  EXPECT_LE(trajectory->get_number_of_segments(), num_steps);
+  // Even at this tight accuracy, far fewer samples than 1 kHz logging.
+  EXPECT_LT(num_steps, 10000);
+}
+
+/// Makes sure a non-increasing final time is rejected.
+TEST_F(DenseOutputTest, RejectsStaleFinalTime) {
+  EXPECT_THROW(AdvanceToWithDenseOutput(simulator_.get(), 0.0),
+               std::logic_error);
+  EXPECT_THROW(AdvanceToWithDenseOutput(nullptr, 1.0), std::logic_error);
+}
+
+}  // namespace
+}  // namespace dense_output
+}  // namespace drake_external_examples
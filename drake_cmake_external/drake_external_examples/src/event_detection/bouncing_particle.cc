@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "bouncing_particle.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <drake/common/eigen_types.h>
+#include <drake/common/value.h>
+#include <drake/systems/framework/framework_common.h>
+#include <drake/systems/framework/system.h>
+#include <drake/systems/framework/vector_base.h>
+
+namespace drake_external_examples {
+namespace event_detection {
+
+using drake::systems::Context;
+using drake::systems::EventStatus;
+using drake::systems::State;
+using drake::systems::System;
+using drake::systems::UnrestrictedUpdateEvent;
+using drake::systems::WitnessFunction;
+using drake::systems::WitnessFunctionDirection;
+
+namespace {
+
+// A witness triggers only when it goes from positive to non-positive over a
+// step. Each impact leaves the particle exactly at the wall, so the clearance
+// is offset by this much, for the witness to be positive again on the next
+// step and catch even a quick return to the same wall.
+constexpr double kClearanceOffset = 1e-12;
+
+}  // namespace
+
+BouncingParticle::BouncingParticle(const BouncingParticleOptions& options)
+    : options_(options) {
+  if (!(options_.mass > 0.0) ||
+      !(options_.lower_limit < options_.upper_limit) ||
+      !(options_.restitution >= 0.0 && options_.restitution <= 1.0) ||
+      !(options_.resting_speed >= 0.0)) {
+    throw std::logic_error("BouncingParticle: invalid options");
+  }
+  this->DeclareInputPort(drake::systems::kUseDefaultName,
+                         drake::systems::kVectorValued, 1);
+  this->DeclareContinuousState(1, 1, 0);
+  this->DeclareVectorOutputPort(drake::systems::kUseDefaultName,
+                                drake::systems::BasicVector<double>(2),
+                                &BouncingParticle::CopyStateOut);
+  this->DeclareNumericParameter(drake::systems::BasicVector<double>(
+      drake::Vector1d(options_.mass)));
+  this->DeclareAbstractState(drake::Value<std::vector<double>>());
+
+  if (options_.detection == ImpactDetection::kPerStep) {
+    this->DeclarePerStepUnrestrictedUpdateEvent(
+        &BouncingParticle::ApplyPassedImpacts);
+    return;
+  }
+  const auto make_reset = [this](double wall_position) {
+    return UnrestrictedUpdateEvent<double>(
+        [this, wall_position](const System<double>&,
+                              const Context<double>& context,
+                              const UnrestrictedUpdateEvent<double>&,
+                              State<double>* state) {
+          ApplyImpact(context, wall_position, state);
+          return EventStatus::Succeeded();
+        });
+  };
+  if (std::isfinite(options_.lower_limit)) {
+    lower_wall_ = this->MakeWitnessFunction(
+        "lower wall", WitnessFunctionDirection::kPositiveThenNonPositive,
+        &BouncingParticle::CalcLowerWallClearance,
+        make_reset(options_.lower_limit));
+  }
+  if (std::isfinite(options_.upper_limit)) {
+    upper_wall_ = this->MakeWitnessFunction(
+        "upper wall", WitnessFunctionDirection::kPositiveThenNonPositive,
+        &BouncingParticle::CalcUpperWallClearance,
+        make_reset(options_.upper_limit));
+  }
+}
+
+BouncingParticle::~BouncingParticle() = default;
+
+const std::vector<double>& BouncingParticle::get_impact_times(
+    const Context<double>& context) const {
+  this->ValidateContext(context);
+  return context.get_abstract_state<std::vector<double>>(0);
+}
+
+void BouncingParticle::CopyStateOut(
+    const Context<double>& context,
+    drake::systems::BasicVector<double>* output) const {
+  output->set_value(context.get_continuous_state_vector().CopyToVector());
+}
+
+void BouncingParticle::DoCalcTimeDerivatives(
+    const Context<double>& context,
+    drake::systems::ContinuousState<double>* derivatives) const {
+  const drake::systems::VectorBase<double>& state =
+      context.get_continuous_state_vector();
+  const double x = state[0];
+  const double v = state[1];
+  double acceleration = this->get_input_port(0).Eval(context)[0] /
+                        context.get_numeric_parameter(0)[0];
+  // A particle at rest against a wall stays there while pushed into it.
+  if (v == 0.0 && ((x <= options_.lower_limit && acceleration < 0.0) ||
+                   (x >= options_.upper_limit && acceleration > 0.0))) {
+    acceleration = 0.0;
+  }
+  derivatives->get_mutable_vector().SetFromVector(
+      Eigen::Vector2d(v, acceleration));
+}
+
+void BouncingParticle::DoGetWitnessFunctions(
+    const Context<double>&,
+    std::vector<const WitnessFunction<double>*>* witnesses) const {
+  for (const auto& wall : {lower_wall_.get(), upper_wall_.get()}) {
+    if (wall != nullptr) {
+      witnesses->push_back(wall);
+    }
+  }
+}
+
+double BouncingParticle::CalcLowerWallClearance(
+    const Context<double>& context) const {
+  return context.get_continuous_state_vector()[0] - options_.lower_limit +
+         kClearanceOffset;
+}
+
+double BouncingParticle::CalcUpperWallClearance(
+    const Context<double>& context) const {
+  return options_.upper_limit - context.get_continuous_state_vector()[0] +
+         kClearanceOffset;
+}
+
+void BouncingParticle::ApplyImpact(const Context<double>& context,
+                                   double wall_position,
+                                   State<double>* state) const {
+  double v = -options_.restitution * context.get_continuous_state_vector()[1];
+  if (std::abs(v) < options_.resting_speed) {
+    v = 0.0;
+  }
+  state->get_mutable_continuous_state().get_mutable_vector().SetFromVector(
+      Eigen::Vector2d(wall_position, v));
+  state->get_mutable_abstract_state<std::vector<double>>(0).push_back(
+      context.get_time());
+}
+
+EventStatus BouncingParticle::ApplyPassedImpacts(
+    const Context<double>& context, State<double>* state) const {
+  const double x = context.get_continuous_state_vector()[0];
+  const double v = context.get_continuous_state_vector()[1];
+  if (x < options_.lower_limit && v < 0.0) {
+    ApplyImpact(context, options_.lower_limit, state);
+    return EventStatus::Succeeded();
+  }
+  if (x > options_.upper_limit && v > 0.0) {
+    ApplyImpact(context, options_.upper_limit, state);
+    return EventStatus::Succeeded();
+  }
+  return EventStatus::DidNothing();
+}
+
+}  // namespace event_detection
+}  // namespace drake_external_examples
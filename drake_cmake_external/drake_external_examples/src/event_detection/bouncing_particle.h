@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/framework/event_status.h>
+#include <drake/systems/framework/leaf_system.h>
+#include <drake/systems/framework/state.h>
+#include <drake/systems/framework/witness_function.h>
+
+namespace drake_external_examples {
+namespace event_detection {
+
+/// How a BouncingParticle finds its impacts with the walls.
+enum class ImpactDetection {
+  /// With a witness function per wall, whose zero the Simulator isolates to
+  /// within 1% of the context's accuracy, in seconds.
+  kWitness,
+  /// By checking after every step whether the particle has passed a wall;
+  /// impacts are then found up to a step late, so accuracy needs tiny steps.
+  kPerStep,
+};
+
+/// Options for BouncingParticle.
+struct BouncingParticleOptions {
+  double mass{1.0};
+
+  /// The walls. Either may be infinite, for no wall.
+  double lower_limit{0.0};
+  double upper_limit{std::numeric_limits<double>::infinity()};
+
+  /// The ratio of the speeds after and before an impact, in [0, 1].
+  double restitution{0.8};
+
+  /// An impact that leaves the particle slower than this brings it to rest
+  /// against the wall, instead of bouncing ever more quickly (Zeno behavior).
+  double resting_speed{1e-3};
+
+  ImpactDetection detection{ImpactDetection::kWitness};
+};
+
+/// A Particle that moves between two walls, and bounces off them, losing a
+/// fraction of its speed at each impact: ẍ = f / m for lower_limit < x <
+/// upper_limit, and at an impact, an unrestricted update resets
+///
+///   x⁺ = the wall's position,  v⁺ = -e v⁻,
+///
+/// where e is the coefficient of restitution, and records the time.
+///
+/// Under a force pushing it into a wall (e.g., gravity), the bounces come ever
+/// more quickly, accumulating at a finite time. So that simulations get past
+/// that time, an impact that leaves the particle slower than the resting
+/// speed stops it at the wall instead, where it stays until the force pulls
+/// it away.
+///
+/// - Inputs: linear force (input index 0), in N.
+/// - States/Outputs: position (index 0), in m; velocity (index 1), in m/s.
+/// - Parameters: mass (numeric parameter index 0), in kg.
+/// - Abstract state: the times of all impacts so far (index 0).
+///
+/// @tparam_double_only
+class BouncingParticle final : public drake::systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BouncingParticle);
+
+  /// @throws std::exception unless the mass is positive, the lower limit is
+  /// below the upper one, the restitution is in [0, 1], and the resting speed
+  /// is not negative.
+  explicit BouncingParticle(const BouncingParticleOptions& options = {});
+
+  ~BouncingParticle() final;
+
+  const BouncingParticleOptions& options() const { return options_; }
+
+  /// Returns the times of the impacts so far in @p context.
+  const std::vector<double>& get_impact_times(
+      const drake::systems::Context<double>& context) const;
+
+ private:
+  void CopyStateOut(const drake::systems::Context<double>& context,
+                    drake::systems::BasicVector<double>* output) const;
+
+  void DoCalcTimeDerivatives(
+      const drake::systems::Context<double>& context,
+      drake::systems::ContinuousState<double>* derivatives) const final;
+
+  void DoGetWitnessFunctions(
+      const drake::systems::Context<double>& context,
+      std::vector<const drake::systems::WitnessFunction<double>*>* witnesses)
+      const final;
+
+  // The witness functions, positive while the particle is clear of a wall.
+  double CalcLowerWallClearance(
+      const drake::systems::Context<double>& context) const;
+  double CalcUpperWallClearance(
+      const drake::systems::Context<double>& context) const;
+
+  // Applies the reset map for the wall at wall_position.
+  void ApplyImpact(const drake::systems::Context<double>& context,
+                   double wall_position,
+                   drake::systems::State<double>* state) const;
+
+  // With ImpactDetection::kPerStep, applies the reset map if the last step
+  // took the particle past a wall.
+  drake::systems::EventStatus ApplyPassedImpacts(
+      const drake::systems::Context<double>& context,
+      drake::systems::State<double>* state) const;
+
+  const BouncingParticleOptions options_;
+  std::unique_ptr<drake::systems::WitnessFunction<double>> lower_wall_;
+  std::unique_ptr<drake::systems::WitnessFunction<double>> upper_wall_;
+};
+
+}  // namespace event_detection
+}  // namespace drake_external_examples
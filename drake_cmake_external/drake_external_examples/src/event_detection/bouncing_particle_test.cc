@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "bouncing_particle.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+
+namespace drake_external_examples {
+namespace event_detection {
+namespace {
+
+using drake::systems::Context;
+using drake::systems::Simulator;
+
+constexpr double kGravity = 9.81;
+constexpr double kAccuracy = 1e-8;
+
+// Returns the impact times of a particle dropped from rest at @p height onto
+// a floor at zero, under gravity.
+std::vector<double> CalcDropImpactTimes(
+    double height, const BouncingParticleOptions& options) {
+  double time = std::sqrt(2.0 * height / kGravity);
+  double speed = std::sqrt(2.0 * kGravity * height);
+  std::vector<double> times{time};
+  while ((speed *= options.restitution) >= options.resting_speed) {
+    time += 2.0 * speed / kGravity;
+    times.push_back(time);
+  }
+  return times;
+}
+
+// Creates a simulator of @p particle under the constant @p force from the
+// position @p x and velocity @p v.
+std::unique_ptr<Simulator<double>> MakeSimulator(
+    const BouncingParticle& particle, double force, double x, double v) {
+  auto context = particle.CreateDefaultContext();
+  particle.get_input_port(0).FixValue(context.get(), drake::Vector1d(force));
+  context->SetContinuousState(Eigen::Vector2d(x, v));
+  context->SetAccuracy(kAccuracy);
+  return std::make_unique<Simulator<double>>(particle, std::move(context));
+}
+
+/// Makes sure a dropped particle bounces ever more quickly at the times the
+/// closed form says, comes to rest on the floor instead of stalling the
+/// simulation at the Zeno time, and leaves it when pulled away.
+TEST(BouncingParticleTest, ZenoBouncingComesToRest) {
+  const BouncingParticleOptions options{.restitution = 0.8};
+  const BouncingParticle particle(options);
+  const std::vector<double> expected = CalcDropImpactTimes(1.0, options);
+  // The bounces accumulate at about 4.06 s.
+  ASSERT_GT(expected.size(), 30);
+  ASSERT_LT(expected.back(), 4.1);
+
+  auto simulator = MakeSimulator(particle, -kGravity, 1.0, 0.0);
+  simulator->AdvanceTo(6.0);
+  const Context<double>& context = simulator->get_context();
+  const std::vector<double>& actual = particle.get_impact_times(context);
+  ASSERT_EQ(actual.size(), expected.size());
+  for (int i = 0; i < static_cast<int>(actual.size()); ++i) {
+    EXPECT_NEAR(actual[i], expected[i], 1e-6) << "impact " << i;
+  }
+  EXPECT_EQ(context.get_continuous_state_vector()[0], 0.0);
+  EXPECT_EQ(context.get_continuous_state_vector()[1], 0.0);
+  // Resting takes no more steps than flying; bouncing does not stall.
+  EXPECT_LT(simulator->get_num_steps_taken(), 10000);
+
+  particle.get_input_port(0).FixValue(&simulator->get_mutable_context(),
+                                      drake::Vector1d(2.0));
+  simulator->AdvanceTo(7.0);
+  EXPECT_NEAR(context.get_continuous_state_vector()[0], 1.0, 1e-9);
+  EXPECT_NEAR(context.get_continuous_state_vector()[1], 2.0, 1e-9);
+}
+
+/// Makes sure a particle shuttling between two walls without losses bounces
+/// off each on time, keeping its phase.
+TEST(BouncingParticleTest, ShuttlesBetweenWalls) {
+  const BouncingParticle particle({.upper_limit = 1.0, .restitution = 1.0});
+  auto simulator = MakeSimulator(particle, 0.0, 0.5, 1.0);
+  for (int i = 1; i <= 10; ++i) {
+    simulator->AdvanceTo(i);
+    const double x = simulator->get_context().get_continuous_state_vector()[0];
+    EXPECT_NEAR(x, 0.5, 1e-8) << "t = " << i;
+  }
+  const std::vector<double>& impacts =
+      particle.get_impact_times(simulator->get_context());
+  ASSERT_EQ(impacts.size(), 10);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_NEAR(impacts[i], 0.5 + i, 1e-8) << "impact " << i;
+  }
+}
+
+/// Makes sure detecting impacts after each step finds them late, by up to a
+/// step each, so that the lag accumulates.
+TEST(BouncingParticleTest, PerStepDetectionLags) {
+  const BouncingParticle particle({.upper_limit = 1.0,
+                                   .restitution = 1.0,
+                                   .detection = ImpactDetection::kPerStep});
+  auto simulator = MakeSimulator(particle, 0.0, 0.5, 1.0);
+  const double max_step = 1e-3;
+  simulator->get_mutable_integrator().set_maximum_step_size(max_step);
+  simulator->AdvanceTo(10.0);
+  const std::vector<double>& impacts =
+      particle.get_impact_times(simulator->get_context());
+  ASSERT_EQ(impacts.size(), 10);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_GE(impacts[i], 0.5 + i) << "impact " << i;
+    EXPECT_LE(impacts[i], 0.5 + i + (i + 1) * max_step) << "impact " << i;
+  }
+}
+
+/// Makes sure invalid options are rejected.
+TEST(BouncingParticleTest, Throws) {
+  EXPECT_THROW(BouncingParticle({.mass = 0.0}), std::logic_error);
+  EXPECT_THROW(BouncingParticle({.lower_limit = 1.0, .upper_limit = 1.0}),
+               std::logic_error);
+  EXPECT_THROW(BouncingParticle({.restitution = 1.5}), std::logic_error);
+  EXPECT_THROW(BouncingParticle({.resting_speed = -1.0}), std::logic_error);
+}
+
+}  // namespace
+}  // namespace event_detection
+}  // namespace drake_external_examples
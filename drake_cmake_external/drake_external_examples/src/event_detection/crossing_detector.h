@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/leaf_system.h>
+#include <drake/systems/framework/witness_function.h>
+
+namespace drake_external_examples {
+namespace event_detection {
+
+/// A time at which a CrossingDetector's signal crossed its threshold.
+struct Crossing {
+  double time{};
+  /// Whether the signal rose through the threshold, rather than fell.
+  bool rising{};
+};
+
+/// Records when one element of its input crosses a threshold, e.g., the
+/// state of the Simple Continuous Time System, or the position of a Particle,
+/// so that simulations need not poll a log for it afterwards.
+///
+/// Two witness functions, one for each direction, watch the signal minus the
+/// threshold; the Simulator isolates their zeros to within 1% of the context's
+/// accuracy, in seconds, and an unrestricted update appends each crossing to
+/// the abstract state. Touching the threshold without crossing it may or may
+/// not be recorded.
+///
+/// - Inputs: the signal (input index 0), a vector.
+/// - Abstract state: the crossings so far, in time order (index 0).
+///
+/// @tparam_double_only
+class CrossingDetector final : public drake::systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CrossingDetector);
+
+  /// Watches element @p index of an input of size @p input_size for crossings
+  /// of @p threshold.
+  /// @throws std::exception unless @p index is in [0, @p input_size).
+  CrossingDetector(int input_size, int index, double threshold);
+
+  ~CrossingDetector() final;
+
+  int index() const { return index_; }
+
+  double threshold() const { return threshold_; }
+
+  /// Returns the crossings so far in @p context.
+  const std::vector<Crossing>& get_crossings(
+      const drake::systems::Context<double>& context) const;
+
+ private:
+  void DoGetWitnessFunctions(
+      const drake::systems::Context<double>& context,
+      std::vector<const drake::systems::WitnessFunction<double>*>* witnesses)
+      const final;
+
+  // The signal minus the threshold.
+  double CalcExcess(const drake::systems::Context<double>& context) const;
+
+  const int index_;
+  const double threshold_;
+  std::unique_ptr<drake::systems::WitnessFunction<double>> falling_;
+  std::unique_ptr<drake::systems::WitnessFunction<double>> rising_;
+};
+
+}  // namespace event_detection
+}  // namespace drake_external_examples
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "implicit_integrator.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+
+#include "particle/particle.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+#include "state_jacobian.h"
+#include "stiff_cubic_chain.h"
+
+namespace drake_external_examples {
+namespace implicit_integration {
+namespace {
+
+using drake::systems::Simulator;
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+// Returns the error at t = 1 of integrating ẋ = -x + x³ from x = 0.5, which
+// has the solution x(t) = (1 + (1/x₀² - 1) e²ᵗ)^(-1/2).
+double CalcSimpleContinuousTimeSystemError(ImplicitScheme scheme,
+                                           double step_size) {
+  const SimpleContinuousTimeSystem<double> system;
+  const SimpleContinuousTimeSystemStateJacobian jacobian(system);
+  ImplicitIntegrator integrator(jacobian,
+                                {.scheme = scheme, .step_size = step_size});
+  auto context = system.CreateDefaultContext();
+  const double x0 = 0.5;
+  context->SetContinuousState(drake::Vector1d(x0));
+  integrator.AdvanceTo(1.0, context.get());
+  EXPECT_DOUBLE_EQ(context->get_time(), 1.0);
+  const double expected =
+      1.0 / std::sqrt(1.0 + (1.0 / (x0 * x0) - 1.0) * std::exp(2.0));
+  return std::abs(context->get_continuous_state()[0] - expected);
+}
+
+/// Makes sure implicit Euler converges at first order, and Radau IIA at
+/// third: halving the step halves the error, or divides it by eight.
+TEST(ImplicitIntegratorTest, OrderOfConvergence) {
+  for (const auto& [scheme, ratio] :
+       {std::pair{ImplicitScheme::kImplicitEuler, 2.0},
+        std::pair{ImplicitScheme::kRadau3, 8.0}}) {
+    const double coarse = CalcSimpleContinuousTimeSystemError(scheme, 0.1);
+    const double fine = CalcSimpleContinuousTimeSystemError(scheme, 0.05);
+    EXPECT_NEAR(coarse / fine, ratio, 0.1 * ratio)
+        << "errors " << coarse << ", " << fine;
+  }
+}
+
+/// Makes sure the Particle, whose Jacobian is constant, is integrated exactly
+/// for a constant force, with Newton's method solving each step at once.
+TEST(ImplicitIntegratorTest, Particle) {
+  const Particle<double> particle;
+  const ParticleStateJacobian jacobian(particle);
+  ImplicitIntegrator integrator(jacobian, {.step_size = 0.25});
+  auto context = particle.CreateDefaultContext();
+  particle.get_input_port(0).FixValue(context.get(), drake::Vector1d(2.0));
+  context->SetContinuousState(Eigen::Vector2d(1.0, -1.0));
+  integrator.AdvanceTo(1.0, context.get());
+  // x = 1 - t + t², v = -1 + 2t.
+  EXPECT_NEAR(context->get_continuous_state()[0], 1.0, 1e-12);
+  EXPECT_NEAR(context->get_continuous_state()[1], 1.0, 1e-12);
+  // The first iteration solves the linear system; the second confirms it.
+  EXPECT_EQ(integrator.statistics().num_steps, 4);
+  EXPECT_EQ(integrator.statistics().num_newton_iterations, 8);
+}
+
+/// Makes sure Radau IIA agrees with Drake's error-controlled integration of
+/// a mildly stiff chain.
+TEST(ImplicitIntegratorTest, MatchesSimulator) {
+  const int n = 10;
+  const StiffCubicChain<double> chain(n, 10.0, 100.0);
+  const StiffCubicChainStateJacobian jacobian(chain);
+  Eigen::VectorXd x0(n);
+  for (int i = 0; i < n; ++i) {
+    x0(i) = 0.5 + 0.3 * std::sin(1.0 * i);
+  }
+
+  ImplicitIntegrator integrator(jacobian, {.step_size = 1e-3});
+  auto context = chain.CreateDefaultContext();
+  context->SetContinuousState(x0);
+
+  Simulator<double> simulator(chain);
+  simulator.get_mutable_integrator().set_target_accuracy(1e-10);
+  simulator.get_mutable_context().SetContinuousState(x0);
+  simulator.Initialize();
+
+  for (const double t : {0.01, 0.05, 0.1}) {
+    integrator.AdvanceTo(t, context.get());
+    simulator.AdvanceTo(t);
+    const Eigen::VectorXd expected =
+        simulator.get_context().get_continuous_state_vector().CopyToVector();
+    const Eigen::VectorXd actual =
+        context->get_continuous_state_vector().CopyToVector();
+    EXPECT_LT((actual - expected).lpNorm<Eigen::Infinity>(), 1e-6)
+        << "t = " << t;
+  }
+  EXPECT_EQ(integrator.statistics().num_step_retries, 0);
+}
+
+/// Makes sure steps on which the simplified Newton method does not converge
+/// are retried in halves, and that the statistics count the work done.
+TEST(ImplicitIntegratorTest, RetriesAndStatistics) {
+  const StiffCubicChain<double> chain(10, 1e3, 10.0);
+  const StiffCubicChainStateJacobian jacobian(chain);
+  ImplicitIntegrator integrator(jacobian, {.step_size = 1e-2});
+  auto context = chain.CreateDefaultContext();
+  Eigen::VectorXd x0(10);
+  for (int i = 0; i < 10; ++i) {
+    x0(i) = 0.5 + 0.3 * std::sin(1.0 * i);
+  }
+  context->SetContinuousState(x0);
+  integrator.AdvanceTo(1.0, context.get());
+
+  // Every state decays to the stable equilibrium at zero.
+  EXPECT_LT(context->get_continuous_state_vector()
+                .CopyToVector()
+                .lpNorm<Eigen::Infinity>(),
+            1e-10);
+  const ImplicitIntegratorStatistics& stats = integrator.statistics();
+  EXPECT_GT(stats.num_step_retries, 0);
+  // Each retry replaces a step with two.
+  EXPECT_EQ(stats.num_steps, 100 + stats.num_step_retries);
+  // Each attempted step evaluates and factors the Newton matrix once, and
+  // each Newton iteration evaluates the derivatives once per stage.
+  const int64_t num_attempts = stats.num_steps + stats.num_step_retries;
+  EXPECT_EQ(stats.num_jacobian_evaluations, num_attempts);
+  EXPECT_EQ(stats.num_factorizations, num_attempts);
+  EXPECT_EQ(stats.num_derivative_evaluations,
+            2 * stats.num_newton_iterations);
+}
+
+/// Makes sure invalid options and times are rejected.
+TEST(ImplicitIntegratorTest, Throws) {
+  const SimpleContinuousTimeSystem<double> system;
+  const SimpleContinuousTimeSystemStateJacobian jacobian(system);
+  EXPECT_THROW(ImplicitIntegrator(jacobian, {.step_size = 0.0}),
+               std::logic_error);
+  EXPECT_THROW(ImplicitIntegrator(jacobian, {.newton_tolerance = -1.0}),
+               std::logic_error);
+  EXPECT_THROW(ImplicitIntegrator(jacobian, {.max_newton_iterations = 0}),
+               std::logic_error);
+
+  ImplicitIntegrator integrator(jacobian);
+  auto context = system.CreateDefaultContext();
+  context->SetTime(1.0);
+  EXPECT_THROW(integrator.AdvanceTo(0.5, context.get()), std::logic_error);
+}
+
+}  // namespace
+}  // namespace implicit_integration
+}  // namespace drake_external_examples
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "state_jacobian.h"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace drake_external_examples {
+namespace implicit_integration {
+
+using drake::systems::Context;
+using drake::systems::System;
+
+StateJacobian::StateJacobian(const System<double>& system,
+                             Eigen::SparseMatrix<double> pattern)
+    : system_(system), pattern_(std::move(pattern)) {
+  const int n = system_.num_continuous_states();
+  if (pattern_.rows() != n || pattern_.cols() != n) {
+    throw std::logic_error(
+        "StateJacobian: the pattern must be square, with a row per state");
+  }
+}
+
+StateJacobian::~StateJacobian() = default;
+
+void StateJacobian::Calc(const Context<double>& context,
+                         Eigen::SparseMatrix<double>* jacobian) const {
+  system_.ValidateContext(context);
+  // Matrices made from the pattern keep it, so this catches the ones that
+  // were not.
+  if (jacobian->rows() != pattern_.rows() ||
+      jacobian->nonZeros() != pattern_.nonZeros() ||
+      !jacobian->isCompressed()) {
+    *jacobian = pattern_;
+  }
+  DoCalc(context, jacobian);
+}
+
+namespace {
+
+Eigen::SparseMatrix<double> MakePattern(
+    int n, const std::vector<Eigen::Triplet<double>>& entries) {
+  Eigen::SparseMatrix<double> pattern(n, n);
+  pattern.setFromTriplets(entries.begin(), entries.end());
+  pattern.makeCompressed();
+  return pattern;
+}
+
+}  // namespace
+
+ParticleStateJacobian::ParticleStateJacobian(
+    const particles::Particle<double>& system)
+    : StateJacobian(system, MakePattern(2, {{0, 1, 1.0}})) {}
+
+void ParticleStateJacobian::DoCalc(
+    const Context<double>&, Eigen::SparseMatrix<double>* jacobian) const {
+  // ∂v/∂v = 1; the acceleration F/m does not depend on the state.
+  jacobian->valuePtr()[0] = 1.0;
+}
+
+SimpleContinuousTimeSystemStateJacobian::
+    SimpleContinuousTimeSystemStateJacobian(
+        const systems::SimpleContinuousTimeSystem<double>& system)
+    : StateJacobian(system, MakePattern(1, {{0, 0, 1.0}})) {}
+
+void SimpleContinuousTimeSystemStateJacobian::DoCalc(
+    const Context<double>& context,
+    Eigen::SparseMatrix<double>* jacobian) const {
+  const double x = context.get_continuous_state()[0];
+  jacobian->valuePtr()[0] = -1.0 + 3.0 * x * x;
+}
+
+}  // namespace implicit_integration
+}  // namespace drake_external_examples
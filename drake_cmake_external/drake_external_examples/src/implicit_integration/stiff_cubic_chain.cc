@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "stiff_cubic_chain.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <drake/common/drake_throw.h>
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/vector_base.h>
+
+namespace drake_external_examples {
+namespace implicit_integration {
+
+template <typename T>
+StiffCubicChain<T>::StiffCubicChain(int num_states, double stiffness,
+                                    double coupling)
+    : drake::systems::LeafSystem<T>(
+          drake::systems::SystemTypeTag<StiffCubicChain>{}),
+      num_states_(num_states),
+      stiffness_(stiffness),
+      coupling_(coupling) {
+  DRAKE_THROW_UNLESS(num_states > 0);
+  DRAKE_THROW_UNLESS(stiffness >= 0.0 && coupling >= 0.0);
+  this->DeclareContinuousState(num_states);
+  this->DeclareVectorOutputPort("x", num_states, &StiffCubicChain::CopyStateOut,
+                                {this->all_state_ticket()});
+}
+
+template <typename T>
+void StiffCubicChain<T>::CopyStateOut(
+    const drake::systems::Context<T>& context,
+    drake::systems::BasicVector<T>* output) const {
+  output->SetFromVector(context.get_continuous_state_vector().CopyToVector());
+}
+
+template <typename T>
+void StiffCubicChain<T>::DoCalcTimeDerivatives(
+    const drake::systems::Context<T>& context,
+    drake::systems::ContinuousState<T>* derivatives) const {
+  const drake::VectorX<T> x =
+      context.get_continuous_state_vector().CopyToVector();
+  const int n = num_states_;
+  drake::VectorX<T> xdot =
+      stiffness_ * (x.array().cube() - x.array()).matrix() - 2 * coupling_ * x;
+  if (n > 1) {
+    xdot.head(n - 1) += coupling_ * x.tail(n - 1);
+    xdot.tail(n - 1) += coupling_ * x.head(n - 1);
+  }
+  derivatives->SetFromVector(xdot);
+}
+
+namespace {
+
+Eigen::SparseMatrix<double> MakeTridiagonalPattern(int n) {
+  std::vector<Eigen::Triplet<double>> entries;
+  for (int i = 0; i < n; ++i) {
+    for (int j = std::max(i - 1, 0); j <= std::min(i + 1, n - 1); ++j) {
+      entries.emplace_back(i, j, 1.0);
+    }
+  }
+  Eigen::SparseMatrix<double> pattern(n, n);
+  pattern.setFromTriplets(entries.begin(), entries.end());
+  pattern.makeCompressed();
+  return pattern;
+}
+
+}  // namespace
+
+StiffCubicChainStateJacobian::StiffCubicChainStateJacobian(
+    const StiffCubicChain<double>& system)
+    : StateJacobian(system, MakeTridiagonalPattern(system.num_states())),
+      chain_(system) {}
+
+void StiffCubicChainStateJacobian::DoCalc(
+    const drake::systems::Context<double>& context,
+    Eigen::SparseMatrix<double>* jacobian) const {
+  const drake::systems::VectorBase<double>& x =
+      context.get_continuous_state_vector();
+  const double lambda = chain_.stiffness();
+  const double k = chain_.coupling();
+  for (int j = 0; j < jacobian->outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(*jacobian, j); it;
+         ++it) {
+      if (it.row() == j) {
+        const double x_j = x[j];
+        it.valueRef() = lambda * (-1.0 + 3.0 * x_j * x_j) - 2.0 * k;
+      } else {
+        it.valueRef() = k;
+      }
+    }
+  }
+}
+
+}  // namespace implicit_integration
+}  // namespace drake_external_examples
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake_external_examples::implicit_integration::StiffCubicChain);
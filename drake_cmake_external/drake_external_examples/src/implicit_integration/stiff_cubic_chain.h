@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <Eigen/SparseCore>
+
+#include <drake/common/default_scalars.h>
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/framework/leaf_system.h>
+#include <drake/systems/framework/system_type_tag.h>
+
+#include "state_jacobian.h"
+
+namespace drake_external_examples {
+namespace implicit_integration {
+
+/// A stiff, spatially coupled version of the Simple Continuous Time System:
+/// a chain of n cubic states, each relaxing at the rate λ and diffusing to
+/// its neighbors at the rate k,
+///
+///   ẋᵢ = λ (-xᵢ + xᵢ³) + k (xᵢ₋₁ - 2xᵢ + xᵢ₊₁),  i = 0, ..., n - 1,
+///
+/// with x₋₁ = xₙ = 0. With λ or k large, the fastest modes decay much faster
+/// than the slowest, so explicit integrators need tiny steps; and the
+/// Jacobian is tridiagonal, so implicit ones need not treat it as dense.
+///
+/// - States/Outputs: x (state/output index 0).
+///
+/// @tparam_default_scalar
+template <typename T>
+class StiffCubicChain final : public drake::systems::LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(StiffCubicChain);
+
+  /// Creates a chain of @p num_states states with the relaxation rate
+  /// @p stiffness (λ) and the diffusion rate @p coupling (k).
+  /// @throws std::exception unless @p num_states is positive, and the rates
+  /// are not negative.
+  StiffCubicChain(int num_states, double stiffness, double coupling);
+
+  /// Scalar-converting copy constructor. See @ref system_scalar_conversion.
+  template <typename U>
+  explicit StiffCubicChain(const StiffCubicChain<U>& other)
+      : StiffCubicChain(other.num_states(), other.stiffness(),
+                        other.coupling()) {}
+
+  int num_states() const { return num_states_; }
+
+  double stiffness() const { return stiffness_; }
+
+  double coupling() const { return coupling_; }
+
+ private:
+  void CopyStateOut(const drake::systems::Context<T>& context,
+                    drake::systems::BasicVector<T>* output) const;
+
+  void DoCalcTimeDerivatives(
+      const drake::systems::Context<T>& context,
+      drake::systems::ContinuousState<T>* derivatives) const final;
+
+  const int num_states_;
+  const double stiffness_;
+  const double coupling_;
+};
+
+/// The tridiagonal Jacobian of a StiffCubicChain, with
+/// Jᵢᵢ = λ (-1 + 3xᵢ²) - 2k and Jᵢ,ᵢ₋₁ = Jᵢ,ᵢ₊₁ = k.
+class StiffCubicChainStateJacobian final : public StateJacobian {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(StiffCubicChainStateJacobian);
+
+  explicit StiffCubicChainStateJacobian(const StiffCubicChain<double>& system);
+
+ private:
+  void DoCalc(const drake::systems::Context<double>& context,
+              Eigen::SparseMatrix<double>* jacobian) const final;
+
+  const StiffCubicChain<double>& chain_;
+};
+
+}  // namespace implicit_integration
+}  // namespace drake_external_examples
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake_external_examples::implicit_integration::StiffCubicChain);
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "cell_list.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace drake_external_examples {
+namespace particles {
+
+void CellList::Rebuild(const Eigen::Ref<const Eigen::VectorXd>& x,
+                       const Eigen::Ref<const Eigen::VectorXd>& y,
+                       double cell_size) {
+  if (x.size() != y.size()) {
+    throw std::logic_error("CellList: x and y differ in size");
+  }
+  if (!(cell_size > 0.0)) {
+    throw std::logic_error("CellList: the cell size must be positive");
+  }
+  const int num_points = static_cast<int>(x.size());
+  const bool same_points = (num_points == this->num_points());
+  if (!same_points) {
+    // Start over in the original order.
+    point_index_.resize(num_points);
+    std::iota(point_index_.begin(), point_index_.end(), 0);
+    cell_of_.assign(num_points, -1);
+    sorted_x_.resize(num_points);
+    sorted_y_.resize(num_points);
+    next_point_index_.resize(num_points);
+  }
+
+  // Keep the grid while it still covers every point, so that cells stay
+  // comparable from one build to the next.
+  bool changed = true;
+  std::optional<bool> cells_changed;
+  if (same_points && cell_size == requested_cell_size_ && num_cells() > 0) {
+    cells_changed = UpdateCells(x, y);
+  }
+  if (cells_changed.has_value()) {
+    changed = *cells_changed;
+  } else {
+    requested_cell_size_ = cell_size;
+    ResizeGrid(x, y);
+    const bool covered = UpdateCells(x, y).has_value();
+    if (!covered) {
+      throw std::runtime_error("CellList: the points must be finite");
+    }
+  }
+
+  last_rebuild_rebucketed_ = changed;
+  if (changed) {
+    // Counting sort by cell, visiting points in their previous sorted order
+    // so that each cell keeps its previous order.
+    cell_begin_.assign(num_cells() + 1, 0);
+    for (int i = 0; i < num_points; ++i) {
+      ++cell_begin_[cell_of_[i] + 1];
+    }
+    std::partial_sum(cell_begin_.begin(), cell_begin_.end(),
+                     cell_begin_.begin());
+    cell_cursor_.assign(cell_begin_.begin(), cell_begin_.end() - 1);
+    for (const int i : point_index_) {
+      next_point_index_[cell_cursor_[cell_of_[i]]++] = i;
+    }
+    point_index_.swap(next_point_index_);
+  }
+  for (int slot = 0; slot < num_points; ++slot) {
+    const int i = point_index_[slot];
+    sorted_x_[slot] = x[i];
+    sorted_y_[slot] = y[i];
+  }
+}
+
+std::optional<bool> CellList::UpdateCells(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y) {
+  bool changed = false;
+  for (int i = 0; i < x.size(); ++i) {
+    const double col = std::floor((x[i] - min_x_) / cell_size_);
+    const double row = std::floor((y[i] - min_y_) / cell_size_);
+    // Written so that NaNs also count as outside.
+    if (!(col >= 0 && col < num_cols_ && row >= 0 && row < num_rows_)) {
+      return std::nullopt;
+    }
+    const int c = cell(static_cast<int>(row), static_cast<int>(col));
+    changed = changed || (c != cell_of_[i]);
+    cell_of_[i] = c;
+  }
+  return changed;
+}
+
+void CellList::ResizeGrid(const Eigen::Ref<const Eigen::VectorXd>& x,
+                          const Eigen::Ref<const Eigen::VectorXd>& y) {
+  const double width = x.size() > 0 ? x.maxCoeff() - x.minCoeff() : 0.0;
+  const double height = y.size() > 0 ? y.maxCoeff() - y.minCoeff() : 0.0;
+  if (!std::isfinite(width) || !std::isfinite(height)) {
+    throw std::runtime_error("CellList: the points must be finite");
+  }
+  // Grow the cells until there are at most about two per point.
+  const double max_cells = std::max(1.0, 2.0 * x.size());
+  cell_size_ = requested_cell_size_;
+  double num_cols = 0;
+  double num_rows = 0;
+  while (true) {
+    num_cols = std::floor(width / cell_size_) + 3;
+    num_rows = std::floor(height / cell_size_) + 3;
+    if (num_cols * num_rows <= std::max(max_cells, 9.0)) {
+      break;
+    }
+    cell_size_ *= 2.0;
+  }
+  num_cols_ = static_cast<int>(num_cols);
+  num_rows_ = static_cast<int>(num_rows);
+  min_x_ = (x.size() > 0 ? x.minCoeff() : 0.0) - cell_size_;
+  min_y_ = (y.size() > 0 ? y.minCoeff() : 0.0) - cell_size_;
+}
+
+}  // namespace particles
+}  // namespace drake_external_examples
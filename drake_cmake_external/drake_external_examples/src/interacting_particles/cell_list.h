@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <drake/common/eigen_types.h>
+
+namespace drake_external_examples {
+namespace particles {
+
+/// A uniform grid of square cells over the bounding box of a set of planar
+/// points, with the points bucketed by cell, for finding all pairs of points
+/// closer than a cutoff radius in O(N) time.
+///
+/// Points are stored sorted by cell, structure-of-arrays: the points of cell c
+/// occupy the sorted slots [cell_begin(c), cell_begin(c + 1)), with their
+/// coordinates in sorted_x() and sorted_y() and their original indices in
+/// point_index(). Every pair of points closer than the cell size lies in the
+/// same or in adjacent (including diagonally adjacent) cells.
+///
+/// Rebuild() reuses the storage of the previous build. When no point has
+/// changed cells since then, which is the common case between successive
+/// derivative evaluations of a simulation, it only refreshes the sorted
+/// coordinates; otherwise it re-buckets the points with a counting sort that
+/// preserves the previous order within each cell.
+class CellList {
+ public:
+  CellList() = default;
+
+  /// Buckets the points (@p x[i], @p y[i]) into cells whose side is at least
+  /// @p cell_size. The side grows past @p cell_size if needed to keep the
+  /// number of cells at most about twice the number of points.
+  /// @throws std::exception if @p x and @p y differ in size or @p cell_size
+  /// is not positive.
+  void Rebuild(const Eigen::Ref<const Eigen::VectorXd>& x,
+               const Eigen::Ref<const Eigen::VectorXd>& y, double cell_size);
+
+  int num_points() const { return static_cast<int>(point_index_.size()); }
+  int num_rows() const { return num_rows_; }
+  int num_cols() const { return num_cols_; }
+  int num_cells() const { return num_rows_ * num_cols_; }
+  double cell_size() const { return cell_size_; }
+
+  /// Returns the index of the cell at @p row and @p col.
+  int cell(int row, int col) const { return row * num_cols_ + col; }
+
+  /// Returns the first sorted slot of @p cell; cell_begin(num_cells()) is
+  /// num_points().
+  int cell_begin(int cell) const { return cell_begin_[cell]; }
+
+  const std::vector<int>& point_index() const { return point_index_; }
+  const std::vector<double>& sorted_x() const { return sorted_x_; }
+  const std::vector<double>& sorted_y() const { return sorted_y_; }
+
+  /// Returns whether the last Rebuild() re-bucketed the points, rather than
+  /// only refreshing their coordinates.
+  bool last_rebuild_rebucketed() const { return last_rebuild_rebucketed_; }
+
+ private:
+  // Computes the cell of every point into cell_of_, and returns whether any
+  // cell changed, or std::nullopt if a point lies outside the current grid.
+  std::optional<bool> UpdateCells(const Eigen::Ref<const Eigen::VectorXd>& x,
+                                  const Eigen::Ref<const Eigen::VectorXd>& y);
+
+  // Sizes a new grid that covers the points with a margin of one cell.
+  void ResizeGrid(const Eigen::Ref<const Eigen::VectorXd>& x,
+                  const Eigen::Ref<const Eigen::VectorXd>& y);
+
+  double requested_cell_size_{};
+  double cell_size_{};
+  double min_x_{};
+  double min_y_{};
+  int num_rows_{};
+  int num_cols_{};
+  std::vector<int> cell_begin_;
+  std::vector<int> point_index_;
+  std::vector<double> sorted_x_;
+  std::vector<double> sorted_y_;
+  // The cell of each point (by original index) as of the last build, and
+  // scratch space for re-bucketing.
+  std::vector<int> cell_of_;
+  std::vector<int> cell_cursor_;
+  std::vector<int> next_point_index_;
+  bool last_rebuild_rebucketed_{};
+};
+
+}  // namespace particles
+}  // namespace drake_external_examples
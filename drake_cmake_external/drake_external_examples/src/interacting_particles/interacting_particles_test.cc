@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "interacting_particles.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+using drake::systems::Simulator;
+
+// Returns positions and velocities for @p num_particles particles scattered
+// over a square, at a density of about three neighbors per particle.
+Eigen::VectorXd RandomState(int num_particles, int seed) {
+  std::mt19937 generator(seed);
+  const double side = std::sqrt(num_particles);
+  std::uniform_real_distribution<double> position(0.0, side);
+  std::uniform_real_distribution<double> velocity(-1.0, 1.0);
+  Eigen::VectorXd state(4 * num_particles);
+  for (int i = 0; i < 2 * num_particles; ++i) {
+    state[i] = position(generator);
+    state[2 * num_particles + i] = velocity(generator);
+  }
+  return state;
+}
+
+/// Makes sure the cell-list derivatives match the all-pairs forces, for any
+/// number of threads, including after the particles move.
+TEST(InteractingParticlesTest, MatchesAllPairs) {
+  const int n = 1000;
+  for (const int num_threads : {1, 4}) {
+    InteractionOptions options;
+    options.num_threads = num_threads;
+    const InteractingParticles system(n, options);
+    auto context = system.CreateDefaultContext();
+    auto derivatives = system.AllocateTimeDerivatives();
+    Eigen::VectorXd state = RandomState(n, 1);
+    for (int step = 0; step < 3; ++step) {
+      context->SetContinuousState(state);
+      system.CalcTimeDerivatives(*context, derivatives.get());
+      const Eigen::VectorXd result = derivatives->CopyToVector();
+      const Eigen::VectorXd velocities = state.tail(2 * n);
+      const Eigen::VectorXd expected_accelerations =
+          CalcInteractionForcesAllPairs(system, state.head(2 * n)) -
+          options.damping * velocities;
+      EXPECT_EQ(result.head(2 * n), velocities);
+      EXPECT_LT((result.tail(2 * n) - expected_accelerations)
+                    .lpNorm<Eigen::Infinity>(),
+                1e-12);
+      // Let the particles drift, crossing some cell boundaries.
+      state.head(2 * n) += 0.05 * velocities;
+    }
+  }
+}
+
+/// Makes sure the interaction forces are equal and opposite, so that they
+/// sum to zero.
+TEST(InteractingParticlesTest, ConservesMomentum) {
+  const int n = 2000;
+  InteractionOptions options;
+  options.damping = 0.0;
+  options.num_threads = 3;
+  const InteractingParticles system(n, options);
+  auto context = system.CreateDefaultContext();
+  context->SetContinuousState(RandomState(n, 2));
+  const Eigen::VectorXd accelerations =
+      system.EvalTimeDerivatives(*context).CopyToVector().tail(2 * n);
+  EXPECT_NEAR(accelerations.head(n).sum(), 0.0, 1e-9);
+  EXPECT_NEAR(accelerations.tail(n).sum(), 0.0, 1e-9);
+}
+
+/// Makes sure two nearby particles at rest push each other apart
+/// symmetrically, until they are out of range.
+TEST(InteractingParticlesTest, PairSeparates) {
+  InteractionOptions options;
+  options.damping = 0.0;
+  const InteractingParticles system(2, options);
+  Simulator<double> simulator(system);
+  Eigen::VectorXd state = Eigen::VectorXd::Zero(8);
+  state[0] = -0.25;  // x₀
+  state[1] = 0.25;   // x₁
+  simulator.get_mutable_context().SetContinuousState(state);
+  simulator.AdvanceTo(5.0);
+  const Eigen::VectorXd result =
+      simulator.get_context().get_continuous_state_vector().CopyToVector();
+  EXPECT_GT(result[1] - result[0], options.cutoff_radius);
+  EXPECT_NEAR(result[0], -result[1], 1e-9);
+  EXPECT_NEAR(result[4], -result[5], 1e-9);
+  EXPECT_GT(result[5], 0.0);
+  // The motion stays on the x axis.
+  EXPECT_EQ(result[2], 0.0);
+  EXPECT_EQ(result[3], 0.0);
+}
+
+/// Makes sure invalid arguments are rejected.
+TEST(InteractingParticlesTest, RejectsBadArguments) {
+  InteractionOptions options;
+  EXPECT_THROW(InteractingParticles(-1, options), std::logic_error);
+  options.cutoff_radius = 0.0;
+  EXPECT_THROW(InteractingParticles(10, options), std::logic_error);
+}
+
+}  // namespace
+}  // namespace particles
+}  // namespace drake_external_examples
@@ -0,0 +1,577 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "model_cache.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <drake/common/sha256.h>
+#include <drake/multibody/parsing/parser.h>
+#include <drake/multibody/tree/prismatic_joint.h>
+#include <drake/multibody/tree/quaternion_floating_joint.h>
+#include <drake/multibody/tree/revolute_joint.h>
+#include <drake/multibody/tree/weld_joint.h>
+
+namespace drake_external_examples {
+namespace model_cache {
+
+using drake::math::RigidTransformd;
+using drake::math::RotationMatrixd;
+using drake::multibody::BodyIndex;
+using drake::multibody::Joint;
+using drake::multibody::JointActuator;
+using drake::multibody::ModelInstanceIndex;
+using drake::multibody::MultibodyPlant;
+using drake::multibody::PrismaticJoint;
+using drake::multibody::QuaternionFloatingJoint;
+using drake::multibody::RevoluteJoint;
+using drake::multibody::RigidBody;
+using drake::multibody::SpatialInertia;
+using drake::multibody::UnitInertia;
+using drake::multibody::WeldJoint;
+
+namespace {
+
+constexpr char kMagic[8] = {'D', 'E', 'E', 'M', 'O', 'D', 'L', '1'};
+constexpr std::string_view kSuffix = ".model";
+
+// Numbers the temporary files of all caches in the process, which may write
+// the same description at once.
+std::atomic<int64_t> g_num_temporaries{0};
+
+// Appends values to a serialized description, in native byte order.
+class Writer {
+ public:
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  void Write(T value) {
+    bytes_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void Write(std::string_view text) {
+    Write(static_cast<uint64_t>(text.size()));
+    bytes_.append(text);
+  }
+
+  // Vectors of known size, e.g., an axis, are written without their size.
+  template <int Size>
+  void Write(const Eigen::Vector<double, Size>& values) {
+    if constexpr (Size == Eigen::Dynamic) {
+      Write(static_cast<uint64_t>(values.size()));
+    }
+    bytes_.append(reinterpret_cast<const char*>(values.data()),
+                  sizeof(double) * values.size());
+  }
+
+  void Write(const RigidTransformd& pose) {
+    const Eigen::Matrix<double, 3, 4> matrix = pose.GetAsMatrix34();
+    bytes_.append(reinterpret_cast<const char*>(matrix.data()),
+                  sizeof(double) * matrix.size());
+  }
+
+  std::string Release() { return std::move(bytes_); }
+
+ private:
+  std::string bytes_;
+};
+
+// Reads back what a Writer wrote, throwing if the bytes run out.
+class Reader {
+ public:
+  explicit Reader(std::string_view bytes) : bytes_(bytes) {}
+
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  T Read() {
+    T value;
+    std::memcpy(&value, Take(sizeof(value)), sizeof(value));
+    return value;
+  }
+
+  // Reads the size of a sequence whose elements take at least
+  // @p min_element_bytes each, so that a corrupt size cannot allocate more
+  // than the bytes could hold.
+  size_t ReadSize(size_t min_element_bytes = 1) {
+    const auto size = Read<uint64_t>();
+    if (size > (bytes_.size() - position_) / min_element_bytes) {
+      Fail();
+    }
+    return static_cast<size_t>(size);
+  }
+
+  std::string ReadString() {
+    const size_t size = ReadSize();
+    return std::string(Take(size), size);
+  }
+
+  template <int Size>
+  Eigen::Vector<double, Size> ReadVector() {
+    const size_t size =
+        Size == Eigen::Dynamic ? ReadSize(sizeof(double)) : Size;
+    Eigen::Vector<double, Size> values;
+    values.resize(size);
+    std::memcpy(values.data(), Take(sizeof(double) * size),
+                sizeof(double) * size);
+    return values;
+  }
+
+  RigidTransformd ReadPose() {
+    Eigen::Matrix<double, 3, 4> matrix;
+    std::memcpy(matrix.data(), Take(sizeof(double) * matrix.size()),
+                sizeof(double) * matrix.size());
+    return RigidTransformd(RotationMatrixd(matrix.leftCols<3>()),
+                           matrix.col(3));
+  }
+
+  bool at_end() const { return position_ == bytes_.size(); }
+
+  [[noreturn]] static void Fail() {
+    throw std::runtime_error("Malformed model description");
+  }
+
+ private:
+  const char* Take(size_t size) {
+    if (size > bytes_.size() - position_) {
+      Fail();
+    }
+    const char* taken = bytes_.data() + position_;
+    position_ += size;
+    return taken;
+  }
+
+  const std::string_view bytes_;
+  size_t position_{};
+};
+
+JointDescription DescribeJoint(const Joint<double>& joint) {
+  JointDescription described;
+  described.name = joint.name();
+  described.type = joint.type_name();
+  described.parent_body = joint.parent_body().index();
+  described.child_body = joint.child_body().index();
+  described.X_PF = joint.frame_on_parent().GetFixedPoseInBodyFrame();
+  described.X_CM = joint.frame_on_child().GetFixedPoseInBodyFrame();
+  if (const auto* revolute =
+          dynamic_cast<const RevoluteJoint<double>*>(&joint)) {
+    described.axis = revolute->revolute_axis();
+    described.damping = revolute->default_damping();
+  } else if (const auto* prismatic =
+                 dynamic_cast<const PrismaticJoint<double>*>(&joint)) {
+    described.axis = prismatic->translation_axis();
+    described.damping = prismatic->default_damping();
+  } else if (const auto* weld =
+                 dynamic_cast<const WeldJoint<double>*>(&joint)) {
+    described.X_FM = weld->X_FM();
+  } else {
+    throw std::logic_error("Joint " + joint.name() + " has the type " +
+                           joint.type_name() +
+                           ", which a model description cannot hold");
+  }
+  described.position_lower_limits = joint.position_lower_limits();
+  described.position_upper_limits = joint.position_upper_limits();
+  described.velocity_lower_limits = joint.velocity_lower_limits();
+  described.velocity_upper_limits = joint.velocity_upper_limits();
+  described.acceleration_lower_limits = joint.acceleration_lower_limits();
+  described.acceleration_upper_limits = joint.acceleration_upper_limits();
+  described.default_positions = joint.default_positions();
+  return described;
+}
+
+const Joint<double>& AddJoint(const JointDescription& joint,
+                              MultibodyPlant<double>* plant) {
+  const RigidBody<double>& parent =
+      plant->get_body(BodyIndex(joint.parent_body));
+  const RigidBody<double>& child = plant->get_body(BodyIndex(joint.child_body));
+  if (joint.type == RevoluteJoint<double>::kTypeName) {
+    return plant->AddJoint<RevoluteJoint>(joint.name, parent, joint.X_PF, child,
+                                          joint.X_CM, joint.axis,
+                                          joint.damping);
+  }
+  if (joint.type == PrismaticJoint<double>::kTypeName) {
+    return plant->AddJoint<PrismaticJoint>(
+        joint.name, parent, joint.X_PF, child, joint.X_CM, joint.axis,
+        -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::infinity(), joint.damping);
+  }
+  if (joint.type == WeldJoint<double>::kTypeName) {
+    return plant->AddJoint<WeldJoint>(joint.name, parent, joint.X_PF, child,
+                                      joint.X_CM, joint.X_FM);
+  }
+  throw std::logic_error("Joint " + joint.name + " has the unknown type " +
+                         joint.type);
+}
+
+std::optional<std::string> ReadFile(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    return std::nullopt;
+  }
+  std::string bytes((std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+  if (in.bad()) {
+    return std::nullopt;
+  }
+  return bytes;
+}
+
+}  // namespace
+
+ModelDescription DescribePlant(const MultibodyPlant<double>& plant) {
+  if (!plant.is_finalized()) {
+    throw std::logic_error("Only finalized plants can be described");
+  }
+  ModelDescription description;
+  for (int i = 2; i < plant.num_model_instances(); ++i) {
+    description.model_instances.push_back(
+        plant.GetModelInstanceName(ModelInstanceIndex(i)));
+  }
+  for (int i = 1; i < plant.num_bodies(); ++i) {
+    const RigidBody<double>& body = plant.get_body(BodyIndex(i));
+    const SpatialInertia<double>& inertia = body.default_spatial_inertia();
+    BodyDescription& described = description.bodies.emplace_back();
+    described.name = body.name();
+    described.model_instance = body.model_instance();
+    described.mass = inertia.get_mass();
+    described.p_BoBcm_B = inertia.get_com();
+    described.unit_inertia << inertia.get_unit_inertia().get_moments(),
+        inertia.get_unit_inertia().get_products();
+  }
+  for (const auto index : plant.GetJointIndices()) {
+    const Joint<double>& joint = plant.get_joint(index);
+    // Finalize() gives each free body a floating joint, and will do so again
+    // for the plant built from the description.
+    if (joint.type_name() == QuaternionFloatingJoint<double>::kTypeName &&
+        joint.parent_body().index() == plant.world_body().index()) {
+      description.bodies[joint.child_body().index() - 1].default_free_pose =
+          plant.GetDefaultFreeBodyPose(joint.child_body());
+      continue;
+    }
+    description.joints.push_back(DescribeJoint(joint));
+  }
+  for (const auto index : plant.GetJointActuatorIndices()) {
+    const JointActuator<double>& actuator = plant.get_joint_actuator(index);
+    ActuatorDescription& described = description.actuators.emplace_back();
+    described.name = actuator.name();
+    described.joint_name = actuator.joint().name();
+    described.model_instance = actuator.joint().model_instance();
+    described.effort_limit = actuator.effort_limit();
+    described.rotor_inertia = actuator.default_rotor_inertia();
+    described.gear_ratio = actuator.default_gear_ratio();
+    if (actuator.has_controller()) {
+      const auto& gains = actuator.get_controller_gains();
+      described.controller_gains = Eigen::Vector2d(gains.p, gains.d);
+    }
+  }
+  description.gravity = plant.gravity_field().gravity_vector();
+  return description;
+}
+
+std::unique_ptr<MultibodyPlant<double>> BuildPlant(
+    const ModelDescription& description, double time_step) {
+  auto plant = std::make_unique<MultibodyPlant<double>>(time_step);
+  for (const std::string& name : description.model_instances) {
+    plant->AddModelInstance(name);
+  }
+  for (const BodyDescription& body : description.bodies) {
+    const auto& g = body.unit_inertia;
+    const RigidBody<double>& added = plant->AddRigidBody(
+        body.name, ModelInstanceIndex(body.model_instance),
+        SpatialInertia<double>(body.mass, body.p_BoBcm_B,
+                               UnitInertia<double>(g[0], g[1], g[2], g[3],
+                                                   g[4], g[5]),
+                               /* skip_validity_check = */ true));
+    if (body.default_free_pose.has_value()) {
+      plant->SetDefaultFreeBodyPose(added, *body.default_free_pose);
+    }
+  }
+  for (const JointDescription& joint : description.joints) {
+    Joint<double>& added =
+        plant->get_mutable_joint(AddJoint(joint, plant.get()).index());
+    added.set_position_limits(joint.position_lower_limits,
+                              joint.position_upper_limits);
+    added.set_velocity_limits(joint.velocity_lower_limits,
+                              joint.velocity_upper_limits);
+    added.set_acceleration_limits(joint.acceleration_lower_limits,
+                                  joint.acceleration_upper_limits);
+    added.set_default_positions(joint.default_positions);
+  }
+  for (const ActuatorDescription& actuator : description.actuators) {
+    const Joint<double>& joint = plant->GetJointByName(
+        actuator.joint_name, ModelInstanceIndex(actuator.model_instance));
+    JointActuator<double>& added = plant->get_mutable_joint_actuator(
+        plant->AddJointActuator(actuator.name, joint, actuator.effort_limit)
+            .index());
+    added.set_default_rotor_inertia(actuator.rotor_inertia);
+    added.set_default_gear_ratio(actuator.gear_ratio);
+    if (actuator.controller_gains.has_value()) {
+      added.set_controller_gains(
+          {(*actuator.controller_gains)[0], (*actuator.controller_gains)[1]});
+    }
+  }
+  plant->mutable_gravity_field().set_gravity_vector(description.gravity);
+  plant->Finalize();
+  return plant;
+}
+
+std::string SerializeModelDescription(const ModelDescription& description) {
+  Writer out;
+  out.Write(std::string_view(kMagic, sizeof(kMagic)));
+  out.Write(static_cast<uint64_t>(description.model_instances.size()));
+  for (const std::string& name : description.model_instances) {
+    out.Write(name);
+  }
+  out.Write(static_cast<uint64_t>(description.bodies.size()));
+  for (const BodyDescription& body : description.bodies) {
+    out.Write(body.name);
+    out.Write(static_cast<int64_t>(body.model_instance));
+    out.Write(body.mass);
+    out.Write(body.p_BoBcm_B);
+    out.Write(body.unit_inertia);
+    out.Write(static_cast<uint8_t>(body.default_free_pose.has_value()));
+    if (body.default_free_pose.has_value()) {
+      out.Write(*body.default_free_pose);
+    }
+  }
+  out.Write(static_cast<uint64_t>(description.joints.size()));
+  for (const JointDescription& joint : description.joints) {
+    out.Write(joint.name);
+    out.Write(joint.type);
+    out.Write(static_cast<int64_t>(joint.parent_body));
+    out.Write(static_cast<int64_t>(joint.child_body));
+    out.Write(joint.X_PF);
+    out.Write(joint.X_CM);
+    out.Write(joint.axis);
+    out.Write(joint.damping);
+    out.Write(joint.X_FM);
+    for (const Eigen::VectorXd* limits :
+         {&joint.position_lower_limits, &joint.position_upper_limits,
+          &joint.velocity_lower_limits, &joint.velocity_upper_limits,
+          &joint.acceleration_lower_limits, &joint.acceleration_upper_limits,
+          &joint.default_positions}) {
+      out.Write(*limits);
+    }
+  }
+  out.Write(static_cast<uint64_t>(description.actuators.size()));
+  for (const ActuatorDescription& actuator : description.actuators) {
+    out.Write(actuator.name);
+    out.Write(actuator.joint_name);
+    out.Write(static_cast<int64_t>(actuator.model_instance));
+    out.Write(actuator.effort_limit);
+    out.Write(actuator.rotor_inertia);
+    out.Write(actuator.gear_ratio);
+    out.Write(static_cast<uint8_t>(actuator.controller_gains.has_value()));
+    if (actuator.controller_gains.has_value()) {
+      out.Write(*actuator.controller_gains);
+    }
+  }
+  out.Write(description.gravity);
+  return out.Release();
+}
+
+ModelDescription DeserializeModelDescription(std::string_view bytes) {
+  Reader in(bytes);
+  if (in.ReadString() != std::string_view(kMagic, sizeof(kMagic))) {
+    Reader::Fail();
+  }
+  // Each element of the sequences below takes at least 8 bytes.
+  constexpr size_t kMinElementBytes = 8;
+  ModelDescription description;
+  description.model_instances.resize(in.ReadSize(kMinElementBytes));
+  for (std::string& name : description.model_instances) {
+    name = in.ReadString();
+  }
+  description.bodies.resize(in.ReadSize(kMinElementBytes));
+  for (BodyDescription& body : description.bodies) {
+    body.name = in.ReadString();
+    body.model_instance = static_cast<int>(in.Read<int64_t>());
+    body.mass = in.Read<double>();
+    body.p_BoBcm_B = in.ReadVector<3>();
+    body.unit_inertia = in.ReadVector<6>();
+    if (in.Read<uint8_t>() != 0) {
+      body.default_free_pose = in.ReadPose();
+    }
+  }
+  description.joints.resize(in.ReadSize(kMinElementBytes));
+  for (JointDescription& joint : description.joints) {
+    joint.name = in.ReadString();
+    joint.type = in.ReadString();
+    joint.parent_body = static_cast<int>(in.Read<int64_t>());
+    joint.child_body = static_cast<int>(in.Read<int64_t>());
+    joint.X_PF = in.ReadPose();
+    joint.X_CM = in.ReadPose();
+    joint.axis = in.ReadVector<3>();
+    joint.damping = in.Read<double>();
+    joint.X_FM = in.ReadPose();
+    for (Eigen::VectorXd* limits :
+         {&joint.position_lower_limits, &joint.position_upper_limits,
+          &joint.velocity_lower_limits, &joint.velocity_upper_limits,
+          &joint.acceleration_lower_limits, &joint.acceleration_upper_limits,
+          &joint.default_positions}) {
+      *limits = in.ReadVector<Eigen::Dynamic>();
+    }
+  }
+  description.actuators.resize(in.ReadSize(kMinElementBytes));
+  for (ActuatorDescription& actuator : description.actuators) {
+    actuator.name = in.ReadString();
+    actuator.joint_name = in.ReadString();
+    actuator.model_instance = static_cast<int>(in.Read<int64_t>());
+    actuator.effort_limit = in.Read<double>();
+    actuator.rotor_inertia = in.Read<double>();
+    actuator.gear_ratio = in.Read<double>();
+    if (in.Read<uint8_t>() != 0) {
+      actuator.controller_gains = in.ReadVector<2>();
+    }
+  }
+  description.gravity = in.ReadVector<3>();
+  if (!in.at_end()) {
+    Reader::Fail();
+  }
+  return description;
+}
+
+ModelDescription ParseModelDescription(const std::string& path) {
+  MultibodyPlant<double> plant(0.0);
+  drake::multibody::Parser(&plant).AddModels(path);
+  plant.Finalize();
+  return DescribePlant(plant);
+}
+
+ModelCache::ModelCache(std::string directory)
+    : directory_(std::move(directory)) {
+  if (!directory_.empty()) {
+    std::filesystem::create_directories(directory_);
+  }
+}
+
+ModelCache::~ModelCache() = default;
+
+std::shared_ptr<const ModelDescription> ModelCache::GetDescription(
+    const std::string& path) {
+  const std::string canonical = std::filesystem::canonical(path).string();
+  const auto modified = static_cast<int64_t>(
+      std::filesystem::last_write_time(canonical).time_since_epoch().count());
+  const auto size =
+      static_cast<uint64_t>(std::filesystem::file_size(canonical));
+
+  // Either finds the file's description, ready or in flight, or puts one in
+  // flight, for this thread to produce.
+  std::promise<std::shared_ptr<const ModelDescription>> promise;
+  std::shared_future<std::shared_ptr<const ModelDescription>> in_flight;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto found = entries_.find(canonical);
+    if (found != entries_.end() && found->second.modified == modified &&
+        found->second.size == size) {
+      ++statistics_.memory_hits;
+      in_flight = found->second.description;
+    } else {
+      entries_.insert_or_assign(
+          canonical, Entry{modified, size, promise.get_future().share()});
+    }
+  }
+  if (in_flight.valid()) {
+    // Waits for the thread that produces it, if need be, and rethrows what
+    // it threw.
+    return in_flight.get();
+  }
+
+  std::shared_ptr<const ModelDescription> description;
+  try {
+    description = std::make_shared<const ModelDescription>(
+        ReadOrParse(canonical, modified, size));
+  } catch (...) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto found = entries_.find(canonical);
+      // Unless the file has changed, and another thread put its own
+      // description in flight since.
+      if (found != entries_.end() && found->second.modified == modified &&
+          found->second.size == size) {
+        entries_.erase(found);
+      }
+    }
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+  promise.set_value(description);
+  return description;
+}
+
+ModelDescription ModelCache::ReadOrParse(const std::string& canonical,
+                                         int64_t modified, uint64_t size) {
+  std::string file;
+  if (!directory_.empty()) {
+    const std::string key = canonical + "\n" + std::to_string(modified) +
+                            "\n" + std::to_string(size);
+    file = directory_ + "/" + drake::Sha256::Checksum(key).to_string() +
+           std::string(kSuffix);
+    if (std::optional<ModelDescription> description = ReadFromDisk(file)) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++statistics_.disk_loads;
+      return std::move(*description);
+    }
+  }
+  ModelDescription description = ParseModelDescription(canonical);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++statistics_.parses;
+  }
+  if (!file.empty()) {
+    WriteToDisk(file, description);
+  }
+  return description;
+}
+
+std::unique_ptr<MultibodyPlant<double>> ModelCache::Load(
+    const std::string& path, double time_step) {
+  return BuildPlant(*GetDescription(path), time_step);
+}
+
+ModelCacheStatistics ModelCache::statistics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return statistics_;
+}
+
+std::optional<ModelDescription> ModelCache::ReadFromDisk(
+    const std::string& file) const {
+  const std::optional<std::string> bytes = ReadFile(file);
+  if (!bytes.has_value()) {
+    return std::nullopt;
+  }
+  try {
+    return DeserializeModelDescription(*bytes);
+  } catch (const std::exception&) {
+    // Parsed again, and replaced.
+    return std::nullopt;
+  }
+}
+
+void ModelCache::WriteToDisk(const std::string& file,
+                             const ModelDescription& description) const {
+  const std::string bytes = SerializeModelDescription(description);
+  const std::string temporary =
+      file + ".tmp." + std::to_string(getpid()) + "." +
+      std::to_string(g_num_temporaries.fetch_add(1, std::memory_order_relaxed));
+  {
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    if (!out.flush()) {
+      std::filesystem::remove(temporary);
+      throw std::runtime_error("Could not write " + temporary);
+    }
+  }
+  std::filesystem::rename(temporary, file);
+}
+
+}  // namespace model_cache
+}  // namespace drake_external_examples
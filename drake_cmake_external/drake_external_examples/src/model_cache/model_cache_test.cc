@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "model_cache.h"  // IWYU pragma: associated
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/common/find_resource.h>
+#include <drake/common/temp_directory.h>
+#include <drake/multibody/parsing/parser.h>
+#include <drake/multibody/tree/prismatic_joint.h>
+#include <drake/multibody/tree/revolute_joint.h>
+
+namespace drake_external_examples {
+namespace model_cache {
+namespace {
+
+using drake::math::RigidTransformd;
+using drake::multibody::MultibodyPlant;
+using drake::multibody::Parser;
+using drake::multibody::PrismaticJoint;
+using drake::multibody::RevoluteJoint;
+using drake::multibody::SpatialInertia;
+
+// A one-link pendulum, whose link has the given mass.
+std::string MakeUrdf(double mass) {
+  return R"""(<?xml version="1.0"?>
+<robot name="pendulum">
+  <link name="arm">
+    <inertial>
+      <origin xyz="0 0 -0.5"/>
+      <mass value=")""" +
+         std::to_string(mass) + R"""("/>
+      <inertia ixx="0.01" ixy="0" ixz="0" iyy="0.01" iyz="0" izz="0.01"/>
+    </inertial>
+  </link>
+  <joint name="theta" type="revolute">
+    <parent link="world"/>
+    <child link="arm"/>
+    <axis xyz="0 1 0"/>
+    <limit lower="-2" upper="2" effort="10" velocity="5"/>
+    <dynamics damping="0.1"/>
+  </joint>
+  <transmission type="SimpleTransmission" name="theta_transmission">
+    <actuator name="tau"/>
+    <joint name="theta"/>
+  </transmission>
+</robot>
+)""";
+}
+
+// Expects the two plants to have the same dynamics at a few configurations.
+void ExpectSameDynamics(const MultibodyPlant<double>& expected,
+                        const MultibodyPlant<double>& actual) {
+  ASSERT_EQ(actual.num_bodies(), expected.num_bodies());
+  ASSERT_EQ(actual.num_joints(), expected.num_joints());
+  ASSERT_EQ(actual.num_actuators(), expected.num_actuators());
+  ASSERT_EQ(actual.num_positions(), expected.num_positions());
+  ASSERT_EQ(actual.num_velocities(), expected.num_velocities());
+  auto expected_context = expected.CreateDefaultContext();
+  auto actual_context = actual.CreateDefaultContext();
+  EXPECT_EQ(actual.GetPositions(*actual_context),
+            expected.GetPositions(*expected_context));
+  for (const double angle : {0.0, 0.3, -1.2}) {
+    const Eigen::VectorXd q =
+        expected.GetPositions(*expected_context).array() + angle;
+    expected.SetPositions(expected_context.get(), q);
+    actual.SetPositions(actual_context.get(), q);
+    Eigen::MatrixXd expected_mass(expected.num_velocities(),
+                                  expected.num_velocities());
+    Eigen::MatrixXd actual_mass(actual.num_velocities(),
+                                actual.num_velocities());
+    expected.CalcMassMatrix(*expected_context, &expected_mass);
+    actual.CalcMassMatrix(*actual_context, &actual_mass);
+    EXPECT_TRUE(actual_mass.isApprox(expected_mass, 1e-14));
+    EXPECT_TRUE(actual.CalcGravityGeneralizedForces(*actual_context)
+                    .isApprox(expected.CalcGravityGeneralizedForces(
+                                  *expected_context),
+                              1e-14));
+  }
+}
+
+// A new temporary directory for the duration of a test.
+class ModelCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override { WriteModel(1.0); }
+
+  // Writes the model, with the given mass, and makes sure that its
+  // modification time differs from the last one's.
+  void WriteModel(double mass) {
+    std::ofstream(model_) << MakeUrdf(mass);
+    last_write_ += std::chrono::seconds(1);
+    std::filesystem::last_write_time(model_, last_write_);
+  }
+
+  int NumCachedFiles() const {
+    int count = 0;
+    for (const auto& file :
+         std::filesystem::directory_iterator(directory_ / "cache")) {
+      count += file.path().extension() == ".model";
+    }
+    return count;
+  }
+
+  const std::filesystem::path directory_{drake::temp_directory()};
+  const std::string model_{(directory_ / "pendulum.urdf").string()};
+  std::filesystem::file_time_type last_write_{
+      std::filesystem::file_time_type::clock::now()};
+};
+
+/// Makes sure a plant built from the description of a Drake example model has
+/// the same dynamics as the parsed one.
+TEST(ModelDescriptionTest, BuildsPendulum) {
+  const std::string path =
+      drake::FindResourceOrThrow("drake/examples/pendulum/Pendulum.urdf");
+  MultibodyPlant<double> parsed(0.0);
+  Parser(&parsed).AddModels(path);
+  parsed.Finalize();
+
+  const ModelDescription description = ParseModelDescription(path);
+  EXPECT_EQ(description.bodies.size(), parsed.num_bodies() - 1);
+  EXPECT_EQ(description.actuators.size(), parsed.num_actuators());
+  ExpectSameDynamics(parsed, *BuildPlant(description));
+  EXPECT_EQ(BuildPlant(description, 1e-3)->time_step(), 1e-3);
+}
+
+/// Makes sure a description holds everything it describes exactly, through
+/// serialization and through building a plant, including free bodies,
+/// prismatic joints and their limits, actuators, and gravity.
+TEST(ModelDescriptionTest, RoundTrips) {
+  MultibodyPlant<double> plant(0.0);
+  const auto instance = plant.AddModelInstance("slider");
+  const auto& cart = plant.AddRigidBody(
+      "cart", instance, SpatialInertia<double>::SolidBoxWithMass(2, 1, 1, 1));
+  const auto& pole = plant.AddRigidBody(
+      "pole", instance,
+      SpatialInertia<double>::PointMass(0.5, Eigen::Vector3d(0, 0, -1)));
+  const auto& ball = plant.AddRigidBody(
+      "ball", SpatialInertia<double>::SolidBoxWithMass(1, 0.1, 0.1, 0.1));
+  const auto& slider = plant.AddJoint<PrismaticJoint>(
+      "x", plant.world_body(), RigidTransformd(Eigen::Vector3d(0, 0, 1)),
+      cart, std::nullopt, Eigen::Vector3d::UnitX(), -1.0, 1.0, 0.5);
+  plant.AddJoint<RevoluteJoint>("theta", cart, std::nullopt, pole,
+                                std::nullopt, Eigen::Vector3d::UnitY(), 0.1);
+  plant.get_mutable_joint(slider.index())
+      .set_velocity_limits(drake::Vector1d(-3), drake::Vector1d(3));
+  plant.get_mutable_joint(slider.index())
+      .set_default_positions(drake::Vector1d(0.25));
+  auto& actuator = plant.get_mutable_joint_actuator(
+      plant.AddJointActuator("force", slider, 20.0).index());
+  actuator.set_default_rotor_inertia(0.01);
+  actuator.set_default_gear_ratio(4.0);
+  plant.SetDefaultFreeBodyPose(ball,
+                               RigidTransformd(Eigen::Vector3d(1, 2, 3)));
+  plant.mutable_gravity_field().set_gravity_vector(Eigen::Vector3d(0, 0, -3.7));
+  plant.Finalize();
+
+  const ModelDescription description = DescribePlant(plant);
+  ASSERT_EQ(description.bodies.size(), 3);
+  EXPECT_FALSE(description.bodies[0].default_free_pose.has_value());
+  ASSERT_TRUE(description.bodies[2].default_free_pose.has_value());
+  // The free body's floating joint is left to Finalize().
+  ASSERT_EQ(description.joints.size(), 2);
+  EXPECT_EQ(description.joints[0].type, "prismatic");
+  EXPECT_EQ(description.joints[1].type, "revolute");
+
+  const std::string bytes = SerializeModelDescription(description);
+  EXPECT_EQ(SerializeModelDescription(DeserializeModelDescription(bytes)),
+            bytes);
+  const auto built = BuildPlant(description);
+  EXPECT_EQ(SerializeModelDescription(DescribePlant(*built)), bytes);
+  ExpectSameDynamics(plant, *built);
+}
+
+/// Makes sure that malformed descriptions and unfinalized plants are
+/// rejected.
+TEST(ModelDescriptionTest, Throws) {
+  MultibodyPlant<double> plant(0.0);
+  EXPECT_THROW(DescribePlant(plant), std::logic_error);
+  plant.Finalize();
+  const std::string bytes =
+      SerializeModelDescription(DescribePlant(plant));
+  EXPECT_THROW(DeserializeModelDescription(""), std::runtime_error);
+  EXPECT_THROW(DeserializeModelDescription("DEEMODL1 and more"),
+               std::runtime_error);
+  EXPECT_THROW(DeserializeModelDescription(bytes.substr(0, bytes.size() - 1)),
+               std::runtime_error);
+  EXPECT_THROW(DeserializeModelDescription(bytes + "x"), std::runtime_error);
+}
+
+/// Makes sure a file is parsed once per process, and once for all caches that
+/// share a directory.
+TEST_F(ModelCacheTest, ParsesOnce) {
+  const std::string directory = (directory_ / "cache").string();
+  ModelCache cache(directory);
+  const auto first = cache.Load(model_);
+  const auto second = cache.Load(model_, 1e-3);
+  EXPECT_EQ(cache.statistics().parses, 1);
+  EXPECT_EQ(cache.statistics().memory_hits, 1);
+  EXPECT_EQ(second->time_step(), 1e-3);
+  ExpectSameDynamics(*first, *second);
+  EXPECT_EQ(NumCachedFiles(), 1);
+
+  // E.g., in another worker.
+  ModelCache other(directory);
+  ExpectSameDynamics(*first, *other.Load(model_));
+  EXPECT_EQ(other.statistics().parses, 0);
+  EXPECT_EQ(other.statistics().disk_loads, 1);
+
+  // Without a directory, each cache parses.
+  ModelCache in_memory;
+  in_memory.Load(model_);
+  EXPECT_EQ(in_memory.statistics().parses, 1);
+  EXPECT_EQ(NumCachedFiles(), 1);
+}
+
+/// Makes sure a file that changes is parsed again, in memory and on disk.
+TEST_F(ModelCacheTest, ParsesChangedFile) {
+  const std::string directory = (directory_ / "cache").string();
+  ModelCache cache(directory);
+  EXPECT_EQ(cache.GetDescription(model_)->bodies[0].mass, 1.0);
+  WriteModel(3.0);
+  EXPECT_EQ(cache.GetDescription(model_)->bodies[0].mass, 3.0);
+  EXPECT_EQ(cache.statistics().parses, 2);
+  EXPECT_EQ(NumCachedFiles(), 2);
+
+  ModelCache other(directory);
+  EXPECT_EQ(other.GetDescription(model_)->bodies[0].mass, 3.0);
+  EXPECT_EQ(other.statistics().disk_loads, 1);
+}
+
+/// Makes sure a corrupt description on disk is parsed again and replaced.
+TEST_F(ModelCacheTest, ReplacesCorruptFile) {
+  const std::string directory = (directory_ / "cache").string();
+  ModelCache(directory).Load(model_);
+  for (const auto& file :
+       std::filesystem::directory_iterator(directory_ / "cache")) {
+    std::ofstream(file.path(), std::ios::trunc) << "DEEMODL1";
+  }
+
+  ModelCache cache(directory);
+  EXPECT_EQ(cache.GetDescription(model_)->bodies[0].mass, 1.0);
+  EXPECT_EQ(cache.statistics().parses, 1);
+  ModelCache other(directory);
+  other.Load(model_);
+  EXPECT_EQ(other.statistics().disk_loads, 1);
+}
+
+/// Makes sure a file that cannot be parsed leaves nothing behind, so that it
+/// is parsed again, and loads once it is fixed.
+TEST_F(ModelCacheTest, FailedParseIsNotKept) {
+  std::ofstream(model_, std::ios::trunc) << "<robot name=";
+  ModelCache cache((directory_ / "cache").string());
+  EXPECT_THROW(cache.GetDescription(model_), std::exception);
+  EXPECT_THROW(cache.GetDescription(model_), std::exception);
+  EXPECT_EQ(cache.statistics().memory_hits, 0);
+  EXPECT_EQ(cache.statistics().parses, 0);
+  EXPECT_EQ(NumCachedFiles(), 0);
+
+  WriteModel(2.0);
+  EXPECT_EQ(cache.GetDescription(model_)->bodies[0].mass, 2.0);
+  EXPECT_EQ(cache.statistics().parses, 1);
+}
+
+/// Makes sure files loaded by many threads at once are each parsed once, and
+/// that every thread gets the same description.
+TEST_F(ModelCacheTest, LoadsConcurrently) {
+  const std::string other_model = (directory_ / "other.urdf").string();
+  std::ofstream(other_model) << MakeUrdf(5.0);
+  ModelCache cache((directory_ / "cache").string());
+  constexpr int kNumThreads = 8;
+  std::vector<std::shared_ptr<const ModelDescription>> descriptions(
+      kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      descriptions[i] = cache.GetDescription(i % 2 == 0 ? model_ : other_model);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(cache.statistics().parses, 2);
+  EXPECT_EQ(cache.statistics().memory_hits, kNumThreads - 2);
+  for (int i = 0; i < kNumThreads; ++i) {
+    EXPECT_EQ(descriptions[i], descriptions[i % 2]);
+  }
+  EXPECT_EQ(descriptions[0]->bodies[0].mass, 1.0);
+  EXPECT_EQ(descriptions[1]->bodies[0].mass, 5.0);
+}
+
+/// Makes sure a missing file is an error, and is not cached.
+TEST_F(ModelCacheTest, ThrowsOnMissingFile) {
+  ModelCache cache((directory_ / "cache").string());
+  EXPECT_THROW(cache.Load((directory_ / "missing.urdf").string()),
+               std::exception);
+  EXPECT_EQ(NumCachedFiles(), 0);
+}
+
+}  // namespace
+}  // namespace model_cache
+}  // namespace drake_external_examples
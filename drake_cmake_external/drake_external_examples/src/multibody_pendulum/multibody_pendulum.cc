@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "multibody_pendulum.h"
+
+#include <string>
+
+#include <drake/common/drake_throw.h>
+#include <drake/common/find_resource.h>
+#include <drake/multibody/parsing/parser.h>
+#include <drake/multibody/tree/revolute_joint.h>
+
+namespace drake_external_examples {
+namespace multibody_pendulum {
+
+using drake::math::RigidTransformd;
+using drake::multibody::MultibodyPlant;
+using drake::multibody::RevoluteJoint;
+using drake::multibody::RigidBody;
+using drake::multibody::SpatialInertia;
+
+std::unique_ptr<MultibodyPlant<double>> MakeUrdfPendulum(double time_step) {
+  auto plant = std::make_unique<MultibodyPlant<double>>(time_step);
+  drake::multibody::Parser(plant.get())
+      .AddModels(
+          drake::FindResourceOrThrow("drake/examples/pendulum/Pendulum.urdf"));
+  plant->Finalize();
+  return plant;
+}
+
+std::unique_ptr<MultibodyPlant<double>> MakePendulumChain(int num_links,
+                                                          double time_step,
+                                                          double link_length,
+                                                          double link_mass) {
+  DRAKE_THROW_UNLESS(num_links > 0);
+  DRAKE_THROW_UNLESS(time_step >= 0.0);
+  DRAKE_THROW_UNLESS(link_length > 0.0);
+  DRAKE_THROW_UNLESS(link_mass > 0.0);
+  auto plant = std::make_unique<MultibodyPlant<double>>(time_step);
+  // Each link's frame is at its joint, and its mass at the end of its rod.
+  const Eigen::Vector3d p_LoLend_L(0.0, 0.0, -link_length);
+  const RigidBody<double>* parent = &plant->world_body();
+  for (int i = 0; i < num_links; ++i) {
+    const std::string index = std::to_string(i);
+    const RigidBody<double>& link = plant->AddRigidBody(
+        "link_" + index,
+        SpatialInertia<double>::PointMass(link_mass, p_LoLend_L));
+    plant->AddJoint<RevoluteJoint>(
+        "joint_" + index, *parent,
+        i == 0 ? RigidTransformd() : RigidTransformd(p_LoLend_L), link,
+        std::nullopt, Eigen::Vector3d::UnitY());
+    parent = &link;
+  }
+  plant->Finalize();
+  return plant;
+}
+
+BatchEvaluator::BatchEvaluator(const MultibodyPlant<double>* plant,
+                               int batch_size, int num_threads)
+    : plant_(*plant),
+      pool_(std::make_unique<parallel::ThreadPool>(num_threads)) {
+  DRAKE_THROW_UNLESS(plant->is_finalized());
+  DRAKE_THROW_UNLESS(batch_size >= 0);
+  for (int i = 0; i < batch_size; ++i) {
+    contexts_.push_back(plant_.CreateDefaultContext());
+  }
+  for (int thread = 0; thread < pool_->num_threads(); ++thread) {
+    if (plant_.is_discrete()) {
+      updates_.push_back(plant_.AllocateDiscreteVariables());
+    } else {
+      derivatives_.push_back(plant_.AllocateTimeDerivatives());
+    }
+  }
+  dynamics_.resize(plant_.num_multibody_states(), batch_size);
+}
+
+BatchEvaluator::~BatchEvaluator() = default;
+
+void BatchEvaluator::SetStates(
+    const Eigen::Ref<const Eigen::MatrixXd>& states) {
+  DRAKE_THROW_UNLESS(states.rows() == plant_.num_multibody_states());
+  DRAKE_THROW_UNLESS(states.cols() == batch_size());
+  pool_->ParallelFor(batch_size(), [&](int64_t i, int) {
+    plant_.SetPositionsAndVelocities(contexts_[i].get(), states.col(i));
+  });
+}
+
+const Eigen::MatrixXd& BatchEvaluator::CalcDynamics() {
+  const int num_states = plant_.num_multibody_states();
+  pool_->ParallelFor(batch_size(), [&](int64_t i, int thread) {
+    if (plant_.is_discrete()) {
+      plant_.CalcForcedDiscreteVariableUpdate(*contexts_[i],
+                                              updates_[thread].get());
+      // The plant's only discrete state group is [q, v].
+      dynamics_.col(i) = updates_[thread]->value().head(num_states);
+    } else {
+      plant_.CalcTimeDerivatives(*contexts_[i], derivatives_[thread].get());
+      dynamics_.col(i) = derivatives_[thread]->CopyToVector();
+    }
+  });
+  return dynamics_;
+}
+
+}  // namespace multibody_pendulum
+}  // namespace drake_external_examples
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/multibody/plant/multibody_plant.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/framework/discrete_values.h>
+
+#include "thread_pool/thread_pool.h"
+
+namespace drake_external_examples {
+namespace multibody_pendulum {
+
+/// Returns a finalized plant of the pendulum in Drake's
+/// `drake/examples/pendulum/Pendulum.urdf`, continuous if @p time_step is
+/// zero, and otherwise discrete with that time step, in @f$ s @f$ units.
+/// Its actuation input is left unconnected, i.e., zero.
+/// @throws std::exception if the resource cannot be found or parsed.
+std::unique_ptr<drake::multibody::MultibodyPlant<double>> MakeUrdfPendulum(
+    double time_step = 0.0);
+
+/// Returns a finalized plant of a planar chain of @p num_links pendulums,
+/// each a point mass of @p link_mass at the end of a massless rod of
+/// @p link_length, hanging from the previous one by a revolute joint about
+/// the y axis; the first hangs from the world. Positions are the joint
+/// angles, zero hanging straight down. The chain is continuous if
+/// @p time_step is zero, and otherwise discrete with that time step.
+/// @throws std::exception if @p num_links, @p link_length or @p link_mass is
+///   not positive, or @p time_step is negative.
+std::unique_ptr<drake::multibody::MultibodyPlant<double>> MakePendulumChain(
+    int num_links, double time_step = 0.0, double link_length = 1.0,
+    double link_mass = 1.0);
+
+/// Evaluates the dynamics of one plant at a batch of states, one context per
+/// state, on a pool of threads: the time derivatives ẋ of a continuous plant,
+/// or the next state x⁺ of a discrete one, for each state x = [q, v].
+///
+/// The plant is shared by all threads, as Drake allows for const evaluations
+/// with separate contexts; each thread has its own output scratch.
+class BatchEvaluator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchEvaluator);
+
+  /// Creates @p batch_size default contexts of @p plant, which is aliased
+  /// and must outlive this, evaluated on @p num_threads threads; values less
+  /// than 1 mean all cores.
+  /// @throws std::exception if @p plant is not finalized, or @p batch_size
+  ///   is negative.
+  BatchEvaluator(const drake::multibody::MultibodyPlant<double>* plant,
+                 int batch_size, int num_threads = 1);
+
+  ~BatchEvaluator();
+
+  int batch_size() const { return static_cast<int>(contexts_.size()); }
+  int num_threads() const { return pool_->num_threads(); }
+  const drake::multibody::MultibodyPlant<double>& plant() const {
+    return plant_;
+  }
+
+  /// Returns the context of the state @p index.
+  const drake::systems::Context<double>& context(int index) const {
+    return *contexts_.at(index);
+  }
+
+  /// Sets the states, one per column of @p states.
+  /// @throws std::exception unless @p states has one row per position and
+  ///   velocity of the plant, and batch_size() columns.
+  void SetStates(const Eigen::Ref<const Eigen::MatrixXd>& states);
+
+  /// Evaluates the dynamics at every state, and returns them, one column per
+  /// state: ẋ for a continuous plant, x⁺ for a discrete one.
+  const Eigen::MatrixXd& CalcDynamics();
+
+ private:
+  const drake::multibody::MultibodyPlant<double>& plant_;
+  const std::unique_ptr<parallel::ThreadPool> pool_;
+  std::vector<std::unique_ptr<drake::systems::Context<double>>> contexts_;
+  // Scratch for each thread.
+  std::vector<std::unique_ptr<drake::systems::ContinuousState<double>>>
+      derivatives_;
+  std::vector<std::unique_ptr<drake::systems::DiscreteValues<double>>>
+      updates_;
+  Eigen::MatrixXd dynamics_;
+};
+
+}  // namespace multibody_pendulum
+}  // namespace drake_external_examples
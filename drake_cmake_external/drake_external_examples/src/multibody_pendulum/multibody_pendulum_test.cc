@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "multibody_pendulum.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <exception>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+namespace drake_external_examples {
+namespace multibody_pendulum {
+namespace {
+
+using drake::multibody::MultibodyPlant;
+
+/// Makes sure a chain of one link is a simple pendulum, θ̈ = −(g / l) sin θ.
+TEST(MakePendulumChainTest, OneLinkIsSimplePendulum) {
+  const double length = 0.5;
+  const auto plant = MakePendulumChain(1, 0.0, length, 2.0);
+  ASSERT_EQ(plant->num_positions(), 1);
+  ASSERT_EQ(plant->num_velocities(), 1);
+  const double g = plant->gravity_field().gravity_vector().norm();
+  auto context = plant->CreateDefaultContext();
+  auto derivatives = plant->AllocateTimeDerivatives();
+  for (const double theta : {0.0, 0.4, -2.0}) {
+    plant->SetPositionsAndVelocities(context.get(),
+                                     Eigen::Vector2d(theta, 0.7));
+    plant->CalcTimeDerivatives(*context, derivatives.get());
+    EXPECT_NEAR((*derivatives)[0], 0.7, 1e-14);
+    EXPECT_NEAR((*derivatives)[1], -g / length * std::sin(theta), 1e-12);
+  }
+}
+
+/// Makes sure the mass matrix of a chain of two links is the textbook one,
+/// m l² [3 + 2 cos θ₂, 1 + cos θ₂; 1 + cos θ₂, 1] for equal links.
+TEST(MakePendulumChainTest, TwoLinkMassMatrix) {
+  const double length = 1.5;
+  const double mass = 0.5;
+  const auto plant = MakePendulumChain(2, 0.0, length, mass);
+  auto context = plant->CreateDefaultContext();
+  Eigen::MatrixXd mass_matrix(2, 2);
+  for (const double theta2 : {0.0, 1.0, 3.0}) {
+    plant->SetPositions(context.get(), Eigen::Vector2d(0.3, theta2));
+    plant->CalcMassMatrix(*context, &mass_matrix);
+    Eigen::Matrix2d expected;
+    expected << 3 + 2 * std::cos(theta2), 1 + std::cos(theta2),
+        1 + std::cos(theta2), 1;
+    expected *= mass * length * length;
+    EXPECT_TRUE(mass_matrix.isApprox(expected, 1e-14));
+  }
+}
+
+/// Makes sure a chain has as many degrees of freedom as links.
+TEST(MakePendulumChainTest, Sizes) {
+  for (const int num_links : {1, 10, 100}) {
+    const auto plant = MakePendulumChain(num_links);
+    EXPECT_EQ(plant->num_positions(), num_links);
+    EXPECT_EQ(plant->num_velocities(), num_links);
+    EXPECT_EQ(plant->num_joints(), num_links);
+  }
+  EXPECT_THROW(MakePendulumChain(0), std::exception);
+  EXPECT_THROW(MakePendulumChain(1, -1.0), std::exception);
+  EXPECT_THROW(MakePendulumChain(1, 0.0, 0.0), std::exception);
+  EXPECT_THROW(MakePendulumChain(1, 0.0, 1.0, 0.0), std::exception);
+}
+
+/// Makes sure the discrete URDF pendulum has the continuous one's mass
+/// matrix, and that a short step of it agrees with the continuous one's
+/// derivatives to first order.
+TEST(MakeUrdfPendulumTest, DiscreteMatchesContinuous) {
+  constexpr double kTimeStep = 1e-4;
+  const auto continuous = MakeUrdfPendulum();
+  const auto discrete = MakeUrdfPendulum(kTimeStep);
+  ASSERT_FALSE(continuous->is_discrete());
+  ASSERT_TRUE(discrete->is_discrete());
+  ASSERT_EQ(continuous->num_multibody_states(), 2);
+  ASSERT_EQ(discrete->num_multibody_states(), 2);
+
+  const Eigen::Vector2d state(0.6, -0.2);
+  auto continuous_context = continuous->CreateDefaultContext();
+  auto discrete_context = discrete->CreateDefaultContext();
+  continuous->SetPositionsAndVelocities(continuous_context.get(), state);
+  discrete->SetPositionsAndVelocities(discrete_context.get(), state);
+
+  Eigen::MatrixXd continuous_mass(1, 1);
+  Eigen::MatrixXd discrete_mass(1, 1);
+  continuous->CalcMassMatrix(*continuous_context, &continuous_mass);
+  discrete->CalcMassMatrix(*discrete_context, &discrete_mass);
+  EXPECT_EQ(continuous_mass, discrete_mass);
+
+  BatchEvaluator continuous_batch(continuous.get(), 1);
+  BatchEvaluator discrete_batch(discrete.get(), 1);
+  continuous_batch.SetStates(state);
+  discrete_batch.SetStates(state);
+  const Eigen::Vector2d euler =
+      state + kTimeStep * continuous_batch.CalcDynamics().col(0);
+  // The step is first-order accurate.
+  EXPECT_TRUE(discrete_batch.CalcDynamics().col(0).isApprox(euler, 1e-6));
+}
+
+/// Makes sure a batch evaluated on several threads matches each state
+/// evaluated alone, for continuous and discrete plants.
+TEST(BatchEvaluatorTest, MatchesSerial) {
+  constexpr int kBatchSize = 37;
+  for (const double time_step : {0.0, 1e-3}) {
+    const auto plant = MakePendulumChain(5, time_step);
+    BatchEvaluator batch(plant.get(), kBatchSize, 4);
+    EXPECT_EQ(batch.batch_size(), kBatchSize);
+    EXPECT_EQ(batch.num_threads(), 4);
+    const Eigen::MatrixXd states =
+        Eigen::MatrixXd::Random(plant->num_multibody_states(), kBatchSize);
+    batch.SetStates(states);
+    const Eigen::MatrixXd dynamics = batch.CalcDynamics();
+    ASSERT_EQ(dynamics.cols(), kBatchSize);
+
+    BatchEvaluator serial(plant.get(), 1);
+    for (int i = 0; i < kBatchSize; ++i) {
+      EXPECT_EQ(plant->GetPositionsAndVelocities(batch.context(i)),
+                states.col(i));
+      serial.SetStates(states.col(i));
+      EXPECT_EQ(serial.CalcDynamics().col(0), dynamics.col(i));
+    }
+  }
+}
+
+/// Makes sure invalid arguments are rejected.
+TEST(BatchEvaluatorTest, Throws) {
+  const auto plant = MakePendulumChain(2);
+  EXPECT_THROW(BatchEvaluator(plant.get(), -1), std::exception);
+  BatchEvaluator batch(plant.get(), 3);
+  EXPECT_THROW(batch.SetStates(Eigen::MatrixXd::Zero(4, 2)), std::exception);
+  EXPECT_THROW(batch.SetStates(Eigen::MatrixXd::Zero(3, 3)), std::exception);
+  MultibodyPlant<double> unfinalized(0.0);
+  EXPECT_THROW(BatchEvaluator(&unfinalized, 1), std::exception);
+}
+
+}  // namespace
+}  // namespace multibody_pendulum
+}  // namespace drake_external_examples
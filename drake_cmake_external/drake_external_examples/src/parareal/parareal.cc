@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "parareal.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include <drake/systems/analysis/integrator_base.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/continuous_state.h>
+
+#include "thread_pool/thread_pool.h"
+
+namespace drake_external_examples {
+namespace parareal {
+namespace {
+
+using drake::systems::Context;
+using drake::systems::ContinuousState;
+using drake::systems::Simulator;
+using drake::systems::System;
+
+// Fixed-step explicit Euler over [t0, t1], with scratch storage owned by the
+// caller so that the serial coarse sweeps do not allocate.
+class CoarsePropagator {
+ public:
+  CoarsePropagator(const System<double>& system,
+                   const Context<double>& initial_context, int num_steps)
+      : system_(system),
+        context_(initial_context.Clone()),
+        derivatives_(system.AllocateTimeDerivatives()),
+        num_steps_(num_steps) {}
+
+  Eigen::VectorXd Propagate(const Eigen::VectorXd& x0, double t0,
+                            double t1) {
+    const double h = (t1 - t0) / num_steps_;
+    Eigen::VectorXd x = x0;
+    for (int i = 0; i < num_steps_; ++i) {
+      context_->SetTime(t0 + i * h);
+      context_->SetContinuousState(x);
+      system_.CalcTimeDerivatives(*context_, derivatives_.get());
+      x += h * derivatives_->CopyToVector();
+    }
+    return x;
+  }
+
+ private:
+  const System<double>& system_;
+  const std::unique_ptr<Context<double>> context_;
+  const std::unique_ptr<ContinuousState<double>> derivatives_;
+  const int num_steps_;
+};
+
+}  // namespace
+
+PararealResult RunParareal(const System<double>& system,
+                           const Context<double>& initial_context,
+                           double t_final, const PararealOptions& options) {
+  const double t0 = initial_context.get_time();
+  const int num_slices = options.num_slices;
+  if (!(t_final > t0)) {
+    throw std::logic_error("RunParareal: t_final must be after the start");
+  }
+  if (num_slices < 1 || options.coarse_steps_per_slice < 1 ||
+      !(options.tolerance >= 0.0)) {
+    throw std::logic_error("RunParareal: invalid options");
+  }
+  const int max_iterations =
+      std::clamp(options.max_iterations.value_or(num_slices), 1, num_slices);
+  auto slice_time = [&](int n) {
+    return (n == num_slices) ? t_final
+                             : t0 + (t_final - t0) * n / num_slices;
+  };
+
+  // One fine Simulator per thread, reused across slices and iterations.
+  parallel::ThreadPool pool(options.num_threads);
+  std::vector<std::unique_ptr<Simulator<double>>> fine(pool.num_threads());
+  for (auto& simulator : fine) {
+    simulator = std::make_unique<Simulator<double>>(system,
+                                                    initial_context.Clone());
+    drake::systems::IntegratorBase<double>& integrator =
+        simulator->get_mutable_integrator();
+    if (options.fine_target_accuracy.has_value()) {
+      integrator.set_target_accuracy(*options.fine_target_accuracy);
+    }
+    if (options.fine_max_step_size.has_value()) {
+      integrator.set_maximum_step_size(*options.fine_max_step_size);
+    }
+  }
+  CoarsePropagator coarse(system, initial_context,
+                          options.coarse_steps_per_slice);
+
+  // U[n] is the current estimate of the state at the start of slice n, and
+  // coarse_from[n] = G(U[n]) over slice n.
+  PararealResult result;
+  std::vector<Eigen::VectorXd>& U = result.boundary_states;
+  U.resize(num_slices + 1);
+  std::vector<Eigen::VectorXd> coarse_from(num_slices);
+  std::vector<Eigen::VectorXd> fine_from(num_slices);
+  U[0] = initial_context.get_continuous_state_vector().CopyToVector();
+  for (int n = 0; n < num_slices; ++n) {
+    coarse_from[n] = coarse.Propagate(U[n], slice_time(n), slice_time(n + 1));
+    U[n + 1] = coarse_from[n];
+  }
+
+  for (int k = 0; k < max_iterations; ++k) {
+    // Fine solves of the slices that are not yet exact, in parallel.
+    pool.ParallelFor(num_slices - k, [&](int64_t index, int thread) {
+      const int n = k + static_cast<int>(index);
+      Simulator<double>& simulator = *fine[thread];
+      Context<double>& context = simulator.get_mutable_context();
+      context.SetTime(slice_time(n));
+      context.SetContinuousState(U[n]);
+      simulator.Initialize();
+      simulator.AdvanceTo(slice_time(n + 1));
+      fine_from[n] = context.get_continuous_state_vector().CopyToVector();
+    });
+
+    // The serial correction sweep. Slice k's fine solve started from an exact
+    // state, so U[k + 1] becomes exact too.
+    result.last_update =
+        (fine_from[k] - U[k + 1]).lpNorm<Eigen::Infinity>();
+    U[k + 1] = fine_from[k];
+    for (int n = k + 1; n < num_slices; ++n) {
+      const Eigen::VectorXd coarse_new =
+          coarse.Propagate(U[n], slice_time(n), slice_time(n + 1));
+      const Eigen::VectorXd corrected =
+          coarse_new + fine_from[n] - coarse_from[n];
+      result.last_update = std::max(
+          result.last_update, (corrected - U[n + 1]).lpNorm<Eigen::Infinity>());
+      coarse_from[n] = coarse_new;
+      U[n + 1] = corrected;
+    }
+    result.iterations = k + 1;
+    if (result.last_update <= options.tolerance) {
+      break;
+    }
+  }
+  result.converged = (result.last_update <= options.tolerance);
+  result.final_state = U[num_slices];
+  return result;
+}
+
+}  // namespace parareal
+}  // namespace drake_external_examples
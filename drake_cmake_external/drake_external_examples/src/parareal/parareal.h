@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/system.h>
+
+namespace drake_external_examples {
+namespace parareal {
+
+/// Configures RunParareal().
+struct PararealOptions {
+  /// The number of equal time slices the horizon is split into. Fine solves
+  /// of different slices run concurrently, so this bounds the parallelism.
+  int num_slices{16};
+
+  /// The number of explicit Euler steps the coarse propagator takes per
+  /// slice.
+  int coarse_steps_per_slice{1};
+
+  /// Iteration stops once no slice boundary state changes by more than this
+  /// (in the infinity norm) between two iterations.
+  double tolerance{1e-8};
+
+  /// Iteration stops after this many iterations even if not converged. After
+  /// num_slices iterations the result equals the serial fine solution (up to
+  /// round-off), so larger values have no effect.
+  std::optional<int> max_iterations;
+
+  /// The number of threads running fine solves; values less than 1 mean all
+  /// cores.
+  int num_threads{1};
+
+  /// The target accuracy of the fine propagator's (error-controlled)
+  /// integrator; if unset, the Simulator default is used.
+  std::optional<double> fine_target_accuracy;
+
+  /// An optional maximum step size for the fine propagator's integrator.
+  std::optional<double> fine_max_step_size;
+};
+
+/// Reports the outcome of RunParareal().
+struct PararealResult {
+  /// The state at the end of the horizon.
+  Eigen::VectorXd final_state;
+  /// The states at the num_slices + 1 slice boundaries, starting with the
+  /// initial state.
+  std::vector<Eigen::VectorXd> boundary_states;
+  /// The number of parareal iterations (rounds of fine solves) performed.
+  int iterations{};
+  /// The largest change of a boundary state in the last iteration.
+  double last_update{};
+  /// Whether last_update reached PararealOptions::tolerance.
+  bool converged{};
+};
+
+/// Integrates the continuous state of @p system from @p initial_context to
+/// time @p t_final using the parareal parallel-in-time method.
+///
+/// The horizon is split into time slices. A cheap coarse propagator G
+/// (fixed-step explicit Euler) sweeps serially across all slices, while an
+/// accurate fine propagator F (a Simulator, with an error-controlled
+/// integrator) solves every slice concurrently from the current estimate of
+/// the slice's initial state. Each iteration then corrects the boundary
+/// states with U[n+1] = G(U[n]) + F(U_old[n]) - G(U_old[n]). This converges
+/// to the serial fine solution, usually in far fewer iterations than there
+/// are slices; each iteration costs one parallel round of fine solves plus a
+/// serial coarse sweep. After k iterations the first k slices are exact, so
+/// they are not solved again.
+///
+/// @p system must have only continuous state, and its inputs (if any) must
+/// be fixed in @p initial_context. The system must be safe to evaluate from
+/// several threads on separate contexts.
+///
+/// @throws std::exception if @p t_final is not after the initial time, or
+/// the options are invalid.
+PararealResult RunParareal(
+    const drake::systems::System<double>& system,
+    const drake::systems::Context<double>& initial_context, double t_final,
+    const PararealOptions& options);
+
+}  // namespace parareal
+}  // namespace drake_external_examples
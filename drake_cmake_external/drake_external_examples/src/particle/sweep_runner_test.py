@@ -0,0 +1,74 @@
+# SPDX-License-Identifier: MIT-0
+
+import unittest
+
+import numpy as np
+
+from sweep_runner import SweepRunner
+
+
+class TestSweepRunner(unittest.TestCase):
+    """A test case for sweeps of Particle rollouts on worker processes."""
+
+    def setUp(self):
+        generator = np.random.default_rng(seed=42)
+        self.initial_states = generator.uniform(-1.0, 1.0, size=(20, 2))
+        self.accelerations = generator.uniform(-2.0, 2.0, size=20)
+
+    def test_matches_closed_form(self):
+        """
+        Makes sure every rollout's samples match x(t) = x0 + v0 t + a t^2 / 2
+        and v(t) = v0 + a t, which the integrator follows exactly.
+        """
+        with SweepRunner(end_time=1.0, num_samples=11,
+                         num_workers=2) as runner:
+            samples = runner.run(self.initial_states, self.accelerations)
+            self.assertEqual(samples.shape, (20, 11, 2))
+            times = np.linspace(0.0, 1.0, 11)
+            for i in range(20):
+                x0, v0 = self.initial_states[i]
+                a = self.accelerations[i]
+                np.testing.assert_allclose(
+                    samples[i, :, 0], x0 + v0 * times + 0.5 * a * times**2,
+                    atol=1e-9)
+                np.testing.assert_allclose(
+                    samples[i, :, 1], v0 + a * times, atol=1e-9)
+            del samples
+
+    def test_independent_of_scheduling(self):
+        """
+        Makes sure the samples do not depend on how many workers run the
+        rollouts, or in what chunks; and that a runner can run several sweeps.
+        """
+        with SweepRunner(end_time=0.5, num_samples=6,
+                         num_workers=1) as runner:
+            expected = runner.run(
+                self.initial_states, self.accelerations).copy()
+        with SweepRunner(end_time=0.5, num_samples=6,
+                         num_workers=3) as runner:
+            for chunk_size in (1, 7, 20):
+                samples = runner.run(self.initial_states, self.accelerations,
+                                     chunk_size=chunk_size)
+                np.testing.assert_allclose(samples, expected, rtol=0.0,
+                                           atol=1e-12)
+                del samples
+
+    def test_rejects_bad_arguments(self):
+        """
+        Makes sure invalid times, sample counts and initial states are
+        rejected.
+        """
+        with self.assertRaises(ValueError):
+            SweepRunner(end_time=0.0, num_samples=10)
+        with self.assertRaises(ValueError):
+            SweepRunner(end_time=1.0, num_samples=0)
+        with SweepRunner(end_time=1.0, num_samples=2,
+                         num_workers=1) as runner:
+            with self.assertRaises(ValueError):
+                runner.run(self.initial_states[:, :1], self.accelerations)
+            with self.assertRaises(ValueError):
+                runner.run(self.initial_states[:5], self.accelerations)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "particle_mpc.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <exception>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <drake/solvers/osqp_solver.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/primitives/constant_vector_source.h>
+
+#include "particle/particle.h"
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+using drake::solvers::MathematicalProgramResult;
+using drake::solvers::OsqpSolver;
+using drake::systems::ConstantVectorSource;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+
+/// Makes sure a plan follows the particle's dynamics from the given state,
+/// keeps to the force limit, and that solving changes the program's data but
+/// not its structure.
+TEST(ParticleMpcTest, PlansFollowDynamics) {
+  // OSQP solves to about this accuracy, after polishing.
+  constexpr double kTolerance = 1e-4;
+  const MpcOptions options{.horizon = 10, .mass = 2.0, .max_force = 1.0};
+  ParticleMpc mpc(options);
+  const OsqpSolver solver;
+  const auto& prog = mpc.prog();
+  const int num_vars = prog.num_vars();
+  EXPECT_EQ(num_vars, mpc.plan_size());
+
+  const double h = options.time_step;
+  for (const double target : {0.1, 100.0}) {
+    const Eigen::Vector2d state(0.5, -0.25);
+    const MathematicalProgramResult result = mpc.Solve(
+        solver, state, Eigen::VectorXd::Constant(options.horizon, target));
+    ASSERT_TRUE(result.is_success());
+    const Eigen::VectorXd plan = result.GetSolution();
+    ASSERT_EQ(plan.size(), mpc.plan_size());
+    EXPECT_NEAR((plan.head(2) - state).norm(), 0.0, kTolerance);
+    for (int k = 0; k < options.horizon; ++k) {
+      const double p = plan[2 * k];
+      const double v = plan[2 * k + 1];
+      const double u = plan[2 * (options.horizon + 1) + k];
+      EXPECT_LE(std::abs(u), options.max_force + kTolerance);
+      EXPECT_NEAR(plan[2 * k + 2], p + h * v + h * h * u / (2 * options.mass),
+                  kTolerance);
+      EXPECT_NEAR(plan[2 * k + 3], v + h * u / options.mass, kTolerance);
+    }
+    EXPECT_EQ(mpc.GetForce(result), plan[2 * (options.horizon + 1)]);
+    // Far from the target, the force saturates.
+    if (target == 100.0) {
+      EXPECT_NEAR(mpc.GetForce(result), options.max_force, kTolerance);
+    }
+  }
+  EXPECT_EQ(prog.num_vars(), num_vars);
+  EXPECT_EQ(prog.linear_equality_constraints().size(), 1);
+  EXPECT_EQ(prog.bounding_box_constraints().size(), 2);
+  EXPECT_EQ(prog.quadratic_costs().size(), 1);
+}
+
+/// Makes sure a warm-started solve, from the shifted previous plan, finds the
+/// same plan as a cold one.
+TEST(ParticleMpcTest, WarmStartMatchesColdStart) {
+  const MpcOptions options;
+  ParticleMpc mpc(options);
+  const OsqpSolver solver;
+  const Eigen::VectorXd reference =
+      Eigen::VectorXd::Constant(options.horizon, 1.0);
+  const MathematicalProgramResult first =
+      mpc.Solve(solver, Eigen::Vector2d(0.0, 0.0), reference);
+  ASSERT_TRUE(first.is_success());
+  const Eigen::VectorXd guess = mpc.ShiftPlan(first.GetSolution());
+  const Eigen::Vector2d next_state = guess.head(2);
+  const MathematicalProgramResult warm =
+      mpc.Solve(solver, next_state, reference, &guess);
+  const MathematicalProgramResult cold =
+      mpc.Solve(solver, next_state, reference);
+  ASSERT_TRUE(warm.is_success());
+  ASSERT_TRUE(cold.is_success());
+  EXPECT_NEAR(mpc.GetForce(warm), mpc.GetForce(cold), 1e-3);
+}
+
+/// Makes sure shifting a plan moves each state and force a step earlier and
+/// repeats the last ones.
+TEST(ParticleMpcTest, ShiftPlan) {
+  const ParticleMpc mpc({.horizon = 3});
+  Eigen::VectorXd plan(mpc.plan_size());
+  // x₀..x₃, then u₀..u₂.
+  plan << 0, 1, 2, 3, 4, 5, 6, 7, 10, 11, 12;
+  Eigen::VectorXd expected(mpc.plan_size());
+  expected << 2, 3, 4, 5, 6, 7, 6, 7, 11, 12, 12;
+  EXPECT_EQ(mpc.ShiftPlan(plan), expected);
+}
+
+/// Makes sure the controller, closed around a Particle, brings it to the
+/// reference and holds it there.
+TEST(ParticleMpcControllerTest, ReachesReference) {
+  const MpcOptions options{.mass = 2.0};
+  DiagramBuilder<double> builder;
+  auto* particle = builder.AddSystem<Particle<double>>(options.mass);
+  auto* controller =
+      builder.AddSystem<ParticleMpcController>(options, OsqpSolver::id());
+  auto* reference = builder.AddSystem<ConstantVectorSource<double>>(
+      Eigen::VectorXd::Constant(options.horizon, 1.5));
+  builder.Connect(particle->get_output_port(0), controller->get_input_port(0));
+  builder.Connect(reference->get_output_port(), controller->get_input_port(1));
+  builder.Connect(controller->get_output_port(0), particle->get_input_port(0));
+  const auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.AdvanceTo(10.0);
+  const Eigen::VectorXd state =
+      particle->get_output_port(0).Eval(particle->GetMyContextFromRoot(
+          simulator.get_context()));
+  EXPECT_NEAR(state[0], 1.5, 1e-2);
+  EXPECT_NEAR(state[1], 0.0, 1e-2);
+}
+
+/// Makes sure invalid options and arguments are rejected.
+TEST(ParticleMpcTest, Throws) {
+  EXPECT_THROW(ParticleMpc({.time_step = 0.0}), std::exception);
+  EXPECT_THROW(ParticleMpc({.horizon = 0}), std::exception);
+  EXPECT_THROW(ParticleMpc({.max_force = 0.0}), std::exception);
+  EXPECT_THROW(ParticleMpc({.velocity_weight = -1.0}), std::exception);
+  ParticleMpc mpc({.horizon = 5});
+  EXPECT_THROW(mpc.Solve(OsqpSolver(), Eigen::Vector2d::Zero(),
+                         Eigen::VectorXd::Zero(4)),
+               std::exception);
+  EXPECT_THROW(mpc.ShiftPlan(Eigen::VectorXd::Zero(3)), std::exception);
+}
+
+}  // namespace
+}  // namespace particles
+}  // namespace drake_external_examples
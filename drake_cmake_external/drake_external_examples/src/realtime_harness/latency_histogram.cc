@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace drake_external_examples {
+namespace realtime {
+
+LatencyHistogram::LatencyHistogram(int64_t range_ns, int64_t bin_ns)
+    : bin_ns_(bin_ns) {
+  if (!(bin_ns > 0 && bin_ns <= range_ns)) {
+    throw std::logic_error("LatencyHistogram: need 0 < bin_ns <= range_ns");
+  }
+  bins_.resize((range_ns + bin_ns - 1) / bin_ns + 1);
+}
+
+void LatencyHistogram::Clear() {
+  std::fill(bins_.begin(), bins_.end(), 0);
+  count_ = 0;
+  max_ns_ = 0;
+}
+
+int64_t LatencyHistogram::Percentile(double quantile) const {
+  if (count_ == 0) {
+    return 0;
+  }
+  // The rank of the sample at the requested quantile, counting from one.
+  const auto rank = std::max<int64_t>(
+      1, static_cast<int64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) *
+                                        static_cast<double>(count_))));
+  int64_t seen = 0;
+  for (int64_t bin = 0; bin < num_bins(); ++bin) {
+    seen += bins_[bin];
+    if (seen >= rank) {
+      return std::min((bin + 1) * bin_ns_, max_ns_);
+    }
+  }
+  return max_ns_;
+}
+
+}  // namespace realtime
+}  // namespace drake_external_examples
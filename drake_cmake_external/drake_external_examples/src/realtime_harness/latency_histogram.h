@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <drake/common/drake_copyable.h>
+
+namespace drake_external_examples {
+namespace realtime {
+
+/// A histogram of latencies in nanoseconds with fixed-width bins, for use on
+/// real-time paths: all storage is allocated by the constructor, and Record()
+/// neither allocates nor locks.
+///
+/// Latencies at or beyond the histogram's range are counted in an overflow
+/// bin; the exact maximum is tracked separately.
+class LatencyHistogram {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(LatencyHistogram);
+
+  /// Covers [0, @p range_ns) with bins of @p bin_ns nanoseconds.
+  /// @throws std::exception unless 0 < @p bin_ns <= @p range_ns.
+  explicit LatencyHistogram(int64_t range_ns = 10'000'000,
+                            int64_t bin_ns = 1'000);
+
+  /// Adds one latency sample; negative latencies are recorded as zero.
+  void Record(int64_t latency_ns) {
+    latency_ns = latency_ns < 0 ? 0 : latency_ns;
+    const int64_t bin = latency_ns / bin_ns_;
+    ++bins_[bin < num_bins() ? bin : num_bins()];
+    ++count_;
+    max_ns_ = latency_ns > max_ns_ ? latency_ns : max_ns_;
+  }
+
+  /// Forgets all samples.
+  void Clear();
+
+  int64_t count() const { return count_; }
+
+  /// Returns the largest latency recorded, or zero if there are none.
+  int64_t max_ns() const { return max_ns_; }
+
+  /// Returns an upper bound, accurate to one bin, on the latency below which
+  /// the fraction @p quantile of samples lie (e.g., 0.999 for p99.9). Samples
+  /// in the overflow bin report max_ns(). Returns zero if there are no
+  /// samples.
+  int64_t Percentile(double quantile) const;
+
+ private:
+  int64_t num_bins() const { return static_cast<int64_t>(bins_.size()) - 1; }
+
+  int64_t bin_ns_{};
+  // The last entry is the overflow bin.
+  std::vector<int64_t> bins_;
+  int64_t count_{};
+  int64_t max_ns_{};
+};
+
+}  // namespace realtime
+}  // namespace drake_external_examples
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <Eigen/Dense>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/analysis/simulator_config.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/system.h>
+
+namespace drake_external_examples {
+namespace rollout_cache {
+
+/// How to roll out a system from a context: the horizon, the samples, and
+/// the integrator.
+struct RolloutSpec {
+  /// The rollout runs from the context's time t₀ to t₀ + horizon.
+  double horizon{};
+  /// The continuous state is sampled at t₀ + horizon k / num_samples, for
+  /// k = 1, ..., num_samples; with the default of one sample, only the final
+  /// state is kept.
+  int num_samples{1};
+  /// Applied to the Simulator with ApplySimulatorConfig(). Its
+  /// target_realtime_rate only paces the simulation, so it is not part of
+  /// the key; every other field is.
+  drake::systems::SimulatorConfig simulator_config{};
+};
+
+/// The samples of a rollout: `states.col(k)` is the continuous state at
+/// `times[k]`.
+struct RolloutSamples {
+  Eigen::VectorXd times;
+  Eigen::MatrixXd states;
+};
+
+/// Counts of how a RolloutCache was used.
+struct RolloutCacheStatistics {
+  int64_t hits{};
+  int64_t misses{};
+  int64_t insertions{};
+  int64_t evictions{};
+
+  /// Returns hits / (hits + misses), or zero before any lookup.
+  double hit_rate() const {
+    const int64_t lookups = hits + misses;
+    return lookups == 0 ? 0.0 : static_cast<double>(hits) / lookups;
+  }
+};
+
+/// Returns a canonical description of @p system that changes whenever its
+/// structure does: its C++ type, the sizes of its state, parameters and
+/// ports, and, for a diagram, the same for each subsystem and how they are
+/// connected. Code changes that alter a system's dynamics but none of these
+/// cannot be seen from the system; ComputeRolloutKey() takes a version to
+/// tell those apart.
+std::string FingerprintSystem(const drake::systems::System<double>& system);
+
+/// Returns the key of a rollout of @p system from @p context as @p spec
+/// says: the SHA-256, in hex, of the system's fingerprint, @p system_version,
+/// everything in @p context that the rollout depends on (the time, the
+/// continuous and discrete state, the numeric parameters, and the values of
+/// the input ports, all bit for bit), and @p spec.
+/// @throws std::logic_error if @p context has abstract state or abstract
+///   parameters, or an input port that is not fixed to a vector value, none
+///   of which can be hashed; or if @p spec is invalid.
+std::string ComputeRolloutKey(const drake::systems::System<double>& system,
+                              const drake::systems::Context<double>& context,
+                              const RolloutSpec& spec,
+                              std::string_view system_version = {});
+
+/// A memoization cache of rollouts, content-addressed by ComputeRolloutKey(),
+/// so that a sweep that repeats a rollout reads the samples from a file
+/// instead of simulating again.
+///
+/// Each rollout is a file named `<key>.rollout` in the cache's directory,
+/// read with mmap(). The files hold, in native byte order:
+///
+/// | offset         | contents                                   |
+/// |----------------|--------------------------------------------|
+/// | 0              | char magic[8], "DEEROLL1"                  |
+/// | 8              | uint64 number of states n                  |
+/// | 16             | uint64 number of samples k                 |
+/// | 24             | double times[k]                            |
+/// | 24 + 8k        | double states[k][n], sample by sample      |
+///
+/// The files' modification times record when they were last used. Once the
+/// files add up to more than the size budget, the least recently used are
+/// removed.
+///
+/// A cache is not thread-safe; use one per thread. Caches in several threads
+/// or processes may share a directory, though: files are written to a
+/// temporary name and renamed into place, so that they appear whole, and a
+/// file that another cache removed is simply a miss.
+class RolloutCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RolloutCache);
+
+  /// Opens the cache in @p directory, creating the directory if need be, and
+  /// removes the least recently used rollouts beyond @p max_bytes.
+  /// @throws std::logic_error if @p max_bytes is not positive.
+  /// @throws std::runtime_error if the directory cannot be created or read.
+  RolloutCache(std::string directory, int64_t max_bytes);
+
+  ~RolloutCache();
+
+  const std::string& directory() const { return directory_; }
+  int64_t max_bytes() const { return max_bytes_; }
+
+  /// Returns the number of rollouts in the cache, and the bytes they take,
+  /// as far as this cache knows.
+  int num_entries() const { return static_cast<int>(index_.size()); }
+  int64_t num_bytes() const { return num_bytes_; }
+
+  const RolloutCacheStatistics& statistics() const { return statistics_; }
+
+  /// Returns the samples of the rollout @p key, if cached, and marks it the
+  /// most recently used. A malformed file is removed, and is a miss.
+  std::optional<RolloutSamples> Find(const std::string& key);
+
+  /// Caches @p samples as the rollout @p key, replacing any cached before,
+  /// and removes the least recently used rollouts beyond the size budget.
+  /// Rollouts larger than the whole budget are not cached.
+  /// @throws std::logic_error if @p key is not a key, or @p samples have
+  ///   mismatched sizes.
+  /// @throws std::runtime_error if the file cannot be written.
+  void Insert(const std::string& key, const RolloutSamples& samples);
+
+  /// Returns the samples of the rollout of @p system from @p context as
+  /// @p spec says, from the cache if it has them, and otherwise by
+  /// simulating, and caching the result.
+  /// @throws std::exception as ComputeRolloutKey() does, or if the simulation
+  ///   fails.
+  RolloutSamples Simulate(const drake::systems::System<double>& system,
+                          const drake::systems::Context<double>& context,
+                          const RolloutSpec& spec,
+                          std::string_view system_version = {});
+
+ private:
+  struct Entry {
+    std::string key;
+    int64_t bytes{};
+  };
+
+  std::string PathOf(const std::string& key) const;
+  void Touch(int fd);
+  void Remember(const std::string& key, int64_t bytes);
+  void Forget(const std::string& key);
+  void EvictBeyond(int64_t max_bytes);
+
+  const std::string directory_;
+  const int64_t max_bytes_;
+  // The entries, most recently used first, and where each is in the list.
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  int64_t num_bytes_{};
+  // The last modification time given to a file, in nanoseconds; each use is
+  // given a later one, so that uses within a clock tick stay ordered.
+  int64_t last_use_ns_{};
+  int64_t num_temporaries_{};
+  RolloutCacheStatistics statistics_;
+};
+
+/// Simulates a rollout of @p system from @p context as @p spec says, without
+/// a cache.
+/// @throws std::logic_error if @p spec is invalid.
+RolloutSamples SimulateRollout(const drake::systems::System<double>& system,
+                               const drake::systems::Context<double>& context,
+                               const RolloutSpec& spec);
+
+}  // namespace rollout_cache
+}  // namespace drake_external_examples
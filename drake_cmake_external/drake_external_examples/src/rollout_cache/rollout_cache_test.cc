@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "rollout_cache.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/common/temp_directory.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/framework/leaf_system.h>
+#include <drake/systems/primitives/constant_vector_source.h>
+
+#include "particle/particle.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace rollout_cache {
+namespace {
+
+using drake::systems::ConstantVectorSource;
+using drake::systems::Context;
+using drake::systems::ContinuousState;
+using drake::systems::DiagramBuilder;
+using drake::systems::LeafSystem;
+using particles::Particle;
+
+// xdot = -x, counting how often its derivatives are evaluated, i.e., how
+// much it is simulated.
+class CountingDecay final : public LeafSystem<double> {
+ public:
+  CountingDecay() { this->DeclareContinuousState(1); }
+
+  int num_evaluations() const { return num_evaluations_; }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    ++num_evaluations_;
+    (*derivatives)[0] = -context.get_continuous_state()[0];
+  }
+
+  mutable int num_evaluations_{};
+};
+
+// A new temporary directory for each test.
+class RolloutCacheTest : public ::testing::Test {
+ protected:
+  const std::filesystem::path directory_{drake::temp_directory()};
+};
+
+RolloutSamples MakeSamples(double value, int num_samples = 4) {
+  RolloutSamples samples;
+  samples.times = Eigen::VectorXd::LinSpaced(num_samples, 0.25, 1.0);
+  samples.states = Eigen::MatrixXd::Constant(2, num_samples, value);
+  return samples;
+}
+
+/// Makes sure that changing anything a rollout depends on, in the context,
+/// the spec, or the system, changes its key; and that nothing else does.
+TEST(ComputeRolloutKeyTest, ChangesWithEverySpecField) {
+  const Particle<double> particle;
+  auto context = particle.CreateDefaultContext();
+  context->SetContinuousState(Eigen::Vector2d(0.5, -0.25));
+  particle.get_input_port(0).FixValue(context.get(), 1.0);
+  const RolloutSpec spec{.horizon = 1.0, .num_samples = 4};
+  const std::string key = ComputeRolloutKey(particle, *context, spec);
+  EXPECT_EQ(key.size(), 64);
+  EXPECT_EQ(ComputeRolloutKey(particle, *context->Clone(), spec), key);
+
+  // Each variation yields a key of its own.
+  std::set<std::string> keys{key};
+  const auto expect_new_key =
+      [&](const std::string& what,
+          const std::function<void(Context<double>*, RolloutSpec*)>& vary) {
+        auto varied_context = context->Clone();
+        RolloutSpec varied_spec = spec;
+        vary(varied_context.get(), &varied_spec);
+        EXPECT_TRUE(
+            keys.insert(ComputeRolloutKey(particle, *varied_context,
+                                          varied_spec))
+                .second)
+            << what;
+      };
+  expect_new_key("position", [](Context<double>* c, RolloutSpec*) {
+    c->get_mutable_continuous_state_vector()[0] = 0.5000000001;
+  });
+  expect_new_key("velocity", [](Context<double>* c, RolloutSpec*) {
+    c->get_mutable_continuous_state_vector()[1] = 0.25;
+  });
+  expect_new_key("time", [](Context<double>* c, RolloutSpec*) {
+    c->SetTime(1.0);
+  });
+  expect_new_key("mass", [&particle](Context<double>* c, RolloutSpec*) {
+    particle.set_mass(c, 2.0);
+  });
+  expect_new_key("force", [&particle](Context<double>* c, RolloutSpec*) {
+    particle.get_input_port(0).FixValue(c, -1.0);
+  });
+  expect_new_key("horizon", [](Context<double>*, RolloutSpec* s) {
+    s->horizon = 2.0;
+  });
+  expect_new_key("samples", [](Context<double>*, RolloutSpec* s) {
+    s->num_samples = 1;
+  });
+  expect_new_key("integrator", [](Context<double>*, RolloutSpec* s) {
+    s->simulator_config.integrator = "runge_kutta2";
+  });
+  expect_new_key("max_step_size", [](Context<double>*, RolloutSpec* s) {
+    s->simulator_config.max_step_size = 0.001;
+  });
+  expect_new_key("accuracy", [](Context<double>*, RolloutSpec* s) {
+    s->simulator_config.accuracy = 1e-6;
+  });
+  expect_new_key("use_error_control", [](Context<double>*, RolloutSpec* s) {
+    s->simulator_config.use_error_control =
+        !s->simulator_config.use_error_control;
+  });
+  expect_new_key("publish_every_time_step",
+                 [](Context<double>*, RolloutSpec* s) {
+                   s->simulator_config.publish_every_time_step =
+                       !s->simulator_config.publish_every_time_step;
+                 });
+  EXPECT_TRUE(
+      keys.insert(ComputeRolloutKey(particle, *context, spec, "v2")).second);
+
+  // The same state, in a system of another type, is another rollout.
+  const systems::SimpleContinuousTimeSystem<double> scts;
+  auto scts_context = scts.CreateDefaultContext();
+  scts_context->SetContinuousState(drake::Vector1d(0.5));
+  EXPECT_TRUE(keys.insert(ComputeRolloutKey(scts, *scts_context, spec)).second);
+
+  // Pacing does not change the samples.
+  RolloutSpec paced = spec;
+  paced.simulator_config.target_realtime_rate = 1.0;
+  EXPECT_EQ(ComputeRolloutKey(particle, *context, paced), key);
+}
+
+/// Makes sure a diagram's fingerprint covers its subsystems and how they are
+/// connected, not only its own ports.
+TEST(FingerprintSystemTest, CoversDiagramStructure) {
+  const auto build = [](bool connect) {
+    DiagramBuilder<double> builder;
+    auto* source = builder.AddSystem<ConstantVectorSource<double>>(1.0);
+    auto* particle = builder.AddSystem<Particle<double>>();
+    if (connect) {
+      builder.Connect(source->get_output_port(), particle->get_input_port(0));
+    } else {
+      builder.ExportInput(particle->get_input_port(0), "force");
+    }
+    builder.ExportOutput(particle->get_output_port(0), "state");
+    return builder.Build();
+  };
+  const auto connected = build(true);
+  const auto exported = build(false);
+  EXPECT_EQ(FingerprintSystem(*connected), FingerprintSystem(*build(true)));
+  EXPECT_NE(FingerprintSystem(*connected), FingerprintSystem(*exported));
+  EXPECT_NE(FingerprintSystem(*connected).find("connection"),
+            std::string::npos);
+}
+
+/// Makes sure keys are refused for rollouts that cannot be hashed, or that
+/// are invalid.
+TEST(ComputeRolloutKeyTest, Throws) {
+  const Particle<double> particle;
+  auto context = particle.CreateDefaultContext();
+  EXPECT_THROW(ComputeRolloutKey(particle, *context, {.horizon = 1.0}),
+               std::logic_error);
+  particle.get_input_port(0).FixValue(context.get(), 1.0);
+  EXPECT_THROW(ComputeRolloutKey(particle, *context, {.horizon = 0.0}),
+               std::logic_error);
+  EXPECT_THROW(
+      ComputeRolloutKey(particle, *context, {.horizon = 1.0, .num_samples = 0}),
+      std::logic_error);
+}
+
+/// Makes sure a repeated rollout is read from the cache instead of being
+/// simulated again, and is the same, bit for bit.
+TEST_F(RolloutCacheTest, HitSkipsSimulation) {
+  const CountingDecay decay;
+  auto context = decay.CreateDefaultContext();
+  context->SetContinuousState(drake::Vector1d(2.0));
+  RolloutCache cache(directory_.string(), 1 << 20);
+  const RolloutSpec spec{.horizon = 1.0, .num_samples = 5};
+
+  const RolloutSamples simulated = cache.Simulate(decay, *context, spec);
+  const int num_evaluations = decay.num_evaluations();
+  EXPECT_GT(num_evaluations, 0);
+  ASSERT_EQ(simulated.states.cols(), 5);
+  EXPECT_EQ(simulated.times[4], 1.0);
+  EXPECT_NEAR(simulated.states(0, 4), 2.0 * std::exp(-1.0), 1e-3);
+
+  const RolloutSamples cached = cache.Simulate(decay, *context, spec);
+  EXPECT_EQ(decay.num_evaluations(), num_evaluations);
+  EXPECT_EQ(cached.times, simulated.times);
+  EXPECT_EQ(cached.states, simulated.states);
+  EXPECT_EQ(cache.statistics().hits, 1);
+  EXPECT_EQ(cache.statistics().misses, 1);
+  EXPECT_EQ(cache.statistics().insertions, 1);
+  EXPECT_EQ(cache.statistics().hit_rate(), 0.5);
+
+  // Another initial state is simulated.
+  context->SetContinuousState(drake::Vector1d(1.0));
+  cache.Simulate(decay, *context, spec);
+  EXPECT_GT(decay.num_evaluations(), num_evaluations);
+  EXPECT_EQ(cache.num_entries(), 2);
+}
+
+/// Makes sure cached rollouts outlive the cache, and are found by the next
+/// one opened on the directory.
+TEST_F(RolloutCacheTest, PersistsAcrossInstances) {
+  const std::string key(64, 'a');
+  {
+    RolloutCache cache(directory_.string(), 1 << 20);
+    EXPECT_FALSE(cache.Find(key).has_value());
+    cache.Insert(key, MakeSamples(3.0));
+  }
+  RolloutCache cache(directory_.string(), 1 << 20);
+  EXPECT_EQ(cache.num_entries(), 1);
+  EXPECT_EQ(cache.num_bytes(), 24 + 8 * 4 * 3);
+  const std::optional<RolloutSamples> found = cache.Find(key);
+  ASSERT_TRUE(found.has_value());
+  EXPECT_EQ(found->times, MakeSamples(3.0).times);
+  EXPECT_EQ(found->states, MakeSamples(3.0).states);
+}
+
+/// Makes sure the least recently used rollouts are evicted once the budget
+/// is exceeded, both while a cache is used and when one is opened.
+TEST_F(RolloutCacheTest, EvictsLeastRecentlyUsed) {
+  constexpr int64_t kEntryBytes = 24 + 8 * 4 * 3;
+  const std::string a(64, 'a');
+  const std::string b(64, 'b');
+  const std::string c(64, 'c');
+  {
+    RolloutCache cache(directory_.string(), 2 * kEntryBytes);
+    cache.Insert(a, MakeSamples(1.0));
+    cache.Insert(b, MakeSamples(2.0));
+    ASSERT_TRUE(cache.Find(a).has_value());
+    cache.Insert(c, MakeSamples(3.0));
+    EXPECT_EQ(cache.statistics().evictions, 1);
+    EXPECT_EQ(cache.num_entries(), 2);
+    EXPECT_EQ(cache.num_bytes(), 2 * kEntryBytes);
+    EXPECT_FALSE(cache.Find(b).has_value());
+    EXPECT_TRUE(cache.Find(c).has_value());
+    EXPECT_TRUE(cache.Find(a).has_value());
+
+    // Rollouts larger than the whole budget are not cached.
+    cache.Insert(b, MakeSamples(2.0, 100));
+    EXPECT_EQ(cache.statistics().insertions, 3);
+    EXPECT_FALSE(cache.Find(b).has_value());
+  }
+  // A smaller budget keeps only the rollout used last.
+  RolloutCache cache(directory_.string(), kEntryBytes);
+  EXPECT_EQ(cache.num_entries(), 1);
+  EXPECT_TRUE(cache.Find(a).has_value());
+  EXPECT_FALSE(cache.Find(c).has_value());
+}
+
+/// Makes sure a malformed file is a miss, and is removed.
+TEST_F(RolloutCacheTest, RemovesMalformedFiles) {
+  const std::string key(64, 'f');
+  const std::filesystem::path path = directory_ / (key + ".rollout");
+  std::ofstream(path) << "not a rollout";
+  RolloutCache cache(directory_.string(), 1 << 20);
+  EXPECT_EQ(cache.num_entries(), 1);
+  EXPECT_FALSE(cache.Find(key).has_value());
+  EXPECT_FALSE(std::filesystem::exists(path));
+  EXPECT_EQ(cache.num_entries(), 0);
+  EXPECT_EQ(cache.statistics().misses, 1);
+
+  EXPECT_THROW(cache.Find("not a key"), std::logic_error);
+  EXPECT_THROW(cache.Insert(key, {.times = Eigen::VectorXd::Zero(2),
+                                  .states = Eigen::MatrixXd::Zero(2, 3)}),
+               std::logic_error);
+  EXPECT_THROW(RolloutCache(directory_.string(), 0), std::logic_error);
+}
+
+}  // namespace
+}  // namespace rollout_cache
+}  // namespace drake_external_examples
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "rollout_model.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/framework/vector_base.h>
+
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace simulation_server {
+
+using drake::systems::ConstantVectorSource;
+using drake::systems::Context;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+namespace {
+
+// Rollouts are integrated to this accuracy, with the Simulator's default
+// error-controlled integrator.
+constexpr double kAccuracy = 1e-8;
+
+}  // namespace
+
+struct RolloutModel::WarmSimulator {
+  std::unique_ptr<Simulator<double>> simulator;
+  // The state of the last sample, reused so that sampling does not allocate.
+  Eigen::VectorXd state;
+};
+
+RolloutModel::RolloutModel(Model model, int num_warm_simulators)
+    : model_(model) {
+  if (num_warm_simulators < 0) {
+    throw std::logic_error(
+        "The number of warm simulators must not be negative");
+  }
+  DiagramBuilder<double> builder;
+  switch (model) {
+    case Model::kSimpleContinuousTimeSystem: {
+      builder.AddSystem<SimpleContinuousTimeSystem<double>>();
+      num_states_ = 1;
+      num_parameters_ = 0;
+      break;
+    }
+    case Model::kAdderParticle: {
+      source_ = builder.AddSystem<ConstantVectorSource<double>>(0.0);
+      adder_ = builder.AddSystem<SimpleAdder<double>>(0.0);
+      particle_ = builder.AddSystem<Particle<double>>();
+      builder.Connect(source_->get_output_port(), adder_->get_input_port(0));
+      builder.Connect(adder_->get_output_port(0),
+                      particle_->get_input_port(0));
+      num_states_ = 2;
+      num_parameters_ = 3;
+      break;
+    }
+    default:
+      throw std::logic_error("Unknown simulation server model " +
+                             std::to_string(static_cast<uint32_t>(model)));
+  }
+  diagram_ = builder.Build();
+  for (int i = 0; i < num_warm_simulators; ++i) {
+    idle_.push_back(MakeWarmSimulator());
+  }
+}
+
+RolloutModel::~RolloutModel() = default;
+
+int RolloutModel::num_idle_simulators() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(idle_.size());
+}
+
+std::unique_ptr<RolloutModel::WarmSimulator>
+RolloutModel::MakeWarmSimulator() const {
+  auto warm = std::make_unique<WarmSimulator>();
+  warm->simulator = std::make_unique<Simulator<double>>(*diagram_);
+  warm->simulator->get_mutable_context().SetAccuracy(kAccuracy);
+  warm->state.resize(num_states_);
+  return warm;
+}
+
+void RolloutModel::SetParameters(const Eigen::VectorXd& parameters,
+                                 Context<double>* context) const {
+  if (model_ != Model::kAdderParticle) return;
+  source_->get_mutable_source_value(
+             &source_->GetMyMutableContextFromRoot(context))
+      .SetAtIndex(0, parameters[0]);
+  adder_->GetMyMutableContextFromRoot(context)
+      .get_mutable_numeric_parameter(0)
+      .SetAtIndex(0, parameters[1]);
+  particle_->set_mass(&particle_->GetMyMutableContextFromRoot(context),
+                      parameters[2]);
+}
+
+void RolloutModel::Run(const RolloutRequest& request,
+                       const SampleCallback& on_sample) const {
+  if (request.model != model_) {
+    throw std::logic_error("The rollout is for another model");
+  }
+  if (request.initial_state.size() != num_states_ ||
+      request.parameters.size() != num_parameters_) {
+    throw std::logic_error(
+        "The model takes " + std::to_string(num_states_) + " states and " +
+        std::to_string(num_parameters_) + " parameters, not " +
+        std::to_string(request.initial_state.size()) + " and " +
+        std::to_string(request.parameters.size()));
+  }
+  if (!(request.horizon > 0.0 && std::isfinite(request.horizon)) ||
+      request.num_samples < 1) {
+    throw std::logic_error(
+        "The horizon must be positive and finite, with at least one sample");
+  }
+  if (model_ == Model::kAdderParticle && !(request.parameters[2] > 0.0)) {
+    throw std::logic_error("The particle mass must be positive");
+  }
+
+  std::unique_ptr<WarmSimulator> warm;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!idle_.empty()) {
+      warm = std::move(idle_.back());
+      idle_.pop_back();
+    }
+  }
+  if (warm == nullptr) {
+    warm = MakeWarmSimulator();
+  }
+  // Whatever happens to the rollout, the next one reinitializes the
+  // simulator, so it goes back to the pool.
+  const auto release = [this, &warm]() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_.push_back(std::move(warm));
+  };
+  try {
+    Simulator<double>& simulator = *warm->simulator;
+    Context<double>& context = simulator.get_mutable_context();
+    context.SetTime(0.0);
+    context.SetContinuousState(request.initial_state);
+    SetParameters(request.parameters, &context);
+    simulator.Initialize();
+    for (int k = 1; k <= request.num_samples; ++k) {
+      const double time = request.horizon * k / request.num_samples;
+      simulator.AdvanceTo(time);
+      context.get_continuous_state_vector().CopyToPreSizedVector(&warm->state);
+      on_sample(time, warm->state);
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+  release();
+}
+
+}  // namespace simulation_server
+}  // namespace drake_external_examples
@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures how many short rollouts per second (the Simple Continuous Time
+/// System over 1 s, sampled 10 times, from varying initial states) run:
+///
+/// - in this process, on a RolloutModel, i.e., the simulation alone;
+/// - on a simulation_server daemon, over one connection reused throughout;
+/// - on the daemon, over a new connection per rollout;
+/// - on the daemon, over a connection per thread from a thread per core; and
+/// - in a `simulation_server --fd` process spawned per rollout, which pays for
+///   starting a process, loading Drake, and building the diagram and its
+///   context every time.
+///
+/// The daemon's own startup, until it has answered its first rollout, is
+/// reported separately.
+///
+/// Usage: simulation_server_benchmark [--rollouts=<count>]
+///            [--process_rollouts=<count>] [--server=<path>]
+///            [--json_output=<path>]
+///
+/// By default, 10000 rollouts are run in each mode, but only 100 with a
+/// process per rollout; and the simulation_server next to this executable is
+/// used.
+
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <drake/common/eigen_types.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "rollout_model.h"
+#include "simulation_client.h"
+
+extern char** environ;
+
+namespace drake_external_examples {
+namespace simulation_server {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+
+RolloutRequest MakeRequest(int i) {
+  return {.model = Model::kSimpleContinuousTimeSystem,
+          .initial_state = drake::Vector1d(0.9 * (i % 100) / 100.0),
+          .horizon = 1.0,
+          .num_samples = 10};
+}
+
+pid_t Spawn(const std::vector<std::string>& command) {
+  std::vector<std::string> arguments = command;
+  std::vector<char*> argv;
+  for (std::string& argument : arguments) {
+    argv.push_back(argument.data());
+  }
+  argv.push_back(nullptr);
+  pid_t pid{};
+  const int error =
+      posix_spawn(&pid, argv[0], nullptr, nullptr, argv.data(), environ);
+  if (error != 0) {
+    throw std::runtime_error("Could not launch " + command[0] + ": " +
+                             std::strerror(error));
+  }
+  return pid;
+}
+
+void Wait(pid_t pid) {
+  int status = 0;
+  while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+  }
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    throw std::runtime_error("simulation_server failed");
+  }
+}
+
+// Keeps connecting to the daemon until it listens.
+std::unique_ptr<SimulationClient> ConnectWhenReady(
+    const std::string& socket_path) {
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  for (;;) {
+    try {
+      return SimulationClient::Connect(socket_path);
+    } catch (const std::runtime_error&) {
+      if (std::chrono::steady_clock::now() > deadline) throw;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+}
+
+// Runs a rollout in a new `simulation_server --fd` process, connected to
+// this one by a socket pair.
+double RunInNewProcess(const std::string& server,
+                       const RolloutRequest& request) {
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+    throw std::runtime_error(std::string("Could not create a socket pair: ") +
+                             std::strerror(errno));
+  }
+  // Only the server's end is inherited.
+  fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+  pid_t pid{};
+  try {
+    pid = Spawn({server, "--fd=" + std::to_string(fds[1])});
+  } catch (...) {
+    close(fds[0]);
+    close(fds[1]);
+    throw;
+  }
+  close(fds[1]);
+  double result{};
+  {
+    SimulationClient client(fds[0]);
+    result = client.Run(request).states(0, request.num_samples - 1);
+  }
+  Wait(pid);
+  return result;
+}
+
+void PrintRate(BenchmarkResult* result, double checksum) {
+  const double rate = result->num_operations / result->seconds;
+  result->values["rollouts_per_second"] = rate;
+  std::cout << "  " << rate << " rollouts/s (checksum " << checksum << ")"
+            << std::endl;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("simulation_server_benchmark", &argc, argv);
+  int num_rollouts = 10'000;
+  int num_process_rollouts = 100;
+  std::string server =
+      (std::filesystem::read_symlink("/proc/self/exe").parent_path() /
+       "simulation_server")
+          .string();
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--rollouts=")) {
+      num_rollouts = std::stoi(std::string(arg.substr(11)));
+    } else if (arg.starts_with("--process_rollouts=")) {
+      num_process_rollouts = std::stoi(std::string(arg.substr(19)));
+    } else if (arg.starts_with("--server=")) {
+      server = arg.substr(9);
+    } else {
+      throw std::logic_error("Unknown argument " + std::string(arg));
+    }
+  }
+  if (num_rollouts < 1 || num_process_rollouts < 1) {
+    throw std::logic_error("The numbers of rollouts must be positive");
+  }
+
+  // Each mode adds up the final states of its rollouts, to be compared.
+  double checksum = 0.0;
+  const RolloutModel model(Model::kSimpleContinuousTimeSystem);
+  BenchmarkResult& in_process =
+      fixture.Measure("in process", num_rollouts, [&]() {
+        for (int i = 0; i < num_rollouts; ++i) {
+          model.Run(MakeRequest(i),
+                    [&checksum](double time,
+                                const Eigen::Ref<const Eigen::VectorXd>& x) {
+                      if (time == 1.0) checksum += x[0];
+                    });
+        }
+      });
+  PrintRate(&in_process, checksum);
+
+  const std::filesystem::path directory =
+      std::filesystem::temp_directory_path() /
+      ("simulation_server_benchmark_" + std::to_string(getpid()));
+  std::filesystem::create_directories(directory);
+  const std::string socket_path = (directory / "socket").string();
+  const pid_t daemon = Spawn({server, "--socket=" + socket_path});
+  std::unique_ptr<SimulationClient> client;
+  fixture.Measure("daemon startup", 1, [&]() {
+    client = ConnectWhenReady(socket_path);
+    client->Run(MakeRequest(0));
+  });
+
+  checksum = 0.0;
+  BenchmarkResult& one_connection =
+      fixture.Measure("daemon, one connection", num_rollouts, [&]() {
+        for (int i = 0; i < num_rollouts; ++i) {
+          checksum += client->Run(MakeRequest(i)).states(0, 9);
+        }
+      });
+  PrintRate(&one_connection, checksum);
+  client.reset();
+
+  checksum = 0.0;
+  BenchmarkResult& connection_per_rollout =
+      fixture.Measure("daemon, connection per rollout", num_rollouts, [&]() {
+        for (int i = 0; i < num_rollouts; ++i) {
+          auto new_client = SimulationClient::Connect(socket_path);
+          checksum += new_client->Run(MakeRequest(i)).states(0, 9);
+        }
+      });
+  PrintRate(&connection_per_rollout, checksum);
+
+  const int num_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  std::vector<double> checksums(num_threads);
+  BenchmarkResult& concurrent = fixture.Measure(
+      "daemon, connections from " + std::to_string(num_threads) + " threads",
+      num_rollouts, [&]() {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; ++t) {
+          threads.emplace_back([&, t]() {
+            auto thread_client = SimulationClient::Connect(socket_path);
+            for (int i = t; i < num_rollouts; i += num_threads) {
+              checksums[t] += thread_client->Run(MakeRequest(i)).states(0, 9);
+            }
+          });
+        }
+        for (std::thread& thread : threads) {
+          thread.join();
+        }
+      });
+  checksum = 0.0;
+  for (const double value : checksums) checksum += value;
+  PrintRate(&concurrent, checksum);
+  kill(daemon, SIGTERM);
+  Wait(daemon);
+  std::filesystem::remove_all(directory);
+
+  checksum = 0.0;
+  BenchmarkResult& process_per_rollout =
+      fixture.Measure("process per rollout", num_process_rollouts, [&]() {
+        for (int i = 0; i < num_process_rollouts; ++i) {
+          checksum += RunInNewProcess(server, MakeRequest(i));
+        }
+      });
+  PrintRate(&process_per_rollout, checksum);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace simulation_server
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::simulation_server::DoMain(argc, argv);
+}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Runs a SimulationServer as a local daemon, until interrupted or
+/// terminated:
+///
+///   simulation_server --socket=<path> [--warm_simulators=<count>]
+///
+/// or, to serve a single connection on an inherited, already connected Unix
+/// domain socket, building only the models it asks for, and exiting when the
+/// peer closes it (which is how a rollout pays for a whole process of its
+/// own):
+///
+///   simulation_server --fd=<fd>
+
+#include <signal.h>
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "rollout_model.h"
+#include "simulation_server.h"
+
+namespace drake_external_examples {
+namespace simulation_server {
+namespace {
+
+SimulationServer* g_server = nullptr;
+
+void HandleStopSignal(int) {
+  if (g_server != nullptr) {
+    g_server->Stop();
+  }
+}
+
+int ServeInheritedConnection(int fd) {
+  std::map<Model, std::unique_ptr<const RolloutModel>> models;
+  ServeConnection(fd, [&models](Model model) -> const RolloutModel& {
+    std::unique_ptr<const RolloutModel>& built = models[model];
+    if (built == nullptr) {
+      built = std::make_unique<RolloutModel>(model);
+    }
+    return *built;
+  });
+  return 0;
+}
+
+int DoMain(int argc, char* argv[]) {
+  std::string socket_path;
+  int fd = -1;
+  int warm_simulators = 1;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--socket=")) {
+      socket_path = arg.substr(9);
+    } else if (arg.starts_with("--fd=")) {
+      fd = std::stoi(std::string(arg.substr(5)));
+    } else if (arg.starts_with("--warm_simulators=")) {
+      warm_simulators = std::stoi(std::string(arg.substr(18)));
+    } else {
+      throw std::logic_error("Unknown argument " + std::string(arg));
+    }
+  }
+  if (socket_path.empty() == (fd < 0)) {
+    throw std::logic_error("Give exactly one of --socket=<path> or --fd=<fd>");
+  }
+  if (fd >= 0) {
+    return ServeInheritedConnection(fd);
+  }
+
+  SimulationServer server(socket_path, warm_simulators);
+  g_server = &server;
+  struct sigaction action {};
+  action.sa_handler = &HandleStopSignal;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGINT, &action, nullptr);
+  sigaction(SIGTERM, &action, nullptr);
+  std::cout << "simulation_server: listening on " << socket_path << std::endl;
+  server.Serve();
+  g_server = nullptr;
+  return 0;
+}
+
+}  // namespace
+}  // namespace simulation_server
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::simulation_server::DoMain(argc, argv);
+}
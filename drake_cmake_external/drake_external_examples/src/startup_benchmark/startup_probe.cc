@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// The process whose startup startup_benchmark measures: it simulates the
+/// SimpleContinuousTimeSystem for a single step, then prints, one
+/// `<name> <value>` pair per line:
+///
+/// - `main_ns`: CLOCK_MONOTONIC on entry to main(), after the dynamic loader
+///   and all static initializers have run.
+/// - `first_step_ns`: CLOCK_MONOTONIC after the first Simulator step.
+/// - `resident_bytes`: the resident set size after that step.
+/// - `executable_bytes`: the size of this executable file.
+/// - `loaded_bytes`: the total size of the files of all loaded objects, i.e.,
+///   the executable and its shared libraries.
+/// - `loaded_objects`: the number of those objects.
+
+#include <link.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace startup {
+namespace {
+
+int64_t NowNanoseconds() {
+  timespec now{};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return int64_t{now.tv_sec} * 1'000'000'000 + now.tv_nsec;
+}
+
+int64_t FileSize(const char* path) {
+  struct stat status {};
+  return (stat(path, &status) == 0) ? static_cast<int64_t>(status.st_size)
+                                    : 0;
+}
+
+int64_t ResidentBytes() {
+  // The second field of statm is the resident set size, in pages.
+  std::ifstream statm("/proc/self/statm");
+  int64_t size_pages = 0;
+  int64_t resident_pages = 0;
+  statm >> size_pages >> resident_pages;
+  return resident_pages * sysconf(_SC_PAGESIZE);
+}
+
+struct LoadedObjects {
+  int64_t bytes{};
+  int count{};
+};
+
+int AddLoadedObject(dl_phdr_info* info, size_t, void* data) {
+  auto* objects = static_cast<LoadedObjects*>(data);
+  // The executable itself has an empty name; the vDSO has no file.
+  const char* name = info->dlpi_name;
+  const int64_t bytes =
+      FileSize((name == nullptr || name[0] == '\0') ? "/proc/self/exe" : name);
+  if (bytes > 0) {
+    objects->bytes += bytes;
+    ++objects->count;
+  }
+  return 0;
+}
+
+int DoMain(int64_t main_ns) {
+  const systems::SimpleContinuousTimeSystem<double> system;
+  drake::systems::Simulator<double> simulator(system);
+  simulator.get_mutable_context().get_mutable_continuous_state()[0] = 0.9;
+  simulator.AdvanceTo(1e-3);
+  const int64_t first_step_ns = NowNanoseconds();
+
+  LoadedObjects objects;
+  dl_iterate_phdr(&AddLoadedObject, &objects);
+  std::cout << "main_ns " << main_ns << "\n"
+            << "first_step_ns " << first_step_ns << "\n"
+            << "resident_bytes " << ResidentBytes() << "\n"
+            << "executable_bytes " << FileSize("/proc/self/exe") << "\n"
+            << "loaded_bytes " << objects.bytes << "\n"
+            << "loaded_objects " << objects.count << std::endl;
+  return 0;
+}
+
+}  // namespace
+}  // namespace startup
+}  // namespace drake_external_examples
+
+int main() {
+  const int64_t main_ns = drake_external_examples::startup::NowNanoseconds();
+  return drake_external_examples::startup::DoMain(main_ns);
+}
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+namespace drake_external_examples {
+namespace particles {
+
+/// The Philox4x32-10 counter-based random number generator of Salmon et al.,
+/// "Parallel Random Numbers: As Easy as 1, 2, 3" (SC 2011).
+///
+/// Rather than advancing a state, it maps a 128-bit counter and a 64-bit key
+/// through ten rounds of multiplication and xor to 128 random bits. Any draw
+/// can therefore be computed directly from what it is for, e.g., a key for
+/// the experiment and a counter made of the rollout and the step; draws do
+/// not depend on the order, or the thread, in which they are computed, and
+/// need no state to be stored or shared.
+///
+/// Its output matches the known-answer tests of the Random123 library.
+class Philox4x32 {
+ public:
+  using Counter = std::array<uint32_t, 4>;
+  using Key = std::array<uint32_t, 2>;
+
+  /// Returns the 128 random bits for @p counter under @p key.
+  static constexpr Counter Generate(Counter counter, Key key) {
+    for (int round = 0; round < 10; ++round) {
+      if (round > 0) {
+        key[0] += kWeyl0;
+        key[1] += kWeyl1;
+      }
+      const uint64_t product0 = uint64_t{kMultiplier0} * counter[0];
+      const uint64_t product1 = uint64_t{kMultiplier1} * counter[2];
+      counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                 static_cast<uint32_t>(product1),
+                 static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                 static_cast<uint32_t>(product0)};
+    }
+    return counter;
+  }
+
+ private:
+  static constexpr uint32_t kMultiplier0 = 0xD2511F53;
+  static constexpr uint32_t kMultiplier1 = 0xCD9E8D57;
+  static constexpr uint32_t kWeyl0 = 0x9E3779B9;
+  static constexpr uint32_t kWeyl1 = 0xBB67AE85;
+};
+
+/// Returns a standard normal draw for the pair (@p stream, @p index) under
+/// @p seed, e.g., for a rollout and a step: the Box–Muller transform of the
+/// two 53-bit uniforms in Philox4x32::Generate({index, stream}, seed).
+inline double PhiloxNormal(uint64_t seed, uint64_t stream, uint64_t index) {
+  const Philox4x32::Counter bits = Philox4x32::Generate(
+      {static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32),
+       static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)},
+      {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)});
+  // Uniforms in (0, 1), never zero, so that the logarithm is finite.
+  constexpr double kScale = 0x1.0p-53;
+  const double u0 =
+      ((((uint64_t{bits[1]} << 32) | bits[0]) >> 11) + 0.5) * kScale;
+  const double u1 =
+      ((((uint64_t{bits[3]} << 32) | bits[2]) >> 11) + 0.5) * kScale;
+  // Only one of the pair of normals the transform yields is used, which
+  // keeps each draw independent of every other.
+  return std::sqrt(-2.0 * std::log(u0)) * std::cos(2.0 * std::numbers::pi * u1);
+}
+
+}  // namespace particles
+}  // namespace drake_external_examples
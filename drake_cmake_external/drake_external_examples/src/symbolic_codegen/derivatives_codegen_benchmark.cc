@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Compares ways to evaluate the time derivatives of the example systems,
+/// and their Jacobian:
+///
+/// - the hand-written SimpleContinuousTimeSystem and Particle;
+/// - the same systems generated by derivatives_codegen (GeneratedSystem), and
+///   the generated function alone, without the System machinery;
+/// - the symbolic::Expression of the derivatives, evaluated in an
+///   Environment;
+/// - for the Jacobian, the AutoDiffXd-converted system.
+///
+/// Each evaluation follows a change of the state, so that nothing is served
+/// from a cache.
+///
+/// Usage: derivatives_codegen_benchmark [num_evaluations]
+///            [--json_output=<path>]
+
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include <drake/common/autodiff.h>
+#include <drake/common/eigen_types.h>
+#include <drake/common/symbolic/expression.h>
+#include <drake/math/autodiff.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/framework/system.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "generated_system.h"
+#include "particle/particle.h"
+#include "particle_derivatives.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+#include "simple_continuous_time_system_derivatives.h"
+
+namespace drake_external_examples {
+namespace symbolic_codegen {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using drake::AutoDiffXd;
+using drake::systems::Context;
+using drake::systems::System;
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+namespace scts_derivatives = simple_continuous_time_system_derivatives;
+
+// A state in [0, 1) that changes with every evaluation.
+double State(int64_t i) {
+  return static_cast<double>(i % 1000) * 1e-3;
+}
+
+// Measures CalcTimeDerivatives() of `system`, whose state has
+// `state_index` changed before every evaluation.
+void MeasureDerivatives(BenchmarkFixture* fixture, const std::string& name,
+                        const System<double>& system, int state_index,
+                        int64_t num_evaluations) {
+  auto context = system.CreateDefaultContext();
+  if (system.num_input_ports() > 0) {
+    system.get_input_port(0).FixValue(context.get(), drake::Vector1d(1.0));
+  }
+  auto derivatives = system.AllocateTimeDerivatives();
+  drake::systems::VectorBase<double>& state =
+      context->get_mutable_continuous_state_vector();
+  double checksum = 0.0;
+  fixture->Measure(name, num_evaluations, [&]() {
+    for (int64_t i = 0; i < num_evaluations; ++i) {
+      state.SetAtIndex(state_index, State(i));
+      system.CalcTimeDerivatives(*context, derivatives.get());
+      checksum += derivatives->get_vector().GetAtIndex(0);
+    }
+  });
+  std::cout << "  (checksum " << checksum << ")" << std::endl;
+}
+
+void BenchmarkDerivatives(BenchmarkFixture* fixture, int64_t num_evaluations) {
+  const SimpleContinuousTimeSystem<double> system;
+  MeasureDerivatives(fixture, "SimpleContinuousTimeSystem derivatives",
+                     system, 0, num_evaluations);
+  MeasureDerivatives(fixture,
+                     "generated SimpleContinuousTimeSystem derivatives",
+                     GeneratedSystem<scts_derivatives::Derivatives>(), 0,
+                     num_evaluations);
+
+  double checksum = 0.0;
+  fixture->Measure(
+      "generated SimpleContinuousTimeSystem function", num_evaluations, [&]() {
+        for (int64_t i = 0; i < num_evaluations; ++i) {
+          const double x = State(i);
+          double xdot;
+          scts_derivatives::Derivatives::Calc(0.0, &x, nullptr, nullptr,
+                                              &xdot);
+          checksum += xdot;
+        }
+      });
+  std::cout << "  (checksum " << checksum << ")" << std::endl;
+
+  // The Expression for xdot, evaluated numerically.
+  const auto symbolic = System<double>::ToSymbolic(system);
+  auto symbolic_context = symbolic->CreateDefaultContext();
+  const drake::symbolic::Variable x("x");
+  symbolic_context->SetContinuousState(
+      drake::Vector1<drake::symbolic::Expression>(
+          drake::symbolic::Expression(x)));
+  const drake::symbolic::Expression xdot =
+      symbolic->EvalTimeDerivatives(*symbolic_context)[0];
+  drake::symbolic::Environment environment{{x, 0.0}};
+  checksum = 0.0;
+  fixture->Measure(
+      "SimpleContinuousTimeSystem Expression::Evaluate", num_evaluations,
+      [&]() {
+        for (int64_t i = 0; i < num_evaluations; ++i) {
+          environment[x] = State(i);
+          checksum += xdot.Evaluate(environment);
+        }
+      });
+  std::cout << "  (checksum " << checksum << ")" << std::endl;
+
+  MeasureDerivatives(fixture, "Particle derivatives", Particle<double>(), 1,
+                     num_evaluations);
+  MeasureDerivatives(fixture, "generated Particle derivatives",
+                     GeneratedSystem<particle_derivatives::Derivatives>(), 1,
+                     num_evaluations);
+}
+
+void BenchmarkJacobian(BenchmarkFixture* fixture, int64_t num_evaluations) {
+  const SimpleContinuousTimeSystem<double> system;
+  const auto autodiff = System<double>::ToAutoDiffXd(system);
+  auto autodiff_context = autodiff->CreateDefaultContext();
+  auto autodiff_derivatives = autodiff->AllocateTimeDerivatives();
+  double checksum = 0.0;
+  fixture->Measure(
+      "SimpleContinuousTimeSystem AutoDiffXd Jacobian", num_evaluations,
+      [&]() {
+        for (int64_t i = 0; i < num_evaluations; ++i) {
+          autodiff_context->SetContinuousState(
+              drake::math::InitializeAutoDiff(drake::Vector1d(State(i))));
+          autodiff->CalcTimeDerivatives(*autodiff_context,
+                                        autodiff_derivatives.get());
+          checksum += (*autodiff_derivatives)[0].derivatives()[0];
+        }
+      });
+  std::cout << "  (checksum " << checksum << ")" << std::endl;
+
+  const GeneratedSystem<scts_derivatives::Derivatives> generated;
+  auto context = generated.CreateDefaultContext();
+  drake::systems::VectorBase<double>& state =
+      context->get_mutable_continuous_state_vector();
+  checksum = 0.0;
+  fixture->Measure(
+      "generated SimpleContinuousTimeSystem Jacobian", num_evaluations, [&]() {
+        for (int64_t i = 0; i < num_evaluations; ++i) {
+          state.SetAtIndex(0, State(i));
+          checksum += generated.CalcJacobian(*context)(0, 0);
+        }
+      });
+  std::cout << "  (checksum " << checksum << ")" << std::endl;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("derivatives_codegen_benchmark", &argc, argv);
+  const int64_t num_evaluations =
+      (argc > 1) ? std::atoll(argv[1]) : 10'000'000;
+  BenchmarkDerivatives(&fixture, num_evaluations);
+  BenchmarkJacobian(&fixture, num_evaluations);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace symbolic_codegen
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::symbolic_codegen::DoMain(argc, argv);
+}
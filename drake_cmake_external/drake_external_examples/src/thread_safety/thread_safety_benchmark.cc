@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures how the throughput of concurrent evaluations of one const system,
+/// each thread with its own context, scales from 1 thread to all cores.
+///
+/// Each workload runs a fixed amount of work per thread, so perfect scaling
+/// keeps the wall time constant as threads are added; the reported speedup is
+/// the throughput relative to one thread, and the efficiency is the speedup
+/// per thread. Workloads that share one system are also run with a copy of
+/// the system per thread: if sharing is much slower, the system (or Drake
+/// beneath it) has hidden shared state that the threads contend for, e.g., a
+/// lock, a reference count or a falsely shared cache line.
+///
+/// Usage: thread_safety_benchmark [max_threads] [--json_output=<path>]
+
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/primitives/constant_vector_source.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "particle/particle.h"
+#include "simple_bindings/simple_adder.h"
+#include "thread_pool/thread_pool.h"
+
+namespace drake_external_examples {
+namespace thread_safety {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::systems::ConstantVectorSource;
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+using parallel::ThreadPool;
+using particles::Particle;
+
+constexpr int kDerivativesPerThread = 1'000'000;
+constexpr int kSimulationsPerThread = 200;
+
+// Evaluates the time derivatives of @p particle kDerivativesPerThread times,
+// as an integrator would, with a state and input that change every time.
+void EvaluateDerivatives(const Particle<double>& particle) {
+  auto context = particle.CreateDefaultContext();
+  auto derivatives = particle.AllocateTimeDerivatives();
+  auto& input =
+      particle.get_input_port(0).FixValue(context.get(), drake::Vector1d(0.0));
+  double sum = 0.0;
+  for (int i = 0; i < kDerivativesPerThread; ++i) {
+    context->SetContinuousState(drake::Vector2<double>(1.0 * i, 0.5 * i));
+    input.GetMutableVectorData<double>()->SetAtIndex(0, 1e-6 * i);
+    particle.CalcTimeDerivatives(*context, derivatives.get());
+    sum += derivatives->get_vector().GetAtIndex(1);
+  }
+  // Keeps the evaluations from being optimized away.
+  if (sum < 0.0) {
+    std::cout << sum << std::endl;
+  }
+}
+
+// Simulates @p diagram for 1 s, kSimulationsPerThread times.
+void Simulate(const Diagram<double>& diagram) {
+  for (int run = 0; run < kSimulationsPerThread; ++run) {
+    Simulator<double> simulator(diagram);
+    simulator.AdvanceTo(1.0);
+  }
+}
+
+std::unique_ptr<Diagram<double>> MakeDiagram() {
+  DiagramBuilder<double> builder;
+  auto source = builder.AddSystem<ConstantVectorSource<double>>(1.0);
+  auto adder = builder.AddSystem<SimpleAdder<double>>(0.5);
+  auto particle = builder.AddSystem<Particle<double>>();
+  builder.Connect(source->get_output_port(), adder->get_input_port(0));
+  builder.Connect(adder->get_output_port(0), particle->get_input_port(0));
+  return builder.Build();
+}
+
+// Measures @p work(thread) run on each of 1, 2, 4, ..., @p max_threads
+// threads (and on exactly @p max_threads), and records the speedup and
+// efficiency over one thread. Returns the efficiency at @p max_threads.
+double MeasureScaling(BenchmarkFixture* fixture, const std::string& name,
+                      int64_t operations_per_thread, int max_threads,
+                      const std::function<void(int thread)>& work) {
+  std::vector<int> thread_counts;
+  for (int n = 1; n < max_threads; n *= 2) {
+    thread_counts.push_back(n);
+  }
+  thread_counts.push_back(max_threads);
+
+  double one_thread_seconds = 0.0;
+  double efficiency = 0.0;
+  for (const int num_threads : thread_counts) {
+    ThreadPool pool(num_threads);
+    BenchmarkResult& result = fixture->Measure(
+        name + ", " + std::to_string(num_threads) + " threads",
+        operations_per_thread * num_threads, [&]() {
+          pool.ParallelFor(num_threads, [&](int64_t index, int) {
+            work(static_cast<int>(index));
+          });
+        });
+    if (num_threads == 1) {
+      one_thread_seconds = result.seconds;
+    }
+    const double speedup = one_thread_seconds * num_threads / result.seconds;
+    efficiency = speedup / num_threads;
+    result.values["threads"] = num_threads;
+    result.values["speedup"] = speedup;
+    result.values["efficiency"] = efficiency;
+    std::cout << "  " << speedup << "x the throughput of one thread, "
+              << 100.0 * efficiency << "% efficient" << std::endl;
+  }
+  return efficiency;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("thread_safety_benchmark", &argc, argv);
+  const int max_threads =
+      (argc > 1) ? std::atoi(argv[1])
+                 : static_cast<int>(std::thread::hardware_concurrency());
+  if (max_threads < 1) {
+    std::cerr << "max_threads must be positive" << std::endl;
+    return 1;
+  }
+
+  const Particle<double> shared_particle;
+  const double shared_efficiency = MeasureScaling(
+      &fixture, "Particle derivatives, shared system", kDerivativesPerThread,
+      max_threads, [&](int) {
+        EvaluateDerivatives(shared_particle);
+      });
+  std::vector<std::unique_ptr<Particle<double>>> particles;
+  for (int i = 0; i < max_threads; ++i) {
+    particles.push_back(std::make_unique<Particle<double>>());
+  }
+  const double copied_efficiency = MeasureScaling(
+      &fixture, "Particle derivatives, system per thread",
+      kDerivativesPerThread, max_threads, [&](int thread) {
+        EvaluateDerivatives(*particles[thread]);
+      });
+  std::cout << "  sharing one Particle is "
+            << 100.0 * shared_efficiency / copied_efficiency
+            << "% as efficient as a copy per thread" << std::endl;
+
+  const std::unique_ptr<Diagram<double>> shared_diagram = MakeDiagram();
+  const double shared_simulation_efficiency = MeasureScaling(
+      &fixture, "simulations, shared diagram", kSimulationsPerThread,
+      max_threads, [&](int) {
+        Simulate(*shared_diagram);
+      });
+  std::vector<std::unique_ptr<Diagram<double>>> diagrams;
+  for (int i = 0; i < max_threads; ++i) {
+    diagrams.push_back(MakeDiagram());
+  }
+  const double copied_simulation_efficiency = MeasureScaling(
+      &fixture, "simulations, diagram per thread", kSimulationsPerThread,
+      max_threads, [&](int thread) {
+        Simulate(*diagrams[thread]);
+      });
+  std::cout << "  sharing one diagram is "
+            << 100.0 * shared_simulation_efficiency /
+                   copied_simulation_efficiency
+            << "% as efficient as a copy per thread" << std::endl;
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace thread_safety
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::thread_safety::DoMain(argc, argv);
+}
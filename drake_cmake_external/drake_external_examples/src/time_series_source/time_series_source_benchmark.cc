@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Plays back a 10M-sample acceleration recording (1 kHz, nearly three hours)
+/// into a Particle.
+///
+/// First, it compares the per-query cost of the hinted segment lookup used by
+/// TimeSeriesSource with a binary search over the sample times (what general
+/// trajectory sources do) for monotonically increasing query times, on a
+/// non-uniformly sampled copy of the recording. Then it simulates a Particle
+/// driven by the recording and reports the simulation rate.
+///
+/// Usage: time_series_source_benchmark [num_samples] [simulated_seconds]
+///            [--json_output=<path>]
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "particle/particle.h"
+#include "time_series_source.h"
+
+namespace drake_external_examples {
+namespace time_series {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+
+constexpr double kPeriod = 1.0e-3;
+
+// A smooth, band-limited acceleration profile with some sensor noise.
+Eigen::RowVectorXd MakeRecording(int64_t num_samples) {
+  std::mt19937 generator(0);
+  std::normal_distribution<double> noise(0.0, 0.05);
+  Eigen::RowVectorXd values(num_samples);
+  for (int64_t i = 0; i < num_samples; ++i) {
+    const double t = static_cast<double>(i) * kPeriod;
+    values(i) = std::sin(0.5 * t) + 0.3 * std::sin(7.0 * t) + noise(generator);
+  }
+  return values;
+}
+
+void BenchmarkLookup(BenchmarkFixture* fixture, const std::string& filename,
+                     int64_t num_samples) {
+  // Jitter the sample times so that the table is not uniform.
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> jitter(-0.25 * kPeriod,
+                                                0.25 * kPeriod);
+  Eigen::VectorXd times(num_samples);
+  for (int64_t i = 0; i < num_samples; ++i) {
+    times(i) = static_cast<double>(i) * kPeriod + jitter(generator);
+  }
+  WriteTimeSeries(filename, times, Eigen::MatrixXd::Zero(1, num_samples));
+  const TimeSeriesTable table(filename);
+  const std::vector<double> breaks(times.data(), times.data() + times.size());
+  std::filesystem::remove(filename);
+
+  // Query at 4 kHz, i.e., roughly as often as an integrator at 1 ms steps.
+  const int64_t num_queries = 4 * num_samples;
+  const double dt = 0.25 * kPeriod;
+
+  std::cout << "lookup over " << num_samples << " samples, " << num_queries
+            << " monotonic queries:" << std::endl;
+  int64_t checksum = 0;
+  fixture->Measure("binary search lookup", num_queries, [&]() {
+    for (int64_t k = 0; k < num_queries; ++k) {
+      const double t = static_cast<double>(k) * dt;
+      const auto found = std::upper_bound(breaks.begin(), breaks.end(), t);
+      checksum += std::max<int64_t>(found - breaks.begin() - 1, 0);
+    }
+  });
+  fixture->Measure("hinted lookup", num_queries, [&]() {
+    int64_t hint = 0;
+    for (int64_t k = 0; k < num_queries; ++k) {
+      const double t = static_cast<double>(k) * dt;
+      hint = table.FindSegment(t, hint);
+      checksum -= std::min<int64_t>(hint, num_samples - 1);
+    }
+  });
+  std::cout << "(checksum " << checksum << ")" << std::endl;
+}
+
+void BenchmarkSimulation(BenchmarkFixture* fixture,
+                         const std::string& filename, int64_t num_samples,
+                         double simulated_seconds) {
+  WriteUniformTimeSeries(filename, 0.0, kPeriod, MakeRecording(num_samples));
+  std::shared_ptr<const TimeSeriesTable> table;
+  fixture->Measure("open (mmap)", 1, [&]() {
+    table = std::make_shared<const TimeSeriesTable>(filename);
+  });
+
+  drake::systems::DiagramBuilder<double> builder;
+  auto source = builder.AddSystem<TimeSeriesSource>(
+      std::move(table), TimeSeriesInterpolation::kLinear);
+  auto particle = builder.AddSystem<particles::Particle<double>>();
+  builder.Connect(source->get_output_port(0), particle->get_input_port(0));
+  auto diagram = builder.Build();
+
+  drake::systems::Simulator<double> simulator(*diagram);
+  simulator.Initialize();
+  // One operation per simulated millisecond, i.e., per recorded sample.
+  BenchmarkResult& result = fixture->Measure(
+      "simulate Particle",
+      static_cast<int64_t>(std::llround(simulated_seconds / kPeriod)),
+      [&]() {
+        simulator.AdvanceTo(simulated_seconds);
+      });
+  std::filesystem::remove(filename);
+
+  const double steps = simulator.get_integrator().get_num_steps_taken();
+  result.values["real_time_rate"] = simulated_seconds / result.seconds;
+  result.values["steps"] = steps;
+  std::cout << "Particle driven by " << num_samples << " samples: simulated "
+            << simulated_seconds << " s at "
+            << result.values["real_time_rate"] << "x real time, in " << steps
+            << " steps" << std::endl;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("time_series_source_benchmark", &argc, argv);
+  const int64_t num_samples = (argc > 1) ? std::atoll(argv[1]) : 10'000'000;
+  const double simulated_seconds =
+      (argc > 2) ? std::atof(argv[2])
+                 : std::min(600.0, static_cast<double>(num_samples) * kPeriod);
+  const std::string filename =
+      (std::filesystem::temp_directory_path() /
+       ("time_series_source_benchmark_" + std::to_string(::getpid()) + ".bin"))
+          .string();
+  BenchmarkLookup(&fixture, filename, num_samples);
+  BenchmarkSimulation(&fixture, filename, num_samples, simulated_seconds);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace time_series
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::time_series::DoMain(argc, argv);
+}
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/common/eigen_types.h>
+#include <drake/systems/primitives/vector_log.h>
+
+namespace drake_external_examples {
+namespace trajectory_dataset {
+
+/// How a TrajectoryDataset stores the values of one column of one run.
+enum class ColumnCodec : uint8_t {
+  /// The doubles, as is; these can be mapped without copying.
+  kRaw = 0,
+  /// Lossless compression for smooth signals: the second differences of the
+  /// values' bit patterns (as 64-bit integers), zigzag-encoded, and split
+  /// into 8 byte planes, each stored as all zeros, as a bitmap of its nonzero
+  /// bytes followed by those bytes, or as is, whichever is smallest. The
+  /// lowest plane is never stored as all zeros, so that every chunk takes at
+  /// least one bit per value.
+  kShuffledDelta = 1,
+};
+
+/// A value column of a TrajectoryDataset.
+struct TrajectoryColumn {
+  /// At most 55 characters, and not "time".
+  std::string name;
+  ColumnCodec codec{ColumnCodec::kShuffledDelta};
+};
+
+/// A run (e.g., one rollout of a parameter sweep) in a TrajectoryDataset.
+struct TrajectoryRun {
+  int64_t run_id{};
+  int64_t num_samples{};
+  double start_time{};
+  double end_time{};
+};
+
+/// Writes a TrajectoryDataset file, run by run; see TrajectoryDataset for the
+/// format. Runs are written as they are added, and the index at the end of
+/// the file is written by Finish().
+class TrajectoryDatasetWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TrajectoryDatasetWriter);
+
+  /// Creates @p filename, for runs that sample @p columns at common times.
+  /// @throws std::exception if a column name is invalid or repeated, or if
+  ///   the file cannot be created.
+  TrajectoryDatasetWriter(const std::string& filename,
+                          std::vector<TrajectoryColumn> columns);
+
+  /// Closes the file. Unless Finish() was called, the file has no index, and
+  /// TrajectoryDataset rejects it.
+  ~TrajectoryDatasetWriter();
+
+  /// Writes the run @p run_id whose sample i is `values.row(i)` at time
+  /// `times(i)`, i.e., each column of @p values is one column of the dataset.
+  /// @throws std::exception if @p run_id was already written, if there are
+  ///   no samples, if @p times decreases, if the sizes do not match, or if
+  ///   the file cannot be written.
+  void AddRun(int64_t run_id, const Eigen::Ref<const Eigen::VectorXd>& times,
+              const Eigen::Ref<const Eigen::MatrixXd>& values);
+
+  /// Writes the samples in @p log as the run @p run_id; the log's vector
+  /// must have one element per column.
+  void AddRun(int64_t run_id, const drake::systems::VectorLog<double>& log);
+
+  /// Writes the index and closes the file. No runs can be added afterwards.
+  /// @throws std::exception if the file cannot be written.
+  void Finish();
+
+  int num_runs() const { return static_cast<int>(runs_.size()); }
+
+ private:
+  void WriteChunk(ColumnCodec codec, const double* values, int64_t size);
+
+  std::string filename_;
+  std::vector<TrajectoryColumn> columns_;
+  std::ofstream out_;
+  uint64_t offset_{};
+  std::vector<TrajectoryRun> runs_;
+  std::unordered_set<int64_t> run_ids_;
+  // The offset and size of each run's column chunks, run by run.
+  std::vector<uint64_t> chunks_;
+  // Scratch space for compression.
+  std::vector<uint8_t> buffer_;
+  bool finished_{false};
+};
+
+/// A read-only dataset of sampled trajectories, memory-mapped from a file so
+/// that a single column of a single run (e.g., one state of one rollout out of
+/// a large sweep) is read without reading, or decompressing, anything else.
+///
+/// The file is columnar: every run stores a "time" column and the same value
+/// columns, each as a separate chunk compressed with its column's
+/// ColumnCodec. After the chunks comes an index of the columns, of the runs
+/// (with their time ranges, sorted by run id and by start time), and of the
+/// chunks, so that runs are found by id, and by time range, with binary
+/// searches. All fields are little-endian, and all chunks are 8-byte aligned:
+///
+/// - `char magic[8]`: "DEETRJD2".
+/// - The chunks, in the order they were written: run by run, and column by
+///   column within a run.
+/// - The index, at offset `index_offset`:
+///   - `uint64_t num_columns`, `uint64_t num_runs`.
+///   - For each column: `uint8_t codec`, 7 bytes of padding, and
+///     `char name[56]`, null-terminated.
+///   - For each run: `int64_t run_id`, `uint64_t num_samples`,
+///     `double start_time`, `double end_time`.
+///   - `uint64_t runs_by_id[num_runs]`: the run indices, sorted by run id.
+///   - `uint64_t runs_by_start[num_runs]`: the run indices, sorted by start
+///     time, and by index among equal start times.
+///   - For each run, and each column: `uint64_t offset`, `uint64_t size` of
+///     its chunk, in bytes. A chunk of n values takes at least n / 8 bytes,
+///     so that a reader can bound n by the size of the file.
+/// - `uint64_t index_offset`, and `char magic[8]` again.
+///
+/// trajectory_dataset.py reads and writes the same format with NumPy.
+class TrajectoryDataset {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TrajectoryDataset);
+
+  /// Maps the dataset stored in @p filename.
+  /// @throws std::exception if the file cannot be mapped or is malformed.
+  explicit TrajectoryDataset(const std::string& filename);
+
+  ~TrajectoryDataset();
+
+  /// Returns the number of columns, including the time column (column 0).
+  int num_columns() const { return static_cast<int>(columns_.size()); }
+
+  const TrajectoryColumn& column(int index) const { return columns_.at(index); }
+
+  /// Returns the index of the column named @p name.
+  /// @throws std::exception if there is no such column.
+  int FindColumn(const std::string& name) const;
+
+  int num_runs() const { return static_cast<int>(num_runs_); }
+
+  /// Returns the run with index @p index, in the order runs were written.
+  const TrajectoryRun& run(int index) const;
+
+  /// Returns the index of the run @p run_id, if there is one.
+  std::optional<int> FindRun(int64_t run_id) const;
+
+  /// Returns the indices of the runs whose time ranges overlap
+  /// [@p start_time, @p end_time], in the order they were written. Binary
+  /// searches skip the runs that start after @p end_time, and the earliest
+  /// starting runs that all end before @p start_time, so for runs of similar
+  /// durations this takes O(log(num_runs()) + k log(k)) time for k matches.
+  std::vector<int> FindRuns(double start_time, double end_time) const;
+
+  /// Decompresses column @p column of the run with index @p run_index.
+  /// @throws std::exception if either index is out of range, or the chunk is
+  ///   malformed.
+  Eigen::VectorXd ReadColumn(int run_index, int column) const;
+
+  /// Returns column @p column of the run with index @p run_index in place, in
+  /// the mapped file, if it is stored as ColumnCodec::kRaw; otherwise returns
+  /// nothing.
+  std::optional<Eigen::Map<const Eigen::VectorXd>> MapColumn(
+      int run_index, int column) const;
+
+ private:
+  struct Chunk {
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  const Chunk& GetChunk(int run_index, int column) const;
+
+  std::string filename_;
+  void* mapping_{};
+  std::size_t mapping_size_{};
+  std::vector<TrajectoryColumn> columns_;
+  uint64_t num_runs_{};
+  const TrajectoryRun* runs_{};
+  const uint64_t* runs_by_id_{};
+  const uint64_t* runs_by_start_{};
+  // The latest end time of the runs up to each position in runs_by_start_.
+  std::vector<double> max_end_times_;
+  const Chunk* chunks_{};
+};
+
+}  // namespace trajectory_dataset
+}  // namespace drake_external_examples
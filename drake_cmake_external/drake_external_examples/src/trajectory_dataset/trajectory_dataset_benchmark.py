@@ -0,0 +1,149 @@
+# SPDX-License-Identifier: MIT-0
+
+"""
+Compares a trajectory dataset with per-run `.npy` files, for the rollouts of
+a parameter sweep: the size on disk, and the time to load every run, one
+column of every run, and a few runs picked at random by id.
+
+Usage: python3 trajectory_dataset_benchmark.py [--runs=<count>]
+           [--samples=<count>] [--repetitions=<count>]
+
+The sweep has `--runs` rollouts (default 10000) of a Particle forced by
+F = a sin(w t + p), with random a, w and p, integrated with RK4 at 1 ms
+steps and logged at every step for `--samples` samples (default 1000), i.e.,
+the columns time, x and v. Loading is timed with the files in the operating
+system's page cache; the table reports the best of `--repetitions`
+(default 3).
+"""
+
+import argparse
+import os
+from pathlib import Path
+import tempfile
+import time
+
+import numpy as np
+
+from trajectory_dataset import RAW, TrajectoryDataset, write_dataset
+
+DT = 1.0e-3
+
+
+def _rollouts(num_runs, num_samples):
+    """Returns the sample times, and the positions and velocities of all
+    rollouts, with one row per run."""
+    rng = np.random.default_rng(0)
+    amplitude = rng.uniform(0.5, 2.0, num_runs)
+    frequency = rng.uniform(1.0, 10.0, num_runs)
+    phase = rng.uniform(0.0, 2.0 * np.pi, num_runs)
+
+    def force(t):
+        return amplitude * np.sin(frequency * t + phase)
+
+    times = np.arange(num_samples) * DT
+    x = np.zeros((num_runs, num_samples))
+    v = np.zeros((num_runs, num_samples))
+    for i in range(1, num_samples):
+        t, x0, v0 = times[i - 1], x[:, i - 1], v[:, i - 1]
+        a1 = force(t)
+        a2 = force(t + DT / 2)
+        a4 = force(t + DT)
+        x[:, i] = x0 + DT * v0 + DT**2 / 6 * (a1 + 2 * a2)
+        v[:, i] = v0 + DT / 6 * (a1 + 4 * a2 + a4)
+    return times, x, v
+
+
+def _best_time(function, repetitions):
+    best = float("inf")
+    for _ in range(repetitions):
+        start = time.perf_counter()
+        function()
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.split("\n\n")[0].strip())
+    parser.add_argument("--runs", type=int, default=10000)
+    parser.add_argument("--samples", type=int, default=1000)
+    parser.add_argument("--repetitions", type=int, default=3)
+    args = parser.parse_args()
+    if args.runs < 1 or args.samples < 1 or args.repetitions < 1:
+        parser.error("the counts must be positive")
+
+    times, x, v = _rollouts(args.runs, args.samples)
+    run_ids = np.arange(args.runs)
+    picks = np.random.default_rng(1).choice(
+        run_ids, min(100, args.runs), replace=False)
+
+    def runs():
+        for run_id in run_ids:
+            yield run_id, times, np.stack([x[run_id], v[run_id]], axis=1)
+
+    with tempfile.TemporaryDirectory() as scratch:
+        scratch = Path(scratch)
+        npy_dir = scratch / "npy"
+        npy_dir.mkdir()
+
+        start = time.perf_counter()
+        for run_id, run_times, values in runs():
+            np.save(npy_dir / f"{run_id}.npy",
+                    np.column_stack([run_times, values]))
+        written = {".npy files": (time.perf_counter() - start, npy_dir)}
+        for name, filename, codecs in (
+                ("dataset (raw)", scratch / "raw.trj", [RAW, RAW]),
+                ("dataset (compressed)", scratch / "compressed.trj", None)):
+            start = time.perf_counter()
+            write_dataset(filename, ["x", "v"], runs(), codecs)
+            written[name] = (time.perf_counter() - start, filename)
+
+        def npy_all():
+            for run_id in run_ids:
+                np.load(npy_dir / f"{run_id}.npy")
+
+        def npy_column():
+            for run_id in run_ids:
+                np.array(np.load(npy_dir / f"{run_id}.npy", mmap_mode="r")[
+                    :, 1])
+
+        def npy_picks():
+            for run_id in picks:
+                np.load(npy_dir / f"{run_id}.npy")
+
+        loads = {".npy files": (npy_all, npy_column, npy_picks)}
+        for name in ("dataset (raw)", "dataset (compressed)"):
+            dataset = TrajectoryDataset(written[name][1])
+
+            def dataset_all(dataset=dataset):
+                for i in range(dataset.num_runs):
+                    dataset.read_run(i)
+
+            def dataset_column(dataset=dataset):
+                for i in range(dataset.num_runs):
+                    dataset.read_column(i, "x")
+
+            def dataset_picks(dataset=dataset):
+                for run_id in picks:
+                    dataset.read_run(dataset.find_run(run_id))
+
+            loads[name] = (dataset_all, dataset_column, dataset_picks)
+
+        print(f"{args.runs} rollouts of {args.samples} samples "
+              f"(time, x, v; {24 * args.runs * args.samples / 1e6:.1f} MB "
+              f"of doubles)")
+        print(f"{'format':<22}{'size [MB]':>10}{'write [s]':>11}"
+              f"{'load all [s]':>14}{'load x [s]':>12}"
+              f"{'load 100 [ms]':>15}")
+        for name, (write_seconds, path) in written.items():
+            size = (sum(f.stat().st_size for f in path.iterdir())
+                    if path.is_dir() else os.path.getsize(path))
+            all_seconds, column_seconds, picks_seconds = (
+                _best_time(load, args.repetitions) for load in loads[name])
+            print(f"{name:<22}{size / 1e6:>10.1f}{write_seconds:>11.2f}"
+                  f"{all_seconds:>14.3f}{column_seconds:>12.3f}"
+                  f"{picks_seconds * 1e3:>15.2f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,125 @@
+# SPDX-License-Identifier: MIT-0
+
+import os
+import tempfile
+import unittest
+
+import numpy as np
+
+from trajectory_dataset import (
+    RAW, SHUFFLED_DELTA, TrajectoryDataset, write_dataset)
+
+
+class TestTrajectoryDataset(unittest.TestCase):
+    """A test case for reading and writing trajectory datasets."""
+    def setUp(self):
+        self.scratch = tempfile.TemporaryDirectory()
+        self.filename = os.path.join(self.scratch.name, "dataset.trj")
+        rng = np.random.default_rng(0)
+        self.runs = []
+        for run in range(3):
+            times = np.linspace(run, run + 1, 1 + 500 * run)
+            values = np.column_stack([
+                np.sin(times), np.cos(times),
+                rng.integers(0, 2**64, len(times), np.uint64,
+                             endpoint=False).view(np.float64)])
+            if len(times) > 4:
+                values[1:4, 0] = [np.inf, -0.0, 5e-324]
+            # Ids need not be written in order.
+            self.runs.append((100 - run, times, values))
+
+    def tearDown(self):
+        self.scratch.cleanup()
+
+    def test_round_trip(self):
+        """
+        Makes sure runs round-trip exactly through both codecs, and can be
+        found by id and by time range.
+        """
+        write_dataset(self.filename, ["smooth", "raw", "noise"], self.runs,
+                      [SHUFFLED_DELTA, RAW, SHUFFLED_DELTA])
+        dataset = TrajectoryDataset(self.filename)
+        self.assertEqual(dataset.column_names,
+                         ["time", "smooth", "raw", "noise"])
+        self.assertEqual(dataset.num_runs, 3)
+        for index, (run_id, times, values) in enumerate(self.runs):
+            self.assertEqual(dataset.find_run(run_id), index)
+            self.assertEqual(dataset.runs["num_samples"][index], len(times))
+            columns = dataset.read_run(index)
+            np.testing.assert_array_equal(
+                columns["time"].view(np.uint64), times.view(np.uint64))
+            for j, name in enumerate(["smooth", "raw", "noise"]):
+                np.testing.assert_array_equal(
+                    columns[name].view(np.uint64),
+                    values[:, j].copy().view(np.uint64))
+            # Raw columns are views of the file.
+            self.assertFalse(columns["raw"].flags.owndata)
+            self.assertFalse(columns["raw"].flags.writeable)
+        self.assertIsNone(dataset.find_run(7))
+        np.testing.assert_array_equal(dataset.find_runs(1.2, 2.0), [1, 2])
+        np.testing.assert_array_equal(dataset.find_runs(5.0, 6.0), [])
+
+    def test_find_runs(self):
+        """
+        Makes sure runs found by time range with the sorted index match a
+        scan of every run.
+        """
+        rng = np.random.default_rng(1)
+        starts = rng.uniform(0.0, 100.0, 200)
+        durations = np.where(np.arange(200) % 7 == 0, 50.0,
+                             rng.uniform(0.0, 5.0, 200))
+        runs = [(i, [start, start + duration], [[0.0], [0.0]])
+                for i, (start, duration) in enumerate(zip(starts, durations))]
+        write_dataset(self.filename, ["x"], runs)
+        dataset = TrajectoryDataset(self.filename)
+        for start_time in rng.uniform(-10.0, 160.0, 500):
+            end_time = start_time + rng.choice([0.0, 1.0, 20.0])
+            np.testing.assert_array_equal(
+                dataset.find_runs(start_time, end_time),
+                np.flatnonzero((starts <= end_time)
+                               & (starts + durations >= start_time)))
+        # A column of zeros still takes one bit per value.
+        np.testing.assert_array_equal(dataset.read_column(3, "x"), [0, 0])
+
+    def test_compression(self):
+        """Makes sure a smooth trajectory takes less space compressed."""
+        times = np.arange(5001) * 1e-3
+        runs = [(0, times, np.column_stack([np.sin(3 * times),
+                                            3 * np.cos(3 * times)]))]
+        raw_filename = os.path.join(self.scratch.name, "raw.trj")
+        write_dataset(raw_filename, ["x", "v"], runs, [RAW, RAW])
+        write_dataset(self.filename, ["x", "v"], runs)
+        self.assertLess(os.path.getsize(self.filename),
+                        0.85 * os.path.getsize(raw_filename))
+        np.testing.assert_array_equal(
+            TrajectoryDataset(self.filename).read_column(0, "v"),
+            runs[0][2][:, 1])
+
+    def test_bad_input(self):
+        """Makes sure malformed datasets and runs are rejected."""
+        with open(self.filename, "wb") as f:
+            f.write(b"this is not a trajectory dataset, not at all")
+        with self.assertRaises(ValueError):
+            TrajectoryDataset(self.filename)
+        with self.assertRaises(ValueError):
+            write_dataset(self.filename, ["time"], [])
+        with self.assertRaises(ValueError):
+            write_dataset(self.filename, ["x"],
+                          [(0, [1.0, 0.0], [[1.0], [2.0]])])
+        with self.assertRaises(ValueError):
+            write_dataset(self.filename, ["x"],
+                          [(0, [0.0], [[1.0]]), (0, [1.0], [[2.0]])])
+        with self.assertRaises(ValueError):
+            write_dataset(self.filename, ["x"], [(0, [np.nan], [[1.0]])])
+
+        # A run whose number of samples its chunks could not hold.
+        write_dataset(self.filename, ["a", "b", "c"], self.runs[:1])
+        with open(self.filename, "r+b") as f:
+            f.seek(-16, os.SEEK_END)
+            index_offset = int.from_bytes(f.read(8), "little")
+            # After the counts and four column records, the run's
+            # num_samples follows its run_id.
+            f.seek(index_offset + 16 + 4 * 64 + 8)
+            f.write((2**40).to_bytes(8, "little"))
+        with self.assertRaises(ValueError):
+            TrajectoryDataset(self.filename)
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "adjoint.h"
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <drake/common/autodiff.h>
+#include <drake/common/trajectories/piecewise_polynomial.h>
+#include <drake/math/autodiff.h>
+#include <drake/math/autodiff_gradient.h>
+#include <drake/systems/analysis/integrator_base.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/framework/leaf_system.h>
+
+#include "dense_output/dense_output.h"
+
+namespace drake_external_examples {
+namespace adjoint {
+namespace {
+
+using drake::AutoDiffXd;
+using drake::systems::Context;
+using drake::systems::ContinuousState;
+using drake::systems::LeafSystem;
+using drake::systems::Simulator;
+using drake::systems::System;
+using drake::trajectories::PiecewisePolynomial;
+
+// Evaluates the vector-Jacobian product [∂f/∂x ∂f/∂p]ᵀ λ of a system's time
+// derivatives f(t, x, p). Drake has no reverse-mode differentiation, so this
+// forms the Jacobian on an AutoDiffXd copy of the system, whose parameters are
+// seeded once and whose state is re-seeded on every call.
+class VectorJacobianProduct {
+ public:
+  VectorJacobianProduct(const System<double>& system,
+                        const Context<double>& context)
+      : system_(System<double>::ToAutoDiffXd(system)),
+        context_(system_->CreateDefaultContext()),
+        derivatives_(system_->AllocateTimeDerivatives()),
+        num_states_(context.num_continuous_states()) {
+    context_->SetTimeStateAndParametersFrom(context);
+    system_->FixInputPortsFrom(system, context, context_.get());
+    num_parameters_ = 0;
+    for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+      num_parameters_ += context.get_numeric_parameter(i).size();
+    }
+    int offset = num_states_;
+    for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+      const Eigen::VectorXd p =
+          context.get_numeric_parameter(i).CopyToVector();
+      context_->get_mutable_numeric_parameter(i).SetFromVector(
+          drake::math::InitializeAutoDiff(p, num_derivatives(), offset));
+      offset += p.size();
+    }
+  }
+
+  int num_states() const { return num_states_; }
+  int num_parameters() const { return num_parameters_; }
+  int num_derivatives() const { return num_states_ + num_parameters_; }
+
+  Eigen::VectorXd Calc(double t, const Eigen::VectorXd& x,
+                       const Eigen::VectorXd& lambda) {
+    context_->SetTime(t);
+    context_->SetContinuousState(
+        drake::math::InitializeAutoDiff(x, num_derivatives(), 0));
+    system_->CalcTimeDerivatives(*context_, derivatives_.get());
+    const Eigen::MatrixXd jacobian = drake::math::ExtractGradient(
+        derivatives_->CopyToVector(), num_derivatives());
+    return jacobian.transpose() * lambda;
+  }
+
+ private:
+  const std::unique_ptr<System<AutoDiffXd>> system_;
+  const std::unique_ptr<Context<AutoDiffXd>> context_;
+  const std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives_;
+  const int num_states_;
+  int num_parameters_{};
+};
+
+// The adjoint ODE over one interval [t₀, t₁], in reversed time τ = t₁ − t so
+// that the Simulator can integrate it forwards. Its state is a = [λ; μ], and
+//   da/dτ = [∂f/∂x ∂f/∂p]ᵀ λ,
+// with x(t) interpolated from the interval's forward trajectory.
+class AdjointSystem final : public LeafSystem<double> {
+ public:
+  explicit AdjointSystem(VectorJacobianProduct* vjp) : vjp_(vjp) {
+    DeclareContinuousState(vjp->num_derivatives());
+  }
+
+  // Sets the forward trajectory over [t₀, t₁] and its end time t₁.
+  void set_interval(const PiecewisePolynomial<double>* trajectory,
+                    double end_time) {
+    trajectory_ = trajectory;
+    end_time_ = end_time;
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    const double t = end_time_ - context.get_time();
+    const Eigen::VectorXd a = context.get_continuous_state_vector()
+                                  .CopyToVector();
+    derivatives->SetFromVector(
+        vjp_->Calc(t, trajectory_->value(t), a.head(vjp_->num_states())));
+  }
+
+  VectorJacobianProduct* const vjp_;
+  const PiecewisePolynomial<double>* trajectory_{};
+  double end_time_{};
+};
+
+void ConfigureIntegrator(const AdjointOptions& options,
+                         Simulator<double>* simulator) {
+  if (options.target_accuracy.has_value()) {
+    simulator->get_mutable_integrator().set_target_accuracy(
+        *options.target_accuracy);
+  }
+}
+
+}  // namespace
+
+AdjointResult CalcAdjointGradients(
+    const System<double>& system, const Context<double>& context,
+    double t_final, const TerminalCostGradient& terminal_cost_gradient,
+    const AdjointOptions& options) {
+  const double t0 = context.get_time();
+  if (!(t_final > t0)) {
+    throw std::logic_error(
+        "CalcAdjointGradients: t_final must be after the start");
+  }
+  if (options.num_checkpoints < 0) {
+    throw std::logic_error("CalcAdjointGradients: invalid options");
+  }
+  if (context.num_discrete_state_groups() > 0 ||
+      context.num_abstract_states() > 0) {
+    throw std::logic_error(
+        "CalcAdjointGradients: only continuous state is supported");
+  }
+  const bool keep_trajectory = (options.num_checkpoints == 0);
+  const int num_intervals = keep_trajectory ? 1 : options.num_checkpoints;
+  auto interval_time = [&](int n) {
+    return (n == num_intervals) ? t_final
+                                : t0 + (t_final - t0) * n / num_intervals;
+  };
+
+  // Forward pass, keeping the state at the start of each interval (or the
+  // whole trajectory).
+  Simulator<double> forward(system, context.Clone());
+  ConfigureIntegrator(options, &forward);
+  std::vector<Eigen::VectorXd> checkpoints(num_intervals);
+  std::unique_ptr<PiecewisePolynomial<double>> trajectory;
+  for (int n = 0; n < num_intervals; ++n) {
+    checkpoints[n] = forward.get_context().get_continuous_state_vector()
+                         .CopyToVector();
+    if (keep_trajectory) {
+      trajectory = dense_output::AdvanceToWithDenseOutput(&forward, t_final);
+    } else {
+      forward.AdvanceTo(interval_time(n + 1));
+    }
+  }
+
+  AdjointResult result;
+  result.final_state =
+      forward.get_context().get_continuous_state_vector().CopyToVector();
+  const Eigen::VectorXd lambda_final = terminal_cost_gradient(
+      result.final_state);
+  if (lambda_final.size() != result.final_state.size()) {
+    throw std::logic_error(
+        "CalcAdjointGradients: the terminal cost gradient has the wrong size");
+  }
+
+  // Backward pass, one interval at a time, last to first.
+  VectorJacobianProduct vjp(system, context);
+  AdjointSystem adjoint_system(&vjp);
+  Simulator<double> backward(adjoint_system);
+  ConfigureIntegrator(options, &backward);
+  Eigen::VectorXd a = Eigen::VectorXd::Zero(vjp.num_derivatives());
+  a.head(vjp.num_states()) = lambda_final;
+  for (int n = num_intervals - 1; n >= 0; --n) {
+    const double start = interval_time(n);
+    const double end = interval_time(n + 1);
+    if (!keep_trajectory) {
+      Context<double>& forward_context = forward.get_mutable_context();
+      forward_context.SetTime(start);
+      forward_context.SetContinuousState(checkpoints[n]);
+      forward.Initialize();
+      trajectory = dense_output::AdvanceToWithDenseOutput(&forward, end);
+    }
+    adjoint_system.set_interval(trajectory.get(), end);
+    Context<double>& backward_context = backward.get_mutable_context();
+    backward_context.SetTime(0.0);
+    backward_context.SetContinuousState(a);
+    backward.Initialize();
+    backward.AdvanceTo(end - start);
+    a = backward.get_context().get_continuous_state_vector().CopyToVector();
+  }
+
+  result.initial_state_gradient = a.head(vjp.num_states());
+  int offset = vjp.num_states();
+  for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+    const int size = context.get_numeric_parameter(i).size();
+    result.parameter_gradients.push_back(a.segment(offset, size));
+    offset += size;
+  }
+  return result;
+}
+
+}  // namespace adjoint
+}  // namespace drake_external_examples
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/system.h>
+
+namespace drake_external_examples {
+namespace adjoint {
+
+/// Returns the gradient ∂L/∂x(t_final) of a scalar terminal cost L, given the
+/// final continuous state x(t_final).
+using TerminalCostGradient =
+    std::function<Eigen::VectorXd(const Eigen::VectorXd& final_state)>;
+
+/// Configures CalcAdjointGradients().
+struct AdjointOptions {
+  /// The number of evenly spaced intervals the horizon is split into. The
+  /// forward pass keeps only the state at the start of each interval, and the
+  /// backward pass recomputes the trajectory one interval at a time, so memory
+  /// is bounded by the steps of one interval. Zero instead keeps the whole
+  /// trajectory from the forward pass, which avoids recomputing it at the cost
+  /// of memory proportional to the total number of steps.
+  int num_checkpoints{8};
+
+  /// The target accuracy of the forward and backward integrators; if unset,
+  /// the Simulator default is used.
+  std::optional<double> target_accuracy;
+};
+
+/// Reports the outcome of CalcAdjointGradients().
+struct AdjointResult {
+  /// The continuous state at t_final.
+  Eigen::VectorXd final_state;
+  /// ∂L/∂x(t₀), the gradient with respect to the initial continuous state.
+  Eigen::VectorXd initial_state_gradient;
+  /// ∂L/∂p for each numeric parameter group p of the context, indexed like
+  /// Context::get_numeric_parameter().
+  std::vector<Eigen::VectorXd> parameter_gradients;
+};
+
+/// Computes the gradient of a terminal cost L(x(t_final)) with respect to the
+/// initial state and all numeric parameters of @p system, by integrating the
+/// adjoint ODE backwards in time.
+///
+/// With ẋ = f(t, x, p), the adjoint λ(t) = ∂L/∂x(t) and the accumulated
+/// parameter gradient μ(t) satisfy
+///
+///   λ̇ = −(∂f/∂x)ᵀ λ,   μ̇ = −(∂f/∂p)ᵀ λ,
+///
+/// from λ(t_final) = ∂L/∂x(t_final) and μ(t_final) = 0 back to t₀, where
+/// ∂L/∂x(t₀) = λ(t₀) and ∂L/∂p = μ(t₀). The state trajectory x(t) comes from
+/// the forward pass's dense output. Unlike forward sensitivities (simulating
+/// an AutoDiffXd system), which integrate |x| (|x| + |p|) sensitivities, only
+/// one vector-valued ODE of size |x| + |p| is integrated backwards.
+///
+/// Its right-hand side is not cheap, though. Drake has no reverse-mode
+/// differentiation, so each vector-Jacobian product forms the full Jacobian
+/// [∂f/∂x ∂f/∂p] on an AutoDiffXd copy of @p system, seeded with |x| + |p|
+/// derivatives, and multiplies it by λ; @p system must support scalar
+/// conversion to AutoDiffXd. Each backward step therefore costs about as much
+/// as a step of forward sensitivities, and the backward pass grows with the
+/// number of parameters rather than costing about one more simulation.
+/// adjoint_benchmark measures how.
+///
+/// @p system must have only continuous state, and its inputs (if any) must
+/// be fixed in @p context.
+///
+/// @throws std::exception if @p t_final is not after the context time, the
+/// options are invalid, or @p terminal_cost_gradient returns a vector of the
+/// wrong size.
+AdjointResult CalcAdjointGradients(
+    const drake::systems::System<double>& system,
+    const drake::systems::Context<double>& context, double t_final,
+    const TerminalCostGradient& terminal_cost_gradient,
+    const AdjointOptions& options = {});
+
+}  // namespace adjoint
+}  // namespace drake_external_examples
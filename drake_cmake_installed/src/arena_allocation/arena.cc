@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "arena.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace drake_external_examples {
+namespace arena_allocation {
+namespace {
+
+// All arenas live in one region of address space, reserved on first use and
+// divided into fixed-size slots, so that operator delete can tell an arena's
+// memory from the heap's, and find its arena, with a comparison and a
+// division.
+constexpr int kNumSlots = 64;
+constexpr std::size_t kSlotSize = std::size_t{16} << 30;
+constexpr std::size_t kAlignment = alignof(std::max_align_t);
+
+std::atomic<char*> g_region{nullptr};
+std::atomic<Arena*> g_slots[kNumSlots];
+std::mutex g_slots_mutex;
+
+thread_local Arena* t_current = nullptr;
+
+char* ReserveRegion() {
+  // Guarded by g_slots_mutex.
+  if (char* region = g_region.load(std::memory_order_relaxed)) {
+    return region;
+  }
+  void* region = ::mmap(nullptr, kNumSlots * kSlotSize, PROT_NONE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (region == MAP_FAILED) {
+    throw std::runtime_error(std::string("Arena: cannot reserve memory: ") +
+                             std::strerror(errno));
+  }
+  g_region.store(static_cast<char*>(region), std::memory_order_release);
+  return static_cast<char*>(region);
+}
+
+std::size_t RoundUpToPage(std::size_t size) {
+  const std::size_t page = ::sysconf(_SC_PAGESIZE);
+  return (size + page - 1) / page * page;
+}
+
+}  // namespace
+
+Arena::Arena(std::size_t capacity) : capacity_(capacity) {
+  if (capacity_ > max_capacity()) {
+    throw std::logic_error("Arena: the capacity " + std::to_string(capacity_) +
+                           " exceeds the maximum " +
+                           std::to_string(max_capacity()));
+  }
+  std::lock_guard<std::mutex> lock(g_slots_mutex);
+  char* const region = ReserveRegion();
+  slot_ = 0;
+  while (slot_ < kNumSlots &&
+         g_slots[slot_].load(std::memory_order_relaxed) != nullptr) {
+    ++slot_;
+  }
+  if (slot_ == kNumSlots) {
+    throw std::runtime_error("Arena: more than " + std::to_string(kNumSlots) +
+                             " arenas at once");
+  }
+  begin_ = region + slot_ * kSlotSize;
+  if (capacity_ > 0 && ::mprotect(begin_, RoundUpToPage(capacity_),
+                                  PROT_READ | PROT_WRITE) != 0) {
+    throw std::runtime_error(std::string("Arena: cannot map memory: ") +
+                             std::strerror(errno));
+  }
+  g_slots[slot_].store(this, std::memory_order_release);
+}
+
+Arena::~Arena() {
+  if (num_live_allocations() != 0 || in_scope_) {
+    std::fprintf(stderr,
+                 "Arena: destroyed while in scope, or with %lld live "
+                 "allocations\n",
+                 static_cast<long long>(num_live_allocations()));
+    std::abort();
+  }
+  std::lock_guard<std::mutex> lock(g_slots_mutex);
+  g_slots[slot_].store(nullptr, std::memory_order_release);
+  if (capacity_ > 0) {
+    // Return the physical memory, and the slot's address space, for reuse.
+    const std::size_t size = RoundUpToPage(capacity_);
+    ::madvise(begin_, size, MADV_DONTNEED);
+    ::mprotect(begin_, size, PROT_NONE);
+  }
+}
+
+std::size_t Arena::max_capacity() {
+  return kSlotSize;
+}
+
+void Arena::Reset() {
+  const int64_t num_live = num_live_allocations();
+  if (num_live != 0) {
+    throw std::logic_error("Arena: cannot reset with " +
+                           std::to_string(num_live) + " live allocations");
+  }
+  used_ = 0;
+}
+
+void* Arena::Allocate(std::size_t size) {
+  // Allocations are distinct even when empty, and aligned for any type.
+  const std::size_t padded =
+      (std::max<std::size_t>(size, 1) + kAlignment - 1) / kAlignment *
+      kAlignment;
+  if (padded > capacity_ - used_) {
+    ++num_overflows_;
+    return nullptr;
+  }
+  void* const result = begin_ + used_;
+  used_ += padded;
+  num_live_.fetch_add(1, std::memory_order_relaxed);
+  return result;
+}
+
+Arena* Arena::Find(const void* ptr) {
+  const char* const region = g_region.load(std::memory_order_acquire);
+  const char* const p = static_cast<const char*>(ptr);
+  if (region == nullptr || p < region || p >= region + kNumSlots * kSlotSize) {
+    return nullptr;
+  }
+  return g_slots[(p - region) / kSlotSize].load(std::memory_order_acquire);
+}
+
+ArenaScope::ArenaScope(Arena* arena) : arena_(arena), previous_(t_current) {
+  if (arena_ == nullptr || arena_->in_scope_) {
+    throw std::logic_error("ArenaScope: the arena is null or in scope");
+  }
+  arena_->in_scope_ = true;
+  t_current = arena_;
+}
+
+ArenaScope::~ArenaScope() {
+  t_current = previous_;
+  arena_->in_scope_ = false;
+}
+
+Arena* ArenaScope::current() {
+  return t_current;
+}
+
+}  // namespace arena_allocation
+}  // namespace drake_external_examples
+
+using drake_external_examples::arena_allocation::Arena;
+using drake_external_examples::arena_allocation::ArenaScope;
+
+void* operator new(std::size_t size) {
+  if (Arena* arena = ArenaScope::current()) {
+    if (void* result = arena->Allocate(size)) {
+      return result;
+    }
+  }
+  if (void* result = std::malloc(size == 0 ? 1 : size)) {
+    return result;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (Arena* arena = Arena::Find(ptr)) {
+    arena->Deallocate();
+    return;
+  }
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept { operator delete(ptr); }
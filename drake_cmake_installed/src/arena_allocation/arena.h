@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <drake/common/drake_copyable.h>
+
+namespace drake_external_examples {
+namespace arena_allocation {
+
+/// A monotonic memory arena: one contiguous block of memory that allocations
+/// are carved from by bumping an offset, and that is released all at once, in
+/// O(1), by Reset().
+///
+/// Drake objects allocate through the global operator new, and take no
+/// allocators, so an arena is used by putting it in scope on a thread with an
+/// ArenaScope: while the scope is alive, every global operator new on that
+/// thread (e.g., within CreateDefaultContext(), AllocateOutput(), or a whole
+/// Simulator run) takes its memory from the arena, and the matching operator
+/// delete, on any thread, only counts it as freed. Linking this library
+/// replaces the global operator new and delete to make that work; outside of
+/// an ArenaScope they use malloc() and free() as usual.
+///
+/// The objects carved from an arena lie next to each other in the order they
+/// were created, instead of scattered over the heap, and creating them costs
+/// a few instructions each. Over-aligned allocations (those through
+/// `operator new(std::size_t, std::align_val_t)`), and those that no longer
+/// fit, are served by the heap instead.
+///
+/// Only operator new is routed, not malloc(). Eigen allocates the storage of
+/// its dynamic-size matrices with malloc() (in Eigen::internal::aligned_malloc,
+/// compiled into Drake's own library), so the values of every BasicVector,
+/// e.g. of a context's state, parameters and fixed inputs, and of outputs and
+/// derivatives, stay on the heap: an arena holds the objects and containers
+/// of a context, but not the numbers in them.
+///
+/// Everything allocated from an arena must be deleted before it is Reset() or
+/// destroyed. Anything created for the first time within a scope that lives
+/// on, e.g., a function-local static or a logger, would violate that, so warm
+/// up such code outside of any arena first.
+///
+/// An arena may be in scope on only one thread at a time.
+class Arena {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Arena);
+
+  /// Creates an arena of @p capacity bytes. Its address space is reserved up
+  /// front, but physical memory is only committed as it is first used.
+  /// @throws std::exception if @p capacity exceeds max_capacity(), or too
+  /// many arenas exist at once.
+  explicit Arena(std::size_t capacity);
+
+  /// @pre Everything allocated from this arena has been deleted, and it is
+  /// not in scope; otherwise, the program is aborted.
+  ~Arena();
+
+  /// Returns the largest capacity an arena may have.
+  static std::size_t max_capacity();
+
+  std::size_t capacity() const { return capacity_; }
+
+  /// Returns the number of bytes carved from the arena since it was created
+  /// or last Reset(), including alignment padding.
+  std::size_t used() const { return used_; }
+
+  /// Returns the number of allocations carved from the arena that have not
+  /// been deleted.
+  int64_t num_live_allocations() const {
+    return num_live_.load(std::memory_order_acquire);
+  }
+
+  /// Returns the number of allocations made in this arena's scope that were
+  /// served by the heap because they did not fit.
+  int64_t num_overflows() const { return num_overflows_; }
+
+  /// Makes all of the arena's capacity available again, keeping its memory
+  /// committed for reuse.
+  /// @throws std::exception if any allocation from the arena is still live.
+  void Reset();
+
+  /// Returns the memory of @p size bytes, or nullptr if it does not fit.
+  /// For use by operator new.
+  void* Allocate(std::size_t size);
+
+  /// Counts one allocation from this arena as deleted. For use by operator
+  /// delete.
+  void Deallocate() { num_live_.fetch_sub(1, std::memory_order_release); }
+
+  /// Returns the arena that @p ptr was allocated from, or nullptr if it was
+  /// not allocated from an arena.
+  static Arena* Find(const void* ptr);
+
+ private:
+  friend class ArenaScope;
+
+  const std::size_t capacity_;
+  int slot_{};
+  char* begin_{};
+  std::size_t used_{0};
+  std::atomic<int64_t> num_live_{0};
+  int64_t num_overflows_{0};
+  bool in_scope_{false};
+};
+
+/// Routes the global operator new of the current thread to an arena for the
+/// lifetime of the scope. Scopes may nest; the innermost one wins.
+class ArenaScope {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ArenaScope);
+
+  /// Puts @p arena in scope on this thread.
+  /// @throws std::exception if @p arena is in scope already.
+  explicit ArenaScope(Arena* arena);
+
+  ~ArenaScope();
+
+  /// Returns the arena in scope on this thread, or nullptr if there is none.
+  static Arena* current();
+
+ private:
+  Arena* const arena_;
+  Arena* const previous_;
+};
+
+}  // namespace arena_allocation
+}  // namespace drake_external_examples
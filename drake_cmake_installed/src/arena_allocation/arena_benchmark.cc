@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Compares carving per-rollout objects from an Arena with allocating them on
+/// the heap.
+///
+/// The first workload creates a context, time derivatives and output for
+/// each of many Particles in bulk (as a batch driver would), evaluates the
+/// time derivatives of all of them repeatedly, and then releases them. It
+/// runs on the heap as the program finds it, on a heap fragmented by other
+/// allocations interleaved with the batch (as in a long-running process),
+/// and on an arena; and reports the time to create, evaluate and release,
+/// and the growth of the resident set size. The Eigen storage of their
+/// vectors is allocated with malloc(), and so is on the heap in every case.
+///
+/// The second workload simulates a batch of rollouts of the Simple
+/// Continuous Time System with SimulateBatch(), with and without arenas.
+///
+/// Usage: arena_benchmark [num_objects] [num_threads] [--json_output=<path>]
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/framework/system_output.h>
+
+#include "arena.h"
+#include "batch_simulation.h"
+#include "benchmark_harness/benchmark_fixture.h"
+#include "particle/particle.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace arena_allocation {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::systems::Context;
+using drake::systems::ContinuousState;
+using drake::systems::SystemOutput;
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+constexpr int kNumSweeps = 20;
+
+enum class Allocation { kHeap, kFragmentedHeap, kArena };
+
+// Returns the resident set size of this process, in bytes.
+int64_t ResidentBytes() {
+  std::ifstream statm("/proc/self/statm");
+  int64_t size = 0;
+  int64_t resident = 0;
+  statm >> size >> resident;
+  return resident * ::sysconf(_SC_PAGESIZE);
+}
+
+// The objects of one Particle rollout.
+struct Objects {
+  std::unique_ptr<Context<double>> context;
+  std::unique_ptr<ContinuousState<double>> derivatives;
+  std::unique_ptr<SystemOutput<double>> output;
+};
+
+void BenchmarkBulkObjects(BenchmarkFixture* fixture, Allocation allocation,
+                          int num_objects) {
+  const std::string label = allocation == Allocation::kHeap ? "heap"
+                            : allocation == Allocation::kFragmentedHeap
+                                ? "fragmented heap"
+                                : "arena";
+  const Particle<double> particle;
+  std::vector<Objects> objects;
+  objects.reserve(num_objects);
+  // Other allocations of random sizes, made between the objects and freed
+  // after them, to scatter them over the heap.
+  std::vector<std::unique_ptr<char[]>> clutter;
+  std::mt19937 generator(0);
+  std::uniform_int_distribution<int> clutter_size(16, 1024);
+  std::unique_ptr<Arena> arena;
+  if (allocation == Allocation::kArena) {
+    arena = std::make_unique<Arena>(std::size_t{1} << 32);
+  }
+
+  const int64_t resident_before = ResidentBytes();
+  BenchmarkResult& create =
+      fixture->Measure("create, " + label, num_objects, [&]() {
+        std::unique_ptr<ArenaScope> scope;
+        if (arena != nullptr) {
+          scope = std::make_unique<ArenaScope>(arena.get());
+        }
+        for (int i = 0; i < num_objects; ++i) {
+          Objects& added = objects.emplace_back();
+          added.context = particle.CreateDefaultContext();
+          added.context->SetContinuousState(Eigen::Vector2d(0.0, 1.0 * i));
+          particle.get_input_port(0).FixValue(added.context.get(),
+                                              drake::Vector1d(1e-3 * i));
+          added.derivatives = particle.AllocateTimeDerivatives();
+          added.output = particle.AllocateOutput();
+          if (allocation == Allocation::kFragmentedHeap) {
+            for (int j = 0; j < 8; ++j) {
+              clutter.emplace_back(new char[clutter_size(generator)]);
+            }
+          }
+        }
+      });
+  create.values["resident_bytes_per_object"] =
+      static_cast<double>(ResidentBytes() - resident_before) / num_objects;
+  if (arena != nullptr) {
+    create.values["arena_bytes_per_object"] =
+        static_cast<double>(arena->used()) / num_objects;
+  }
+  std::cout << "  " << create.values["resident_bytes_per_object"]
+            << " resident bytes per object" << std::endl;
+
+  double sum = 0.0;
+  const BenchmarkResult& evaluate = fixture->Measure(
+      "evaluate derivatives, " + label,
+      static_cast<int64_t>(kNumSweeps) * num_objects, [&]() {
+        for (int sweep = 0; sweep < kNumSweeps; ++sweep) {
+          for (Objects& rollout : objects) {
+            particle.CalcTimeDerivatives(*rollout.context,
+                                         rollout.derivatives.get());
+            particle.CalcOutput(*rollout.context, rollout.output.get());
+            sum += rollout.derivatives->get_vector().GetAtIndex(1) +
+                   rollout.output->get_vector_data(0)->GetAtIndex(1);
+          }
+        }
+      });
+  std::cout << "  " << evaluate.seconds / evaluate.num_operations * 1e9
+            << " ns per evaluation (checksum " << sum << ")" << std::endl;
+
+  clutter.clear();
+  fixture->Measure("release, " + label, num_objects, [&]() {
+    objects.clear();
+    if (arena != nullptr) {
+      arena->Reset();
+    }
+  });
+}
+
+void BenchmarkBatch(BenchmarkFixture* fixture, bool use_arenas,
+                    int num_rollouts, int num_threads) {
+  const SimpleContinuousTimeSystem<double> system;
+  std::vector<Eigen::VectorXd> initial_states;
+  for (int i = 0; i < num_rollouts; ++i) {
+    initial_states.push_back(drake::Vector1d(0.9 * i / num_rollouts));
+  }
+  const int64_t resident_before = ResidentBytes();
+  BenchmarkResult& result = fixture->Measure(
+      std::string("simulate batch, ") + (use_arenas ? "arenas" : "heap") +
+          ", " + std::to_string(num_threads) + " threads",
+      num_rollouts, [&]() {
+        SimulateBatch(system, initial_states, 1.0,
+                      {.num_threads = num_threads, .use_arenas = use_arenas});
+      });
+  result.values["resident_bytes_growth"] =
+      static_cast<double>(ResidentBytes() - resident_before);
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("arena_benchmark", &argc, argv);
+  const int num_objects =
+      (argc > 1) ? std::max(1, std::atoi(argv[1])) : 100000;
+  const int num_threads =
+      (argc > 2) ? std::max(1, std::atoi(argv[2]))
+                 : static_cast<int>(std::thread::hardware_concurrency());
+
+  // Warm up anything Drake allocates once and keeps, outside of any arena.
+  const Particle<double> particle;
+  particle.CalcTimeDerivatives(*particle.CreateDefaultContext(),
+                               particle.AllocateTimeDerivatives().get());
+  particle.AllocateOutput();
+  for (const Allocation allocation :
+       {Allocation::kHeap, Allocation::kFragmentedHeap, Allocation::kArena}) {
+    BenchmarkBulkObjects(&fixture, allocation, num_objects);
+  }
+  const int num_rollouts = std::max(2, num_objects / 10);
+  BenchmarkBatch(&fixture, false, num_rollouts, num_threads);
+  BenchmarkBatch(&fixture, true, num_rollouts, num_threads);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace arena_allocation
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::arena_allocation::DoMain(argc, argv);
+}
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "benchmark_fixture.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace drake_external_examples {
+namespace benchmarking {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::string_view kJsonOutputFlag = "--json_output=";
+
+void Accumulate(const std::optional<double>& value,
+                std::optional<double>* total) {
+  if (value.has_value()) {
+    *total = total->value_or(0.0) + *value;
+  }
+}
+
+std::optional<double> PerOperation(const std::optional<double>& value,
+                                   int64_t num_operations) {
+  if (!value.has_value() || num_operations <= 0) {
+    return std::nullopt;
+  }
+  return *value / static_cast<double>(num_operations);
+}
+
+std::string JsonString(std::string_view text) {
+  std::string result = "\"";
+  for (const char c : text) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          result += escaped;
+        } else {
+          result += c;
+        }
+    }
+  }
+  return result + "\"";
+}
+
+std::string JsonNumber(const std::optional<double>& value) {
+  if (!value.has_value() || !std::isfinite(*value)) {
+    return "null";
+  }
+  std::ostringstream stream;
+  stream.precision(10);
+  stream << *value;
+  return stream.str();
+}
+
+}  // namespace
+
+std::optional<double> BenchmarkResult::instructions_per_cycle() const {
+  if (!counters.instructions.has_value() || !counters.cycles.has_value() ||
+      *counters.cycles <= 0.0) {
+    return std::nullopt;
+  }
+  return *counters.instructions / *counters.cycles;
+}
+
+BenchmarkFixture::BenchmarkFixture(std::string name, int* argc, char* argv[])
+    : name_(std::move(name)), json_output_(name_ + ".json") {
+  int kept = 1;
+  for (int i = 1; i < *argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.substr(0, kJsonOutputFlag.size()) == kJsonOutputFlag) {
+      json_output_ = arg.substr(kJsonOutputFlag.size());
+    } else {
+      argv[kept++] = argv[i];
+    }
+  }
+  *argc = kept;
+  if (!counters_.available()) {
+    std::cout << "Hardware counters unavailable ("
+              << counters_.unavailable_reason() << "); reporting wall time only."
+              << std::endl;
+  }
+}
+
+BenchmarkResult& BenchmarkFixture::Measure(
+    const std::string& name, int64_t num_operations,
+    const std::function<void()>& region) {
+  return MeasureRepeated(name, 1, num_operations, [] {}, region);
+}
+
+BenchmarkResult& BenchmarkFixture::MeasureRepeated(
+    const std::string& name, int repetitions,
+    int64_t operations_per_repetition, const std::function<void()>& setup,
+    const std::function<void()>& region) {
+  BenchmarkResult& result = results_.emplace_back();
+  result.name = name;
+  result.repetitions = std::max(repetitions, 1);
+  result.num_operations = operations_per_repetition * result.repetitions;
+  std::vector<double> seconds;
+  for (int i = 0; i < result.repetitions; ++i) {
+    setup();
+    counters_.Start();
+    const Clock::time_point start = Clock::now();
+    region();
+    const Clock::time_point stop = Clock::now();
+    const PerfCounterValues values = counters_.Stop();
+    seconds.push_back(std::chrono::duration<double>(stop - start).count());
+    Accumulate(values.cycles, &result.counters.cycles);
+    Accumulate(values.instructions, &result.counters.instructions);
+    Accumulate(values.cache_misses, &result.counters.cache_misses);
+    Accumulate(values.branch_misses, &result.counters.branch_misses);
+  }
+  for (const double s : seconds) {
+    result.seconds += s;
+  }
+  std::nth_element(seconds.begin(), seconds.begin() + seconds.size() / 2,
+                   seconds.end());
+  result.median_seconds = seconds[seconds.size() / 2];
+  Print(result);
+  return result;
+}
+
+void BenchmarkFixture::Print(const BenchmarkResult& result) const {
+  std::cout << result.name << ": ";
+  if (result.repetitions > 1) {
+    std::cout << "median " << result.median_seconds * 1e3 << " ms, ";
+  } else {
+    std::cout << result.seconds * 1e3 << " ms, ";
+  }
+  if (const auto ns = PerOperation(result.seconds * 1e9,
+                                   result.num_operations)) {
+    std::cout << *ns << " ns/op";
+  }
+  if (const auto ipc = result.instructions_per_cycle()) {
+    std::cout << ", IPC " << *ipc;
+  }
+  if (const auto misses =
+          PerOperation(result.counters.cache_misses, result.num_operations)) {
+    std::cout << ", " << *misses << " cache misses/op";
+  }
+  if (const auto misses =
+          PerOperation(result.counters.branch_misses, result.num_operations)) {
+    std::cout << ", " << *misses << " branch misses/op";
+  }
+  std::cout << std::endl;
+}
+
+std::string BenchmarkFixture::ToJson() const {
+  std::ostringstream json;
+  json << "{\n  \"benchmark\": " << JsonString(name_)
+       << ",\n  \"counters_available\": "
+       << (counters_.available() ? "true" : "false")
+       << ",\n  \"counters_error\": "
+       << (counters_.available() ? "null"
+                                 : JsonString(counters_.unavailable_reason()))
+       << ",\n  \"results\": [";
+  bool first = true;
+  for (const BenchmarkResult& result : results_) {
+    const int64_t n = result.num_operations;
+    json << (first ? "\n" : ",\n") << "    {\"name\": "
+         << JsonString(result.name)
+         << ", \"repetitions\": " << result.repetitions
+         << ", \"operations\": " << n
+         << ", \"seconds\": " << JsonNumber(result.seconds)
+         << ", \"median_seconds\": " << JsonNumber(result.median_seconds)
+         << ", \"ns_per_operation\": "
+         << JsonNumber(PerOperation(result.seconds * 1e9, n))
+         << ", \"cycles\": " << JsonNumber(result.counters.cycles)
+         << ", \"instructions\": " << JsonNumber(result.counters.instructions)
+         << ", \"cache_misses\": " << JsonNumber(result.counters.cache_misses)
+         << ", \"branch_misses\": "
+         << JsonNumber(result.counters.branch_misses)
+         << ", \"instructions_per_cycle\": "
+         << JsonNumber(result.instructions_per_cycle())
+         << ", \"cache_misses_per_operation\": "
+         << JsonNumber(PerOperation(result.counters.cache_misses, n))
+         << ", \"branch_misses_per_operation\": "
+         << JsonNumber(PerOperation(result.counters.branch_misses, n))
+         << ", \"values\": {";
+    bool first_value = true;
+    for (const auto& [key, value] : result.values) {
+      json << (first_value ? "" : ", ") << JsonString(key) << ": "
+           << JsonNumber(value);
+      first_value = false;
+    }
+    json << "}}";
+    first = false;
+  }
+  json << "\n  ]\n}\n";
+  return json.str();
+}
+
+int BenchmarkFixture::WriteResults() const {
+  std::ofstream file(json_output_);
+  file << ToJson();
+  file.close();
+  if (!file) {
+    std::cerr << "Could not write " << json_output_ << std::endl;
+    return 1;
+  }
+  std::cout << "Wrote " << json_output_ << std::endl;
+  return 0;
+}
+
+}  // namespace benchmarking
+}  // namespace drake_external_examples
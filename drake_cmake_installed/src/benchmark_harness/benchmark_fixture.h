@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+
+#include <drake/common/drake_copyable.h>
+
+#include "perf_counters.h"
+
+namespace drake_external_examples {
+namespace benchmarking {
+
+/// The outcome of one measured region of a benchmark.
+struct BenchmarkResult {
+  std::string name;
+  /// The number of times the region ran.
+  int repetitions{};
+  /// The number of operations (e.g., evaluations or simulated steps) done in
+  /// all repetitions, which the per-operation figures are divided by.
+  int64_t num_operations{};
+  /// The wall time of all repetitions, and the median of one repetition.
+  double seconds{};
+  double median_seconds{};
+  /// The hardware event counts of all repetitions.
+  PerfCounterValues counters;
+  /// Additional figures reported by the benchmark, e.g., retained bytes.
+  std::map<std::string, double> values;
+
+  /// Returns instructions per cycle, if both were counted.
+  std::optional<double> instructions_per_cycle() const;
+};
+
+/// Measures the regions of a benchmark program, times them, reads hardware
+/// counters (see PerfCounters) around them, prints a summary of each, and
+/// writes all results as JSON.
+///
+/// The JSON file is named `<benchmark name>.json` in the working directory,
+/// unless the program is run with `--json_output=<path>`. It has the form
+///
+///   {"benchmark": ..., "counters_available": ..., "counters_error": ...,
+///    "results": [{"name": ..., "repetitions": ..., "operations": ...,
+///                 "seconds": ..., "median_seconds": ...,
+///                 "ns_per_operation": ..., "cycles": ...,
+///                 "instructions": ..., "cache_misses": ...,
+///                 "branch_misses": ..., "instructions_per_cycle": ...,
+///                 "cache_misses_per_operation": ...,
+///                 "branch_misses_per_operation": ..., "values": {...}},
+///                ...]}
+///
+/// where figures that could not be measured are null.
+class BenchmarkFixture {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BenchmarkFixture);
+
+  /// Creates a fixture for the benchmark @p name, removing the fixture's own
+  /// flags from @p argc and @p argv so that the benchmark can parse the rest.
+  BenchmarkFixture(std::string name, int* argc, char* argv[]);
+
+  const std::string& name() const { return name_; }
+
+  const std::string& json_output() const { return json_output_; }
+
+  bool counters_available() const { return counters_.available(); }
+
+  /// Runs @p region once, which does @p num_operations operations, and
+  /// records and prints its measurement. The returned result remains valid for
+  /// the fixture's lifetime; benchmarks may add to its values before calling
+  /// WriteResults().
+  BenchmarkResult& Measure(const std::string& name, int64_t num_operations,
+                           const std::function<void()>& region);
+
+  /// Like Measure(), but runs @p region @p repetitions times, each time after
+  /// an unmeasured call to @p setup, and accumulates the measurements.
+  BenchmarkResult& MeasureRepeated(const std::string& name, int repetitions,
+                                   int64_t operations_per_repetition,
+                                   const std::function<void()>& setup,
+                                   const std::function<void()>& region);
+
+  /// Returns all results as a JSON document.
+  std::string ToJson() const;
+
+  /// Writes ToJson() to json_output(), and returns a process exit code.
+  int WriteResults() const;
+
+ private:
+  void Print(const BenchmarkResult& result) const;
+
+  const std::string name_;
+  std::string json_output_;
+  PerfCounters counters_;
+  std::deque<BenchmarkResult> results_;
+};
+
+}  // namespace benchmarking
+}  // namespace drake_external_examples
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "benchmark_fixture.h"  // IWYU pragma: associated
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace drake_external_examples {
+namespace benchmarking {
+namespace {
+
+/// Makes sure the fixture's flag is removed, and other arguments are kept in
+/// order.
+TEST(BenchmarkFixtureTest, ParsesFlags) {
+  const std::string path = ::testing::TempDir() + "/results.json";
+  std::string flag = "--json_output=" + path;
+  char program[] = "benchmark";
+  char first[] = "10";
+  char second[] = "--other";
+  char* argv[] = {program, first, flag.data(), second, nullptr};
+  int argc = 4;
+  const BenchmarkFixture fixture("example", &argc, argv);
+  EXPECT_EQ(fixture.json_output(), path);
+  ASSERT_EQ(argc, 3);
+  EXPECT_EQ(std::string(argv[1]), "10");
+  EXPECT_EQ(std::string(argv[2]), "--other");
+
+  char* default_argv[] = {program, nullptr};
+  int default_argc = 1;
+  const BenchmarkFixture default_fixture("example", &default_argc,
+                                         default_argv);
+  EXPECT_EQ(default_fixture.json_output(), "example.json");
+}
+
+/// Makes sure measurements run the setup and region as requested, and are
+/// written as JSON.
+TEST(BenchmarkFixtureTest, MeasuresAndWritesJson) {
+  const std::string path = ::testing::TempDir() + "/fixture_test.json";
+  std::string flag = "--json_output=" + path;
+  char program[] = "benchmark";
+  char* argv[] = {program, flag.data(), nullptr};
+  int argc = 2;
+  BenchmarkFixture fixture("fixture \"test\"", &argc, argv);
+
+  int num_setups = 0;
+  int num_regions = 0;
+  BenchmarkResult& result = fixture.MeasureRepeated(
+      "repeated", 5, 100, [&] { ++num_setups; }, [&] { ++num_regions; });
+  result.values["answer"] = 42;
+  EXPECT_EQ(num_setups, 5);
+  EXPECT_EQ(num_regions, 5);
+  EXPECT_EQ(result.repetitions, 5);
+  EXPECT_EQ(result.num_operations, 500);
+  EXPECT_GE(result.seconds, result.median_seconds);
+  EXPECT_EQ(result.counters.cycles.has_value(), fixture.counters_available());
+
+  fixture.Measure("once", 1, [] {});
+  ASSERT_EQ(fixture.WriteResults(), 0);
+  std::ifstream file(path);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  const std::string json = contents.str();
+  EXPECT_EQ(json, fixture.ToJson());
+  EXPECT_NE(json.find("\"benchmark\": \"fixture \\\"test\\\"\""),
+            std::string::npos);
+  EXPECT_NE(json.find("\"name\": \"repeated\", \"repetitions\": 5, "
+                      "\"operations\": 500"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"values\": {\"answer\": 42}"), std::string::npos);
+  EXPECT_NE(json.find("\"name\": \"once\""), std::string::npos);
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace drake_external_examples
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "counting_allocator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace drake_external_examples {
+namespace benchmarking {
+namespace {
+
+std::atomic<int64_t> g_live_bytes{0};
+std::atomic<int64_t> g_num_allocations{0};
+
+// Each allocation carries a header recording its size, so that frees can be
+// subtracted from g_live_bytes.
+constexpr std::size_t kHeaderSize = alignof(std::max_align_t);
+
+}  // namespace
+
+int64_t LiveHeapBytes() {
+  return g_live_bytes.load(std::memory_order_relaxed);
+}
+
+int64_t NumHeapAllocations() {
+  return g_num_allocations.load(std::memory_order_relaxed);
+}
+
+}  // namespace benchmarking
+}  // namespace drake_external_examples
+
+using drake_external_examples::benchmarking::g_live_bytes;
+using drake_external_examples::benchmarking::g_num_allocations;
+using drake_external_examples::benchmarking::kHeaderSize;
+
+void* operator new(std::size_t size) {
+  void* block = std::malloc(size + kHeaderSize);
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  *static_cast<std::size_t*>(block) = size;
+  g_live_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+  g_num_allocations.fetch_add(1, std::memory_order_relaxed);
+  return static_cast<char*>(block) + kHeaderSize;
+}
+
+void operator delete(void* ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  void* block = static_cast<char*>(ptr) - kHeaderSize;
+  g_live_bytes.fetch_sub(
+      static_cast<int64_t>(*static_cast<std::size_t*>(block)),
+      std::memory_order_relaxed);
+  std::free(block);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept { operator delete(ptr); }
@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "counting_allocator.h"  // IWYU pragma: associated
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace drake_external_examples {
+namespace benchmarking {
+namespace {
+
+/// Makes sure allocations are counted, and their bytes are counted until
+/// they are deleted, sized or not.
+TEST(CountingAllocatorTest, CountsAllocations) {
+  const int64_t bytes_before = LiveHeapBytes();
+  const int64_t allocations_before = NumHeapAllocations();
+  // Calls to the operators themselves cannot be elided, unlike new
+  // expressions.
+  void* first = ::operator new(100);
+  void* second = ::operator new(28);
+  EXPECT_EQ(LiveHeapBytes() - bytes_before, 128);
+  EXPECT_EQ(NumHeapAllocations() - allocations_before, 2);
+  ::operator delete(first);
+  ::operator delete(second, 28);
+  EXPECT_EQ(LiveHeapBytes(), bytes_before);
+  EXPECT_EQ(NumHeapAllocations() - allocations_before, 2);
+}
+
+/// Makes sure memory deleted on another thread is subtracted.
+TEST(CountingAllocatorTest, CountsAcrossThreads) {
+  const int64_t bytes_before = LiveHeapBytes();
+  void* block = nullptr;
+  std::thread([&block]() { block = ::operator new(64); }).join();
+  const int64_t allocated = LiveHeapBytes() - bytes_before;
+  EXPECT_GE(allocated, 64);
+  ::operator delete(block);
+  EXPECT_EQ(LiveHeapBytes() - bytes_before, allocated - 64);
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace drake_external_examples
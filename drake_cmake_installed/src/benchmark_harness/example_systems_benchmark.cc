@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures the per-evaluation cost of the example systems, with hardware
+/// counters, to tell whether they are bound by instruction count, memory, or
+/// branch mispredictions:
+///
+/// - the time derivatives of a Particle,
+/// - the output of a SimpleAdder,
+/// - a simulation of a SimpleAdder driving a Particle, per integrator step.
+///
+/// Each evaluation follows a change of the state or input, so that it is
+/// recomputed rather than served from the cache.
+///
+/// Usage: example_systems_benchmark [num_evaluations] [--json_output=<path>]
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/framework/fixed_input_port_value.h>
+#include <drake/systems/primitives/constant_vector_source.h>
+
+#include "benchmark_fixture.h"
+#include "particle/particle.h"
+#include "simple_bindings/simple_adder.h"
+
+namespace drake_external_examples {
+namespace benchmarking {
+namespace {
+
+using drake::systems::BasicVector;
+using drake::systems::ConstantVectorSource;
+using drake::systems::DiagramBuilder;
+using drake::systems::FixedInputPortValue;
+using drake::systems::Simulator;
+using particles::Particle;
+
+void BenchmarkParticle(BenchmarkFixture* fixture, int64_t num_evaluations) {
+  const Particle<double> particle;
+  auto context = particle.CreateDefaultContext();
+  particle.get_input_port(0).FixValue(context.get(), drake::Vector1d(1.0));
+  auto derivatives = particle.AllocateTimeDerivatives();
+  drake::systems::VectorBase<double>& state =
+      context->get_mutable_continuous_state_vector();
+  double checksum = 0.0;
+  fixture->Measure("Particle derivatives", num_evaluations, [&]() {
+    for (int64_t i = 0; i < num_evaluations; ++i) {
+      state.SetAtIndex(1, static_cast<double>(i));
+      particle.CalcTimeDerivatives(*context, derivatives.get());
+      checksum += derivatives->get_vector().GetAtIndex(0);
+    }
+  });
+  std::cout << "  (checksum " << checksum << ")" << std::endl;
+}
+
+void BenchmarkSimpleAdder(BenchmarkFixture* fixture,
+                          int64_t num_evaluations) {
+  const SimpleAdder<double> adder(1.0);
+  auto context = adder.CreateDefaultContext();
+  FixedInputPortValue& input =
+      adder.get_input_port(0).FixValue(context.get(), drake::Vector1d(0.0));
+  double checksum = 0.0;
+  fixture->Measure("SimpleAdder output", num_evaluations, [&]() {
+    for (int64_t i = 0; i < num_evaluations; ++i) {
+      input.GetMutableVectorData<double>()->SetAtIndex(
+          0, static_cast<double>(i));
+      checksum += adder.get_output_port(0).Eval(*context)[0];
+    }
+  });
+  std::cout << "  (checksum " << checksum << ")" << std::endl;
+}
+
+void BenchmarkSimulation(BenchmarkFixture* fixture) {
+  DiagramBuilder<double> builder;
+  auto source =
+      builder.AddSystem<ConstantVectorSource<double>>(drake::Vector1d(1.0));
+  auto adder = builder.AddSystem<SimpleAdder<double>>(0.5);
+  auto particle = builder.AddSystem<Particle<double>>();
+  builder.Connect(source->get_output_port(), adder->get_input_port(0));
+  builder.Connect(adder->get_output_port(0), particle->get_input_port(0));
+  auto diagram = builder.Build();
+
+  // Fixed-size steps, so that the number of operations is known.
+  Simulator<double> simulator(*diagram);
+  simulator.get_mutable_integrator().set_fixed_step_mode(true);
+  simulator.get_mutable_integrator().set_maximum_step_size(1e-3);
+  simulator.Initialize();
+  const double t_final = 100.0;
+  BenchmarkResult& result = fixture->Measure(
+      "SimpleAdder and Particle simulation step",
+      static_cast<int64_t>(t_final / 1e-3), [&]() {
+        simulator.AdvanceTo(t_final);
+      });
+  result.values["steps"] = simulator.get_num_steps_taken();
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("example_systems_benchmark", &argc, argv);
+  const int64_t num_evaluations =
+      (argc > 1) ? std::atoll(argv[1]) : 10'000'000;
+  BenchmarkParticle(&fixture, num_evaluations);
+  BenchmarkSimpleAdder(&fixture, num_evaluations);
+  BenchmarkSimulation(&fixture);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::benchmarking::DoMain(argc, argv);
+}
@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "bulk_diagram.h"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <drake/common/value.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/framework/framework_common.h>
+
+namespace drake_external_examples {
+namespace bulk_diagram {
+
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::PortDataType;
+using drake::systems::System;
+
+namespace {
+
+// Validates a table against its systems, counting each input port's uses in
+// one flat array indexed by the systems' first input ports.
+class TableValidator {
+ public:
+  explicit TableValidator(
+      const std::vector<std::unique_ptr<System<double>>>& systems)
+      : systems_(systems) {
+    first_input_.reserve(systems.size() + 1);
+    int num_inputs = 0;
+    for (size_t i = 0; i < systems.size(); ++i) {
+      if (systems[i] == nullptr) {
+        throw std::logic_error("System " + std::to_string(i) + " is null");
+      }
+      first_input_.push_back(num_inputs);
+      num_inputs += systems[i]->num_input_ports();
+    }
+    input_used_.resize(num_inputs);
+  }
+
+  // Rows are described, e.g., as "Connection 3", only to report errors.
+  void CheckOutput(const TablePort& port, const char* table,
+                   size_t row) const {
+    CheckSystem(port, table, row);
+    if (port.port < 0 ||
+        port.port >= systems_[port.system]->num_output_ports()) {
+      throw std::logic_error(Describe(table, row) + ": system " +
+                             std::to_string(port.system) +
+                             " has no output port " +
+                             std::to_string(port.port));
+    }
+  }
+
+  void UseInput(const TablePort& port, const char* table, size_t row) {
+    CheckSystem(port, table, row);
+    if (port.port < 0 ||
+        port.port >= systems_[port.system]->num_input_ports()) {
+      throw std::logic_error(Describe(table, row) + ": system " +
+                             std::to_string(port.system) +
+                             " has no input port " +
+                             std::to_string(port.port));
+    }
+    const int index = first_input_[port.system] + port.port;
+    if (input_used_[index]) {
+      throw std::logic_error(Describe(table, row) + ": input port " +
+                             std::to_string(port.port) + " of system " +
+                             std::to_string(port.system) +
+                             " is already connected or exported");
+    }
+    input_used_[index] = true;
+  }
+
+  // Checks that the ports of a connection, already checked to exist, carry
+  // the same data, as DiagramBuilder::Connect() will.
+  void CheckCompatible(const TableConnection& connection, size_t row) const {
+    const auto& output = systems_[connection.output.system]->get_output_port(
+        connection.output.port);
+    const auto& input = systems_[connection.input.system]->get_input_port(
+        connection.input.port);
+    std::string mismatch;
+    if (output.get_data_type() != input.get_data_type()) {
+      mismatch = "one is vector-valued and the other abstract";
+    } else if (output.get_data_type() == PortDataType::kVectorValued) {
+      if (output.size() != input.size()) {
+        mismatch = "their sizes are " + std::to_string(output.size()) +
+                   " and " + std::to_string(input.size());
+      }
+    } else if (output.Allocate()->type_info() !=
+               input.Allocate()->type_info()) {
+      // Abstract ports are rare, so allocating their values here is cheap.
+      mismatch = "their value types differ";
+    }
+    if (!mismatch.empty()) {
+      throw std::logic_error(Describe("Connection", row) + ": output port " +
+                             std::to_string(connection.output.port) +
+                             " of system " +
+                             std::to_string(connection.output.system) +
+                             " cannot feed input port " +
+                             std::to_string(connection.input.port) +
+                             " of system " +
+                             std::to_string(connection.input.system) + "; " +
+                             mismatch);
+    }
+  }
+
+ private:
+  static std::string Describe(const char* table, size_t row) {
+    return std::string(table) + " " + std::to_string(row);
+  }
+
+  void CheckSystem(const TablePort& port, const char* table,
+                   size_t row) const {
+    if (port.system < 0 || port.system >= static_cast<int>(systems_.size())) {
+      throw std::logic_error(Describe(table, row) + ": there is no system " +
+                             std::to_string(port.system));
+    }
+  }
+
+  const std::vector<std::unique_ptr<System<double>>>& systems_;
+  std::vector<int> first_input_;
+  std::vector<bool> input_used_;
+};
+
+}  // namespace
+
+std::unique_ptr<Diagram<double>> BuildDiagram(
+    std::vector<std::unique_ptr<System<double>>> systems,
+    const DiagramTable& table) {
+  {
+    TableValidator validator(systems);
+    for (size_t i = 0; i < table.connections.size(); ++i) {
+      validator.CheckOutput(table.connections[i].output, "Connection", i);
+      validator.UseInput(table.connections[i].input, "Connection", i);
+      validator.CheckCompatible(table.connections[i], i);
+    }
+    for (size_t i = 0; i < table.exported_inputs.size(); ++i) {
+      validator.UseInput(table.exported_inputs[i], "Exported input", i);
+    }
+    for (size_t i = 0; i < table.exported_outputs.size(); ++i) {
+      validator.CheckOutput(table.exported_outputs[i], "Exported output", i);
+    }
+  }
+
+  DiagramBuilder<double> builder;
+  std::vector<const System<double>*> added;
+  added.reserve(systems.size());
+  for (size_t i = 0; i < systems.size(); ++i) {
+    if (systems[i]->get_name().empty()) {
+      systems[i]->set_name("system_" + std::to_string(i));
+    }
+    added.push_back(builder.AddSystem(std::move(systems[i])));
+  }
+  for (const TableConnection& connection : table.connections) {
+    builder.Connect(
+        added[connection.output.system]->get_output_port(
+            connection.output.port),
+        added[connection.input.system]->get_input_port(connection.input.port));
+  }
+  for (const TablePort& port : table.exported_inputs) {
+    builder.ExportInput(added[port.system]->get_input_port(port.port));
+  }
+  for (const TablePort& port : table.exported_outputs) {
+    builder.ExportOutput(added[port.system]->get_output_port(port.port));
+  }
+  return builder.Build();
+}
+
+DiagramTable MakeTreeTable(int num_systems) {
+  if (num_systems < 1) {
+    throw std::logic_error("A tree needs at least one system");
+  }
+  DiagramTable table;
+  table.Reserve(num_systems - 1, 1, 1);
+  table.exported_inputs.push_back({0, 0});
+  for (int i = 1; i < num_systems; ++i) {
+    table.connections.push_back({{(i - 1) / 2, 0}, {i, 0}});
+  }
+  table.exported_outputs.push_back({num_systems - 1, 0});
+  return table;
+}
+
+}  // namespace bulk_diagram
+}  // namespace drake_external_examples
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "bulk_diagram.h"  // IWYU pragma: associated
+
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/value.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/primitives/pass_through.h>
+
+#include "simple_bindings/simple_adder.h"
+
+namespace drake_external_examples {
+namespace bulk_diagram {
+namespace {
+
+using drake::Value;
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::PassThrough;
+using drake::systems::System;
+
+// Stages that add 1, 2, ..., num_systems.
+std::vector<std::unique_ptr<System<double>>> MakeAdders(int num_systems) {
+  std::vector<std::unique_ptr<System<double>>> systems;
+  for (int i = 0; i < num_systems; ++i) {
+    systems.push_back(std::make_unique<SimpleAdder<double>>(i + 1.0));
+  }
+  return systems;
+}
+
+// Returns the connections of @p diagram, by the names of the systems.
+std::set<std::tuple<std::string, int, std::string, int>> GetConnections(
+    const Diagram<double>& diagram) {
+  std::set<std::tuple<std::string, int, std::string, int>> connections;
+  for (const auto& [input, output] : diagram.connection_map()) {
+    connections.emplace(output.first->get_name(), output.second,
+                        input.first->get_name(), input.second);
+  }
+  return connections;
+}
+
+/// Makes sure a tree is wired and named as its table says, and computes what
+/// its adders add along the path to its output.
+TEST(BuildDiagramTest, BuildsTree) {
+  const auto diagram = BuildDiagram(MakeAdders(7), MakeTreeTable(7));
+  ASSERT_EQ(diagram->GetSystems().size(), 7);
+  for (int i = 0; i < 7; ++i) {
+    EXPECT_EQ(diagram->GetSystems()[i]->get_name(),
+              "system_" + std::to_string(i));
+  }
+  EXPECT_EQ(diagram->connection_map().size(), 6);
+  ASSERT_EQ(diagram->num_input_ports(), 1);
+  ASSERT_EQ(diagram->num_output_ports(), 1);
+
+  auto context = diagram->CreateDefaultContext();
+  diagram->get_input_port(0).FixValue(context.get(), 10.0);
+  // The output is that of stage 6, fed by stage 2, fed by stage 0.
+  EXPECT_EQ(diagram->get_output_port(0).Eval(*context)[0],
+            10.0 + 1.0 + 3.0 + 7.0);
+}
+
+/// Makes sure the diagram has the same connections as one built system by
+/// system with a DiagramBuilder, and that named systems keep their names.
+TEST(BuildDiagramTest, MatchesDiagramBuilder) {
+  constexpr int kNumSystems = 100;
+  const DiagramTable table = MakeTreeTable(kNumSystems);
+  auto systems = MakeAdders(kNumSystems);
+  systems[5]->set_name("named");
+  const auto diagram = BuildDiagram(std::move(systems), table);
+
+  DiagramBuilder<double> builder;
+  std::vector<SimpleAdder<double>*> added;
+  for (int i = 0; i < kNumSystems; ++i) {
+    added.push_back(builder.AddSystem<SimpleAdder<double>>(i + 1.0));
+    added.back()->set_name(i == 5 ? "named" : "system_" + std::to_string(i));
+  }
+  for (int i = 1; i < kNumSystems; ++i) {
+    builder.Connect(added[(i - 1) / 2]->get_output_port(0),
+                    added[i]->get_input_port(0));
+  }
+  builder.ExportInput(added[0]->get_input_port(0));
+  builder.ExportOutput(added[kNumSystems - 1]->get_output_port(0));
+  const auto expected = builder.Build();
+
+  EXPECT_EQ(GetConnections(*diagram), GetConnections(*expected));
+  EXPECT_EQ(diagram->GetSystems()[5]->get_name(), "named");
+}
+
+/// Makes sure a table with any invalid row, including a connection between
+/// ports that carry different data, is rejected before anything is built,
+/// and that a tree needs a system.
+TEST(BuildDiagramTest, Throws) {
+  const auto build = [](const DiagramTable& table) {
+    return BuildDiagram(MakeAdders(3), table);
+  };
+  DiagramTable table;
+  table.connections = {{{0, 0}, {3, 0}}};
+  EXPECT_THROW(build(table), std::logic_error);
+  table.connections = {{{0, 1}, {1, 0}}};
+  EXPECT_THROW(build(table), std::logic_error);
+  table.connections = {{{0, 0}, {1, 1}}};
+  EXPECT_THROW(build(table), std::logic_error);
+  table.connections = {{{0, 0}, {1, 0}}, {{2, 0}, {1, 0}}};
+  EXPECT_THROW(build(table), std::logic_error);
+  table.connections = {{{0, 0}, {1, 0}}};
+  table.exported_inputs = {{1, 0}};
+  EXPECT_THROW(build(table), std::logic_error);
+  table.exported_inputs = {};
+  table.exported_outputs = {{-1, 0}};
+  EXPECT_THROW(build(table), std::logic_error);
+
+  // Ports are checked to carry the same data: a size 1 output cannot feed a
+  // size 2 input, nor a vector an abstract input, nor a string an int.
+  const auto build_mixed = [](const DiagramTable& mixed_table) {
+    auto systems = MakeAdders(1);
+    systems.push_back(std::make_unique<PassThrough<double>>(2));
+    systems.push_back(
+        std::make_unique<PassThrough<double>>(Value<std::string>()));
+    systems.push_back(std::make_unique<PassThrough<double>>(Value<int>()));
+    return BuildDiagram(std::move(systems), mixed_table);
+  };
+  for (const TableConnection& connection :
+       {TableConnection{{0, 0}, {1, 0}}, TableConnection{{0, 0}, {2, 0}},
+        TableConnection{{2, 0}, {3, 0}}}) {
+    DiagramTable mixed_table;
+    mixed_table.connections = {connection};
+    EXPECT_THROW(build_mixed(mixed_table), std::logic_error);
+  }
+
+  auto systems = MakeAdders(2);
+  systems[1].reset();
+  EXPECT_THROW(BuildDiagram(std::move(systems), {}), std::logic_error);
+  EXPECT_THROW(MakeTreeTable(0), std::logic_error);
+}
+
+}  // namespace
+}  // namespace bulk_diagram
+}  // namespace drake_external_examples
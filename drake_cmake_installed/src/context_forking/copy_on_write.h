@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace drake_external_examples {
+namespace context_forking {
+
+/// A value of type T whose copies share one instance until one of them is
+/// written, at which point that copy makes its own.
+///
+/// Stored as an abstract parameter or abstract state (i.e., in a
+/// `drake::Value<CopyOnWrite<T>>`), it makes `Context::Clone()` and
+/// `Context::SetTimeStateAndParametersFrom()` copy a pointer instead of the
+/// whole value, so that contexts forked from a common template share large,
+/// rarely written data such as tables or maps.
+///
+/// Whether a copy may write in place is not decided from the pointer's
+/// use_count(), which gives no ordering with other threads releasing their
+/// copies. Instead each copy remembers whether it made its value itself and
+/// has not been copied from since: a copy made from another, and the copy it
+/// was made from, both make their own value on their next write, even if the
+/// other has been destroyed by then.
+///
+/// Reading and copying shared values from many threads is safe. Writing
+/// through get_mutable() is safe as well, as long as each thread writes only
+/// to its own copies (e.g., those in its own context), and no other thread
+/// copies them meanwhile.
+template <typename T>
+class CopyOnWrite {
+ public:
+  /// Holds a default-constructed T.
+  CopyOnWrite() : CopyOnWrite(T{}) {}
+
+  /// Holds @p value.
+  explicit CopyOnWrite(T value)
+      : value_(std::make_shared<T>(std::move(value))), owned_(true) {}
+
+  /// Shares the value of @p other, which no longer owns it either.
+  CopyOnWrite(const CopyOnWrite& other) : value_(other.value_) {
+    other.owned_.store(false, std::memory_order_relaxed);
+  }
+
+  CopyOnWrite& operator=(const CopyOnWrite& other) {
+    if (this != &other) {
+      value_ = other.value_;
+      owned_.store(false, std::memory_order_relaxed);
+      other.owned_.store(false, std::memory_order_relaxed);
+    }
+    return *this;
+  }
+
+  CopyOnWrite(CopyOnWrite&& other) noexcept
+      : value_(std::move(other.value_)),
+        owned_(other.owned_.load(std::memory_order_relaxed)) {}
+
+  CopyOnWrite& operator=(CopyOnWrite&& other) noexcept {
+    value_ = std::move(other.value_);
+    owned_.store(other.owned_.load(std::memory_order_relaxed),
+                 std::memory_order_relaxed);
+    return *this;
+  }
+
+  /// Returns the value, which may be shared with other copies.
+  const T& get() const { return *value_; }
+
+  /// Returns the value for writing, first copying it unless this copy owns
+  /// it.
+  T& get_mutable() {
+    if (is_shared()) {
+      value_ = std::make_shared<T>(*value_);
+      owned_.store(true, std::memory_order_relaxed);
+    }
+    return *value_;
+  }
+
+  /// Returns true iff this copy's value may be shared with other copies, so
+  /// that the next get_mutable() copies it.
+  bool is_shared() const { return !owned_.load(std::memory_order_relaxed); }
+
+ private:
+  std::shared_ptr<T> value_;
+  // Copies of this copy change this, hence mutable; they may be made on
+  // several threads at once.
+  mutable std::atomic<bool> owned_{false};
+};
+
+}  // namespace context_forking
+}  // namespace drake_external_examples
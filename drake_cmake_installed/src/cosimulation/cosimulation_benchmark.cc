@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures the round-trip latency of a SharedMemoryMailbox exchange, i.e.,
+/// the overhead that co-simulation adds to each major step, with a peer that
+/// echoes each request: once with this program relaunched as a C++ peer, and
+/// once with cosimulation.py as a Python peer, for a few vector sizes. Reports
+/// the median, p99, p99.9 and maximum latencies.
+///
+/// With --cpus, this process and the peer are pinned to the two given CPUs;
+/// otherwise the scheduler places them, and the tail latencies include its
+/// migrations and wake-up delays.
+///
+/// Usage: cosimulation_benchmark [num_round_trips] [--cpus=<own>,<peer>]
+///            [--json_output=<path>]
+
+#include <sched.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "realtime_harness/latency_histogram.h"
+#include "shared_memory_mailbox.h"
+
+namespace drake_external_examples {
+namespace cosimulation {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using realtime::LatencyHistogram;
+
+int RunEchoPeer(int argc, char* argv[]) {
+  MailboxPeer peer(argc, argv);
+  double time{};
+  Eigen::VectorXd request;
+  while (peer.Receive(&time, &request)) {
+    peer.Reply(request);
+  }
+  return 0;
+}
+
+void Pin(pid_t pid, int cpu) {
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu, &cpus);
+  if (sched_setaffinity(pid, sizeof(cpus), &cpus) != 0) {
+    std::cerr << "warning: could not pin process " << pid << " to CPU " << cpu
+              << ": " << std::strerror(errno) << std::endl;
+  }
+}
+
+void BenchmarkRoundTrips(BenchmarkFixture* fixture, const std::string& name,
+                         const std::vector<std::string>& peer_command,
+                         int size, int num_round_trips, int peer_cpu) {
+  SharedMemoryMailbox mailbox(size, size);
+  mailbox.LaunchPeer(peer_command);
+  if (peer_cpu >= 0) {
+    Pin(mailbox.peer_pid(), peer_cpu);
+  }
+  Eigen::VectorXd request = Eigen::VectorXd::LinSpaced(size, 0.0, 1.0);
+  Eigen::VectorXd reply(size);
+  // Wakes up the peer (e.g., finishes the Python imports) before measuring.
+  for (int i = 0; i < 100; ++i) {
+    mailbox.Exchange(0.0, request, &reply);
+  }
+
+  LatencyHistogram histogram(/* range_ns = */ 10'000'000, /* bin_ns = */ 100);
+  double checksum = 0.0;
+  const auto round_trips = [&]() {
+    for (int i = 0; i < num_round_trips; ++i) {
+      request(0) = i;
+      const auto start = std::chrono::steady_clock::now();
+      mailbox.Exchange(i, request, &reply);
+      const auto stop = std::chrono::steady_clock::now();
+      histogram.Record(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+              .count());
+      checksum += reply(0);
+    }
+  };
+  BenchmarkResult& result = fixture->Measure(
+      name + " size " + std::to_string(size), num_round_trips, round_trips);
+  result.values["p50_ns"] = histogram.Percentile(0.5);
+  result.values["p99_ns"] = histogram.Percentile(0.99);
+  result.values["p99.9_ns"] = histogram.Percentile(0.999);
+  result.values["max_ns"] = histogram.max_ns();
+  std::cout << "  round trip p50 " << result.values["p50_ns"] << " ns, p99 "
+            << result.values["p99_ns"] << " ns, p99.9 "
+            << result.values["p99.9_ns"] << " ns, max "
+            << result.values["max_ns"] << " ns (checksum " << checksum << ")"
+            << std::endl;
+}
+
+int DoMain(int argc, char* argv[]) {
+  if (MailboxPeer::IsPeer(argc, argv)) {
+    return RunEchoPeer(argc, argv);
+  }
+  BenchmarkFixture fixture("cosimulation_benchmark", &argc, argv);
+  int num_round_trips = 20'000;
+  int own_cpu = -1;
+  int peer_cpu = -1;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--cpus=")) {
+      const std::string cpus(arg.substr(7));
+      own_cpu = std::atoi(cpus.c_str());
+      const size_t comma = cpus.find(',');
+      peer_cpu = (comma == std::string::npos)
+                     ? own_cpu
+                     : std::atoi(cpus.c_str() + comma + 1);
+    } else {
+      num_round_trips = std::atoi(argv[i]);
+    }
+  }
+  if (own_cpu >= 0) {
+    Pin(0, own_cpu);
+  }
+
+  const std::vector<std::string> cpp_peer{"/proc/self/exe"};
+  const std::vector<std::string> python_peer{
+      COSIMULATION_PYTHON, COSIMULATION_SOURCE_DIR "/cosimulation.py"};
+  for (const int size : {2, 64, 1024}) {
+    BenchmarkRoundTrips(&fixture, "C++ peer", cpp_peer, size,
+                        num_round_trips, peer_cpu);
+    BenchmarkRoundTrips(&fixture, "Python peer", python_peer, size,
+                        num_round_trips, peer_cpu);
+  }
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace cosimulation
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::cosimulation::DoMain(argc, argv);
+}
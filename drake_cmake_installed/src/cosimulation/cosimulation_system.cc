@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "cosimulation_system.h"
+
+#include <stdexcept>
+
+#include <drake/systems/framework/basic_vector.h>
+
+namespace drake_external_examples {
+namespace cosimulation {
+
+using drake::systems::Context;
+using drake::systems::DiscreteValues;
+using drake::systems::EventStatus;
+
+CosimulationSystem::CosimulationSystem(
+    double period, int input_size, int output_size,
+    const std::vector<std::string>& peer_command)
+    : period_(period),
+      mailbox_(std::make_unique<SharedMemoryMailbox>(input_size, output_size)) {
+  if (!(period > 0.0)) {
+    throw std::logic_error("The cosimulation period must be positive");
+  }
+  DeclareVectorInputPort("input", input_size);
+  const auto state_index = DeclareDiscreteState(output_size);
+  DeclareStateOutputPort("output", state_index);
+  DeclarePeriodicDiscreteUpdateEvent(period, 0.0,
+                                     &CosimulationSystem::Exchange);
+  mailbox_->LaunchPeer(peer_command);
+}
+
+EventStatus CosimulationSystem::Exchange(
+    const Context<double>& context,
+    DiscreteValues<double>* discrete_state) const {
+  Eigen::VectorXd reply(mailbox_->reply_size());
+  mailbox_->Exchange(context.get_time(), get_input_port().Eval(context),
+                     &reply);
+  discrete_state->get_mutable_vector().SetFromVector(reply);
+  return EventStatus::Succeeded();
+}
+
+}  // namespace cosimulation
+}  // namespace drake_external_examples
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/discrete_values.h>
+#include <drake/systems/framework/event_status.h>
+#include <drake/systems/framework/leaf_system.h>
+
+#include "shared_memory_mailbox.h"
+
+namespace drake_external_examples {
+namespace cosimulation {
+
+/// Co-simulates a peer process in lockstep with a simulation: every
+/// `period` seconds, starting at time zero, sends the value of the input port
+/// (input index 0) to the peer through a SharedMemoryMailbox, and holds the
+/// peer's reply on the output port (output index 0) until the next period.
+/// The output is zero before the first exchange. A controller connected this
+/// way thus behaves like a MatrixGain followed by a ZeroOrderHold.
+///
+/// The peer keeps its own state and only ever moves forward in time, so only
+/// one context of this system should be simulated, from time zero.
+///
+/// @tparam_double_only
+class CosimulationSystem final : public drake::systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CosimulationSystem);
+
+  /// Launches @p peer_command (see SharedMemoryMailbox::LaunchPeer()), which
+  /// must reply with @p output_size values to each request of
+  /// @p input_size values.
+  /// @throws std::exception if @p period is not positive, or the peer cannot
+  ///   be launched.
+  CosimulationSystem(double period, int input_size, int output_size,
+                     const std::vector<std::string>& peer_command);
+
+  double period() const { return period_; }
+
+  const SharedMemoryMailbox& mailbox() const { return *mailbox_; }
+
+ private:
+  drake::systems::EventStatus Exchange(
+      const drake::systems::Context<double>& context,
+      drake::systems::DiscreteValues<double>* discrete_state) const;
+
+  const double period_;
+  // The exchange mutates the mailbox, though not the system's behavior.
+  const std::unique_ptr<SharedMemoryMailbox> mailbox_;
+};
+
+}  // namespace cosimulation
+}  // namespace drake_external_examples
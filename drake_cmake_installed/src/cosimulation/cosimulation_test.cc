@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "cosimulation_system.h"  // IWYU pragma: associated
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/types.h>
+
+#include <cerrno>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/primitives/matrix_gain.h>
+#include <drake/systems/primitives/zero_order_hold.h>
+
+#include "particle/particle.h"
+
+namespace drake_external_examples {
+namespace cosimulation {
+namespace {
+
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::MatrixGain;
+using drake::systems::Simulator;
+using drake::systems::ZeroOrderHold;
+using particles::Particle;
+
+constexpr double kPeriod = 0.01;
+constexpr double kP = 4.0;
+constexpr double kD = 2.0;
+
+/// Simulates @p diagram, a Particle in closed loop, from x = 1, v = 0, and
+/// returns the particle's final state.
+Eigen::VectorXd Simulate(const Diagram<double>& diagram,
+                         const Particle<double>& particle) {
+  Simulator<double> simulator(diagram);
+  auto& particle_context =
+      particle.GetMyMutableContextFromRoot(&simulator.get_mutable_context());
+  particle_context.SetContinuousState(Eigen::Vector2d(1.0, 0.0));
+  simulator.AdvanceTo(5.0);
+  return particle_context.get_continuous_state_vector().CopyToVector();
+}
+
+/// Makes sure a Particle controlled by the PD controller in pd_controller.py,
+/// co-simulated in a Python process, follows the same trajectory as one
+/// controlled by the equivalent MatrixGain and ZeroOrderHold in the diagram.
+TEST(CosimulationTest, ParticleWithPythonController) {
+  DiagramBuilder<double> cosimulated_builder;
+  auto cosimulated_particle =
+      cosimulated_builder.AddSystem<Particle<double>>();
+  auto controller = cosimulated_builder.AddSystem<CosimulationSystem>(
+      kPeriod, 2, 1,
+      std::vector<std::string>{
+          COSIMULATION_PYTHON, COSIMULATION_SOURCE_DIR "/pd_controller.py",
+          "--kp=" + std::to_string(kP), "--kd=" + std::to_string(kD)});
+  cosimulated_builder.Connect(cosimulated_particle->get_output_port(0),
+                              controller->get_input_port(0));
+  cosimulated_builder.Connect(controller->get_output_port(0),
+                              cosimulated_particle->get_input_port(0));
+  auto cosimulated = cosimulated_builder.Build();
+
+  DiagramBuilder<double> reference_builder;
+  auto reference_particle = reference_builder.AddSystem<Particle<double>>();
+  auto gain = reference_builder.AddSystem<MatrixGain<double>>(
+      Eigen::RowVector2d(-kP, -kD));
+  auto hold = reference_builder.AddSystem<ZeroOrderHold<double>>(kPeriod, 1);
+  reference_builder.Connect(reference_particle->get_output_port(0),
+                            gain->get_input_port());
+  reference_builder.Connect(gain->get_output_port(), hold->get_input_port());
+  reference_builder.Connect(hold->get_output_port(),
+                            reference_particle->get_input_port(0));
+  auto reference = reference_builder.Build();
+
+  const Eigen::VectorXd expected = Simulate(*reference, *reference_particle);
+  const Eigen::VectorXd actual = Simulate(*cosimulated, *cosimulated_particle);
+  EXPECT_LT((actual - expected).lpNorm<Eigen::Infinity>(), 1e-10);
+  // The controller did its job.
+  EXPECT_LT(expected.norm(), 0.1);
+}
+
+/// Makes sure an exchange fails, rather than blocking forever, when the peer
+/// exits without replying.
+TEST(CosimulationTest, PeerExitThrows) {
+  SharedMemoryMailbox mailbox(1, 1);
+  mailbox.LaunchPeer({COSIMULATION_PYTHON, "-c", "pass"});
+  Eigen::VectorXd reply(1);
+  EXPECT_THROW(mailbox.Exchange(0.0, Eigen::VectorXd::Zero(1), &reply),
+               std::runtime_error);
+  EXPECT_EQ(mailbox.peer_pid(), -1);
+}
+
+// Returns the file descriptors open in this process.
+std::set<int> OpenFds() {
+  std::set<int> fds;
+  for (const auto& entry :
+       std::filesystem::directory_iterator("/proc/self/fd")) {
+    fds.insert(std::stoi(entry.path().filename().string()));
+  }
+  return fds;
+}
+
+/// Makes sure the mailbox's file descriptors are close-on-exec, so that only
+/// the peer inherits them.
+TEST(CosimulationTest, FdsAreCloseOnExec) {
+  const std::set<int> before = OpenFds();
+  SharedMemoryMailbox mailbox(1, 1);
+  int num_new = 0;
+  for (const int fd : OpenFds()) {
+    if (!before.contains(fd) && fcntl(fd, F_GETFD) >= 0) {
+      ++num_new;
+      EXPECT_NE(fcntl(fd, F_GETFD) & FD_CLOEXEC, 0) << "fd " << fd;
+    }
+  }
+  EXPECT_EQ(num_new, 3);
+}
+
+/// Makes sure the mailbox does not wait forever for a peer that hangs, but
+/// kills it.
+TEST(CosimulationTest, HungPeerIsKilled) {
+  const auto start = std::chrono::steady_clock::now();
+  pid_t pid = -1;
+  {
+    SharedMemoryMailbox mailbox(1, 1);
+    mailbox.LaunchPeer({"/bin/sh", "-c", "exec sleep 100"});
+    pid = mailbox.peer_pid();
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - start,
+            std::chrono::seconds(30));
+  // The peer was reaped, so it no longer exists.
+  EXPECT_EQ(kill(pid, 0), -1);
+  EXPECT_EQ(errno, ESRCH);
+}
+
+/// Makes sure requests and replies of the wrong size are rejected.
+TEST(CosimulationTest, WrongSizesThrow) {
+  SharedMemoryMailbox mailbox(2, 1);
+  mailbox.LaunchPeer({COSIMULATION_PYTHON,
+                      COSIMULATION_SOURCE_DIR "/pd_controller.py"});
+  Eigen::VectorXd reply(1);
+  EXPECT_THROW(mailbox.Exchange(0.0, Eigen::VectorXd::Zero(3), &reply),
+               std::logic_error);
+  Eigen::VectorXd wrong_reply(2);
+  EXPECT_THROW(mailbox.Exchange(0.0, Eigen::VectorXd::Zero(2), &wrong_reply),
+               std::logic_error);
+  mailbox.Exchange(0.0, Eigen::Vector2d(1.0, 1.0), &reply);
+  EXPECT_EQ(reply(0), -2.0);
+}
+
+}  // namespace
+}  // namespace cosimulation
+}  // namespace drake_external_examples
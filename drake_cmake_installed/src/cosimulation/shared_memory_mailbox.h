@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/common/eigen_types.h>
+
+namespace drake_external_examples {
+namespace cosimulation {
+
+/// A mailbox in shared memory, through which a simulation exchanges vectors
+/// with a peer process in lockstep: the simulation posts a request (a time
+/// and a vector), and blocks until the peer posts its reply (a vector). The
+/// peer may be written in Python (see cosimulation.py) or C++ (see
+/// MailboxPeer), and runs on its own core, without sharing an interpreter
+/// lock with the simulation.
+///
+/// The mailbox is an anonymous memory file (memfd), and each direction is
+/// signaled with an eventfd, so waiting blocks in the kernel instead of
+/// spinning. The eventfd reads and writes also order the memory accesses to
+/// the mailbox between the processes. The peer inherits the three file
+/// descriptors, and is told their numbers with the arguments
+/// `--mailbox_fd=<fd> --request_fd=<fd> --reply_fd=<fd>`; they are
+/// close-on-exec in this process, so that no other child inherits them.
+///
+/// The mailbox holds, in native byte order:
+///
+/// | offset         | contents                                        |
+/// |----------------|-------------------------------------------------|
+/// | 0              | uint32 magic number 0x44434f53                  |
+/// | 4              | uint32 request size n, in doubles               |
+/// | 8              | uint32 reply size m, in doubles                 |
+/// | 12             | uint32 closed flag, set when the peer must exit |
+/// | 16             | double time of the request                      |
+/// | 32             | double request[n]                               |
+/// | 32 + 8n        | double reply[m]                                 |
+///
+/// Linux only.
+class SharedMemoryMailbox {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SharedMemoryMailbox);
+
+  /// Creates a mailbox for requests of @p request_size and replies of
+  /// @p reply_size doubles.
+  /// @throws std::exception if either size is negative, or if the mailbox
+  ///   cannot be created.
+  SharedMemoryMailbox(int request_size, int reply_size);
+
+  /// Tells the peer, if any, to exit, and waits until it has. A peer that
+  /// has not exited after 5 seconds is killed.
+  ~SharedMemoryMailbox();
+
+  int request_size() const { return request_size_; }
+  int reply_size() const { return reply_size_; }
+
+  /// Launches the peer: runs @p command (a program and its arguments, found
+  /// on the PATH), with the mailbox arguments appended.
+  /// @throws std::exception if a peer was already launched, or if @p command
+  ///   cannot be run.
+  void LaunchPeer(const std::vector<std::string>& command);
+
+  /// Returns the process ID of the peer, or -1 if none was launched.
+  pid_t peer_pid() const { return peer_pid_; }
+
+  /// Posts @p request at @p time, and blocks until the peer replies.
+  /// @throws std::exception if no peer was launched, if @p request or
+  ///   @p reply has the wrong size, or if the peer exits without replying.
+  void Exchange(double time, const Eigen::Ref<const Eigen::VectorXd>& request,
+                drake::EigenPtr<Eigen::VectorXd> reply);
+
+ private:
+  int request_size_{};
+  int reply_size_{};
+  int mailbox_fd_{-1};
+  int request_fd_{-1};
+  int reply_fd_{-1};
+  size_t mapped_size_{};
+  uint8_t* mapped_{nullptr};
+  pid_t peer_pid_{-1};
+};
+
+/// The peer's end of a SharedMemoryMailbox, for peers written in C++.
+class MailboxPeer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MailboxPeer);
+
+  /// Attaches to the mailbox given by the `--mailbox_fd`, `--request_fd`
+  /// and `--reply_fd` arguments in @p argv, which SharedMemoryMailbox
+  /// appended.
+  /// @throws std::exception if an argument is missing, or the file
+  ///   descriptors do not hold a mailbox.
+  MailboxPeer(int argc, const char* const argv[]);
+
+  ~MailboxPeer();
+
+  int request_size() const { return request_size_; }
+  int reply_size() const { return reply_size_; }
+
+  /// Returns true if @p argv has the arguments that SharedMemoryMailbox
+  /// appends, i.e., if this process was launched as a peer.
+  static bool IsPeer(int argc, const char* const argv[]);
+
+  /// Blocks until the next request, and returns its time and vector, or
+  /// returns false if the mailbox was closed instead.
+  bool Receive(double* time, Eigen::VectorXd* request);
+
+  /// Posts @p reply to the last request.
+  /// @throws std::exception if @p reply has the wrong size.
+  void Reply(const Eigen::Ref<const Eigen::VectorXd>& reply);
+
+ private:
+  int request_size_{};
+  int reply_size_{};
+  int request_fd_{-1};
+  int reply_fd_{-1};
+  size_t mapped_size_{};
+  uint8_t* mapped_{nullptr};
+};
+
+}  // namespace cosimulation
+}  // namespace drake_external_examples
@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "dense_output.h"
+
+#include <stdexcept>
+
+#include <drake/systems/analysis/integrator_base.h>
+#include <drake/systems/framework/context.h>
+
+namespace drake_external_examples {
+namespace dense_output {
+
+std::unique_ptr<drake::trajectories::PiecewisePolynomial<double>>
+AdvanceToWithDenseOutput(drake::systems::Simulator<double>* simulator,
+                         double t_final) {
+  if (simulator == nullptr) {
+    throw std::logic_error("AdvanceToWithDenseOutput: null simulator");
+  }
+  const drake::systems::Context<double>& context = simulator->get_context();
+  if (context.num_continuous_states() == 0) {
+    throw std::logic_error(
+        "AdvanceToWithDenseOutput: the system has no continuous state");
+  }
+  if (!(t_final > context.get_time())) {
+    throw std::logic_error(
+        "AdvanceToWithDenseOutput: t_final must be after the current time");
+  }
+
+  simulator->set_publish_every_time_step(false);
+  drake::systems::IntegratorBase<double>& integrator =
+      simulator->get_mutable_integrator();
+  integrator.StartDenseIntegration();
+  simulator->AdvanceTo(t_final);
+  return integrator.StopDenseIntegration();
+}
+
+}  // namespace dense_output
+}  // namespace drake_external_examples
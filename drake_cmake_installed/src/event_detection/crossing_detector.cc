@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "crossing_detector.h"
+
+#include <stdexcept>
+
+#include <drake/common/value.h>
+#include <drake/systems/framework/event_status.h>
+#include <drake/systems/framework/framework_common.h>
+#include <drake/systems/framework/state.h>
+#include <drake/systems/framework/system.h>
+
+namespace drake_external_examples {
+namespace event_detection {
+
+using drake::systems::Context;
+using drake::systems::EventStatus;
+using drake::systems::State;
+using drake::systems::System;
+using drake::systems::UnrestrictedUpdateEvent;
+using drake::systems::WitnessFunction;
+using drake::systems::WitnessFunctionDirection;
+
+CrossingDetector::CrossingDetector(int input_size, int index,
+                                   double threshold)
+    : index_(index), threshold_(threshold) {
+  if (index < 0 || index >= input_size) {
+    throw std::logic_error("CrossingDetector: index out of range");
+  }
+  this->DeclareInputPort(drake::systems::kUseDefaultName,
+                         drake::systems::kVectorValued, input_size);
+  this->DeclareAbstractState(drake::Value<std::vector<Crossing>>());
+
+  const auto make_record = [](bool rising) {
+    return UnrestrictedUpdateEvent<double>(
+        [rising](const System<double>&, const Context<double>& context,
+                 const UnrestrictedUpdateEvent<double>&,
+                 State<double>* state) {
+          state->get_mutable_abstract_state<std::vector<Crossing>>(0)
+              .push_back({context.get_time(), rising});
+          return EventStatus::Succeeded();
+        });
+  };
+  falling_ = this->MakeWitnessFunction(
+      "falling", WitnessFunctionDirection::kPositiveThenNonPositive,
+      &CrossingDetector::CalcExcess, make_record(false));
+  rising_ = this->MakeWitnessFunction(
+      "rising", WitnessFunctionDirection::kNegativeThenNonNegative,
+      &CrossingDetector::CalcExcess, make_record(true));
+}
+
+CrossingDetector::~CrossingDetector() = default;
+
+const std::vector<Crossing>& CrossingDetector::get_crossings(
+    const Context<double>& context) const {
+  this->ValidateContext(context);
+  return context.get_abstract_state<std::vector<Crossing>>(0);
+}
+
+void CrossingDetector::DoGetWitnessFunctions(
+    const Context<double>&,
+    std::vector<const WitnessFunction<double>*>* witnesses) const {
+  witnesses->push_back(falling_.get());
+  witnesses->push_back(rising_.get());
+}
+
+double CrossingDetector::CalcExcess(const Context<double>& context) const {
+  return this->get_input_port(0).Eval(context)[index_] - threshold_;
+}
+
+}  // namespace event_detection
+}  // namespace drake_external_examples
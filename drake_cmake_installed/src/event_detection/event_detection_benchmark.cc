@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Compares the cost and the accuracy of locating the impacts of a
+/// BouncingParticle dropped from 1 m under gravity, with a restitution of 0.9,
+/// over the 10 s in which it bounces about eighty times and comes to rest:
+///
+/// - with witness functions, at several context accuracies, which the
+///   Simulator isolates impact times to 1% of; and
+/// - by checking for impacts after every step, with the step size limited to
+///   several maxima, as accuracy then requires.
+///
+/// For each this reports the wall time, the steps taken, the impacts found
+/// (and expected), and the largest error in their times compared with the
+/// closed form.
+///
+/// Usage: event_detection_benchmark [--json_output=<path>]
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "bouncing_particle.h"
+
+namespace drake_external_examples {
+namespace event_detection {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::systems::Simulator;
+
+constexpr double kGravity = 9.81;
+constexpr double kHeight = 1.0;
+constexpr double kEndTime = 10.0;
+
+std::vector<double> CalcExpectedImpactTimes(
+    const BouncingParticleOptions& options) {
+  double time = std::sqrt(2.0 * kHeight / kGravity);
+  double speed = std::sqrt(2.0 * kGravity * kHeight);
+  std::vector<double> times{time};
+  while ((speed *= options.restitution) >= options.resting_speed) {
+    time += 2.0 * speed / kGravity;
+    times.push_back(time);
+  }
+  return times;
+}
+
+void MeasureDrop(BenchmarkFixture* fixture, const std::string& name,
+                 ImpactDetection detection, double accuracy,
+                 std::optional<double> max_step) {
+  const BouncingParticleOptions options{.restitution = 0.9,
+                                        .detection = detection};
+  const BouncingParticle particle(options);
+  auto context = particle.CreateDefaultContext();
+  particle.get_input_port(0).FixValue(context.get(),
+                                      drake::Vector1d(-kGravity));
+  context->SetContinuousState(Eigen::Vector2d(kHeight, 0.0));
+  context->SetAccuracy(accuracy);
+  Simulator<double> simulator(particle, std::move(context));
+  if (max_step) {
+    simulator.get_mutable_integrator().set_maximum_step_size(*max_step);
+  }
+  simulator.Initialize();
+
+  BenchmarkResult& result =
+      fixture->Measure(name, 1, [&]() { simulator.AdvanceTo(kEndTime); });
+
+  const std::vector<double> expected = CalcExpectedImpactTimes(options);
+  const std::vector<double>& actual =
+      particle.get_impact_times(simulator.get_context());
+  double max_error = 0.0;
+  for (size_t i = 0; i < std::min(actual.size(), expected.size()); ++i) {
+    max_error = std::max(max_error, std::abs(actual[i] - expected[i]));
+  }
+  result.values["steps"] = simulator.get_num_steps_taken();
+  result.values["impacts"] = actual.size();
+  result.values["expected_impacts"] = expected.size();
+  result.values["max_impact_time_error"] = max_error;
+  std::cout << "  " << simulator.get_num_steps_taken() << " steps, "
+            << actual.size() << " of " << expected.size()
+            << " impacts, max impact time error " << max_error << " s"
+            << std::endl;
+}
+
+std::string FormatSeconds(double seconds) {
+  std::ostringstream out;
+  out << seconds << " s";
+  return out.str();
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("event_detection_benchmark", &argc, argv);
+  for (const double accuracy : {1e-4, 1e-6, 1e-8}) {
+    MeasureDrop(&fixture,
+                "witness, isolated to " + FormatSeconds(0.01 * accuracy),
+                ImpactDetection::kWitness, accuracy, std::nullopt);
+  }
+  for (const double max_step : {1e-2, 1e-3, 1e-4, 1e-5}) {
+    MeasureDrop(&fixture, "per step, steps up to " + FormatSeconds(max_step),
+                ImpactDetection::kPerStep, 1e-8, max_step);
+  }
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace event_detection
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::event_detection::DoMain(argc, argv);
+}
@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Compares Drake's implicit integrators, which form the Jacobian of the time
+/// derivatives by finite differences or automatic differentiation of the
+/// whole system, with ImplicitIntegrator, which uses an analytic, sparse
+/// StateJacobian, on StiffCubicChain systems of 10, 100 and 1000 states.
+///
+/// Every integrator takes fixed steps of 10 ms to t = 1 s, with both implicit
+/// Euler and the two-stage (third order) Radau IIA method. For each this
+/// reports the wall time; the derivative evaluations, in all and for forming
+/// Jacobians; the Jacobian evaluations and factorizations; and the largest
+/// error in the final state, compared with Radau IIA at a hundredth of the
+/// step size.
+///
+/// Usage: implicit_integration_benchmark [max_states]
+///            [--json_output=<path>]
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <drake/systems/analysis/implicit_euler_integrator.h>
+#include <drake/systems/analysis/implicit_integrator.h>
+#include <drake/systems/analysis/radau_integrator.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "implicit_integrator.h"
+#include "state_jacobian.h"
+#include "stiff_cubic_chain.h"
+
+namespace drake_external_examples {
+namespace implicit_integration {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::systems::ImplicitEulerIntegrator;
+using drake::systems::RadauIntegrator;
+using drake::systems::Simulator;
+using JacobianScheme =
+    drake::systems::ImplicitIntegrator<double>::JacobianComputationScheme;
+
+constexpr double kStiffness = 1e3;
+constexpr double kCoupling = 1e3;
+constexpr double kStepSize = 1e-2;
+constexpr double kEndTime = 1.0;
+constexpr int64_t kNumSteps = 100;
+
+Eigen::VectorXd MakeInitialState(int num_states) {
+  Eigen::VectorXd x0(num_states);
+  for (int i = 0; i < num_states; ++i) {
+    x0(i) = 0.5 + 0.3 * std::sin(1.0 * i);
+  }
+  return x0;
+}
+
+// Records and prints the work counts and the error of a finished run.
+void Record(BenchmarkResult* result, int64_t derivative_evaluations,
+            int64_t derivative_evaluations_for_jacobian,
+            int64_t jacobian_evaluations, int64_t factorizations,
+            const Eigen::VectorXd& x, const Eigen::VectorXd& reference) {
+  result->values["derivative_evaluations"] = derivative_evaluations;
+  result->values["derivative_evaluations_for_jacobian"] =
+      derivative_evaluations_for_jacobian;
+  result->values["jacobian_evaluations"] = jacobian_evaluations;
+  result->values["factorizations"] = factorizations;
+  result->values["max_error"] = (x - reference).lpNorm<Eigen::Infinity>();
+  std::cout << "  " << derivative_evaluations << " derivative evaluations ("
+            << derivative_evaluations_for_jacobian << " for Jacobians), "
+            << jacobian_evaluations << " Jacobians, " << factorizations
+            << " factorizations, max error " << result->values["max_error"]
+            << std::endl;
+}
+
+template <class Integrator>
+void MeasureDrake(BenchmarkFixture* fixture, const std::string& name,
+                  JacobianScheme scheme, const StiffCubicChain<double>& chain,
+                  const Eigen::VectorXd& x0, const Eigen::VectorXd& reference) {
+  Simulator<double> simulator(chain);
+  simulator.get_mutable_context().SetContinuousState(x0);
+  auto& integrator = simulator.reset_integrator<Integrator>();
+  integrator.set_fixed_step_mode(true);
+  integrator.set_maximum_step_size(kStepSize);
+  integrator.set_jacobian_computation_scheme(scheme);
+  simulator.Initialize();
+  std::string failure;
+  BenchmarkResult& result = fixture->Measure(name, kNumSteps, [&]() {
+    try {
+      simulator.AdvanceTo(kEndTime);
+    } catch (const std::exception& e) {
+      failure = e.what();
+    }
+  });
+  if (!failure.empty()) {
+    std::cout << "  failed: " << failure << std::endl;
+    return;
+  }
+  Record(&result, integrator.get_num_derivative_evaluations(),
+         integrator.get_num_derivative_evaluations_for_jacobian(),
+         integrator.get_num_jacobian_evaluations(),
+         integrator.get_num_iteration_matrix_factorizations(),
+         simulator.get_context().get_continuous_state_vector().CopyToVector(),
+         reference);
+}
+
+void MeasureAnalytic(BenchmarkFixture* fixture, const std::string& name,
+                     ImplicitScheme scheme,
+                     const StiffCubicChainStateJacobian& jacobian,
+                     const Eigen::VectorXd& x0,
+                     const Eigen::VectorXd& reference) {
+  ImplicitIntegrator integrator(jacobian,
+                                {.scheme = scheme, .step_size = kStepSize});
+  auto context = jacobian.system().CreateDefaultContext();
+  context->SetContinuousState(x0);
+  BenchmarkResult& result = fixture->Measure(name, kNumSteps, [&]() {
+    integrator.AdvanceTo(kEndTime, context.get());
+  });
+  const ImplicitIntegratorStatistics& stats = integrator.statistics();
+  // The analytic Jacobian takes no evaluations of the derivatives.
+  Record(&result, stats.num_derivative_evaluations, 0,
+         stats.num_jacobian_evaluations, stats.num_factorizations,
+         context->get_continuous_state_vector().CopyToVector(), reference);
+  result.values["step_retries"] = stats.num_step_retries;
+}
+
+void BenchmarkChain(BenchmarkFixture* fixture, int num_states) {
+  const StiffCubicChain<double> chain(num_states, kStiffness, kCoupling);
+  const StiffCubicChainStateJacobian jacobian(chain);
+  const Eigen::VectorXd x0 = MakeInitialState(num_states);
+
+  ImplicitIntegrator reference_integrator(jacobian,
+                                          {.step_size = kStepSize / 100});
+  auto reference_context = chain.CreateDefaultContext();
+  reference_context->SetContinuousState(x0);
+  reference_integrator.AdvanceTo(kEndTime, reference_context.get());
+  const Eigen::VectorXd reference =
+      reference_context->get_continuous_state_vector().CopyToVector();
+
+  const std::string prefix = std::to_string(num_states) + " states, ";
+  MeasureDrake<ImplicitEulerIntegrator<double>>(
+      fixture, prefix + "Drake implicit Euler, finite differences",
+      JacobianScheme::kForwardDifference, chain, x0, reference);
+  MeasureDrake<ImplicitEulerIntegrator<double>>(
+      fixture, prefix + "Drake implicit Euler, autodiff",
+      JacobianScheme::kAutomatic, chain, x0, reference);
+  MeasureAnalytic(fixture, prefix + "analytic implicit Euler",
+                  ImplicitScheme::kImplicitEuler, jacobian, x0, reference);
+  MeasureDrake<RadauIntegrator<double, 2>>(
+      fixture, prefix + "Drake Radau3, finite differences",
+      JacobianScheme::kForwardDifference, chain, x0, reference);
+  MeasureDrake<RadauIntegrator<double, 2>>(
+      fixture, prefix + "Drake Radau3, autodiff", JacobianScheme::kAutomatic,
+      chain, x0, reference);
+  MeasureAnalytic(fixture, prefix + "analytic Radau3",
+                  ImplicitScheme::kRadau3, jacobian, x0, reference);
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("implicit_integration_benchmark", &argc, argv);
+  const int max_states = (argc > 1) ? std::atoi(argv[1]) : 1000;
+  std::cout << "Chains with stiffness " << kStiffness << " and coupling "
+            << kCoupling << ", " << kNumSteps << " steps of " << kStepSize
+            << " s" << std::endl;
+  for (const int num_states : {10, 100, 1000}) {
+    if (num_states <= max_states) {
+      BenchmarkChain(&fixture, num_states);
+    }
+  }
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace implicit_integration
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::implicit_integration::DoMain(argc, argv);
+}
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "implicit_integrator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace drake_external_examples {
+namespace implicit_integration {
+
+using drake::systems::Context;
+
+namespace {
+
+// The Butcher coefficients of a stiffly accurate method: the solution at the
+// end of a step is its last stage.
+struct Coefficients {
+  Eigen::MatrixXd a;
+  Eigen::VectorXd c;
+};
+
+const Coefficients& GetCoefficients(ImplicitScheme scheme) {
+  static const Coefficients kImplicitEuler{Eigen::MatrixXd::Ones(1, 1),
+                                           Eigen::VectorXd::Ones(1)};
+  static const Coefficients kRadau3{
+      (Eigen::MatrixXd(2, 2) << 5.0 / 12, -1.0 / 12, 3.0 / 4, 1.0 / 4)
+          .finished(),
+      Eigen::Vector2d(1.0 / 3, 1.0)};
+  return scheme == ImplicitScheme::kImplicitEuler ? kImplicitEuler : kRadau3;
+}
+
+// Steps that fail to converge are halved at most this many times.
+constexpr int kMaxHalvings = 20;
+
+}  // namespace
+
+ImplicitIntegrator::ImplicitIntegrator(
+    const StateJacobian& jacobian, const ImplicitIntegratorOptions& options)
+    : jacobian_(jacobian),
+      options_(options),
+      num_stages_(
+          static_cast<int>(GetCoefficients(options.scheme).c.size())),
+      derivatives_(jacobian.system().AllocateTimeDerivatives()) {
+  if (!(options_.step_size > 0.0) || !(options_.newton_tolerance > 0.0) ||
+      options_.max_newton_iterations < 1) {
+    throw std::logic_error("ImplicitIntegrator: invalid options");
+  }
+}
+
+ImplicitIntegrator::~ImplicitIntegrator() = default;
+
+void ImplicitIntegrator::AdvanceTo(double end_time, Context<double>* context) {
+  jacobian_.system().ValidateContext(*context);
+  const double start_time = context->get_time();
+  if (end_time < start_time) {
+    throw std::logic_error("ImplicitIntegrator: cannot advance backwards");
+  }
+  // Steps end at multiples of the step size from the start time, so that
+  // round-off does not accumulate in the time.
+  for (int64_t i = 1; context->get_time() < end_time; ++i) {
+    const double next_time =
+        std::min(start_time + i * options_.step_size, end_time);
+    AdvanceBy(next_time - context->get_time(), 0, context);
+    context->SetTime(next_time);
+  }
+}
+
+void ImplicitIntegrator::AdvanceBy(double h, int num_halvings,
+                                   Context<double>* context) {
+  if (Step(h, context)) {
+    return;
+  }
+  if (num_halvings == kMaxHalvings) {
+    throw std::runtime_error(
+        "ImplicitIntegrator: Newton's method did not converge at t = " +
+        std::to_string(context->get_time()));
+  }
+  ++stats_.num_step_retries;
+  AdvanceBy(h / 2, num_halvings + 1, context);
+  AdvanceBy(h / 2, num_halvings + 1, context);
+}
+
+bool ImplicitIntegrator::Step(double h, Context<double>* context) {
+  const Coefficients& coefficients = GetCoefficients(options_.scheme);
+  const int n = jacobian_.system().num_continuous_states();
+  const int s = num_stages_;
+  const double t0 = context->get_time();
+  const Eigen::VectorXd x0 =
+      context->get_continuous_state_vector().CopyToVector();
+
+  jacobian_.Calc(*context, &jacobian_values_);
+  ++stats_.num_jacobian_evaluations;
+  if (!Factor(h)) {
+    return false;
+  }
+
+  // Solve for the stage increments Z = (Z₁, ..., Zₛ), with
+  // Zᵢ = h Σⱼ aᵢⱼ f(t₀ + cⱼh, x₀ + Zⱼ).
+  Eigen::VectorXd z = Eigen::VectorXd::Zero(s * n);
+  Eigen::VectorXd f(s * n);
+  Eigen::VectorXd stage_derivatives(n);
+  const double tolerance =
+      options_.newton_tolerance * (1.0 + x0.lpNorm<Eigen::Infinity>());
+  bool converged = false;
+  for (int iteration = 0;
+       iteration < options_.max_newton_iterations && !converged; ++iteration) {
+    ++stats_.num_newton_iterations;
+    for (int i = 0; i < s; ++i) {
+      CalcDerivatives(t0 + coefficients.c(i) * h, x0 + z.segment(i * n, n),
+                      context, &stage_derivatives);
+      f.segment(i * n, n) = stage_derivatives;
+    }
+    Eigen::VectorXd residual = -z;
+    for (int i = 0; i < s; ++i) {
+      for (int j = 0; j < s; ++j) {
+        residual.segment(i * n, n) +=
+            h * coefficients.a(i, j) * f.segment(j * n, n);
+      }
+    }
+    const Eigen::VectorXd delta = lu_.solve(residual);
+    if (!delta.allFinite()) {
+      break;
+    }
+    z += delta;
+    converged = delta.lpNorm<Eigen::Infinity>() <= tolerance;
+  }
+
+  if (!converged) {
+    context->SetTimeAndContinuousState(t0, x0);
+    return false;
+  }
+  context->SetTimeAndContinuousState(t0 + h, x0 + z.tail(n));
+  ++stats_.num_steps;
+  return true;
+}
+
+void ImplicitIntegrator::CalcDerivatives(double t,
+                                         const Eigen::VectorXd& x,
+                                         Context<double>* context,
+                                         Eigen::VectorXd* xdot) {
+  context->SetTimeAndContinuousState(t, x);
+  jacobian_.system().CalcTimeDerivatives(*context, derivatives_.get());
+  derivatives_->get_vector().CopyToPreSizedVector(xdot);
+  ++stats_.num_derivative_evaluations;
+}
+
+bool ImplicitIntegrator::Factor(double h) {
+  const Coefficients& coefficients = GetCoefficients(options_.scheme);
+  const int n = jacobian_values_.rows();
+  const int s = num_stages_;
+  // The Newton matrix I - h A ⊗ J always has the same entries stored, even
+  // where a value happens to be zero, so its ordering can be reused.
+  std::vector<Eigen::Triplet<double>> entries;
+  entries.reserve(s * s * jacobian_values_.nonZeros() + s * n);
+  for (int i = 0; i < s; ++i) {
+    for (int k = 0; k < n; ++k) {
+      entries.emplace_back(i * n + k, i * n + k, 1.0);
+    }
+    for (int j = 0; j < s; ++j) {
+      const double scale = -h * coefficients.a(i, j);
+      for (int col = 0; col < n; ++col) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(jacobian_values_,
+                                                           col);
+             it; ++it) {
+          entries.emplace_back(i * n + it.row(), j * n + col,
+                               scale * it.value());
+        }
+      }
+    }
+  }
+  newton_matrix_.resize(s * n, s * n);
+  newton_matrix_.setFromTriplets(entries.begin(), entries.end());
+  newton_matrix_.makeCompressed();
+  if (!pattern_analyzed_) {
+    lu_.analyzePattern(newton_matrix_);
+    pattern_analyzed_ = true;
+  }
+  lu_.factorize(newton_matrix_);
+  ++stats_.num_factorizations;
+  return lu_.info() == Eigen::Success;
+}
+
+}  // namespace implicit_integration
+}  // namespace drake_external_examples
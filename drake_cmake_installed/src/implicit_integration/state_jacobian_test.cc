@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "state_jacobian.h"  // IWYU pragma: associated
+
+#include <memory>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/autodiff.h>
+#include <drake/common/eigen_types.h>
+#include <drake/math/autodiff.h>
+#include <drake/math/autodiff_gradient.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/system.h>
+
+#include "particle/particle.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+#include "stiff_cubic_chain.h"
+
+namespace drake_external_examples {
+namespace implicit_integration {
+namespace {
+
+using drake::AutoDiffXd;
+using drake::systems::Context;
+using drake::systems::System;
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+// Differentiates the system's time derivatives with respect to its state in
+// context, on an AutoDiffXd copy of the system with the same inputs.
+Eigen::MatrixXd CalcAutoDiffJacobian(const System<double>& system,
+                                     const Context<double>& context) {
+  const std::unique_ptr<System<AutoDiffXd>> autodiff =
+      System<double>::ToAutoDiffXd(system);
+  auto autodiff_context = autodiff->CreateDefaultContext();
+  autodiff_context->SetTimeStateAndParametersFrom(context);
+  autodiff->FixInputPortsFrom(system, context, autodiff_context.get());
+  autodiff_context->SetContinuousState(drake::math::InitializeAutoDiff(
+      context.get_continuous_state_vector().CopyToVector()));
+  auto derivatives = autodiff->AllocateTimeDerivatives();
+  autodiff->CalcTimeDerivatives(*autodiff_context, derivatives.get());
+  return drake::math::ExtractGradient(derivatives->CopyToVector(),
+                                      context.num_continuous_states());
+}
+
+// Compares the analytic Jacobian with automatic differentiation at random
+// states, and checks that it has no nonzeros outside of its pattern.
+void ExpectMatchesAutoDiff(const StateJacobian& jacobian,
+                           Context<double>* context) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-2.0, 2.0);
+  const int n = context->num_continuous_states();
+  Eigen::SparseMatrix<double> values;
+  for (int trial = 0; trial < 10; ++trial) {
+    Eigen::VectorXd x(n);
+    for (int i = 0; i < n; ++i) {
+      x(i) = distribution(generator);
+    }
+    context->SetContinuousState(x);
+    jacobian.Calc(*context, &values);
+    const Eigen::MatrixXd expected =
+        CalcAutoDiffJacobian(jacobian.system(), *context);
+    EXPECT_TRUE(Eigen::MatrixXd(values).isApprox(expected, 1e-14))
+        << "x = " << x.transpose() << "\nJ =\n"
+        << Eigen::MatrixXd(values) << "\nexpected\n"
+        << expected;
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        if (expected(i, j) != 0.0) {
+          EXPECT_NE(jacobian.pattern().coeff(i, j), 0.0)
+              << "(" << i << ", " << j << ") is not in the pattern";
+        }
+      }
+    }
+  }
+}
+
+/// Makes sure the Particle's Jacobian matches automatic differentiation,
+/// with a force input and a mass other than one.
+TEST(StateJacobianTest, Particle) {
+  const Particle<double> particle(2.5);
+  const ParticleStateJacobian jacobian(particle);
+  auto context = particle.CreateDefaultContext();
+  particle.get_input_port(0).FixValue(context.get(), drake::Vector1d(3.0));
+  ExpectMatchesAutoDiff(jacobian, context.get());
+}
+
+/// Makes sure the Simple Continuous Time System's Jacobian matches automatic
+/// differentiation.
+TEST(StateJacobianTest, SimpleContinuousTimeSystem) {
+  const SimpleContinuousTimeSystem<double> system;
+  const SimpleContinuousTimeSystemStateJacobian jacobian(system);
+  auto context = system.CreateDefaultContext();
+  ExpectMatchesAutoDiff(jacobian, context.get());
+}
+
+/// Makes sure the chain's Jacobian matches automatic differentiation, and is
+/// tridiagonal.
+TEST(StateJacobianTest, StiffCubicChain) {
+  for (const int n : {1, 2, 7}) {
+    const StiffCubicChain<double> chain(n, 1e3, 50.0);
+    const StiffCubicChainStateJacobian jacobian(chain);
+    EXPECT_EQ(jacobian.pattern().nonZeros(), 3 * n - 2);
+    auto context = chain.CreateDefaultContext();
+    ExpectMatchesAutoDiff(jacobian, context.get());
+  }
+}
+
+/// Makes sure Calc() gives a matrix the pattern only when it does not
+/// already have it, and otherwise writes the values in place.
+TEST(StateJacobianTest, CalcReusesStorage) {
+  const StiffCubicChain<double> chain(5, 1.0, 1.0);
+  const StiffCubicChainStateJacobian jacobian(chain);
+  auto context = chain.CreateDefaultContext();
+
+  Eigen::SparseMatrix<double> values(2, 3);
+  jacobian.Calc(*context, &values);
+  ASSERT_EQ(values.rows(), 5);
+  ASSERT_EQ(values.cols(), 5);
+  ASSERT_EQ(values.nonZeros(), jacobian.pattern().nonZeros());
+  const double* storage = values.valuePtr();
+  EXPECT_EQ(values.coeff(0, 0), -3.0);
+
+  context->SetContinuousState(Eigen::VectorXd::Ones(5));
+  jacobian.Calc(*context, &values);
+  EXPECT_EQ(values.valuePtr(), storage);
+  EXPECT_EQ(values.coeff(0, 0), 0.0);
+  EXPECT_EQ(values.coeff(1, 0), 1.0);
+}
+
+}  // namespace
+}  // namespace implicit_integration
+}  // namespace drake_external_examples
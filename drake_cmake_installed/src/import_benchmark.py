@@ -0,0 +1,124 @@
+# SPDX-License-Identifier: MIT-0
+
+"""
+Measures how long it takes a fresh Python process to run import statements,
+e.g., to import the example modules, or all of pydrake.
+
+Usage: python3 import_benchmark.py [--runs=<count>] [--top=<count>]
+           [<statement> ...]
+
+Each statement is run in new interpreters, `--runs` times each (default 10):
+- cold, with an empty bytecode cache, so that every module is compiled;
+- warm, with a bytecode cache that an earlier run filled.
+Either way, the files themselves are in the operating system's page cache.
+The table reports the median wall time of each, and also of an empty
+statement, i.e., of the interpreter's own startup. Then, for each statement,
+a warm run with `-X importtime` lists the `--top` modules (default 10) that
+took the longest to import, including the modules they imported.
+
+This directory, and its particle/ subdirectory if any, are prepended to
+PYTHONPATH, so that `particle` can be imported in every example tree.
+"""
+
+import argparse
+import os
+from pathlib import Path
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+DEFAULT_STATEMENTS = [
+    "import particle",
+    "from particle import Particle",
+    "import pydrake.systems.framework",
+    "import pydrake.all",
+]
+
+
+def _environment(pycache_prefix):
+    here = Path(__file__).resolve().parent
+    paths = [str(path) for path in (here, here / "particle") if path.is_dir()]
+    if os.environ.get("PYTHONPATH"):
+        paths.append(os.environ["PYTHONPATH"])
+    env = dict(os.environ)
+    env["PYTHONPATH"] = os.pathsep.join(paths)
+    # Keep the bytecode this benchmark writes out of the source tree, and
+    # ignore any that is already there.
+    env["PYTHONPYCACHEPREFIX"] = pycache_prefix
+    return env
+
+
+def _run(statement, pycache_prefix, importtime=False):
+    """Runs `statement` in a new interpreter, and returns its wall time in
+    seconds and its standard error.
+    """
+    command = [sys.executable]
+    if importtime:
+        command += ["-X", "importtime"]
+    command += ["-c", statement]
+    start = time.perf_counter()
+    result = subprocess.run(command, env=_environment(pycache_prefix),
+                            stdout=subprocess.DEVNULL, stderr=subprocess.PIPE,
+                            text=True)
+    seconds = time.perf_counter() - start
+    if result.returncode != 0:
+        raise RuntimeError(f"{statement!r} failed:\n{result.stderr}")
+    return seconds, result.stderr
+
+
+def _slowest_imports(importtime_output, top):
+    """Parses the `-X importtime` lines, i.e.,
+        import time: <self [us]> | <cumulative [us]> | <indented module>
+    and returns the `top` (cumulative microseconds, module) pairs.
+    """
+    imports = []
+    for line in importtime_output.splitlines():
+        if not line.startswith("import time:"):
+            continue
+        _, cumulative, module = line[len("import time:"):].split("|")
+        if cumulative.strip().isdigit():
+            imports.append((int(cumulative), module.strip()))
+    return sorted(imports, reverse=True)[:top]
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.split("\n\n")[0].strip())
+    parser.add_argument("--runs", type=int, default=10)
+    parser.add_argument("--top", type=int, default=10)
+    parser.add_argument("statements", nargs="*", default=DEFAULT_STATEMENTS)
+    args = parser.parse_args()
+    if args.runs < 1:
+        parser.error("--runs must be positive")
+
+    statements = ["pass"] + args.statements
+    width = max(len(statement) for statement in statements)
+    print(f"{'statement':<{width}}  {'cold [ms]':>10}  {'warm [ms]':>10}")
+    breakdowns = []
+    with tempfile.TemporaryDirectory() as scratch:
+        warm_prefix = os.path.join(scratch, "warm")
+        for statement in statements:
+            cold = []
+            for run in range(args.runs):
+                cold_prefix = os.path.join(scratch, f"cold_{run}")
+                cold.append(_run(statement, cold_prefix)[0])
+            _run(statement, warm_prefix)
+            warm = [_run(statement, warm_prefix)[0] for _ in range(args.runs)]
+            cold_ms = statistics.median(cold) * 1e3
+            warm_ms = statistics.median(warm) * 1e3
+            print(f"{statement:<{width}}  {cold_ms:>10.1f}  {warm_ms:>10.1f}")
+            if statement != "pass":
+                _, stderr = _run(statement, warm_prefix, importtime=True)
+                breakdowns.append(
+                    (statement, _slowest_imports(stderr, args.top)))
+
+    for statement, imports in breakdowns:
+        print(f"\nSlowest imports (cumulative, warm) for {statement!r}:")
+        for microseconds, module in imports:
+            print(f"  {microseconds / 1e3:>8.1f} ms  {module}")
+
+
+if __name__ == "__main__":
+    main()
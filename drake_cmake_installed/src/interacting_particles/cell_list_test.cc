@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "cell_list.h"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+Eigen::VectorXd RandomCoordinates(int size, double extent, int seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> distribution(0.0, extent);
+  Eigen::VectorXd result(size);
+  for (int i = 0; i < size; ++i) {
+    result[i] = distribution(generator);
+  }
+  return result;
+}
+
+// Checks that the cell list holds exactly the given points, and that every
+// pair closer than the cutoff lies in the same or adjacent cells.
+void ExpectConsistent(const CellList& cells, const Eigen::VectorXd& x,
+                      const Eigen::VectorXd& y, double cutoff) {
+  const int n = static_cast<int>(x.size());
+  ASSERT_EQ(cells.num_points(), n);
+  EXPECT_GE(cells.cell_size(), cutoff);
+  EXPECT_EQ(cells.cell_begin(cells.num_cells()), n);
+  std::vector<int> cell_of(n, -1);
+  for (int c = 0; c < cells.num_cells(); ++c) {
+    for (int s = cells.cell_begin(c); s < cells.cell_begin(c + 1); ++s) {
+      const int i = cells.point_index()[s];
+      ASSERT_EQ(cell_of[i], -1);
+      cell_of[i] = c;
+      EXPECT_EQ(cells.sorted_x()[s], x[i]);
+      EXPECT_EQ(cells.sorted_y()[s], y[i]);
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    ASSERT_NE(cell_of[i], -1);
+    for (int j = i + 1; j < n; ++j) {
+      if (std::hypot(x[i] - x[j], y[i] - y[j]) < cutoff) {
+        const int row_i = cell_of[i] / cells.num_cols();
+        const int row_j = cell_of[j] / cells.num_cols();
+        const int col_i = cell_of[i] % cells.num_cols();
+        const int col_j = cell_of[j] % cells.num_cols();
+        EXPECT_LE(std::abs(row_i - row_j), 1);
+        EXPECT_LE(std::abs(col_i - col_j), 1);
+      }
+    }
+  }
+}
+
+/// Makes sure random points are bucketed so that all close pairs are found.
+TEST(CellListTest, FindsAllNeighbors) {
+  const Eigen::VectorXd x = RandomCoordinates(2000, 30.0, 1);
+  const Eigen::VectorXd y = RandomCoordinates(2000, 20.0, 2);
+  CellList cells;
+  cells.Rebuild(x, y, 1.0);
+  EXPECT_TRUE(cells.last_rebuild_rebucketed());
+  ExpectConsistent(cells, x, y, 1.0);
+}
+
+/// Makes sure small motions only refresh the coordinates, while larger ones
+/// re-bucket the points or re-size the grid.
+TEST(CellListTest, RebuildsIncrementally) {
+  Eigen::VectorXd x = RandomCoordinates(500, 10.0, 3);
+  Eigen::VectorXd y = RandomCoordinates(500, 10.0, 4);
+  CellList cells;
+  cells.Rebuild(x, y, 1.0);
+
+  // Move every point by a tiny amount, which for these points crosses no cell
+  // boundary.
+  x.array() += 1e-12;
+  cells.Rebuild(x, y, 1.0);
+  EXPECT_FALSE(cells.last_rebuild_rebucketed());
+  ExpectConsistent(cells, x, y, 1.0);
+
+  // Move one point to the other side of the box.
+  x[7] = 10.0 - x[7];
+  y[7] = 10.0 - y[7];
+  cells.Rebuild(x, y, 1.0);
+  EXPECT_TRUE(cells.last_rebuild_rebucketed());
+  ExpectConsistent(cells, x, y, 1.0);
+
+  // Move one point far outside the grid.
+  x[11] = 100.0;
+  cells.Rebuild(x, y, 1.0);
+  EXPECT_TRUE(cells.last_rebuild_rebucketed());
+  ExpectConsistent(cells, x, y, 1.0);
+
+  // Change the number of points.
+  x.conservativeResize(100);
+  y.conservativeResize(100);
+  cells.Rebuild(x, y, 1.0);
+  ExpectConsistent(cells, x, y, 1.0);
+}
+
+/// Makes sure far-apart points do not make the grid grow without bound.
+TEST(CellListTest, BoundsTheNumberOfCells) {
+  const Eigen::VectorXd x = Eigen::Vector3d(0.0, 1.0, 1e9);
+  const Eigen::VectorXd y = Eigen::Vector3d(0.0, 0.5, -1e9);
+  CellList cells;
+  cells.Rebuild(x, y, 1.0);
+  EXPECT_LE(cells.num_cells(), 9);
+  ExpectConsistent(cells, x, y, 1.0);
+}
+
+/// Makes sure invalid arguments are rejected.
+TEST(CellListTest, RejectsBadArguments) {
+  CellList cells;
+  const Eigen::VectorXd x = Eigen::Vector2d(0.0, 1.0);
+  const Eigen::VectorXd y = Eigen::Vector2d(
+      0.0, std::numeric_limits<double>::quiet_NaN());
+  EXPECT_THROW(cells.Rebuild(x, Eigen::VectorXd(3), 1.0), std::logic_error);
+  EXPECT_THROW(cells.Rebuild(x, x, 0.0), std::logic_error);
+  EXPECT_THROW(cells.Rebuild(x, y, 1.0), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace particles
+}  // namespace drake_external_examples
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/cache_entry.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/framework/leaf_system.h>
+
+#include "cell_list.h"
+#include "thread_pool/thread_pool.h"
+
+namespace drake_external_examples {
+namespace particles {
+
+/// Configures InteractingParticles.
+struct InteractionOptions {
+  /// Particles closer than this repel each other, in @f$ m @f$ units.
+  double cutoff_radius{1.0};
+  /// The repulsive force between two coincident particles, in @f$ N @f$
+  /// units; it falls linearly to zero at the cutoff radius.
+  double stiffness{10.0};
+  /// A linear drag coefficient, in @f$ N s/m @f$ units.
+  double damping{0.5};
+  /// The number of threads computing forces; values less than 1 mean all
+  /// cores.
+  int num_threads{1};
+};
+
+/// A planar system of unit-mass particles, each one a 2D `Particle`, that
+/// repel their neighbors with a soft, short-range force.
+///
+/// Particles i and j at distance r < r_c push each other apart along the line
+/// between them with a force of magnitude k (1 − r / r_c), and each particle
+/// feels a drag −b v. It can be described in terms of its:
+///
+/// - States/Outputs (output index 0), structure-of-arrays:
+///   - positions (state indices [0, 2N)), all x then all y, in @f$ m @f$.
+///   - velocities (state indices [2N, 4N)), all x then all y, in
+///     @f$ m/s @f$.
+///
+/// Neighbors are found with a CellList whose cells are at least r_c wide,
+/// kept in the cache of each context and rebuilt incrementally whenever the
+/// positions change, so evaluating the time derivatives costs O(N) rather
+/// than O(N²). The forces are computed in parallel, one row of cells per
+/// task; each particle's force is summed by exactly one task, so no
+/// synchronization is needed and the result does not depend on the number of
+/// threads. The thread pool is shared by all contexts of the system, so
+/// concurrent derivative evaluations take turns using it.
+///
+/// @tparam_double_only
+class InteractingParticles final : public drake::systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(InteractingParticles);
+
+  /// Creates a system of @p num_particles particles.
+  /// @throws std::exception if @p num_particles is negative, or the cutoff
+  /// radius is not positive.
+  InteractingParticles(int num_particles, const InteractionOptions& options);
+
+  int num_particles() const { return num_particles_; }
+
+  const InteractionOptions& options() const { return options_; }
+
+  /// Returns the cell list for the positions in @p context.
+  const CellList& EvalCellList(
+      const drake::systems::Context<double>& context) const;
+
+ private:
+  void CopyStateOut(const drake::systems::Context<double>& context,
+                    drake::systems::BasicVector<double>* output) const;
+
+  void CalcCellList(const drake::systems::Context<double>& context,
+                    CellList* cell_list) const;
+
+  void DoCalcTimeDerivatives(
+      const drake::systems::Context<double>& context,
+      drake::systems::ContinuousState<double>* derivatives) const override;
+
+  const int num_particles_;
+  const InteractionOptions options_;
+  const drake::systems::CacheEntry* cell_list_cache_entry_{};
+  const std::unique_ptr<parallel::ThreadPool> pool_;
+  mutable std::mutex pool_mutex_;
+};
+
+/// Computes the interaction force on every particle of @p system by checking
+/// all pairs, in O(N²) time, as a reference for the cell-list version.
+/// @p positions are laid out like the system's positions, and so is the
+/// result.
+Eigen::VectorXd CalcInteractionForcesAllPairs(
+    const InteractingParticles& system,
+    const Eigen::Ref<const Eigen::VectorXd>& positions);
+
+}  // namespace particles
+}  // namespace drake_external_examples
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/math/rigid_transform.h>
+#include <drake/multibody/plant/multibody_plant.h>
+
+namespace drake_external_examples {
+namespace model_cache {
+
+/// A rigid body of a ModelDescription.
+struct BodyDescription {
+  std::string name;
+  /// The index of the body's model instance in the plant.
+  int model_instance{};
+  /// The body's mass, the position of its center of mass, and its unit
+  /// inertia about its origin, [Gxx, Gyy, Gzz, Gxy, Gxz, Gyz], all in its
+  /// frame B.
+  double mass{};
+  Eigen::Vector3d p_BoBcm_B{Eigen::Vector3d::Zero()};
+  Eigen::Vector<double, 6> unit_inertia{Eigen::Vector<double, 6>::Zero()};
+  /// The body's default pose in the world, if it is free, i.e., has no
+  /// inboard joint other than the floating joint that Finalize() adds.
+  std::optional<drake::math::RigidTransformd> default_free_pose;
+};
+
+/// A revolute, prismatic or weld joint of a ModelDescription.
+struct JointDescription {
+  std::string name;
+  /// The joint's type_name(): "revolute", "prismatic" or "weld".
+  std::string type;
+  /// The indices of the parent and child bodies in the plant; 0 is the
+  /// world.
+  int parent_body{};
+  int child_body{};
+  /// The poses of the joint's frames F and M in the parent and child bodies.
+  drake::math::RigidTransformd X_PF;
+  drake::math::RigidTransformd X_CM;
+  /// For a revolute or prismatic joint, its axis, in F and M, and damping.
+  Eigen::Vector3d axis{Eigen::Vector3d::Zero()};
+  double damping{};
+  /// For a weld, the pose of M in F.
+  drake::math::RigidTransformd X_FM;
+  Eigen::VectorXd position_lower_limits;
+  Eigen::VectorXd position_upper_limits;
+  Eigen::VectorXd velocity_lower_limits;
+  Eigen::VectorXd velocity_upper_limits;
+  Eigen::VectorXd acceleration_lower_limits;
+  Eigen::VectorXd acceleration_upper_limits;
+  Eigen::VectorXd default_positions;
+};
+
+/// A joint actuator of a ModelDescription.
+struct ActuatorDescription {
+  std::string name;
+  /// The actuated joint, by its name and the index of its model instance.
+  std::string joint_name;
+  int model_instance{};
+  double effort_limit{};
+  double rotor_inertia{};
+  double gear_ratio{};
+  /// The proportional and derivative gains of the actuator's PD controller,
+  /// if it has one.
+  std::optional<Eigen::Vector2d> controller_gains;
+};
+
+/// What a finalized MultibodyPlant holds of the models parsed into it, enough
+/// to build an equivalent plant without parsing them again: its model
+/// instances, the mass properties of its bodies, and its joints, actuators
+/// and gravity. Geometry is not kept, so the plants built from it have no
+/// visual or collision geometry and need no SceneGraph.
+struct ModelDescription {
+  /// The names of the model instances other than the world and default
+  /// ones, in order; the first has index 2.
+  std::vector<std::string> model_instances;
+  /// The bodies other than the world, in order; the first has index 1.
+  std::vector<BodyDescription> bodies;
+  std::vector<JointDescription> joints;
+  std::vector<ActuatorDescription> actuators;
+  Eigen::Vector3d gravity{Eigen::Vector3d::Zero()};
+};
+
+/// Returns the description of @p plant.
+/// @throws std::logic_error if @p plant is not finalized, or has a joint
+///   that is not revolute, prismatic, weld or an implicit floating joint.
+ModelDescription DescribePlant(
+    const drake::multibody::MultibodyPlant<double>& plant);
+
+/// Returns a finalized plant, with the time step @p time_step, built from
+/// @p description.
+/// @throws std::exception if @p description is inconsistent, e.g., a joint
+///   refers to a body that it does not have.
+std::unique_ptr<drake::multibody::MultibodyPlant<double>> BuildPlant(
+    const ModelDescription& description, double time_step = 0.0);
+
+/// Returns @p description in a binary format, in native byte order, that
+/// DeserializeModelDescription() reads back exactly.
+std::string SerializeModelDescription(const ModelDescription& description);
+
+/// @throws std::runtime_error if @p bytes are not a description serialized by
+///   SerializeModelDescription().
+ModelDescription DeserializeModelDescription(std::string_view bytes);
+
+/// Parses the model file (URDF, SDFormat, ...) at @p path into a plant, and
+/// returns its description.
+/// @throws std::exception if the file cannot be parsed.
+ModelDescription ParseModelDescription(const std::string& path);
+
+/// Counts of how a ModelCache was used.
+struct ModelCacheStatistics {
+  /// Loads served from the descriptions in memory, including those that
+  /// waited for another thread to read or parse the file.
+  int64_t memory_hits{};
+  /// Loads that read a description from the cache's directory.
+  int64_t disk_loads{};
+  /// Loads that parsed the model file.
+  int64_t parses{};
+};
+
+/// Loads model files, parsing each once: the first load of a file parses it
+/// and keeps its ModelDescription, keyed by the file's canonical path and its
+/// modification time and size, and later loads build plants from the
+/// description instead. A file that changes is parsed again.
+///
+/// Given a directory, the cache also keeps the serialized descriptions there,
+/// named by the SHA-256 of their keys, so that other processes that open a
+/// cache on the same directory (e.g., the workers of a sweep) load them
+/// without parsing. Descriptions are written to a temporary name and renamed
+/// into place, so processes may share the directory; an unreadable one is
+/// parsed again and replaced.
+///
+/// Only the file itself is keyed: changes to the files it includes (e.g.,
+/// meshes or other models) are not noticed.
+///
+/// A cache is thread-safe. A file loaded by several threads at once is read
+/// or parsed once, by the first of them, while the others wait for its
+/// description; different files are read and parsed concurrently, and so are
+/// the plants built from them. If a file cannot be parsed, every thread
+/// waiting for it gets the exception, and nothing is kept, so that a later
+/// load tries again.
+class ModelCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ModelCache);
+
+  /// Opens a cache in memory only, or, if @p directory is not empty, also in
+  /// @p directory, creating it if need be.
+  /// @throws std::runtime_error if the directory cannot be created.
+  explicit ModelCache(std::string directory = {});
+
+  ~ModelCache();
+
+  const std::string& directory() const { return directory_; }
+
+  /// Returns the description of the model file at @p path.
+  /// @throws std::exception if the file does not exist or cannot be parsed.
+  std::shared_ptr<const ModelDescription> GetDescription(
+      const std::string& path);
+
+  /// Returns a finalized plant, with the time step @p time_step, of the
+  /// model file at @p path.
+  /// @throws std::exception as GetDescription() does.
+  std::unique_ptr<drake::multibody::MultibodyPlant<double>> Load(
+      const std::string& path, double time_step = 0.0);
+
+  ModelCacheStatistics statistics() const;
+
+ private:
+  // A description, ready or still being read or parsed by some thread.
+  struct Entry {
+    int64_t modified{};
+    uint64_t size{};
+    std::shared_future<std::shared_ptr<const ModelDescription>> description;
+  };
+
+  // Reads or parses the description, without holding mutex_.
+  ModelDescription ReadOrParse(const std::string& canonical, int64_t modified,
+                               uint64_t size);
+  std::optional<ModelDescription> ReadFromDisk(const std::string& file) const;
+  void WriteToDisk(const std::string& file,
+                   const ModelDescription& description) const;
+
+  const std::string directory_;
+  mutable std::mutex mutex_;
+  // The descriptions, by canonical path.
+  std::unordered_map<std::string, Entry> entries_;
+  ModelCacheStatistics statistics_;
+};
+
+}  // namespace model_cache
+}  // namespace drake_external_examples
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures the throughput of rigid-body dynamics on a MultibodyPlant, as a
+/// baseline for planning how many evaluations a machine sustains:
+///
+/// - the pendulum of Drake's `Pendulum.urdf`, continuous and discrete
+///   (1 ms), evaluating on one thread its dynamics (CalcTimeDerivatives(),
+///   or the discrete update) and its mass matrix (CalcMassMatrix());
+/// - the same dynamics evaluated for a batch of states, one context each,
+///   on 1 thread and on all threads, with the speedup; and
+/// - a chain of 1 to 100 pendulums, continuous, to show how the cost of each
+///   evaluation grows with the degrees of freedom.
+///
+/// The states change at every evaluation, so that no results are reused
+/// from the contexts' caches.
+///
+/// Usage: multibody_pendulum_benchmark [--evaluations=<count>]
+///            [--batch=<size>] [--threads=<count>] [--json_output=<path>]
+///
+/// By default, each single-thread measurement makes 100000 evaluations of the
+/// pendulum (fewer, in proportion, for longer chains), and the batches hold
+/// 1000 states, evaluated 100 times, on all cores.
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "multibody_pendulum.h"
+
+namespace drake_external_examples {
+namespace multibody_pendulum {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::multibody::MultibodyPlant;
+
+void PrintRate(BenchmarkResult* result, double checksum) {
+  const double rate = result->num_operations / result->seconds;
+  result->values["evaluations_per_second"] = rate;
+  result->values["ns_per_evaluation"] = 1e9 / rate;
+  std::cout << "  " << rate << " evaluations/s, " << 1e9 / rate
+            << " ns each (checksum " << checksum << ")" << std::endl;
+}
+
+// Returns the state of evaluation @p i of a plant with @p num_positions
+// positions: every angle and rate varies with i, and none repeats soon.
+Eigen::VectorXd StateAt(int64_t i, int num_positions) {
+  return Eigen::VectorXd::LinSpaced(2 * num_positions, 0.1, 0.9) *
+         (1.0 + 1e-3 * (i % 1000));
+}
+
+// Measures @p count evaluations of the dynamics of @p plant, and then of its
+// mass matrix, on this thread.
+void MeasureEvaluations(BenchmarkFixture* fixture, const std::string& name,
+                        const MultibodyPlant<double>& plant, int64_t count) {
+  auto context = plant.CreateDefaultContext();
+  const int n = plant.num_positions();
+  // The states are made up front, so that only the evaluations are timed.
+  Eigen::MatrixXd states(2 * n, 1000);
+  for (int i = 0; i < states.cols(); ++i) {
+    states.col(i) = StateAt(i, n);
+  }
+
+  double checksum = 0.0;
+  BenchmarkResult& dynamics = fixture->Measure(
+      name + (plant.is_discrete() ? ", discrete update" : ", derivatives"),
+      count, [&]() {
+        auto derivatives = plant.AllocateTimeDerivatives();
+        auto update = plant.AllocateDiscreteVariables();
+        for (int64_t i = 0; i < count; ++i) {
+          plant.SetPositionsAndVelocities(context.get(),
+                                          states.col(i % states.cols()));
+          if (plant.is_discrete()) {
+            plant.CalcForcedDiscreteVariableUpdate(*context, update.get());
+            checksum += update->value()[n];
+          } else {
+            plant.CalcTimeDerivatives(*context, derivatives.get());
+            checksum += (*derivatives)[n];
+          }
+        }
+      });
+  PrintRate(&dynamics, checksum);
+  dynamics.values["degrees_of_freedom"] = n;
+
+  checksum = 0.0;
+  Eigen::MatrixXd mass_matrix(n, n);
+  BenchmarkResult& mass =
+      fixture->Measure(name + ", mass matrix", count, [&]() {
+        for (int64_t i = 0; i < count; ++i) {
+          plant.SetPositionsAndVelocities(context.get(),
+                                          states.col(i % states.cols()));
+          plant.CalcMassMatrix(*context, &mass_matrix);
+          checksum += mass_matrix(0, 0);
+        }
+      });
+  PrintRate(&mass, checksum);
+  mass.values["degrees_of_freedom"] = n;
+}
+
+// Measures @p num_batches evaluations of a batch of @p batch_size states of
+// @p plant, on 1 and on @p num_threads threads.
+void MeasureBatches(BenchmarkFixture* fixture, const std::string& name,
+                    const MultibodyPlant<double>& plant, int batch_size,
+                    int num_batches, int num_threads) {
+  const int n = plant.num_positions();
+  double one_thread_seconds = 0.0;
+  for (const int threads : {1, num_threads}) {
+    BatchEvaluator batch(&plant, batch_size, threads);
+    // Alternate batches take alternate states.
+    Eigen::MatrixXd states[2];
+    for (int k = 0; k < 2; ++k) {
+      states[k].resize(2 * n, batch_size);
+      for (int i = 0; i < batch_size; ++i) {
+        states[k].col(i) = StateAt(int64_t{k} * batch_size + i, n);
+      }
+    }
+    double checksum = 0.0;
+    BenchmarkResult& result = fixture->Measure(
+        name + ", batch of " + std::to_string(batch_size) + ", " +
+            std::to_string(batch.num_threads()) + " threads",
+        int64_t{batch_size} * num_batches, [&]() {
+          for (int k = 0; k < num_batches; ++k) {
+            batch.SetStates(states[k % 2]);
+            checksum += batch.CalcDynamics()(n, 0);
+          }
+        });
+    PrintRate(&result, checksum);
+    if (threads == 1) {
+      one_thread_seconds = result.seconds;
+    }
+    const double speedup = one_thread_seconds / result.seconds;
+    result.values["threads"] = batch.num_threads();
+    result.values["speedup"] = speedup;
+    std::cout << "  " << speedup << "x the throughput of one thread"
+              << std::endl;
+    if (batch.num_threads() == 1) {
+      break;
+    }
+  }
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("multibody_pendulum_benchmark", &argc, argv);
+  int64_t num_evaluations = 100'000;
+  int batch_size = 1'000;
+  int num_threads = 0;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--evaluations=")) {
+      num_evaluations = std::stoll(std::string(arg.substr(14)));
+    } else if (arg.starts_with("--batch=")) {
+      batch_size = std::stoi(std::string(arg.substr(8)));
+    } else if (arg.starts_with("--threads=")) {
+      num_threads = std::stoi(std::string(arg.substr(10)));
+    } else {
+      throw std::logic_error("Unknown argument " + std::string(arg));
+    }
+  }
+  if (num_evaluations < 1 || batch_size < 1) {
+    throw std::logic_error(
+        "The numbers of evaluations and the batch size must be positive");
+  }
+  constexpr int kNumBatches = 100;
+
+  for (const double time_step : {0.0, 1e-3}) {
+    const auto plant = MakeUrdfPendulum(time_step);
+    const std::string name =
+        time_step == 0.0 ? "pendulum, continuous" : "pendulum, discrete";
+    MeasureEvaluations(&fixture, name, *plant, num_evaluations);
+    MeasureBatches(&fixture, name, *plant, batch_size, kNumBatches,
+                   num_threads);
+  }
+
+  for (const int num_links : {1, 2, 5, 10, 20, 50, 100}) {
+    const auto chain = MakePendulumChain(num_links);
+    MeasureEvaluations(&fixture,
+                       "chain of " + std::to_string(num_links) + " links",
+                       *chain, std::max<int64_t>(num_evaluations / num_links,
+                                                 100));
+  }
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace multibody_pendulum
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::multibody_pendulum::DoMain(argc, argv);
+}
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures the speedup of parareal over a serial simulation of a
+/// SimpleContinuousTimeSystem across thread counts, for a long horizon.
+///
+/// The fine propagator's step size is capped (as it would be by, e.g., a
+/// controller's update rate) so that the serial solve does a realistic amount
+/// of work per simulated second.
+///
+/// Usage: parareal_benchmark [horizon_seconds] [num_slices] [max_step_size]
+///            [--json_output=<path>]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <drake/systems/analysis/simulator.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "parareal.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace parareal {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("parareal_benchmark", &argc, argv);
+  const double horizon = (argc > 1) ? std::atof(argv[1]) : 100.0;
+  const int num_slices = (argc > 2) ? std::atoi(argv[2]) : 64;
+  const double max_step_size = (argc > 3) ? std::atof(argv[3]) : 1e-3;
+  const double accuracy = 1e-10;
+
+  systems::SimpleContinuousTimeSystem<double> system;
+  auto context = system.CreateDefaultContext();
+  context->get_mutable_continuous_state()[0] = 0.9;
+
+  drake::systems::Simulator<double> serial(system, context->Clone());
+  serial.get_mutable_integrator().set_target_accuracy(accuracy);
+  serial.get_mutable_integrator().set_maximum_step_size(max_step_size);
+  // One operation per simulated second.
+  const int64_t num_operations = std::max<int64_t>(1, std::llround(horizon));
+  const BenchmarkResult& serial_result =
+      fixture.Measure("serial", num_operations, [&]() {
+        serial.AdvanceTo(horizon);
+      });
+  const double serial_seconds = serial_result.seconds;
+  const double serial_x = serial.get_context().get_continuous_state()[0];
+
+  const int max_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  std::vector<int> thread_counts;
+  for (int n = 1; n < max_threads; n *= 2) {
+    thread_counts.push_back(n);
+  }
+  thread_counts.push_back(max_threads);
+
+  PararealOptions options;
+  options.num_slices = num_slices;
+  options.coarse_steps_per_slice = 10;
+  options.tolerance = 1e-10;
+  options.fine_target_accuracy = accuracy;
+  options.fine_max_step_size = max_step_size;
+  for (const int num_threads : thread_counts) {
+    options.num_threads = num_threads;
+    std::optional<PararealResult> parareal;
+    BenchmarkResult& result = fixture.Measure(
+        "parareal, " + std::to_string(num_threads) + " threads",
+        num_operations, [&]() {
+          parareal = RunParareal(system, *context, horizon, options);
+        });
+    result.values["speedup"] = serial_seconds / result.seconds;
+    result.values["iterations"] = parareal->iterations;
+    result.values["error"] = std::abs(parareal->final_state[0] - serial_x);
+    std::cout << "  speedup " << result.values["speedup"] << "x, "
+              << parareal->iterations << " iterations, |x - x_serial| = "
+              << result.values["error"] << std::endl;
+  }
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace parareal
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::parareal::DoMain(argc, argv);
+}
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "parareal.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+
+#include "particle/particle.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace parareal {
+namespace {
+
+using drake::systems::Context;
+using drake::systems::Simulator;
+using systems::SimpleContinuousTimeSystem;
+
+constexpr double kX0 = 0.9;
+
+// The closed-form solution of xdot = -x + x³ from x(0) = x0.
+double ExactSolution(double x0, double t) {
+  return x0 / std::sqrt(x0 * x0 + (1.0 - x0 * x0) * std::exp(2.0 * t));
+}
+
+PararealOptions MakeOptions(int num_threads) {
+  PararealOptions options;
+  options.num_slices = 16;
+  options.coarse_steps_per_slice = 4;
+  options.tolerance = 1e-10;
+  options.num_threads = num_threads;
+  options.fine_target_accuracy = 1e-10;
+  return options;
+}
+
+class PararealTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    context_ = system_.CreateDefaultContext();
+    context_->get_mutable_continuous_state()[0] = kX0;
+  }
+
+  SimpleContinuousTimeSystem<double> system_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+/// Makes sure the result converges to the exact solution, at every slice
+/// boundary, and agrees with a serial simulation.
+TEST_F(PararealTest, MatchesSerialSimulation) {
+  const PararealResult result =
+      RunParareal(system_, *context_, 10.0, MakeOptions(4));
+  EXPECT_TRUE(result.converged);
+  EXPECT_LT(result.iterations, 16);
+  ASSERT_EQ(result.boundary_states.size(), 17);
+  for (int n = 0; n <= 16; ++n) {
+    EXPECT_NEAR(result.boundary_states[n][0], ExactSolution(kX0, n * 10.0 / 16),
+                1e-7);
+  }
+
+  Simulator<double> serial(system_, context_->Clone());
+  serial.get_mutable_integrator().set_target_accuracy(1e-10);
+  serial.AdvanceTo(10.0);
+  EXPECT_NEAR(result.final_state[0],
+              serial.get_context().get_continuous_state()[0], 1e-8);
+}
+
+/// Makes sure the number of threads does not change the result at all.
+TEST_F(PararealTest, Deterministic) {
+  const PararealResult one =
+      RunParareal(system_, *context_, 10.0, MakeOptions(1));
+  const PararealResult many =
+      RunParareal(system_, *context_, 10.0, MakeOptions(5));
+  EXPECT_EQ(one.iterations, many.iterations);
+  for (int n = 0; n <= 16; ++n) {
+    EXPECT_EQ(one.boundary_states[n], many.boundary_states[n]);
+  }
+}
+
+/// Makes sure that iterating once per slice reproduces the fine propagator
+/// applied serially, slice after slice.
+TEST_F(PararealTest, ExactAfterOneIterationPerSlice) {
+  PararealOptions options = MakeOptions(3);
+  options.num_slices = 5;
+  options.tolerance = 0.0;
+  const PararealResult result = RunParareal(system_, *context_, 5.0, options);
+  EXPECT_EQ(result.iterations, 5);
+
+  Simulator<double> fine(system_, context_->Clone());
+  fine.get_mutable_integrator().set_target_accuracy(1e-10);
+  for (int n = 1; n <= 5; ++n) {
+    fine.Initialize();
+    fine.AdvanceTo(n);
+    EXPECT_NEAR(result.boundary_states[n][0],
+                fine.get_context().get_continuous_state()[0], 1e-12);
+  }
+}
+
+/// Makes sure systems with fixed inputs and several states are supported.
+TEST(PararealParticleTest, ConstantAcceleration) {
+  const particles::Particle<double> particle;
+  auto context = particle.CreateDefaultContext();
+  particle.get_input_port(0).FixValue(context.get(), drake::Vector1d(2.0));
+  context->SetContinuousState(Eigen::Vector2d(1.0, -3.0));
+
+  PararealOptions options = MakeOptions(2);
+  options.coarse_steps_per_slice = 1;
+  const PararealResult result = RunParareal(particle, *context, 8.0, options);
+  EXPECT_TRUE(result.converged);
+  // x = x0 + v0 t + a t² / 2, v = v0 + a t.
+  EXPECT_NEAR(result.final_state[0], 1.0 - 3.0 * 8.0 + 64.0, 1e-8);
+  EXPECT_NEAR(result.final_state[1], -3.0 + 2.0 * 8.0, 1e-8);
+}
+
+/// Makes sure invalid arguments are rejected.
+TEST_F(PararealTest, RejectsBadArguments) {
+  EXPECT_THROW(RunParareal(system_, *context_, 0.0, MakeOptions(1)),
+               std::logic_error);
+  PararealOptions options = MakeOptions(1);
+  options.num_slices = 0;
+  EXPECT_THROW(RunParareal(system_, *context_, 1.0, options),
+               std::logic_error);
+}
+
+}  // namespace
+}  // namespace parareal
+}  // namespace drake_external_examples
@@ -1,48 +1,103 @@
 # SPDX-License-Identifier: MIT-0
 
-from pydrake.systems.framework import BasicVector
-from pydrake.systems.framework import LeafSystem
-from pydrake.systems.framework import PortDataType
-
-
-class Particle(LeafSystem):
-    """
-    A linear 1DOF particle system.
-
-    With very simple dynamics xdotdot = a, this system can be described in
-    terms of its:
-
-    Inputs:
-        linear acceleration (input index 0), in m/s^2 units.
-
-    States/Outputs:
-        linear position (state/output index 0), in m units.
-        linear velocity (state/output index 1), in m/s units.
-    """
-    def __init__(self):
-        LeafSystem.__init__(self)
-        # A 1D input vector for acceleration.
-        self.DeclareInputPort('acceleration', PortDataType.kVectorValued, 1)
-        # Adding one generalized position and one generalized velocity.
-        self.DeclareContinuousState(1, 1, 0)
-        # A 2D output vector for position and velocity.
-        self.DeclareVectorOutputPort('postion_and_velocity', BasicVector(2),
-                                     self.CopyStateOut)
-
-    def CopyStateOut(self, context, output):
-        # Get current state from context.
-        continuous_state_vector = context.get_continuous_state_vector()
-        # Write system output.
-        output.SetFromVector(continuous_state_vector.CopyToVector())
-
-    def DoCalcTimeDerivatives(self, context, derivatives):
-        # Get current state from context.
-        continuous_state_vector = x = context.get_continuous_state_vector()
-        # Obtain the structure we need to write into.
-        derivatives_vector = derivatives.get_mutable_vector()
-        # Get current input acceleration value.
-        input_vector = self.EvalVectorInput(context, 0)
-        # Set the derivatives. The first one is velocity and the second one is
-        # acceleration.
-        derivatives_vector.SetAtIndex(0, continuous_state_vector.GetAtIndex(1))
-        derivatives_vector.SetAtIndex(1, input_vector.GetAtIndex(0))
+"""
+Provides the Particle system.
+
+Importing this module is cheap: pydrake's systems framework is imported, and
+Particle is defined, only when Particle is first used (e.g., by
+`from particle import Particle`), so that a process which only imports this
+module does not pay for pydrake.
+"""
+
+import threading
+
+__all__ = ["Particle"]
+
+_lock = threading.Lock()
+
+
+def _define_particle():
+    from pydrake.systems.framework import BasicVector
+    from pydrake.systems.framework import LeafSystem
+    from pydrake.systems.framework import PortDataType
+
+    class Particle(LeafSystem):
+        """
+        A linear 1DOF particle system.
+
+        With very simple dynamics xdotdot = f / m, this system can be
+        described in terms of its:
+
+        Inputs:
+            linear force (input index 0), in N units. With the default unit
+            mass, this is the linear acceleration in m/s^2 units.
+
+        States/Outputs:
+            linear position (state/output index 0), in m units.
+            linear velocity (state/output index 1), in m/s units.
+
+        Parameters:
+            mass (numeric parameter index 0), in kg units.
+        """
+        def __init__(self, mass=1.0):
+            """Initializes the system, with a mass parameter that defaults to
+            `mass`, which must be positive."""
+            LeafSystem.__init__(self)
+            if not mass > 0.0:
+                raise ValueError(f"The mass must be positive, not {mass}")
+            self._default_mass = float(mass)
+            # A 1D input vector for force.
+            self.DeclareInputPort('force', PortDataType.kVectorValued, 1)
+            # Adding one generalized position and one generalized velocity.
+            self.DeclareContinuousState(1, 1, 0)
+            # A 2D output vector for position and velocity.
+            self.DeclareVectorOutputPort(
+                'postion_and_velocity', BasicVector(2), self.CopyStateOut)
+            # A 1D parameter vector for mass.
+            self.DeclareNumericParameter(BasicVector([self._default_mass]))
+
+        def default_mass(self):
+            """Returns the mass that new contexts are initialized with."""
+            return self._default_mass
+
+        def get_mass(self, context):
+            """Returns the mass parameter stored in `context`."""
+            return context.get_numeric_parameter(0).GetAtIndex(0)
+
+        def set_mass(self, context, mass):
+            """Sets the mass parameter stored in `context`."""
+            context.get_mutable_numeric_parameter(0).SetAtIndex(0, mass)
+
+        def CopyStateOut(self, context, output):
+            # Get current state from context.
+            continuous_state_vector = context.get_continuous_state_vector()
+            # Write system output.
+            output.SetFromVector(continuous_state_vector.CopyToVector())
+
+        def DoCalcTimeDerivatives(self, context, derivatives):
+            # Get current state from context.
+            continuous_state_vector = x = context.get_continuous_state_vector()
+            # Obtain the structure we need to write into.
+            derivatives_vector = derivatives.get_mutable_vector()
+            # Get current input force value.
+            input_vector = self.EvalVectorInput(context, 0)
+            # Set the derivatives. The first one is velocity and the second one
+            # is acceleration.
+            derivatives_vector.SetAtIndex(
+                0, continuous_state_vector.GetAtIndex(1))
+            derivatives_vector.SetAtIndex(
+                1, input_vector.GetAtIndex(0) / self.get_mass(context))
+
+    # Name the class as if it were defined at module scope, e.g. for pickle.
+    Particle.__qualname__ = "Particle"
+    return Particle
+
+
+def __getattr__(name):
+    # Called only for names that are not (yet) module globals; see PEP 562.
+    if name != "Particle":
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+    with _lock:
+        if "Particle" not in globals():
+            globals()["Particle"] = _define_particle()
+    return globals()["Particle"]
@@ -2,10 +2,12 @@
 
 #include "particle.h"  // IWYU pragma: associated
 
+#include <exception>
 #include <memory>
 
 #include <gtest/gtest.h>
 
+#include <drake/common/autodiff.h>
 #include <drake/common/eigen_types.h>
 #include <drake/systems/framework/input_port.h>
 #include <drake/systems/framework/system_output.h>
@@ -92,9 +94,39 @@ TYPED_TEST_P(ParticleTest, DerivativesTest) {
             static_cast<TypeParam>(1.0));  // x1dot == u0
 }
 
-REGISTER_TYPED_TEST_SUITE_P(ParticleTest, OutputTest, DerivativesTest);
+/// Makes sure a Particle system's acceleration is its input force divided
+/// by its mass parameter.
+TYPED_TEST_P(ParticleTest, MassTest) {
+  const auto& particle = dynamic_cast<const Particle<TypeParam>&>(*this->dut_);
+  EXPECT_EQ(particle.default_mass(), 1.0);
+  EXPECT_EQ(particle.get_mass(*this->context_), static_cast<TypeParam>(1.0));
+  particle.set_mass(this->context_.get(), static_cast<TypeParam>(4.0));
+  // Set input.
+  drake::VectorX<TypeParam> u0(1);
+  u0 << 2.0;  // N
+  this->dut_->get_input_port(0).FixValue(this->context_.get(), u0);
+  // Compute derivatives.
+  this->dut_->CalcTimeDerivatives(*this->context_, this->derivatives_.get());
+  // Check results.
+  EXPECT_EQ(this->derivatives_->get_vector().GetAtIndex(1),
+            static_cast<TypeParam>(0.5));  // x1dot == u0 / m
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ParticleTest, OutputTest, DerivativesTest,
+                            MassTest);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(WithDoubles, ParticleTest, double);
+INSTANTIATE_TYPED_TEST_SUITE_P(WithAutoDiffXd, ParticleTest,
+                               drake::AutoDiffXd);
+
+/// Makes sure a Particle converts to other scalar types, keeping its mass.
+GTEST_TEST(ParticleScalarConversionTest, ToAutoDiffXd) {
+  const Particle<double> particle(3.0);
+  const std::unique_ptr<Particle<drake::AutoDiffXd>> converted =
+      drake::systems::System<double>::ToAutoDiffXd(particle);
+  EXPECT_EQ(converted->default_mass(), 3.0);
+  EXPECT_THROW(Particle<double>(0.0), std::exception);
+}
 
 }  // namespace
 }  // namespace particles
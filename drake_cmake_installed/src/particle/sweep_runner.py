@@ -0,0 +1,207 @@
+# SPDX-License-Identifier: MIT-0
+
+"""
+Runs sweeps of rollouts of the Python Particle on a pool of worker processes.
+
+The Particle is written in Python, so simulating it holds the GIL, and threads
+cannot run rollouts in parallel; processes can. Each worker builds its own
+diagram, a constant acceleration driving a Particle, and its Simulator, once,
+and reuses them for every rollout it is given. Workers write their samples
+straight into one NumPy array in shared memory, instead of pickling them back
+to the parent, so that gathering the results costs nothing.
+
+On Linux the workers are forked, which is cheap. Importing `particle` does not
+import pydrake, so the parent has not imported it (unless it used Particle
+itself), and each worker imports it for itself. Elsewhere, workers are
+spawned.
+
+Example:
+
+    with SweepRunner(end_time=1.0, num_samples=11) as runner:
+        samples = runner.run(initial_states, accelerations)
+
+where samples[i, k] is the [position, velocity] of rollout i at the k-th of
+the num_samples times spaced evenly over [0, end_time].
+"""
+
+import math
+import multiprocessing
+from multiprocessing import resource_tracker
+from multiprocessing import shared_memory
+import os
+import sys
+
+import numpy as np
+
+__all__ = ["SweepRunner"]
+
+_START_METHOD = "fork" if sys.platform.startswith("linux") else "spawn"
+
+# Workers attach to the parent's shared memory without registering it with the
+# resource tracker. Before Python 3.13, registering is unavoidable, but
+# harmless as long as the workers share the parent's tracker (see
+# SweepRunner.__init__), since the parent unlinks the memory anyway.
+_ATTACH_OPTIONS = {"track": False} if sys.version_info >= (3, 13) else {}
+
+# In each worker process: its _Rollout, and the shared memory it writes to.
+_rollout = None
+_attached = {}
+
+
+class _Rollout:
+    """A Particle driven by a constant acceleration, with its Simulator, which
+    a worker builds once and reuses for all of its rollouts.
+    """
+
+    def __init__(self, end_time, num_samples):
+        from pydrake.systems.analysis import Simulator
+        from pydrake.systems.framework import DiagramBuilder
+        from pydrake.systems.primitives import ConstantVectorSource
+
+        from particle import Particle
+
+        builder = DiagramBuilder()
+        self._source = builder.AddSystem(ConstantVectorSource([0.0]))
+        particle = builder.AddSystem(Particle())
+        builder.Connect(self._source.get_output_port(0),
+                        particle.get_input_port(0))
+        self._diagram = builder.Build()
+        self._simulator = Simulator(self._diagram)
+        self._context = self._simulator.get_mutable_context()
+        self._particle_context = particle.GetMyMutableContextFromRoot(
+            self._context)
+        self._source_context = self._source.GetMyMutableContextFromRoot(
+            self._context)
+        self._times = np.linspace(0.0, end_time, num_samples)
+
+    def simulate(self, initial_state, acceleration, samples):
+        """Simulates from `initial_state` under `acceleration`, writing the
+        state at each sample time into the rows of `samples`.
+        """
+        self._context.SetTime(0.0)
+        self._particle_context.SetContinuousState(initial_state)
+        self._source.get_mutable_source_value(
+            self._source_context).SetFromVector([acceleration])
+        self._simulator.Initialize()
+        for k, time in enumerate(self._times):
+            self._simulator.AdvanceTo(time)
+            samples[k] = (
+                self._particle_context.get_continuous_state_vector()
+                .CopyToVector())
+
+
+def _initialize_worker(end_time, num_samples):
+    global _rollout
+    _rollout = _Rollout(end_time, num_samples)
+
+
+def _attach(name):
+    """Returns the shared memory `name`, detaching from any earlier run's."""
+    block = _attached.get(name)
+    if block is None:
+        for stale in _attached.values():
+            stale.close()
+        _attached.clear()
+        block = shared_memory.SharedMemory(name=name, **_ATTACH_OPTIONS)
+        _attached[name] = block
+    return block
+
+
+def _run_chunk(task):
+    """Runs the rollouts of one chunk into the shared samples array."""
+    name, shape, start, initial_states, accelerations = task
+    samples = np.ndarray(shape, dtype=np.float64, buffer=_attach(name).buf)
+    for i, (initial_state, acceleration) in enumerate(
+            zip(initial_states, accelerations)):
+        _rollout.simulate(initial_state, acceleration, samples[start + i])
+    return len(accelerations)
+
+
+class SweepRunner:
+    """A pool of worker processes that run rollouts of a Particle, each
+    sampled at `num_samples` times spaced evenly over [0, `end_time`].
+
+    Use it as a context manager, or call close() when done with it.
+    """
+
+    def __init__(self, end_time, num_samples, num_workers=None):
+        if not end_time > 0.0 or num_samples < 1:
+            raise ValueError(
+                "SweepRunner: need a positive end time and at least one "
+                "sample")
+        self.end_time = end_time
+        self.num_samples = num_samples
+        self.num_workers = num_workers or os.cpu_count()
+        # Start the resource tracker before the workers, for them to inherit.
+        # Otherwise each would start its own, which would unlink the shared
+        # memory it attached to when the worker exits.
+        resource_tracker.ensure_running()
+        context = multiprocessing.get_context(_START_METHOD)
+        self._pool = context.Pool(self.num_workers,
+                                  initializer=_initialize_worker,
+                                  initargs=(end_time, num_samples))
+        self._samples = None
+        self._in_use = []
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc_info):
+        self.close()
+
+    def run(self, initial_states, accelerations, chunk_size=None):
+        """Runs a rollout from each row [position, velocity] of
+        `initial_states` under the matching constant acceleration in
+        `accelerations`, handing the workers `chunk_size` rollouts at a time
+        (by default, enough for about four chunks per worker).
+
+        Returns the samples, an array of shape (rollouts, num_samples, 2) in
+        shared memory, which remains valid until the next run() or close();
+        copy it to keep it longer.
+        """
+        initial_states = np.asarray(initial_states, dtype=np.float64)
+        accelerations = np.asarray(accelerations, dtype=np.float64)
+        num_rollouts = len(accelerations)
+        if (accelerations.shape != (num_rollouts,)
+                or initial_states.shape != (num_rollouts, 2)):
+            raise ValueError(
+                "SweepRunner: need an initial state [position, velocity] "
+                "for each acceleration")
+        if chunk_size is None:
+            chunk_size = max(1, math.ceil(
+                num_rollouts / (4 * self.num_workers)))
+
+        self._release_samples()
+        shape = (num_rollouts, self.num_samples, 2)
+        self._samples = shared_memory.SharedMemory(
+            create=True, size=max(1, 8 * math.prod(shape)))
+        tasks = [
+            (self._samples.name, shape, start,
+             initial_states[start:start + chunk_size],
+             accelerations[start:start + chunk_size])
+            for start in range(0, num_rollouts, chunk_size)
+        ]
+        for _ in self._pool.imap_unordered(_run_chunk, tasks):
+            pass
+        return np.ndarray(shape, dtype=np.float64, buffer=self._samples.buf)
+
+    def close(self):
+        """Stops the workers, and frees the samples of the last run."""
+        self._pool.close()
+        self._pool.join()
+        self._release_samples()
+
+    def _release_samples(self):
+        if self._samples is not None:
+            self._samples.unlink()
+            self._in_use.append(self._samples)
+            self._samples = None
+        # Memory whose samples the caller still holds stays mapped until they
+        # are dropped, and is closed on a later call.
+        still_in_use = []
+        for block in self._in_use:
+            try:
+                block.close()
+            except BufferError:
+                still_in_use.append(block)
+        self._in_use = still_in_use
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures the latency per tick of model-predictive control of a Particle
+/// tracking a moving reference, r(t) = sin(t), with each open-source QP
+/// solver available in this build of Drake (OSQP, Clarabel, SCS), both
+/// warm-started from the shifted previous plan and cold. Each tick updates
+/// the one ParticleMpc program with the current state and reference, solves
+/// it, and applies the first force to a model of the particle stepped
+/// exactly, so that all solvers see the same closed loop.
+///
+/// Per solver and start, it prints the median, p99 and largest latency, in
+/// microseconds, and the mean tracking error. Solvers that are not available
+/// are skipped.
+///
+/// Usage: particle_mpc_benchmark [--ticks=<count>] [--horizon=<steps>]
+///            [--json_output=<path>]
+///
+/// By default, 2000 ticks of 50 ms are run, planning 20 steps ahead.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <drake/solvers/clarabel_solver.h>
+#include <drake/solvers/osqp_solver.h>
+#include <drake/solvers/scs_solver.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "particle_mpc.h"
+#include "realtime_harness/latency_histogram.h"
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::solvers::MathematicalProgramResult;
+using drake::solvers::SolverInterface;
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("particle_mpc_benchmark", &argc, argv);
+  int num_ticks = 2'000;
+  MpcOptions options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--ticks=")) {
+      num_ticks = std::stoi(std::string(arg.substr(8)));
+    } else if (arg.starts_with("--horizon=")) {
+      options.horizon = std::stoi(std::string(arg.substr(10)));
+    } else {
+      throw std::logic_error("Unknown argument " + std::string(arg));
+    }
+  }
+  if (num_ticks < 1) {
+    throw std::logic_error("The number of ticks must be positive");
+  }
+
+  ParticleMpc mpc(options);
+  const double h = options.time_step;
+  const std::unique_ptr<SolverInterface> solvers[] = {
+      std::make_unique<drake::solvers::OsqpSolver>(),
+      std::make_unique<drake::solvers::ClarabelSolver>(),
+      std::make_unique<drake::solvers::ScsSolver>()};
+  for (const auto& solver : solvers) {
+    const std::string name = solver->solver_id().name();
+    if (!solver->available() || !solver->enabled()) {
+      std::cout << name << " is not available; skipped." << std::endl;
+      continue;
+    }
+    for (const bool warm : {true, false}) {
+      // Latencies up to 100 ms, in 1 µs bins.
+      realtime::LatencyHistogram latencies(100'000'000, 1'000);
+      double tracking_error = 0.0;
+      BenchmarkResult& result = fixture.Measure(
+          name + (warm ? ", warm" : ", cold"), num_ticks, [&]() {
+            Eigen::Vector2d state = Eigen::Vector2d::Zero();
+            Eigen::VectorXd guess;
+            Eigen::VectorXd reference(options.horizon);
+            for (int tick = 0; tick < num_ticks; ++tick) {
+              for (int k = 0; k < options.horizon; ++k) {
+                reference[k] = std::sin((tick + k + 1) * h);
+              }
+              const auto start = std::chrono::steady_clock::now();
+              const MathematicalProgramResult solved = mpc.Solve(
+                  *solver, state, reference,
+                  warm && guess.size() > 0 ? &guess : nullptr);
+              latencies.Record(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count());
+              if (!solved.is_success()) {
+                throw std::runtime_error(name + " failed at tick " +
+                                         std::to_string(tick));
+              }
+              if (warm) {
+                guess = mpc.ShiftPlan(solved.GetSolution());
+              }
+              // The particle, stepped exactly with the force held.
+              const double u = mpc.GetForce(solved) / options.mass;
+              state = Eigen::Vector2d(state[0] + h * state[1] + h * h * u / 2,
+                                      state[1] + h * u);
+              tracking_error += std::abs(state[0] - reference[0]);
+            }
+          });
+      result.values["p50_us"] = latencies.Percentile(0.5) * 1e-3;
+      result.values["p99_us"] = latencies.Percentile(0.99) * 1e-3;
+      result.values["max_us"] = latencies.max_ns() * 1e-3;
+      result.values["mean_tracking_error"] = tracking_error / num_ticks;
+      std::cout << "  p50 " << result.values["p50_us"] << " us, p99 "
+                << result.values["p99_us"] << " us, max "
+                << result.values["max_us"] << " us, mean tracking error "
+                << result.values["mean_tracking_error"] << std::endl;
+    }
+  }
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace particles
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::particles::DoMain(argc, argv);
+}
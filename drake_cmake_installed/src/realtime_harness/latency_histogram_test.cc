@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "latency_histogram.h"  // IWYU pragma: associated
+
+#include <gtest/gtest.h>
+
+namespace drake_external_examples {
+namespace realtime {
+namespace {
+
+/// Makes sure an empty histogram reports zeros.
+TEST(LatencyHistogramTest, Empty) {
+  const LatencyHistogram dut;
+  EXPECT_EQ(dut.count(), 0);
+  EXPECT_EQ(dut.max_ns(), 0);
+  EXPECT_EQ(dut.Percentile(0.5), 0);
+}
+
+/// Makes sure percentiles are reported to within one bin.
+TEST(LatencyHistogramTest, Percentiles) {
+  LatencyHistogram dut(1'000'000, 1'000);
+  // 1000 samples spread over [0, 999] µs.
+  for (int i = 0; i < 1000; ++i) {
+    dut.Record(i * 1'000 + 500);
+  }
+  EXPECT_EQ(dut.count(), 1000);
+  EXPECT_EQ(dut.max_ns(), 999'500);
+  EXPECT_EQ(dut.Percentile(0.5), 500'000);
+  EXPECT_EQ(dut.Percentile(0.99), 990'000);
+  EXPECT_EQ(dut.Percentile(0.999), 999'000);
+  EXPECT_EQ(dut.Percentile(1.0), 999'500);
+  EXPECT_EQ(dut.Percentile(0.0), 1'000);
+}
+
+/// Makes sure samples beyond the range are still counted, and reported by
+/// their exact maximum.
+TEST(LatencyHistogramTest, Overflow) {
+  LatencyHistogram dut(10'000, 1'000);
+  dut.Record(-5);
+  dut.Record(500);
+  dut.Record(20'000);
+  dut.Record(50'000);
+  EXPECT_EQ(dut.count(), 4);
+  EXPECT_EQ(dut.Percentile(0.5), 1'000);
+  EXPECT_EQ(dut.Percentile(0.75), 50'000);
+  EXPECT_EQ(dut.max_ns(), 50'000);
+  dut.Clear();
+  EXPECT_EQ(dut.count(), 0);
+  EXPECT_EQ(dut.max_ns(), 0);
+}
+
+/// Makes sure invalid bin sizes are rejected.
+TEST(LatencyHistogramTest, BadBins) {
+  EXPECT_THROW(LatencyHistogram(1'000, 0), std::exception);
+  EXPECT_THROW(LatencyHistogram(1'000, 2'000), std::exception);
+}
+
+}  // namespace
+}  // namespace realtime
+}  // namespace drake_external_examples
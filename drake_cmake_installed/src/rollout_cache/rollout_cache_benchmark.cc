@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures how many rollouts per second a parameter sweep runs, with and
+/// without a RolloutCache, when the sweep repeats configurations, as sweeps
+/// that refine a grid or rerun after an unrelated change do. The sweep draws
+/// each rollout from a fixed set of distinct configurations: initial states
+/// and masses of a Particle pushed by a fixed force, and initial states of
+/// the Simple Continuous Time System, each over 1 s, sampled 10 times. It is
+/// run:
+///
+/// - without a cache, simulating every rollout;
+/// - with a cold cache, in a new directory, which simulates each distinct
+///   configuration once and reads the repeats;
+/// - with the cache warm from the previous run, which simulates nothing; and
+/// - computing the keys alone, the least a hit costs.
+///
+/// The hit rate of each cached run is reported with its rate.
+///
+/// Usage: rollout_cache_benchmark [--rollouts=<count>]
+///            [--configurations=<count>] [--json_output=<path>]
+///
+/// By default, 10000 rollouts are drawn from 1000 configurations.
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <drake/common/eigen_types.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "particle/particle.h"
+#include "rollout_cache.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace rollout_cache {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::systems::Context;
+using drake::systems::System;
+
+// The systems of the sweep, and a context for each to be set up from a
+// configuration.
+class Sweep {
+ public:
+  explicit Sweep(int num_configurations)
+      : num_configurations_(num_configurations),
+        particle_context_(particle_.CreateDefaultContext()),
+        scts_context_(scts_.CreateDefaultContext()) {
+    particle_.get_input_port(0).FixValue(particle_context_.get(), 1.0);
+  }
+
+  // Sets up rollout @p i, which repeats configuration i % the number of
+  // configurations, and returns its system and context.
+  std::pair<const System<double>*, const Context<double>*> Configure(int i) {
+    const int c = i % num_configurations_;
+    const double fraction = static_cast<double>(c) / num_configurations_;
+    if (c % 2 == 0) {
+      particle_context_->SetContinuousState(
+          Eigen::Vector2d(fraction, 1.0 - fraction));
+      particle_.set_mass(particle_context_.get(), 1.0 + c % 7);
+      return {&particle_, particle_context_.get()};
+    }
+    scts_context_->SetContinuousState(drake::Vector1d(0.9 * fraction));
+    return {&scts_, scts_context_.get()};
+  }
+
+ private:
+  const int num_configurations_;
+  const particles::Particle<double> particle_;
+  const systems::SimpleContinuousTimeSystem<double> scts_;
+  std::unique_ptr<Context<double>> particle_context_;
+  std::unique_ptr<Context<double>> scts_context_;
+};
+
+void PrintRate(BenchmarkResult* result, double checksum,
+               const RolloutCache* cache) {
+  const double rate = result->num_operations / result->seconds;
+  result->values["rollouts_per_second"] = rate;
+  std::cout << "  " << rate << " rollouts/s";
+  if (cache != nullptr) {
+    const double hit_rate = cache->statistics().hit_rate();
+    result->values["hit_rate"] = hit_rate;
+    std::cout << ", hit rate " << hit_rate;
+  }
+  std::cout << " (checksum " << checksum << ")" << std::endl;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("rollout_cache_benchmark", &argc, argv);
+  int num_rollouts = 10'000;
+  int num_configurations = 1'000;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--rollouts=")) {
+      num_rollouts = std::stoi(std::string(arg.substr(11)));
+    } else if (arg.starts_with("--configurations=")) {
+      num_configurations = std::stoi(std::string(arg.substr(17)));
+    } else {
+      throw std::logic_error("Unknown argument " + std::string(arg));
+    }
+  }
+  if (num_rollouts < 1 || num_configurations < 1) {
+    throw std::logic_error(
+        "The numbers of rollouts and configurations must be positive");
+  }
+
+  const RolloutSpec spec{.horizon = 1.0, .num_samples = 10};
+  Sweep sweep(num_configurations);
+  // Each run adds up the final first states of its rollouts, to be compared.
+  double checksum = 0.0;
+  BenchmarkResult& uncached =
+      fixture.Measure("no cache", num_rollouts, [&]() {
+        for (int i = 0; i < num_rollouts; ++i) {
+          const auto [system, context] = sweep.Configure(i);
+          checksum += SimulateRollout(*system, *context, spec).states(0, 9);
+        }
+      });
+  PrintRate(&uncached, checksum, nullptr);
+
+  const std::filesystem::path directory =
+      std::filesystem::temp_directory_path() /
+      ("rollout_cache_benchmark_" + std::to_string(getpid()));
+  // Large enough for every configuration.
+  constexpr int64_t kMaxBytes = int64_t{1} << 30;
+  for (const std::string_view temperature : {"cold", "warm"}) {
+    RolloutCache cache(directory.string(), kMaxBytes);
+    checksum = 0.0;
+    BenchmarkResult& cached = fixture.Measure(
+        std::string(temperature) + " cache", num_rollouts, [&]() {
+          for (int i = 0; i < num_rollouts; ++i) {
+            const auto [system, context] = sweep.Configure(i);
+            checksum += cache.Simulate(*system, *context, spec).states(0, 9);
+          }
+        });
+    PrintRate(&cached, checksum, &cache);
+  }
+  std::filesystem::remove_all(directory);
+
+  size_t key_bytes = 0;
+  BenchmarkResult& keys = fixture.Measure("keys alone", num_rollouts, [&]() {
+    for (int i = 0; i < num_rollouts; ++i) {
+      const auto [system, context] = sweep.Configure(i);
+      key_bytes += ComputeRolloutKey(*system, *context, spec).size();
+    }
+  });
+  PrintRate(&keys, static_cast<double>(key_bytes), nullptr);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace rollout_cache
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::rollout_cache::DoMain(argc, argv);
+}
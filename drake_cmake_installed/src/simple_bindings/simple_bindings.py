@@ -0,0 +1,24 @@
+# SPDX-License-Identifier: MIT-0
+
+"""
+Provides the example systems bound in C++ by the `_simple_bindings` extension
+module.
+
+Importing this module is cheap: the extension module, which imports pydrake's
+systems framework as it loads, is imported only when one of its systems is
+first used (e.g., by `from simple_bindings import SimpleAdder`).
+"""
+
+import importlib
+
+__all__ = ["SimpleAdder", "SimpleContinuousTimeSystem"]
+
+
+def __getattr__(name):
+    # Called only for names that are not (yet) module globals; see PEP 562.
+    if name not in __all__:
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+    # The import system serializes concurrent imports of the same module.
+    value = getattr(importlib.import_module("_simple_bindings"), name)
+    globals()[name] = value
+    return value
@@ -6,7 +6,7 @@ Provides an example of using pybind11-bound Drake C++ system with pydrake.
 
 from __future__ import print_function
 
-from simple_bindings import SimpleAdder
+from simple_bindings import SimpleAdder, SimpleContinuousTimeSystem
 
 import numpy as np
 
@@ -34,6 +34,24 @@ def main():
     print("Output values: {}".format(x))
     assert np.allclose(x, 110.)
 
+    # Record the integrator's dense output instead of logging; the resulting
+    # PiecewisePolynomial may be evaluated at any time after the run.
+    system = SimpleContinuousTimeSystem()
+    simulator = Simulator(system)
+    simulator.get_mutable_context().SetContinuousState([0.9])
+    integrator = simulator.get_mutable_integrator()
+    integrator.StartDenseIntegration()
+    simulator.AdvanceTo(10)
+    trajectory = integrator.StopDenseIntegration()
+    assert trajectory.start_time() == 0.
+    assert trajectory.end_time() == 10.
+    context = simulator.get_context()
+    x_final = context.get_continuous_state_vector().GetAtIndex(0)
+    assert np.isclose(trajectory.value(10.)[0, 0], x_final)
+    assert trajectory.value(1.)[0, 0] < trajectory.value(0.5)[0, 0] < 0.9
+    print("Dense output segments: {}".format(
+        trajectory.get_number_of_segments()))
+
 
 if __name__ == "__main__":
     main()
@@ -5,54 +5,29 @@
 // This is meant to be a sort of "hello world" example for the drake::system
 // classes. It defines a very simple continuous time system and simulates it
 // from a given initial condition.
+//
+// Pass --dense_output to have the integrator record a continuous (cubic
+// Hermite) trajectory of the state instead of only the final value; the
+// trajectory can then be evaluated at any time within the simulated interval.
 
 #include <cmath>
+#include <memory>
+#include <string_view>
 
 #include <drake/common/drake_assert.h>
+#include <drake/common/trajectories/piecewise_polynomial.h>
+#include <drake/systems/analysis/integrator_base.h>
 #include <drake/systems/analysis/simulator.h>
-#include <drake/systems/framework/basic_vector.h>
-#include <drake/systems/framework/context.h>
 #include <drake/systems/framework/continuous_state.h>
-#include <drake/systems/framework/leaf_system.h>
-
-namespace drake_external_examples {
-namespace systems {
-
-// Simple Continuous Time System
-//   xdot = -x + x³
-//   y = x
-class SimpleContinuousTimeSystem : public drake::systems::LeafSystem<double> {
- public:
-  SimpleContinuousTimeSystem() {
-    DeclareVectorOutputPort("y", drake::systems::BasicVector<double>(1),
-                            &SimpleContinuousTimeSystem::CopyStateOut);
-    DeclareContinuousState(1);  // One state variable.
-  }
 
- private:
-  // xdot = -x + x³
-  void DoCalcTimeDerivatives(
-      const drake::systems::Context<double>& context,
-      drake::systems::ContinuousState<double>* derivatives) const override {
-    const double x = context.get_continuous_state()[0];
-    const double xdot = -x + std::pow(x, 3.0);
-    (*derivatives)[0] = xdot;
-  }
+#include "simple_continuous_time_system.h"
 
-  // y = x
-  void CopyStateOut(const drake::systems::Context<double>& context,
-                    drake::systems::BasicVector<double>* output) const {
-    const double x = context.get_continuous_state()[0];
-    (*output)[0] = x;
-  }
-};
+int main(int argc, char* argv[]) {
+  const bool dense_output =
+      (argc > 1 && std::string_view(argv[1]) == "--dense_output");
 
-}  // namespace systems
-}  // namespace drake_external_examples
-
-int main() {
   // Create the simple system.
-  drake_external_examples::systems::SimpleContinuousTimeSystem system;
+  drake_external_examples::systems::SimpleContinuousTimeSystem<double> system;
 
   // Create the simulator.
   drake::systems::Simulator<double> simulator(system);
@@ -62,11 +37,29 @@ int main() {
       simulator.get_mutable_context().get_mutable_continuous_state();
   state[0] = 0.9;
 
+  // Optionally record the integrator's dense output while simulating.
+  drake::systems::IntegratorBase<double>& integrator =
+      simulator.get_mutable_integrator();
+  if (dense_output) {
+    integrator.StartDenseIntegration();
+  }
+
   // Simulate for 10 seconds.
   simulator.AdvanceTo(10);
 
   // Make sure the simulation converges to the stable fixed point at x = 0.
   DRAKE_DEMAND(state[0] < 1.0e-4);
 
+  if (dense_output) {
+    const std::unique_ptr<drake::trajectories::PiecewisePolynomial<double>>
+        trajectory = integrator.StopDenseIntegration();
+    // The trajectory spans the whole simulation, agrees with the final state,
+    // and decays monotonically in between.
+    DRAKE_DEMAND(trajectory->start_time() == 0.0);
+    DRAKE_DEMAND(trajectory->end_time() == 10.0);
+    DRAKE_DEMAND(std::abs(trajectory->value(10.0)(0) - state[0]) < 1.0e-8);
+    DRAKE_DEMAND(trajectory->value(1.0)(0) < trajectory->value(0.5)(0));
+  }
+
   return 0;
 }
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "rollout_protocol.h"
+
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace drake_external_examples {
+namespace simulation_server {
+namespace protocol {
+namespace {
+
+[[noreturn]] void ThrowErrno(const std::string& what) {
+  throw std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+void Append(const void* data, size_t size, std::vector<uint8_t>* buffer) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  buffer->insert(buffer->end(), bytes, bytes + size);
+}
+
+}  // namespace
+
+void WriteAll(int fd, const void* data, size_t size) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  while (size > 0) {
+    // MSG_NOSIGNAL reports a closed peer as EPIPE instead of raising SIGPIPE.
+    const ssize_t count = send(fd, bytes, size, MSG_NOSIGNAL);
+    if (count < 0) {
+      if (errno == EINTR) continue;
+      ThrowErrno("Could not send to the simulation server connection");
+    }
+    bytes += count;
+    size -= static_cast<size_t>(count);
+  }
+}
+
+bool ReadAll(int fd, void* data, size_t size) {
+  auto* bytes = static_cast<uint8_t*>(data);
+  size_t received = 0;
+  while (received < size) {
+    const ssize_t count = recv(fd, bytes + received, size - received, 0);
+    if (count < 0) {
+      if (errno == EINTR) continue;
+      ThrowErrno("Could not receive from the simulation server connection");
+    }
+    if (count == 0) {
+      if (received == 0) return false;
+      throw std::runtime_error(
+          "The simulation server connection closed partway through a "
+          "message");
+    }
+    received += static_cast<size_t>(count);
+  }
+  return true;
+}
+
+void AppendRequest(const RolloutRequest& request,
+                   std::vector<uint8_t>* buffer) {
+  const RequestHeader header{
+      .magic = kRequestMagic,
+      .model = static_cast<uint32_t>(request.model),
+      .state_size = static_cast<uint32_t>(request.initial_state.size()),
+      .parameter_count = static_cast<uint32_t>(request.parameters.size()),
+      .num_samples = static_cast<uint32_t>(request.num_samples),
+      .zero = 0,
+      .horizon = request.horizon};
+  Append(&header, sizeof(header), buffer);
+  Append(request.initial_state.data(),
+         sizeof(double) * request.initial_state.size(), buffer);
+  Append(request.parameters.data(), sizeof(double) * request.parameters.size(),
+         buffer);
+}
+
+void AppendRecord(RecordKind kind, const void* payload, size_t size,
+                  std::vector<uint8_t>* buffer) {
+  const RecordHeader header{.kind = kind,
+                            .size = static_cast<uint32_t>(size)};
+  Append(&header, sizeof(header), buffer);
+  Append(payload, size, buffer);
+}
+
+}  // namespace protocol
+}  // namespace simulation_server
+}  // namespace drake_external_examples
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures the startup cost of a Drake program: launches startup_probe
+/// repeatedly and reports the median time from launch to main(), the median
+/// time from launch to the end of the first Simulator step, the resident set
+/// size after that step, and the sizes of the executable and of everything it
+/// loaded. Give several probes, e.g., the same example built against a shared
+/// and against a static Drake, to compare them side by side.
+///
+/// Usage: startup_benchmark [--runs=<count>] [<probe> ...]
+///
+/// Without a probe, runs the startup_probe next to this executable.
+
+#include <spawn.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+extern char** environ;
+
+namespace drake_external_examples {
+namespace startup {
+namespace {
+
+int64_t NowNanoseconds() {
+  timespec now{};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return int64_t{now.tv_sec} * 1'000'000'000 + now.tv_nsec;
+}
+
+/// One launch of a probe; times are relative to the launch.
+struct Sample {
+  double to_main_ms{};
+  double to_first_step_ms{};
+  double to_exit_ms{};
+  int64_t resident_bytes{};
+  int64_t executable_bytes{};
+  int64_t loaded_bytes{};
+  int64_t loaded_objects{};
+};
+
+/// Launches `probe`, and parses the `<name> <value>` lines it prints.
+Sample RunProbe(const std::string& probe) {
+  int pipe_fds[2];
+  if (pipe(pipe_fds) != 0) {
+    throw std::runtime_error("Could not create a pipe");
+  }
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_adddup2(&actions, pipe_fds[1], STDOUT_FILENO);
+  posix_spawn_file_actions_addclose(&actions, pipe_fds[0]);
+  posix_spawn_file_actions_addclose(&actions, pipe_fds[1]);
+  std::string path = probe;
+  char* argv[] = {path.data(), nullptr};
+
+  pid_t pid{};
+  const int64_t launch_ns = NowNanoseconds();
+  const int error =
+      posix_spawn(&pid, path.c_str(), &actions, nullptr, argv, environ);
+  posix_spawn_file_actions_destroy(&actions);
+  close(pipe_fds[1]);
+  if (error != 0) {
+    close(pipe_fds[0]);
+    throw std::runtime_error("Could not launch " + probe);
+  }
+
+  std::string output;
+  char buffer[4096];
+  ssize_t count = 0;
+  while ((count = read(pipe_fds[0], buffer, sizeof(buffer))) > 0) {
+    output.append(buffer, count);
+  }
+  close(pipe_fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  const int64_t exit_ns = NowNanoseconds();
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    throw std::runtime_error(probe + " failed");
+  }
+
+  std::map<std::string, int64_t> values;
+  std::istringstream lines(output);
+  std::string name;
+  int64_t value = 0;
+  while (lines >> name >> value) {
+    values[name] = value;
+  }
+  for (const char* required :
+       {"main_ns", "first_step_ns", "resident_bytes", "executable_bytes",
+        "loaded_bytes", "loaded_objects"}) {
+    if (values.count(required) == 0) {
+      throw std::runtime_error(probe + " did not report " + required);
+    }
+  }
+  const auto since_launch_ms = [launch_ns](int64_t ns) {
+    return static_cast<double>(ns - launch_ns) * 1e-6;
+  };
+  return Sample{since_launch_ms(values["main_ns"]),
+                since_launch_ms(values["first_step_ns"]),
+                since_launch_ms(exit_ns),
+                values["resident_bytes"],
+                values["executable_bytes"],
+                values["loaded_bytes"],
+                values["loaded_objects"]};
+}
+
+template <typename Value>
+Value Median(std::vector<Value> values) {
+  std::nth_element(values.begin(), values.begin() + values.size() / 2,
+                   values.end());
+  return values[values.size() / 2];
+}
+
+double Megabytes(int64_t bytes) {
+  return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+int DoMain(int argc, char* argv[]) {
+  int runs = 20;
+  std::vector<std::string> probes;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.substr(0, 7) == "--runs=") {
+      runs = std::stoi(std::string(arg.substr(7)));
+    } else {
+      probes.emplace_back(arg);
+    }
+  }
+  if (runs < 1) {
+    throw std::logic_error("--runs must be positive");
+  }
+  if (probes.empty()) {
+    const std::filesystem::path self =
+        std::filesystem::read_symlink("/proc/self/exe");
+    probes.push_back((self.parent_path() / "startup_probe").string());
+  }
+
+  std::printf("%-32s %10s %13s %10s %9s %9s %11s %7s\n", "probe",
+              "main [ms]", "1st step [ms]", "exit [ms]", "RSS [MB]",
+              "exe [MB]", "loaded [MB]", "objects");
+  for (const std::string& probe : probes) {
+    // One unmeasured launch brings the files into the page cache, so that
+    // every probe is measured warm.
+    RunProbe(probe);
+    std::vector<double> to_main_ms;
+    std::vector<double> to_first_step_ms;
+    std::vector<double> to_exit_ms;
+    std::vector<int64_t> resident_bytes;
+    Sample sample;
+    for (int run = 0; run < runs; ++run) {
+      sample = RunProbe(probe);
+      to_main_ms.push_back(sample.to_main_ms);
+      to_first_step_ms.push_back(sample.to_first_step_ms);
+      to_exit_ms.push_back(sample.to_exit_ms);
+      resident_bytes.push_back(sample.resident_bytes);
+    }
+    std::printf("%-32s %10.2f %13.2f %10.2f %9.1f %9.1f %11.1f %7lld\n",
+                std::filesystem::path(probe).filename().c_str(),
+                Median(to_main_ms), Median(to_first_step_ms),
+                Median(to_exit_ms), Megabytes(Median(resident_bytes)),
+                Megabytes(sample.executable_bytes),
+                Megabytes(sample.loaded_bytes),
+                static_cast<long long>(sample.loaded_objects));
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace startup
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::startup::DoMain(argc, argv);
+}
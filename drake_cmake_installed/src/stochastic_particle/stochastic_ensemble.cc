@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "stochastic_ensemble.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+// The particles stepped by one task: their positions and velocities, 64 KiB,
+// stay in the cache through all the steps.
+constexpr int64_t kBlockSize = 4096;
+
+}  // namespace
+
+StochasticParticleEnsemble::StochasticParticleEnsemble(
+    int num_particles, const StochasticEnsembleOptions& options,
+    uint64_t first_rollout_id)
+    : options_(options),
+      first_rollout_id_(first_rollout_id),
+      pool_(std::make_unique<parallel::ThreadPool>(options.num_threads)) {
+  if (num_particles < 0 || !(options.time_step > 0.0) ||
+      !(options.mass > 0.0) || !(options.noise_intensity >= 0.0)) {
+    throw std::logic_error("StochasticParticleEnsemble: invalid arguments");
+  }
+  positions_ = Eigen::VectorXd::Zero(num_particles);
+  velocities_ = Eigen::VectorXd::Zero(num_particles);
+}
+
+StochasticParticleEnsemble::~StochasticParticleEnsemble() = default;
+
+void StochasticParticleEnsemble::SetState(
+    const Eigen::Ref<const Eigen::VectorXd>& positions,
+    const Eigen::Ref<const Eigen::VectorXd>& velocities, int64_t step) {
+  if (positions.size() != num_particles() ||
+      velocities.size() != num_particles() || step < 0) {
+    throw std::logic_error("StochasticParticleEnsemble: invalid state");
+  }
+  positions_ = positions;
+  velocities_ = velocities;
+  step_ = step;
+}
+
+void StochasticParticleEnsemble::Advance(
+    int64_t num_steps, const Eigen::Ref<const Eigen::VectorXd>& forces) {
+  if (forces.size() != num_particles() || num_steps < 0) {
+    throw std::logic_error("StochasticParticleEnsemble: invalid forces");
+  }
+  const double h = options_.time_step;
+  const double inverse_mass = 1.0 / options_.mass;
+  const double noise_scale = options_.noise_intensity * std::sqrt(h);
+  const uint64_t seed = options_.seed;
+  const int64_t first_step = step_;
+  const int64_t size = num_particles();
+  const int64_t num_blocks = (size + kBlockSize - 1) / kBlockSize;
+  pool_->ParallelFor(num_blocks, [&](int64_t block, int) {
+    const int64_t begin = block * kBlockSize;
+    const int64_t end = std::min(begin + kBlockSize, size);
+    double* const x = positions_.data();
+    double* const v = velocities_.data();
+    const double* const f = forces.data();
+    for (int64_t step = first_step; step < first_step + num_steps; ++step) {
+      for (int64_t i = begin; i < end; ++i) {
+        const double noise =
+            StochasticParticleNoise(seed, first_rollout_id_ + i, step);
+        EulerMaruyamaStep(h, f[i] * inverse_mass, noise_scale, noise, &x[i],
+                          &v[i]);
+      }
+    }
+  });
+  step_ += num_steps;
+}
+
+}  // namespace particles
+}  // namespace drake_external_examples
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "stochastic_particle.h"
+
+#include <cmath>
+
+#include <drake/common/drake_throw.h>
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/framework_common.h>
+
+#include "stochastic_ensemble.h"
+
+namespace drake_external_examples {
+namespace particles {
+
+using drake::systems::BasicVector;
+using drake::systems::Context;
+using drake::systems::DiscreteValues;
+using drake::systems::EventStatus;
+
+StochasticParticle::StochasticParticle(double time_step, uint64_t seed,
+                                       double mass, double noise_intensity)
+    : time_step_(time_step), seed_(seed) {
+  DRAKE_THROW_UNLESS(time_step > 0.0);
+  DRAKE_THROW_UNLESS(mass > 0.0);
+  DRAKE_THROW_UNLESS(noise_intensity >= 0.0);
+  // A 1D input vector for force.
+  DeclareVectorInputPort("force", 1);
+  // Position and velocity, output as they are, and the step.
+  const auto state_index = DeclareDiscreteState(2);
+  DeclareDiscreteState(1);
+  DeclareStateOutputPort("state", state_index);
+  DeclareNumericParameter(BasicVector<double>(drake::Vector1d(mass)));
+  DeclareNumericParameter(
+      BasicVector<double>(drake::Vector1d(noise_intensity)));
+  DeclareNumericParameter(BasicVector<double>(drake::Vector1d(0.0)));
+  DeclarePeriodicDiscreteUpdateEvent(time_step, 0.0, &StochasticParticle::Step);
+}
+
+double StochasticParticle::get_mass(const Context<double>& context) const {
+  return context.get_numeric_parameter(0).GetAtIndex(0);
+}
+
+void StochasticParticle::set_mass(Context<double>* context,
+                                  double mass) const {
+  context->get_mutable_numeric_parameter(0).SetAtIndex(0, mass);
+}
+
+double StochasticParticle::get_noise_intensity(
+    const Context<double>& context) const {
+  return context.get_numeric_parameter(1).GetAtIndex(0);
+}
+
+void StochasticParticle::set_noise_intensity(Context<double>* context,
+                                             double noise_intensity) const {
+  context->get_mutable_numeric_parameter(1).SetAtIndex(0, noise_intensity);
+}
+
+uint64_t StochasticParticle::get_rollout_id(
+    const Context<double>& context) const {
+  return static_cast<uint64_t>(context.get_numeric_parameter(2).GetAtIndex(0));
+}
+
+void StochasticParticle::set_rollout_id(Context<double>* context,
+                                        uint64_t rollout_id) const {
+  DRAKE_THROW_UNLESS(rollout_id <= kMaxRolloutId);
+  context->get_mutable_numeric_parameter(2).SetAtIndex(
+      0, static_cast<double>(rollout_id));
+}
+
+int64_t StochasticParticle::get_step(const Context<double>& context) const {
+  return static_cast<int64_t>(context.get_discrete_state(1).GetAtIndex(0));
+}
+
+EventStatus StochasticParticle::Step(const Context<double>& context,
+                                     DiscreteValues<double>* next_state) const {
+  const int64_t step = get_step(context);
+  const double force = get_input_port(0).Eval(context)[0];
+  const double noise =
+      StochasticParticleNoise(seed_, get_rollout_id(context), step);
+  // The same arithmetic as StochasticParticleEnsemble, so that rollouts
+  // match bit for bit.
+  const BasicVector<double>& state = context.get_discrete_state(0);
+  double x = state.GetAtIndex(0);
+  double v = state.GetAtIndex(1);
+  EulerMaruyamaStep(time_step_, force * (1.0 / get_mass(context)),
+                    get_noise_intensity(context) * std::sqrt(time_step_),
+                    noise, &x, &v);
+  next_state->get_mutable_vector(0).SetAtIndex(0, x);
+  next_state->get_mutable_vector(0).SetAtIndex(1, v);
+  next_state->get_mutable_vector(1).SetAtIndex(0,
+                                               static_cast<double>(step + 1));
+  return EventStatus::Succeeded();
+}
+
+}  // namespace particles
+}  // namespace drake_external_examples
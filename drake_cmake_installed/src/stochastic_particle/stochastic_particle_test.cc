@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "stochastic_particle.h"  // IWYU pragma: associated
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <drake/systems/analysis/simulator.h>
+
+#include "stochastic_ensemble.h"
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+using drake::systems::Simulator;
+
+/// Makes sure simulating the system takes one step per period and yields,
+/// bit for bit, the same rollouts as the ensemble, by rollout id.
+TEST(StochasticParticleTest, MatchesEnsemble) {
+  constexpr double kTimeStep = 0.01;
+  constexpr uint64_t kSeed = 3;
+  const StochasticParticle particle(kTimeStep, kSeed, 2.0, 0.5);
+  StochasticParticleEnsemble ensemble(
+      4, {.time_step = kTimeStep, .seed = kSeed, .mass = 2.0,
+          .noise_intensity = 0.5});
+  const Eigen::Vector4d positions(0.0, 0.5, 1.0, -1.0);
+  const Eigen::Vector4d forces(0.0, 1.0, -1.0, 2.0);
+  ensemble.SetState(positions, Eigen::Vector4d::Zero());
+
+  Simulator<double> simulator(particle);
+  auto& context = simulator.get_mutable_context();
+  for (int i = 0; i < 4; ++i) {
+    context.SetTime(0.0);
+    context.get_mutable_discrete_state(0).SetAtIndex(0, positions[i]);
+    context.get_mutable_discrete_state(0).SetAtIndex(1, 0.0);
+    context.get_mutable_discrete_state(1).SetAtIndex(0, 0.0);
+    particle.set_rollout_id(&context, i);
+    particle.get_input_port(0).FixValue(&context, forces[i]);
+    simulator.Initialize();
+    simulator.AdvanceTo(1.0);
+    const int64_t num_steps = particle.get_step(context);
+    // One step per period, with or without the one at the final time.
+    EXPECT_GE(num_steps, 100);
+    EXPECT_LE(num_steps, 101);
+    if (i == 0) {
+      ensemble.Advance(num_steps, forces);
+    }
+    const auto& state = particle.get_output_port(0).Eval(context);
+    EXPECT_EQ(state[0], ensemble.positions()[i]) << i;
+    EXPECT_EQ(state[1], ensemble.velocities()[i]) << i;
+  }
+}
+
+/// Makes sure the parameters are stored in the context, with the defaults
+/// given to the constructor.
+TEST(StochasticParticleTest, Parameters) {
+  const StochasticParticle particle(0.1, 5, 3.0, 0.25);
+  EXPECT_EQ(particle.time_step(), 0.1);
+  EXPECT_EQ(particle.seed(), 5);
+  auto context = particle.CreateDefaultContext();
+  EXPECT_EQ(particle.get_mass(*context), 3.0);
+  EXPECT_EQ(particle.get_noise_intensity(*context), 0.25);
+  EXPECT_EQ(particle.get_rollout_id(*context), 0);
+  EXPECT_EQ(particle.get_step(*context), 0);
+  particle.set_mass(context.get(), 1.5);
+  particle.set_noise_intensity(context.get(), 0.0);
+  particle.set_rollout_id(context.get(), StochasticParticle::kMaxRolloutId);
+  EXPECT_EQ(particle.get_mass(*context), 1.5);
+  EXPECT_EQ(particle.get_noise_intensity(*context), 0.0);
+  EXPECT_EQ(particle.get_rollout_id(*context),
+            StochasticParticle::kMaxRolloutId);
+  EXPECT_THROW(particle.set_rollout_id(context.get(),
+                                       StochasticParticle::kMaxRolloutId + 1),
+               std::exception);
+}
+
+/// Makes sure invalid constructor arguments are rejected.
+TEST(StochasticParticleTest, Throws) {
+  EXPECT_THROW(StochasticParticle(0.0, 0), std::exception);
+  EXPECT_THROW(StochasticParticle(0.1, 0, 0.0), std::exception);
+  EXPECT_THROW(StochasticParticle(0.1, 0, 1.0, -1.0), std::exception);
+}
+
+}  // namespace
+}  // namespace particles
+}  // namespace drake_external_examples
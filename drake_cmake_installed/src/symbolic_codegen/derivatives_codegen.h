@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <string>
+
+#include <drake/systems/framework/system.h>
+
+namespace drake_external_examples {
+namespace symbolic_codegen {
+
+/// The C++ code that GenerateDerivatives() emits: a header and a source file.
+struct GeneratedDerivatives {
+  std::string header;
+  std::string source;
+};
+
+/// Evaluates the time derivatives xdot = f(t, x, u, p) of @p system on
+/// symbolic::Expression, and emits C++ code that computes them, and their
+/// Jacobian ∂f/∂x, as flat straight-line functions of plain arrays. Here x is
+/// the continuous state, u the values of all input ports, concatenated in
+/// port order, and p all numeric parameters, concatenated in group order.
+///
+/// The header declares, in namespace
+/// `drake_external_examples::symbolic_codegen::<name>`, a struct
+/// `Derivatives` with:
+/// - `kNumStates`, `kNumInputs` and `kNumParameters`, the sizes of x, u and p;
+/// - `kDefaultParameters`, the values of p in a default context of @p system;
+/// - `static void Calc(double t, const double* x, const double* u,
+///   const double* p, double* xdot)`;
+/// - `static void CalcJacobian(double t, const double* x, const double* u,
+///   const double* p, double* dxdot_dx)`, which writes the Jacobian in
+///   column-major order.
+/// GeneratedSystem wraps these back into a LeafSystem.
+///
+/// Common subexpressions are computed once, and integer powers by repeated
+/// multiplication, rather than by calling std::pow().
+///
+/// @param name a valid C++ identifier, e.g. "simple_continuous_time_system".
+/// @param header_path the path by which the source includes the header.
+/// @throws std::exception if @p system has discrete or abstract state, or
+///   an abstract-valued input port, or if its derivatives are not smooth
+///   functions of t, x, u and p (e.g., use if-then-else).
+GeneratedDerivatives GenerateDerivatives(
+    const drake::systems::System<double>& system, const std::string& name,
+    const std::string& header_path);
+
+}  // namespace symbolic_codegen
+}  // namespace drake_external_examples
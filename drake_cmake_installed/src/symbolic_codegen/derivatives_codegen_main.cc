@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Emits C++ code for the time derivatives, and their Jacobian, of one of the
+/// example systems; see GenerateDerivatives().
+///
+/// Usage: derivatives_codegen
+///            --system=<particle|simple_continuous_time_system>
+///            --name=<name> --output_dir=<directory>
+///
+/// Writes `<directory>/<name>.h` and `<directory>/<name>.cc`.
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <drake/systems/framework/system.h>
+
+#include "derivatives_codegen.h"
+#include "particle/particle.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace symbolic_codegen {
+namespace {
+
+std::unique_ptr<drake::systems::System<double>> MakeSystem(
+    const std::string& name) {
+  if (name == "particle") {
+    return std::make_unique<particles::Particle<double>>();
+  }
+  if (name == "simple_continuous_time_system") {
+    return std::make_unique<systems::SimpleContinuousTimeSystem<double>>();
+  }
+  throw std::runtime_error("Unknown system: " + name);
+}
+
+void WriteFile(const std::string& path, const std::string& contents) {
+  std::ofstream file(path);
+  file << contents;
+  if (!file) {
+    throw std::runtime_error("Could not write " + path);
+  }
+}
+
+int DoMain(int argc, char* argv[]) {
+  std::string system;
+  std::string name;
+  std::string output_dir;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.substr(0, 9) == "--system=") {
+      system = arg.substr(9);
+    } else if (arg.substr(0, 7) == "--name=") {
+      name = arg.substr(7);
+    } else if (arg.substr(0, 13) == "--output_dir=") {
+      output_dir = arg.substr(13);
+    } else {
+      std::cerr << "Unknown argument: " << arg << std::endl;
+      return 1;
+    }
+  }
+  if (system.empty() || name.empty() || output_dir.empty()) {
+    std::cerr << "Usage: " << argv[0]
+              << " --system=<particle|simple_continuous_time_system>"
+                 " --name=<name> --output_dir=<directory>"
+              << std::endl;
+    return 1;
+  }
+
+  const GeneratedDerivatives generated =
+      GenerateDerivatives(*MakeSystem(system), name, name + ".h");
+  WriteFile(output_dir + "/" + name + ".h", generated.header);
+  WriteFile(output_dir + "/" + name + ".cc", generated.source);
+  return 0;
+}
+
+}  // namespace
+}  // namespace symbolic_codegen
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::symbolic_codegen::DoMain(argc, argv);
+}
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Checks the contract that the examples, and their parallel drivers, rely
+/// on: one const system may be evaluated and simulated from many threads at
+/// once, as long as each thread has its own context. Each test runs the same
+/// work on every thread concurrently, and compares each thread's results with
+/// those of the same work run on one thread; they must be bitwise identical.
+///
+/// Build with -DDRAKE_EXAMPLE_THREAD_SANITIZER=ON to also have
+/// ThreadSanitizer report any data race in the examples' code.
+
+#include <algorithm>
+#include <latch>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/framework/system.h>
+#include <drake/systems/primitives/constant_vector_source.h>
+
+#include "particle/particle.h"
+#include "simple_bindings/simple_adder.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace thread_safety {
+namespace {
+
+using drake::systems::ConstantVectorSource;
+using drake::systems::Context;
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+// Enough threads to interleave even on small machines.
+int NumThreads() {
+  return std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 4,
+                    16);
+}
+
+/// Runs `work(thread)` for each thread in [0, NumThreads()), first one after
+/// the other, and then on that many threads released at once; and expects
+/// each thread's results to be the same both times.
+template <typename Work>
+void ExpectDeterministicConcurrently(const Work& work) {
+  const int num_threads = NumThreads();
+  std::vector<std::vector<double>> expected(num_threads);
+  for (int thread = 0; thread < num_threads; ++thread) {
+    expected[thread] = work(thread);
+  }
+
+  std::vector<std::vector<double>> actual(num_threads);
+  std::latch start(num_threads);
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < num_threads; ++thread) {
+    threads.emplace_back([&, thread]() {
+      start.arrive_and_wait();
+      actual[thread] = work(thread);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (int thread = 0; thread < num_threads; ++thread) {
+    ASSERT_FALSE(expected[thread].empty());
+    EXPECT_EQ(actual[thread], expected[thread]) << "thread " << thread;
+  }
+}
+
+/// Makes sure Particle time derivatives, with a different state, input and
+/// mass on each thread, are unaffected by the other threads.
+TEST(ThreadSafetyTest, ParticleDerivatives) {
+  const Particle<double> particle;
+  ExpectDeterministicConcurrently([&particle](int thread) {
+    auto context = particle.CreateDefaultContext();
+    particle.set_mass(context.get(), 1.0 + thread);
+    auto derivatives = particle.AllocateTimeDerivatives();
+    std::vector<double> results;
+    for (int i = 0; i < 20'000; ++i) {
+      context->SetContinuousState(
+          drake::Vector2<double>(1.0 * thread, 1.0 * i));
+      particle.get_input_port(0).FixValue(context.get(),
+                                         drake::Vector1d(0.5 * i - thread));
+      particle.CalcTimeDerivatives(*context, derivatives.get());
+      results.push_back(derivatives->get_vector().GetAtIndex(1));
+    }
+    return results;
+  });
+}
+
+/// Makes sure SimpleAdder outputs, whether evaluated through the cache or
+/// calculated directly, are unaffected by the other threads.
+TEST(ThreadSafetyTest, SimpleAdderOutputs) {
+  const SimpleAdder<double> adder(3.0);
+  // SimpleAdder's own CalcOutput() is its (private) output calculator.
+  const drake::systems::System<double>& system = adder;
+  ExpectDeterministicConcurrently([&adder, &system](int thread) {
+    auto context = adder.CreateDefaultContext();
+    context->get_mutable_numeric_parameter(0).SetAtIndex(0, thread);
+    auto output = adder.AllocateOutput();
+    std::vector<double> results;
+    for (int i = 0; i < 20'000; ++i) {
+      adder.get_input_port(0).FixValue(context.get(), drake::Vector1d(1.0 * i));
+      results.push_back(adder.get_output_port(0).Eval(*context)[0]);
+      system.CalcOutput(*context, output.get());
+      results.push_back(output->get_vector_data(0)->GetAtIndex(0));
+    }
+    return results;
+  });
+}
+
+/// Makes sure full simulations of one diagram, a SimpleAdder driving a
+/// Particle, from a different initial state on each thread, are unaffected by
+/// the other threads; and likewise for the Simple Continuous Time System.
+TEST(ThreadSafetyTest, Simulations) {
+  DiagramBuilder<double> builder;
+  auto source = builder.AddSystem<ConstantVectorSource<double>>(1.0);
+  auto adder = builder.AddSystem<SimpleAdder<double>>(0.5);
+  auto particle = builder.AddSystem<Particle<double>>();
+  builder.Connect(source->get_output_port(), adder->get_input_port(0));
+  builder.Connect(adder->get_output_port(0), particle->get_input_port(0));
+  const std::unique_ptr<const Diagram<double>> diagram = builder.Build();
+  const SimpleContinuousTimeSystem<double> system;
+
+  ExpectDeterministicConcurrently([&](int thread) {
+    std::vector<double> results;
+    for (int run = 0; run < 10; ++run) {
+      Simulator<double> simulator(*diagram);
+      Context<double>& particle_context =
+          particle->GetMyMutableContextFromRoot(
+              &simulator.get_mutable_context());
+      particle_context.SetContinuousState(
+          drake::Vector2<double>(1.0 * thread, -1.0 * run));
+      simulator.AdvanceTo(2.0);
+      const drake::VectorX<double> state =
+          particle_context.get_continuous_state_vector().CopyToVector();
+      results.insert(results.end(), state.data(), state.data() + state.size());
+
+      Simulator<double> system_simulator(system);
+      system_simulator.get_mutable_context().SetContinuousState(
+          drake::Vector1d(0.9 - 0.05 * thread - 0.01 * run));
+      system_simulator.AdvanceTo(5.0);
+      results.push_back(system_simulator.get_context()
+                            .get_continuous_state_vector()
+                            .GetAtIndex(0));
+    }
+    return results;
+  });
+}
+
+}  // namespace
+}  // namespace thread_safety
+}  // namespace drake_external_examples
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "time_series_source.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <drake/systems/framework/framework_common.h>
+
+namespace drake_external_examples {
+namespace time_series {
+namespace {
+
+constexpr char kMagic[8] = {'D', 'E', 'E', 'T', 'S', 'R', 'C', '1'};
+
+struct Header {
+  char magic[8];
+  uint64_t num_samples;
+  uint64_t num_values;
+  double start_time;
+  double period;
+};
+static_assert(sizeof(Header) == 40);
+
+[[noreturn]] void ThrowForFile(const std::string& filename,
+                               const std::string& message) {
+  throw std::runtime_error("TimeSeriesTable: " + filename + ": " + message);
+}
+
+void WriteFile(const std::string& filename, const Header& header,
+               const double* times,
+               const Eigen::Ref<const Eigen::MatrixXd>& values) {
+  std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  if (times != nullptr) {
+    out.write(reinterpret_cast<const char*>(times),
+              sizeof(double) * header.num_samples);
+  }
+  // Each column of values is one sample, stored contiguously.
+  for (int64_t i = 0; i < values.cols(); ++i) {
+    out.write(reinterpret_cast<const char*>(values.col(i).data()),
+              sizeof(double) * values.rows());
+  }
+  if (!out) {
+    ThrowForFile(filename, "could not write the file");
+  }
+}
+
+}  // namespace
+
+TimeSeriesTable::TimeSeriesTable(const std::string& filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    ThrowForFile(filename, std::strerror(errno));
+  }
+  struct stat info {};
+  if (::fstat(fd, &info) != 0 ||
+      static_cast<std::size_t>(info.st_size) < sizeof(Header)) {
+    ::close(fd);
+    ThrowForFile(filename, "missing header");
+  }
+  mapping_size_ = info.st_size;
+  mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    ThrowForFile(filename, std::strerror(errno));
+  }
+  // Playback reads the table front to back.
+  ::madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+
+  const auto* header = static_cast<const Header*>(mapping_);
+  const uint64_t num_samples = header->num_samples;
+  const uint64_t num_values = header->num_values;
+  const bool has_times = !(header->period > 0.0);
+  const uint64_t num_doubles =
+      (has_times ? num_samples : 0) + num_samples * num_values;
+  std::string error;
+  if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0) {
+    error = "not a time series table";
+  } else if (num_samples < 1 || num_values < 1 ||
+             num_values > std::numeric_limits<int>::max() ||
+             num_samples > mapping_size_ / sizeof(double) / num_values) {
+    error = "invalid table dimensions";
+  } else if (has_times && header->period != 0.0) {
+    error = "invalid sample period";
+  } else if (mapping_size_ != sizeof(Header) + sizeof(double) * num_doubles) {
+    error = "file size does not match the table dimensions";
+  }
+  if (!error.empty()) {
+    ::munmap(mapping_, mapping_size_);
+    mapping_ = nullptr;
+    ThrowForFile(filename, error);
+  }
+
+  num_samples_ = static_cast<int64_t>(num_samples);
+  num_values_ = static_cast<int>(num_values);
+  start_time_ = header->start_time;
+  period_ = header->period;
+  const auto* data = reinterpret_cast<const double*>(header + 1);
+  if (has_times) {
+    times_ = data;
+    start_time_ = times_[0];
+    data += num_samples;
+  }
+  values_ = data;
+}
+
+TimeSeriesTable::~TimeSeriesTable() {
+  if (mapping_ != nullptr) {
+    ::munmap(mapping_, mapping_size_);
+  }
+}
+
+int64_t TimeSeriesTable::FindSegment(double t, int64_t hint) const {
+  const int64_t last = std::max<int64_t>(num_samples_ - 2, 0);
+  if (is_uniform()) {
+    const double position = std::floor((t - start_time_) / period_);
+    int64_t i = static_cast<int64_t>(
+        std::clamp(position, 0.0, static_cast<double>(last)));
+    // Undo any rounding in the division at segment boundaries.
+    if (i < last && time(i + 1) <= t) {
+      ++i;
+    }
+    return i;
+  }
+
+  const int64_t start = std::clamp<int64_t>(hint, 0, last);
+  if (t < times_[start]) {
+    // Going backwards; search everything before the hint.
+    const double* found = std::upper_bound(times_, times_ + start, t);
+    return std::max<int64_t>(found - times_ - 1, 0);
+  }
+  // Gallop forward from the hint to bracket t, then search the bracket. In
+  // playback, t is almost always within one or two segments of the hint.
+  int64_t low = start;
+  int64_t step = 1;
+  while (low + step <= last && times_[low + step] <= t) {
+    low += step;
+    step *= 2;
+  }
+  const int64_t high = std::min(low + step, last + 1);
+  const double* found = std::upper_bound(times_ + low + 1, times_ + high, t);
+  return found - times_ - 1;
+}
+
+void WriteTimeSeries(const std::string& filename,
+                     const Eigen::Ref<const Eigen::VectorXd>& times,
+                     const Eigen::Ref<const Eigen::MatrixXd>& values) {
+  if (times.size() != values.cols() || times.size() < 1) {
+    ThrowForFile(filename, "need one sample time per column of values");
+  }
+  for (int64_t i = 1; i < times.size(); ++i) {
+    if (!(times(i) > times(i - 1))) {
+      ThrowForFile(filename, "sample times must be strictly increasing");
+    }
+  }
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.num_samples = times.size();
+  header.num_values = values.rows();
+  header.start_time = times(0);
+  header.period = 0.0;
+  WriteFile(filename, header, times.data(), values);
+}
+
+void WriteUniformTimeSeries(const std::string& filename, double start_time,
+                            double period,
+                            const Eigen::Ref<const Eigen::MatrixXd>& values) {
+  if (!(period > 0.0)) {
+    ThrowForFile(filename, "the sample period must be positive");
+  }
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.num_samples = values.cols();
+  header.num_values = values.rows();
+  header.start_time = start_time;
+  header.period = period;
+  WriteFile(filename, header, nullptr, values);
+}
+
+TimeSeriesSource::TimeSeriesSource(
+    std::shared_ptr<const TimeSeriesTable> table,
+    TimeSeriesInterpolation interpolation)
+    : table_(std::move(table)), interpolation_(interpolation) {
+  if (table_ == nullptr) {
+    throw std::logic_error("TimeSeriesSource: null table");
+  }
+  this->DeclareVectorOutputPort(
+      drake::systems::kUseDefaultName,
+      drake::systems::BasicVector<double>(table_->num_values()),
+      &TimeSeriesSource::CalcValue, {this->time_ticket()});
+}
+
+void TimeSeriesSource::CalcValue(
+    const drake::systems::Context<double>& context,
+    drake::systems::BasicVector<double>* output) const {
+  const double t = context.get_time();
+  const TimeSeriesTable& table = *table_;
+  const int64_t i =
+      table.FindSegment(t, hint_.load(std::memory_order_relaxed));
+  hint_.store(i, std::memory_order_relaxed);
+
+  auto&& y = output->get_mutable_value();
+  if (table.num_samples() == 1) {
+    y = table.values(0);
+    return;
+  }
+  const double t0 = table.time(i);
+  const double t1 = table.time(i + 1);
+  if (interpolation_ == TimeSeriesInterpolation::kZeroOrderHold) {
+    y = table.values(t < t1 ? i : i + 1);
+    return;
+  }
+  const double s = std::clamp((t - t0) / (t1 - t0), 0.0, 1.0);
+  y = (1.0 - s) * table.values(i) + s * table.values(i + 1);
+}
+
+}  // namespace time_series
+}  // namespace drake_external_examples
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "time_series_source.h"  // IWYU pragma: associated
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+
+#include "particle/particle.h"
+
+namespace drake_external_examples {
+namespace time_series {
+namespace {
+
+using drake::systems::Context;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+
+std::string TempFile(const std::string& name) {
+  return ::testing::TempDir() + "/" + name;
+}
+
+/// Evaluates the output of @p source at time @p t.
+double ValueAt(const TimeSeriesSource& source, double t) {
+  std::unique_ptr<Context<double>> context = source.CreateDefaultContext();
+  context->SetTime(t);
+  return source.get_output_port(0).Eval(*context)[0];
+}
+
+/// Makes sure a uniformly sampled table round-trips through its file.
+TEST(TimeSeriesTableTest, UniformRoundTrip) {
+  const std::string filename = TempFile("uniform.bin");
+  const Eigen::Matrix<double, 2, 3> values =
+      (Eigen::Matrix<double, 2, 3>() << 1, 2, 3, 4, 5, 6).finished();
+  WriteUniformTimeSeries(filename, 1.0, 0.5, values);
+  const TimeSeriesTable table(filename);
+  EXPECT_TRUE(table.is_uniform());
+  EXPECT_EQ(table.num_samples(), 3);
+  EXPECT_EQ(table.num_values(), 2);
+  EXPECT_EQ(table.time(2), 2.0);
+  EXPECT_EQ(table.values(1), values.col(1));
+  EXPECT_EQ(table.FindSegment(1.5, 0), 1);
+  EXPECT_EQ(table.FindSegment(-10.0, 0), 0);
+  EXPECT_EQ(table.FindSegment(10.0, 0), 1);
+}
+
+/// Makes sure segment lookups in a non-uniform table are correct whether the
+/// hint is before, at, or after the queried segment.
+TEST(TimeSeriesTableTest, NonUniformLookup) {
+  const std::string filename = TempFile("non_uniform.bin");
+  const Eigen::VectorXd times =
+      (Eigen::VectorXd(6) << 0.0, 0.1, 0.5, 0.6, 2.0, 3.0).finished();
+  WriteTimeSeries(filename, times, Eigen::MatrixXd::Zero(1, 6));
+  const TimeSeriesTable table(filename);
+  EXPECT_FALSE(table.is_uniform());
+  for (int64_t hint = 0; hint < 6; ++hint) {
+    EXPECT_EQ(table.FindSegment(-1.0, hint), 0);
+    EXPECT_EQ(table.FindSegment(0.05, hint), 0);
+    EXPECT_EQ(table.FindSegment(0.5, hint), 2);
+    EXPECT_EQ(table.FindSegment(1.0, hint), 3);
+    EXPECT_EQ(table.FindSegment(2.5, hint), 4);
+    EXPECT_EQ(table.FindSegment(3.0, hint), 4);
+    EXPECT_EQ(table.FindSegment(9.0, hint), 4);
+  }
+}
+
+/// Makes sure malformed tables are rejected.
+TEST(TimeSeriesTableTest, RejectsBadFiles) {
+  EXPECT_THROW(TimeSeriesTable(TempFile("no_such_file.bin")),
+               std::exception);
+  const std::string filename = TempFile("garbage.bin");
+  std::ofstream(filename) << "this is not a time series table at all";
+  EXPECT_THROW(TimeSeriesTable{filename}, std::exception);
+  EXPECT_THROW(WriteTimeSeries(filename, Eigen::Vector2d(1.0, 1.0),
+                               Eigen::MatrixXd::Zero(1, 2)),
+               std::exception);
+  EXPECT_THROW(
+      WriteUniformTimeSeries(filename, 0.0, 0.0, Eigen::MatrixXd::Zero(1, 2)),
+      std::exception);
+}
+
+/// Makes sure both interpolation modes hold the end values outside the table
+/// and differ as expected in between.
+TEST(TimeSeriesSourceTest, Interpolation) {
+  const std::string filename = TempFile("ramp.bin");
+  WriteUniformTimeSeries(filename, 0.0, 1.0, Eigen::RowVector3d(0, 10, 20));
+  const auto table = std::make_shared<const TimeSeriesTable>(filename);
+  const TimeSeriesSource hold(table, TimeSeriesInterpolation::kZeroOrderHold);
+  const TimeSeriesSource linear(table, TimeSeriesInterpolation::kLinear);
+
+  EXPECT_EQ(ValueAt(hold, -1.0), 0.0);
+  EXPECT_EQ(ValueAt(hold, 0.5), 0.0);
+  EXPECT_EQ(ValueAt(hold, 1.0), 10.0);
+  EXPECT_EQ(ValueAt(hold, 1.75), 10.0);
+  EXPECT_EQ(ValueAt(hold, 2.0), 20.0);
+  EXPECT_EQ(ValueAt(hold, 5.0), 20.0);
+
+  EXPECT_EQ(ValueAt(linear, -1.0), 0.0);
+  EXPECT_DOUBLE_EQ(ValueAt(linear, 0.5), 5.0);
+  EXPECT_DOUBLE_EQ(ValueAt(linear, 1.75), 17.5);
+  EXPECT_EQ(ValueAt(linear, 5.0), 20.0);
+
+  // Evaluating out of order is slower, but still correct.
+  EXPECT_DOUBLE_EQ(ValueAt(linear, 0.25), 2.5);
+}
+
+/// Makes sure a recorded acceleration profile drives a Particle as expected.
+TEST(TimeSeriesSourceTest, DrivesParticle) {
+  // A constant 2 m/s² recorded at 100 Hz for 10 s.
+  const std::string filename = TempFile("acceleration.bin");
+  WriteUniformTimeSeries(filename, 0.0, 0.01,
+                         Eigen::RowVectorXd::Constant(1001, 2.0));
+
+  DiagramBuilder<double> builder;
+  auto source = builder.AddSystem<TimeSeriesSource>(
+      std::make_shared<const TimeSeriesTable>(filename),
+      TimeSeriesInterpolation::kLinear);
+  auto particle = builder.AddSystem<particles::Particle<double>>();
+  builder.Connect(source->get_output_port(0), particle->get_input_port(0));
+  auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.AdvanceTo(3.0);
+  const Context<double>& context =
+      particle->GetMyContextFromRoot(simulator.get_context());
+  const drake::VectorX<double> state =
+      context.get_continuous_state_vector().CopyToVector();
+  EXPECT_NEAR(state[0], 9.0, 1.0e-9);  // x = a t² / 2
+  EXPECT_NEAR(state[1], 6.0, 1.0e-9);  // v = a t
+}
+
+}  // namespace
+}  // namespace time_series
+}  // namespace drake_external_examples
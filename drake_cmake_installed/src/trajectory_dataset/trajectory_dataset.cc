@@ -0,0 +1,516 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "trajectory_dataset.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace drake_external_examples {
+namespace trajectory_dataset {
+namespace {
+
+static_assert(std::endian::native == std::endian::little,
+              "The dataset format is little-endian");
+
+constexpr char kMagic[8] = {'D', 'E', 'E', 'T', 'R', 'J', 'D', '2'};
+constexpr char kTimeColumn[] = "time";
+
+struct ColumnRecord {
+  uint8_t codec;
+  uint8_t padding[7];
+  char name[56];
+};
+static_assert(sizeof(ColumnRecord) == 64);
+static_assert(sizeof(TrajectoryRun) == 32);
+
+struct Trailer {
+  uint64_t index_offset;
+  char magic[8];
+};
+
+// The plane encodings of ColumnCodec::kShuffledDelta.
+enum PlaneMode : uint8_t { kZeroPlane = 0, kSparsePlane = 1, kDensePlane = 2 };
+
+[[noreturn]] void ThrowForFile(const std::string& filename,
+                               const std::string& message) {
+  throw std::runtime_error("TrajectoryDataset: " + filename + ": " + message);
+}
+
+uint64_t ZigZag(uint64_t value) {
+  const uint64_t sign = static_cast<int64_t>(value) < 0 ? ~uint64_t{0} : 0;
+  return (value << 1) ^ sign;
+}
+
+uint64_t UnZigZag(uint64_t value) {
+  return (value >> 1) ^ (0 - (value & 1));
+}
+
+void EncodeShuffledDelta(const double* values, int64_t size,
+                         std::vector<uint8_t>* out) {
+  // Smooth signals sampled finely have nearly constant differences, so their
+  // second differences have mostly zero high bytes.
+  std::vector<uint64_t> residuals(size);
+  uint64_t previous = 0;
+  uint64_t previous_delta = 0;
+  for (int64_t i = 0; i < size; ++i) {
+    const uint64_t bits = std::bit_cast<uint64_t>(values[i]);
+    const uint64_t delta = bits - previous;
+    residuals[i] = ZigZag(delta - previous_delta);
+    previous = bits;
+    previous_delta = delta;
+  }
+
+  const int64_t bitmap_size = (size + 7) / 8;
+  out->assign(8, kZeroPlane);
+  std::vector<uint8_t> plane(size);
+  for (int k = 0; k < 8; ++k) {
+    int64_t num_nonzero = 0;
+    for (int64_t i = 0; i < size; ++i) {
+      plane[i] = static_cast<uint8_t>(residuals[i] >> (8 * k));
+      num_nonzero += (plane[i] != 0);
+    }
+    // The lowest plane is stored even if it is all zeros, so that the chunk
+    // takes at least one bit per value.
+    if (num_nonzero == 0 && k > 0) {
+      continue;
+    }
+    if (bitmap_size + num_nonzero < size) {
+      (*out)[k] = kSparsePlane;
+      const size_t bitmap_start = out->size();
+      out->resize(bitmap_start + bitmap_size, 0);
+      for (int64_t i = 0; i < size; ++i) {
+        if (plane[i] != 0) {
+          (*out)[bitmap_start + i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+        }
+      }
+      for (int64_t i = 0; i < size; ++i) {
+        if (plane[i] != 0) {
+          out->push_back(plane[i]);
+        }
+      }
+    } else {
+      (*out)[k] = kDensePlane;
+      out->insert(out->end(), plane.begin(), plane.end());
+    }
+  }
+}
+
+// Returns false if `in` is not a valid encoding of `size` values.
+bool DecodeShuffledDelta(const uint8_t* in, uint64_t in_size, int64_t size,
+                         double* values) {
+  if (in_size < 8) {
+    return false;
+  }
+  std::vector<uint64_t> residuals(size, 0);
+  const int64_t bitmap_size = (size + 7) / 8;
+  const uint8_t* modes = in;
+  const uint8_t* next = in + 8;
+  const uint8_t* end = in + in_size;
+  if (modes[0] == kZeroPlane) {
+    return false;
+  }
+  for (int k = 0; k < 8; ++k) {
+    if (modes[k] == kDensePlane) {
+      if (end - next < size) {
+        return false;
+      }
+      for (int64_t i = 0; i < size; ++i) {
+        residuals[i] |= uint64_t{next[i]} << (8 * k);
+      }
+      next += size;
+    } else if (modes[k] == kSparsePlane) {
+      if (end - next < bitmap_size) {
+        return false;
+      }
+      const uint8_t* bitmap = next;
+      next += bitmap_size;
+      for (int64_t i = 0; i < size; ++i) {
+        if ((bitmap[i / 8] >> (i % 8)) & 1) {
+          if (next == end) {
+            return false;
+          }
+          residuals[i] |= uint64_t{*next++} << (8 * k);
+        }
+      }
+    } else if (modes[k] != kZeroPlane) {
+      return false;
+    }
+  }
+  if (next != end) {
+    return false;
+  }
+
+  uint64_t bits = 0;
+  uint64_t delta = 0;
+  for (int64_t i = 0; i < size; ++i) {
+    delta += UnZigZag(residuals[i]);
+    bits += delta;
+    values[i] = std::bit_cast<double>(bits);
+  }
+  return true;
+}
+
+}  // namespace
+
+TrajectoryDatasetWriter::TrajectoryDatasetWriter(
+    const std::string& filename, std::vector<TrajectoryColumn> columns)
+    : filename_(filename) {
+  columns_.push_back({kTimeColumn, ColumnCodec::kShuffledDelta});
+  for (TrajectoryColumn& column : columns) {
+    if (column.name.empty() || column.name.size() >= 56) {
+      ThrowForFile(filename, "invalid column name '" + column.name + "'");
+    }
+    for (const TrajectoryColumn& other : columns_) {
+      if (other.name == column.name) {
+        ThrowForFile(filename, "repeated column name '" + column.name + "'");
+      }
+    }
+    columns_.push_back(std::move(column));
+  }
+  out_.open(filename, std::ios::binary | std::ios::trunc);
+  out_.write(kMagic, sizeof(kMagic));
+  offset_ = sizeof(kMagic);
+  if (!out_) {
+    ThrowForFile(filename, "could not create the file");
+  }
+}
+
+TrajectoryDatasetWriter::~TrajectoryDatasetWriter() = default;
+
+void TrajectoryDatasetWriter::WriteChunk(ColumnCodec codec,
+                                         const double* values, int64_t size) {
+  const char* data = reinterpret_cast<const char*>(values);
+  uint64_t data_size = sizeof(double) * size;
+  if (codec == ColumnCodec::kShuffledDelta) {
+    EncodeShuffledDelta(values, size, &buffer_);
+    data = reinterpret_cast<const char*>(buffer_.data());
+    data_size = buffer_.size();
+  }
+  chunks_.push_back(offset_);
+  chunks_.push_back(data_size);
+  out_.write(data, data_size);
+  // Keeps the next chunk aligned, so that raw chunks can be mapped as doubles.
+  const char padding[8] = {};
+  const uint64_t padding_size = (8 - data_size % 8) % 8;
+  out_.write(padding, padding_size);
+  offset_ += data_size + padding_size;
+}
+
+void TrajectoryDatasetWriter::AddRun(
+    int64_t run_id, const Eigen::Ref<const Eigen::VectorXd>& times,
+    const Eigen::Ref<const Eigen::MatrixXd>& values) {
+  if (finished_) {
+    ThrowForFile(filename_, "the dataset is finished");
+  }
+  if (times.size() < 1 || values.rows() != times.size() ||
+      values.cols() + 1 != static_cast<int64_t>(columns_.size())) {
+    ThrowForFile(filename_, "need at least one sample, and a row of values "
+                            "with one value per column for each sample");
+  }
+  if (std::isnan(times(0))) {
+    ThrowForFile(filename_, "sample times must not be NaN");
+  }
+  for (int64_t i = 1; i < times.size(); ++i) {
+    if (!(times(i) >= times(i - 1))) {
+      ThrowForFile(filename_, "sample times must not be NaN or decrease");
+    }
+  }
+  if (!run_ids_.insert(run_id).second) {
+    ThrowForFile(filename_, "repeated run id " + std::to_string(run_id));
+  }
+
+  const int64_t size = times.size();
+  WriteChunk(columns_[0].codec, times.data(), size);
+  for (int64_t j = 0; j < values.cols(); ++j) {
+    WriteChunk(columns_[j + 1].codec, values.col(j).data(), size);
+  }
+  if (!out_) {
+    ThrowForFile(filename_, "could not write the file");
+  }
+  runs_.push_back({run_id, size, times(0), times(size - 1)});
+}
+
+void TrajectoryDatasetWriter::AddRun(
+    int64_t run_id, const drake::systems::VectorLog<double>& log) {
+  AddRun(run_id, log.sample_times(), log.data().transpose());
+}
+
+void TrajectoryDatasetWriter::Finish() {
+  if (finished_) {
+    return;
+  }
+  finished_ = true;
+  const uint64_t index_offset = offset_;
+  const uint64_t counts[2] = {columns_.size(), runs_.size()};
+  out_.write(reinterpret_cast<const char*>(counts), sizeof(counts));
+  for (const TrajectoryColumn& column : columns_) {
+    ColumnRecord record{};
+    record.codec = static_cast<uint8_t>(column.codec);
+    std::memcpy(record.name, column.name.data(), column.name.size());
+    out_.write(reinterpret_cast<const char*>(&record), sizeof(record));
+  }
+  out_.write(reinterpret_cast<const char*>(runs_.data()),
+             sizeof(TrajectoryRun) * runs_.size());
+  std::vector<uint64_t> runs_by_id(runs_.size());
+  for (size_t i = 0; i < runs_by_id.size(); ++i) {
+    runs_by_id[i] = i;
+  }
+  std::vector<uint64_t> runs_by_start = runs_by_id;
+  std::sort(runs_by_id.begin(), runs_by_id.end(),
+            [this](uint64_t a, uint64_t b) {
+              return runs_[a].run_id < runs_[b].run_id;
+            });
+  std::stable_sort(runs_by_start.begin(), runs_by_start.end(),
+                   [this](uint64_t a, uint64_t b) {
+                     return runs_[a].start_time < runs_[b].start_time;
+                   });
+  out_.write(reinterpret_cast<const char*>(runs_by_id.data()),
+             sizeof(uint64_t) * runs_by_id.size());
+  out_.write(reinterpret_cast<const char*>(runs_by_start.data()),
+             sizeof(uint64_t) * runs_by_start.size());
+  out_.write(reinterpret_cast<const char*>(chunks_.data()),
+             sizeof(uint64_t) * chunks_.size());
+  Trailer trailer{};
+  trailer.index_offset = index_offset;
+  std::memcpy(trailer.magic, kMagic, sizeof(kMagic));
+  out_.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+  out_.close();
+  if (!out_) {
+    ThrowForFile(filename_, "could not write the file");
+  }
+}
+
+TrajectoryDataset::TrajectoryDataset(const std::string& filename)
+    : filename_(filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    ThrowForFile(filename, std::strerror(errno));
+  }
+  struct stat info {};
+  if (::fstat(fd, &info) != 0 ||
+      static_cast<std::size_t>(info.st_size) <
+          sizeof(kMagic) + sizeof(Trailer)) {
+    ::close(fd);
+    ThrowForFile(filename, "not a trajectory dataset");
+  }
+  mapping_size_ = info.st_size;
+  mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    ThrowForFile(filename, std::strerror(errno));
+  }
+  // Readers typically pick a few columns of a few runs.
+  ::madvise(mapping_, mapping_size_, MADV_RANDOM);
+
+  const auto* bytes = static_cast<const uint8_t*>(mapping_);
+  Trailer trailer{};
+  std::memcpy(&trailer, bytes + mapping_size_ - sizeof(trailer),
+              sizeof(trailer));
+  const uint64_t index_size = mapping_size_ - sizeof(trailer) -
+                              std::min(trailer.index_offset, mapping_size_);
+  uint64_t num_columns = 0;
+  std::string error;
+  if (std::memcmp(bytes, kMagic, sizeof(kMagic)) != 0 ||
+      std::memcmp(trailer.magic, kMagic, sizeof(kMagic)) != 0) {
+    error = "not a trajectory dataset, or not finished";
+  } else if (trailer.index_offset % 8 != 0 ||
+             index_size < 2 * sizeof(uint64_t)) {
+    error = "invalid index";
+  } else {
+    const auto* counts =
+        reinterpret_cast<const uint64_t*>(bytes + trailer.index_offset);
+    num_columns = counts[0];
+    num_runs_ = counts[1];
+    // Each column needs a record, and each run needs a record, an id entry,
+    // a start time entry, and a chunk entry for each column.
+    const uint64_t available = index_size - 2 * sizeof(uint64_t);
+    if (num_columns < 1 || num_columns > available / sizeof(ColumnRecord) ||
+        num_runs_ > (available - num_columns * sizeof(ColumnRecord)) /
+                        (sizeof(TrajectoryRun) + 2 * sizeof(uint64_t) +
+                         num_columns * sizeof(Chunk)) ||
+        index_size != 2 * sizeof(uint64_t) +
+                          num_columns * sizeof(ColumnRecord) +
+                          num_runs_ * (sizeof(TrajectoryRun) +
+                                       2 * sizeof(uint64_t) +
+                                       num_columns * sizeof(Chunk))) {
+      error = "invalid index";
+    }
+  }
+  if (error.empty()) {
+    const uint8_t* next = bytes + trailer.index_offset + 2 * sizeof(uint64_t);
+    const auto* records = reinterpret_cast<const ColumnRecord*>(next);
+    for (uint64_t j = 0; j < num_columns && error.empty(); ++j) {
+      const ColumnRecord& record = records[j];
+      if (record.codec > static_cast<uint8_t>(ColumnCodec::kShuffledDelta) ||
+          record.name[sizeof(record.name) - 1] != '\0') {
+        error = "invalid column";
+      } else {
+        columns_.push_back(
+            {record.name, static_cast<ColumnCodec>(record.codec)});
+      }
+    }
+    next += num_columns * sizeof(ColumnRecord);
+    runs_ = reinterpret_cast<const TrajectoryRun*>(next);
+    next += num_runs_ * sizeof(TrajectoryRun);
+    runs_by_id_ = reinterpret_cast<const uint64_t*>(next);
+    next += num_runs_ * sizeof(uint64_t);
+    runs_by_start_ = reinterpret_cast<const uint64_t*>(next);
+    next += num_runs_ * sizeof(uint64_t);
+    chunks_ = reinterpret_cast<const Chunk*>(next);
+    for (uint64_t i = 0; i < num_runs_; ++i) {
+      if (runs_by_id_[i] >= num_runs_ || runs_by_start_[i] >= num_runs_ ||
+          runs_[i].num_samples < 1) {
+        error = "invalid run";
+        break;
+      }
+    }
+    // Every chunk takes at least one bit per value, which bounds the number
+    // of samples, and so what ReadColumn() allocates, by the file's size.
+    for (uint64_t i = 0; i < num_runs_ * num_columns && error.empty(); ++i) {
+      const auto num_samples =
+          static_cast<uint64_t>(runs_[i / num_columns].num_samples);
+      if (chunks_[i].offset > trailer.index_offset ||
+          chunks_[i].size > trailer.index_offset - chunks_[i].offset ||
+          chunks_[i].offset % 8 != 0 ||
+          (num_samples + 7) / 8 > chunks_[i].size) {
+        error = "invalid chunk";
+      }
+    }
+    max_end_times_.reserve(num_runs_);
+    for (uint64_t k = 0; k < num_runs_ && error.empty(); ++k) {
+      const TrajectoryRun& run = runs_[runs_by_start_[k]];
+      if (k > 0 &&
+          !(run.start_time >= runs_[runs_by_start_[k - 1]].start_time)) {
+        error = "runs not sorted by start time";
+      }
+      const double previous = k == 0 ? run.end_time : max_end_times_.back();
+      max_end_times_.push_back(std::max(previous, run.end_time));
+    }
+  }
+  if (!error.empty()) {
+    ::munmap(mapping_, mapping_size_);
+    mapping_ = nullptr;
+    ThrowForFile(filename, error);
+  }
+}
+
+TrajectoryDataset::~TrajectoryDataset() {
+  if (mapping_ != nullptr) {
+    ::munmap(mapping_, mapping_size_);
+  }
+}
+
+int TrajectoryDataset::FindColumn(const std::string& name) const {
+  for (int j = 0; j < num_columns(); ++j) {
+    if (columns_[j].name == name) {
+      return j;
+    }
+  }
+  ThrowForFile(filename_, "no column named '" + name + "'");
+}
+
+const TrajectoryRun& TrajectoryDataset::run(int index) const {
+  if (index < 0 || index >= num_runs()) {
+    throw std::out_of_range("TrajectoryDataset: run index out of range");
+  }
+  return runs_[index];
+}
+
+std::optional<int> TrajectoryDataset::FindRun(int64_t run_id) const {
+  const uint64_t* found = std::lower_bound(
+      runs_by_id_, runs_by_id_ + num_runs_, run_id,
+      [this](uint64_t index, int64_t id) { return runs_[index].run_id < id; });
+  if (found == runs_by_id_ + num_runs_ || runs_[*found].run_id != run_id) {
+    return std::nullopt;
+  }
+  return static_cast<int>(*found);
+}
+
+std::vector<int> TrajectoryDataset::FindRuns(double start_time,
+                                             double end_time) const {
+  // The runs that start by end_time come first in runs_by_start_. Of those,
+  // the ones up to the first whose max_end_times_ reaches start_time all end
+  // before start_time, since max_end_times_ never decreases.
+  const uint64_t* last = std::upper_bound(
+      runs_by_start_, runs_by_start_ + num_runs_, end_time,
+      [this](double time, uint64_t index) {
+        return time < runs_[index].start_time;
+      });
+  const int64_t num_started = last - runs_by_start_;
+  const int64_t first =
+      std::lower_bound(max_end_times_.begin(),
+                       max_end_times_.begin() + num_started, start_time) -
+      max_end_times_.begin();
+  std::vector<int> result;
+  for (int64_t k = first; k < num_started; ++k) {
+    if (runs_[runs_by_start_[k]].end_time >= start_time) {
+      result.push_back(static_cast<int>(runs_by_start_[k]));
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+const TrajectoryDataset::Chunk& TrajectoryDataset::GetChunk(
+    int run_index, int column) const {
+  if (run_index < 0 || run_index >= num_runs() || column < 0 ||
+      column >= num_columns()) {
+    throw std::out_of_range("TrajectoryDataset: index out of range");
+  }
+  return chunks_[static_cast<int64_t>(run_index) * num_columns() + column];
+}
+
+Eigen::VectorXd TrajectoryDataset::ReadColumn(int run_index,
+                                              int column) const {
+  const Chunk& chunk = GetChunk(run_index, column);
+  const int64_t size = runs_[run_index].num_samples;
+  const auto* data = static_cast<const uint8_t*>(mapping_) + chunk.offset;
+  // The constructor checked that size is at most 8 * chunk.size, so this
+  // allocates no more than 64 times the chunk's size.
+  Eigen::VectorXd result;
+  bool valid = true;
+  if (columns_[column].codec == ColumnCodec::kRaw) {
+    valid = chunk.size == sizeof(double) * size;
+    if (valid) {
+      result.resize(size);
+      std::memcpy(result.data(), data, chunk.size);
+    }
+  } else {
+    result.resize(size);
+    valid = DecodeShuffledDelta(data, chunk.size, size, result.data());
+  }
+  if (!valid) {
+    ThrowForFile(filename_, "invalid chunk for column '" +
+                                columns_[column].name + "' of run " +
+                                std::to_string(runs_[run_index].run_id));
+  }
+  return result;
+}
+
+std::optional<Eigen::Map<const Eigen::VectorXd>> TrajectoryDataset::MapColumn(
+    int run_index, int column) const {
+  const Chunk& chunk = GetChunk(run_index, column);
+  const int64_t size = runs_[run_index].num_samples;
+  if (columns_[column].codec != ColumnCodec::kRaw ||
+      chunk.size != sizeof(double) * size) {
+    return std::nullopt;
+  }
+  return Eigen::Map<const Eigen::VectorXd>(
+      reinterpret_cast<const double*>(static_cast<const uint8_t*>(mapping_) +
+                                      chunk.offset),
+      size);
+}
+
+}  // namespace trajectory_dataset
+}  // namespace drake_external_examples
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "arena.h"  // IWYU pragma: associated
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/context.h>
+
+#include "batch_simulation.h"
+#include "particle/particle.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace arena_allocation {
+namespace {
+
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+bool Contains(const Arena& arena, const void* ptr) {
+  return Arena::Find(ptr) == &arena;
+}
+
+/// Makes sure allocations within a scope, and only those, come from its
+/// arena, and that the arena can be reset once they are all deleted.
+TEST(ArenaTest, ServesAllocationsInScope) {
+  Arena arena(1 << 20);
+  EXPECT_EQ(ArenaScope::current(), nullptr);
+  auto outside = std::make_unique<int>(1);
+  EXPECT_EQ(Arena::Find(outside.get()), nullptr);
+
+  std::unique_ptr<int> first;
+  std::unique_ptr<std::vector<double>> second;
+  {
+    ArenaScope scope(&arena);
+    EXPECT_EQ(ArenaScope::current(), &arena);
+    EXPECT_THROW(ArenaScope{&arena}, std::exception);
+    first = std::make_unique<int>(2);
+    second = std::make_unique<std::vector<double>>(100, 3.0);
+  }
+  EXPECT_EQ(ArenaScope::current(), nullptr);
+  EXPECT_TRUE(Contains(arena, first.get()));
+  EXPECT_TRUE(Contains(arena, second->data()));
+  // Allocations are carved one after the other.
+  EXPECT_EQ(reinterpret_cast<const char*>(second.get()) -
+                reinterpret_cast<const char*>(first.get()),
+            alignof(std::max_align_t));
+  EXPECT_EQ(arena.num_live_allocations(), 3);
+  EXPECT_GE(arena.used(), 800);
+
+  // Deletes on other threads count, too.
+  std::thread([&]() { second.reset(); }).join();
+  EXPECT_EQ(arena.num_live_allocations(), 1);
+  EXPECT_THROW(arena.Reset(), std::exception);
+  first.reset();
+  arena.Reset();
+  EXPECT_EQ(arena.used(), 0);
+
+  {
+    ArenaScope scope(&arena);
+    first = std::make_unique<int>(4);
+  }
+  EXPECT_EQ(*first, 4);
+  first.reset();
+  arena.Reset();
+}
+
+/// Makes sure allocations that do not fit are served by the heap, and that
+/// scopes nest.
+TEST(ArenaTest, OverflowsAndNests) {
+  Arena small(64);
+  Arena large(1 << 20);
+  ArenaScope outer(&large);
+  std::unique_ptr<std::string> inner_string;
+  std::unique_ptr<std::vector<char>> overflow;
+  {
+    ArenaScope inner(&small);
+    EXPECT_EQ(ArenaScope::current(), &small);
+    inner_string = std::make_unique<std::string>();
+    overflow = std::make_unique<std::vector<char>>(1000);
+  }
+  EXPECT_EQ(ArenaScope::current(), &large);
+  EXPECT_TRUE(Contains(small, inner_string.get()));
+  EXPECT_EQ(Arena::Find(overflow->data()), nullptr);
+  EXPECT_EQ(small.num_overflows(), 1);
+  inner_string.reset();
+  overflow.reset();
+  EXPECT_EQ(small.num_live_allocations(), 0);
+  EXPECT_THROW(Arena{Arena::max_capacity() + 1}, std::exception);
+}
+
+/// Makes sure the contexts, outputs and derivatives of a system can be
+/// created, evaluated, and released from an arena.
+TEST(ArenaTest, HoldsSystemObjects) {
+  const Particle<double> particle;
+  // Warm up outside of the arena, in case the first use allocates anything
+  // that is kept.
+  particle.CalcTimeDerivatives(*particle.CreateDefaultContext(),
+                               particle.AllocateTimeDerivatives().get());
+  particle.AllocateOutput();
+  Arena arena(16 << 20);
+  for (int batch = 0; batch < 3; ++batch) {
+    {
+      ArenaScope scope(&arena);
+      std::vector<std::unique_ptr<drake::systems::Context<double>>> contexts;
+      for (int i = 0; i < 100; ++i) {
+        contexts.push_back(particle.CreateDefaultContext());
+        contexts.back()->SetContinuousState(Eigen::Vector2d(1.0 * i, 1.0));
+        particle.get_input_port(0).FixValue(contexts.back().get(),
+                                            drake::Vector1d(2.0 * i));
+      }
+      auto derivatives = particle.AllocateTimeDerivatives();
+      auto output = particle.AllocateOutput();
+      for (int i = 0; i < 100; ++i) {
+        particle.CalcTimeDerivatives(*contexts[i], derivatives.get());
+        EXPECT_EQ(derivatives->get_vector().GetAtIndex(1), 2.0 * i);
+      }
+      EXPECT_TRUE(Contains(arena, contexts.back().get()));
+      EXPECT_TRUE(Contains(arena, output.get()));
+    }
+    EXPECT_EQ(arena.num_live_allocations(), 0);
+    EXPECT_EQ(arena.num_overflows(), 0);
+    arena.Reset();
+  }
+}
+
+/// Makes sure the objects of a context come from the arena, but the storage
+/// of its Eigen vectors, which Eigen allocates with malloc(), does not.
+TEST(ArenaTest, EigenStorageIsOnHeap) {
+  const Particle<double> particle;
+  particle.CreateDefaultContext();
+  Arena arena(1 << 20);
+  std::unique_ptr<drake::systems::Context<double>> context;
+  {
+    ArenaScope scope(&arena);
+    context = particle.CreateDefaultContext();
+  }
+  const auto& state = dynamic_cast<const drake::systems::BasicVector<double>&>(
+      context->get_continuous_state_vector());
+  EXPECT_TRUE(Contains(arena, context.get()));
+  EXPECT_TRUE(Contains(arena, &state));
+  EXPECT_EQ(Arena::Find(state.get_value().data()), nullptr);
+  EXPECT_EQ(Arena::Find(context->get_numeric_parameter(0).get_value().data()),
+            nullptr);
+  context.reset();
+  EXPECT_EQ(arena.num_live_allocations(), 0);
+}
+
+/// Makes sure batches simulated within arenas, on several threads, match
+/// those simulated on the heap.
+TEST(BatchSimulationTest, MatchesHeap) {
+  const SimpleContinuousTimeSystem<double> system;
+  std::vector<Eigen::VectorXd> initial_states;
+  for (int i = 0; i < 50; ++i) {
+    initial_states.push_back(drake::Vector1d(0.9 - 0.01 * i));
+  }
+  const std::vector<Eigen::VectorXd> expected =
+      SimulateBatch(system, initial_states, 2.0);
+  const std::vector<Eigen::VectorXd> actual = SimulateBatch(
+      system, initial_states, 2.0, {.num_threads = 4, .use_arenas = true});
+  ASSERT_EQ(actual.size(), initial_states.size());
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(actual[i], expected[i]) << "rollout " << i;
+  }
+  EXPECT_NE(expected[0], expected[1]);
+  EXPECT_THROW(SimulateBatch(system, {Eigen::Vector2d::Zero()}, 1.0),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace arena_allocation
+}  // namespace drake_external_examples
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/system.h>
+
+namespace drake_external_examples {
+namespace arena_allocation {
+
+/// Options for SimulateBatch().
+struct BatchOptions {
+  /// The number of threads to simulate on, including the caller's; see
+  /// parallel::ThreadPool.
+  int num_threads{1};
+
+  /// Whether each thread carves the objects of its rollouts (the simulator,
+  /// context, integrator and their containers, but not the storage of their
+  /// Eigen vectors; see Arena) from its own Arena, released at once when each
+  /// rollout finishes, instead of from the heap.
+  bool use_arenas{false};
+
+  /// The capacity of each thread's arena. Allocations that do not fit are
+  /// served by the heap.
+  std::size_t arena_capacity{std::size_t{64} << 20};
+};
+
+/// Simulates the closed @p system from time 0 to @p end_time once from each
+/// of @p initial_states (continuous states, starting from the default
+/// context), and returns the final continuous states in the same order.
+///
+/// The first rollout is always run on the heap, on the calling thread, to
+/// warm up anything that is allocated once and kept (see Arena).
+/// @throws std::exception if an initial state has the wrong size.
+std::vector<Eigen::VectorXd> SimulateBatch(
+    const drake::systems::System<double>& system,
+    const std::vector<Eigen::VectorXd>& initial_states, double end_time,
+    const BatchOptions& options = {});
+
+}  // namespace arena_allocation
+}  // namespace drake_external_examples
@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Counts what is allocated through the global operator new, so that a
+/// benchmark can report the heap bytes an object retains, or check that a
+/// loop allocates nothing. Linking the counting_allocator library replaces
+/// the global operator new and delete with ones that count, on every thread,
+/// and otherwise use malloc() and free() as usual; link it into benchmarks
+/// only. Each allocation carries a header recording its size, so that
+/// deletes can be subtracted. Over-aligned allocations (those through
+/// `operator new(std::size_t, std::align_val_t)`) are not counted.
+
+#pragma once
+
+#include <cstdint>
+
+namespace drake_external_examples {
+namespace benchmarking {
+
+/// Returns the bytes allocated through the global operator new, and not yet
+/// deleted.
+int64_t LiveHeapBytes();
+
+/// Returns the number of allocations made through the global operator new.
+int64_t NumHeapAllocations();
+
+}  // namespace benchmarking
+}  // namespace drake_external_examples
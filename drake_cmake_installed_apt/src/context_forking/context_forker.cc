@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "context_forker.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace drake_external_examples {
+namespace context_forking {
+
+using drake::systems::Context;
+using drake::systems::System;
+
+ContextForker::ContextForker(const System<double>& system,
+                             const Context<double>& template_context)
+    : system_(system), template_(template_context.Clone()) {
+  system_.ValidateContext(*template_);
+  // Recycled forks keep the input port values they were handed back with, so
+  // only closed systems can be forked.
+  if (system_.num_input_ports() > 0) {
+    throw std::logic_error(
+        "ContextForker: cannot fork the contexts of a system with inputs");
+  }
+}
+
+std::unique_ptr<Context<double>> ContextForker::Fork() {
+  if (released_.empty()) {
+    return template_->Clone();
+  }
+  std::unique_ptr<Context<double>> fork = std::move(released_.back());
+  released_.pop_back();
+  fork->SetTimeStateAndParametersFrom(*template_);
+  return fork;
+}
+
+void ContextForker::Release(std::unique_ptr<Context<double>> fork) {
+  if (fork == nullptr) {
+    throw std::logic_error("ContextForker: cannot release a null context");
+  }
+  system_.ValidateContext(*fork);
+  released_.push_back(std::move(fork));
+}
+
+}  // namespace context_forking
+}  // namespace drake_external_examples
@@ -0,0 +1,316 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "shared_memory_mailbox.h"
+
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+extern char** environ;
+
+namespace drake_external_examples {
+namespace cosimulation {
+namespace {
+
+constexpr uint32_t kMagic = 0x44434f53;
+constexpr size_t kRequestOffset = 32;
+// How long the destructor waits for the peer to exit before killing it.
+constexpr std::chrono::seconds kPeerExitTimeout{5};
+
+// The start of the mailbox; see the table in shared_memory_mailbox.h.
+struct Header {
+  uint32_t magic;
+  uint32_t request_size;
+  uint32_t reply_size;
+  uint32_t closed;
+  double time;
+};
+static_assert(sizeof(Header) <= kRequestOffset);
+
+Header& GetHeader(uint8_t* mapped) {
+  return *reinterpret_cast<Header*>(mapped);
+}
+
+double* GetRequest(uint8_t* mapped) {
+  return reinterpret_cast<double*>(mapped + kRequestOffset);
+}
+
+double* GetReply(uint8_t* mapped) {
+  return GetRequest(mapped) + GetHeader(mapped).request_size;
+}
+
+[[noreturn]] void ThrowErrno(const std::string& what) {
+  throw std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+// Owns a file descriptor, closing it unless it is released.
+class UniqueFd {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(UniqueFd);
+
+  explicit UniqueFd(int fd) : fd_(fd) {}
+  ~UniqueFd() {
+    if (fd_ >= 0) close(fd_);
+  }
+
+  int get() const { return fd_; }
+
+  int release() {
+    const int fd = fd_;
+    fd_ = -1;
+    return fd;
+  }
+
+ private:
+  int fd_{-1};
+};
+
+// Waits for `pid` to exit for up to kPeerExitTimeout, then kills it, and
+// reaps it either way.
+void ReapPeer(pid_t pid) {
+  const auto deadline = std::chrono::steady_clock::now() + kPeerExitTimeout;
+  while (std::chrono::steady_clock::now() < deadline) {
+    const pid_t result = waitpid(pid, nullptr, WNOHANG);
+    if (result == pid || (result < 0 && errno != EINTR)) {
+      return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  kill(pid, SIGKILL);
+  while (waitpid(pid, nullptr, 0) < 0 && errno == EINTR) {
+  }
+}
+
+uint8_t* Map(int fd, size_t size) {
+  void* mapped =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (mapped == MAP_FAILED) {
+    ThrowErrno("Could not map the cosimulation mailbox");
+  }
+  return static_cast<uint8_t*>(mapped);
+}
+
+void Signal(int fd) {
+  const uint64_t one = 1;
+  while (write(fd, &one, sizeof(one)) < 0) {
+    if (errno != EINTR) {
+      ThrowErrno("Could not signal the cosimulation mailbox");
+    }
+  }
+}
+
+// Blocks until `fd` is signaled. If `*peer_pid` is a process, throws once it
+// has exited instead, and sets `*peer_pid` to -1.
+void Wait(int fd, pid_t* peer_pid) {
+  uint64_t count = 0;
+  for (;;) {
+    if (*peer_pid >= 0) {
+      pollfd poll_fd{fd, POLLIN, 0};
+      const int ready = poll(&poll_fd, 1, /* timeout = */ 100);
+      if (ready < 0 && errno != EINTR) {
+        ThrowErrno("Could not wait on the cosimulation mailbox");
+      }
+      if (ready <= 0) {
+        if (waitpid(*peer_pid, nullptr, WNOHANG) == *peer_pid) {
+          *peer_pid = -1;
+          throw std::runtime_error(
+              "The cosimulation peer exited without replying");
+        }
+        continue;
+      }
+    }
+    if (read(fd, &count, sizeof(count)) == sizeof(count)) {
+      return;
+    }
+    if (errno != EINTR) {
+      ThrowErrno("Could not wait on the cosimulation mailbox");
+    }
+  }
+}
+
+int ParseFd(int argc, const char* const argv[], const std::string& name) {
+  const std::string prefix = "--" + name + "=";
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with(prefix)) {
+      return std::stoi(std::string(arg.substr(prefix.size())));
+    }
+  }
+  throw std::runtime_error("Missing argument " + prefix + "<fd>");
+}
+
+}  // namespace
+
+SharedMemoryMailbox::SharedMemoryMailbox(int request_size, int reply_size)
+    : request_size_(request_size), reply_size_(reply_size) {
+  if (request_size < 0 || reply_size < 0) {
+    throw std::logic_error("The mailbox sizes must not be negative");
+  }
+  mapped_size_ = kRequestOffset + sizeof(double) * (request_size + reply_size);
+  // The file descriptors are close-on-exec, so that no child inherits them
+  // but the peer; LaunchPeer() clears the flag in the peer only.
+  UniqueFd mailbox_fd(memfd_create("cosimulation_mailbox", MFD_CLOEXEC));
+  UniqueFd request_fd(eventfd(0, EFD_CLOEXEC));
+  UniqueFd reply_fd(eventfd(0, EFD_CLOEXEC));
+  if (mailbox_fd.get() < 0 || request_fd.get() < 0 || reply_fd.get() < 0 ||
+      ftruncate(mailbox_fd.get(), static_cast<off_t>(mapped_size_)) != 0) {
+    ThrowErrno("Could not create the cosimulation mailbox");
+  }
+  mapped_ = Map(mailbox_fd.get(), mapped_size_);
+  mailbox_fd_ = mailbox_fd.release();
+  request_fd_ = request_fd.release();
+  reply_fd_ = reply_fd.release();
+  Header& header = GetHeader(mapped_);
+  header.magic = kMagic;
+  header.request_size = static_cast<uint32_t>(request_size);
+  header.reply_size = static_cast<uint32_t>(reply_size);
+}
+
+SharedMemoryMailbox::~SharedMemoryMailbox() {
+  if (peer_pid_ >= 0) {
+    std::atomic_ref<uint32_t>(GetHeader(mapped_).closed)
+        .store(1, std::memory_order_release);
+    const uint64_t one = 1;
+    // If the peer cannot be told, or does not listen, it is killed.
+    static_cast<void>(write(request_fd_, &one, sizeof(one)));
+    ReapPeer(peer_pid_);
+  }
+  munmap(mapped_, mapped_size_);
+  close(mailbox_fd_);
+  close(request_fd_);
+  close(reply_fd_);
+}
+
+void SharedMemoryMailbox::LaunchPeer(const std::vector<std::string>& command) {
+  if (peer_pid_ >= 0) {
+    throw std::logic_error("The cosimulation peer was already launched");
+  }
+  if (command.empty()) {
+    throw std::logic_error("The cosimulation peer command is empty");
+  }
+  std::vector<std::string> arguments = command;
+  arguments.push_back("--mailbox_fd=" + std::to_string(mailbox_fd_));
+  arguments.push_back("--request_fd=" + std::to_string(request_fd_));
+  arguments.push_back("--reply_fd=" + std::to_string(reply_fd_));
+  std::vector<char*> argv;
+  for (std::string& argument : arguments) {
+    argv.push_back(argument.data());
+  }
+  argv.push_back(nullptr);
+  // Duplicating a file descriptor onto itself clears its close-on-exec flag
+  // in the peer (POSIX.1-2024; glibc 2.29 and later), and in no other child.
+  posix_spawn_file_actions_t actions;
+  int error = posix_spawn_file_actions_init(&actions);
+  if (error != 0) {
+    throw std::runtime_error("Could not launch " + command[0] + ": " +
+                             std::strerror(error));
+  }
+  for (const int fd : {mailbox_fd_, request_fd_, reply_fd_}) {
+    if (error == 0) {
+      error = posix_spawn_file_actions_adddup2(&actions, fd, fd);
+    }
+  }
+  pid_t pid{};
+  if (error == 0) {
+    error =
+        posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+  }
+  posix_spawn_file_actions_destroy(&actions);
+  if (error != 0) {
+    throw std::runtime_error("Could not launch " + command[0] + ": " +
+                             std::strerror(error));
+  }
+  peer_pid_ = pid;
+}
+
+void SharedMemoryMailbox::Exchange(
+    double time, const Eigen::Ref<const Eigen::VectorXd>& request,
+    drake::EigenPtr<Eigen::VectorXd> reply) {
+  if (peer_pid_ < 0) {
+    throw std::logic_error("The cosimulation peer is not running");
+  }
+  if (request.size() != request_size_ || reply == nullptr ||
+      reply->size() != reply_size_) {
+    throw std::logic_error("The request or reply has the wrong size");
+  }
+  GetHeader(mapped_).time = time;
+  std::memcpy(GetRequest(mapped_), request.data(),
+              sizeof(double) * request_size_);
+  Signal(request_fd_);
+  Wait(reply_fd_, &peer_pid_);
+  std::memcpy(reply->data(), GetReply(mapped_), sizeof(double) * reply_size_);
+}
+
+MailboxPeer::MailboxPeer(int argc, const char* const argv[]) {
+  const int mailbox_fd = ParseFd(argc, argv, "mailbox_fd");
+  request_fd_ = ParseFd(argc, argv, "request_fd");
+  reply_fd_ = ParseFd(argc, argv, "reply_fd");
+  struct stat status {};
+  if (fstat(mailbox_fd, &status) != 0) {
+    ThrowErrno("Could not open the cosimulation mailbox");
+  }
+  mapped_size_ = static_cast<size_t>(status.st_size);
+  if (mapped_size_ < kRequestOffset) {
+    throw std::runtime_error("The file is not a cosimulation mailbox");
+  }
+  mapped_ = Map(mailbox_fd, mapped_size_);
+  const Header& header = GetHeader(mapped_);
+  request_size_ = static_cast<int>(header.request_size);
+  reply_size_ = static_cast<int>(header.reply_size);
+  if (header.magic != kMagic ||
+      mapped_size_ <
+          kRequestOffset + sizeof(double) * (request_size_ + reply_size_)) {
+    munmap(mapped_, mapped_size_);
+    throw std::runtime_error("The file is not a cosimulation mailbox");
+  }
+}
+
+MailboxPeer::~MailboxPeer() { munmap(mapped_, mapped_size_); }
+
+bool MailboxPeer::IsPeer(int argc, const char* const argv[]) {
+  for (int i = 1; i < argc; ++i) {
+    if (std::string_view(argv[i]).starts_with("--mailbox_fd=")) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool MailboxPeer::Receive(double* time, Eigen::VectorXd* request) {
+  pid_t no_process = -1;
+  Wait(request_fd_, &no_process);
+  Header& header = GetHeader(mapped_);
+  if (std::atomic_ref<uint32_t>(header.closed).load(
+          std::memory_order_acquire) != 0) {
+    return false;
+  }
+  *time = header.time;
+  request->resize(request_size_);
+  std::memcpy(request->data(), GetRequest(mapped_),
+              sizeof(double) * request_size_);
+  return true;
+}
+
+void MailboxPeer::Reply(const Eigen::Ref<const Eigen::VectorXd>& reply) {
+  if (reply.size() != reply_size_) {
+    throw std::logic_error("The reply has the wrong size");
+  }
+  std::memcpy(GetReply(mapped_), reply.data(), sizeof(double) * reply_size_);
+  Signal(reply_fd_);
+}
+
+}  // namespace cosimulation
+}  // namespace drake_external_examples
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Compares recording a SimpleContinuousTimeSystem trajectory over 10 s with
+/// 1 kHz VectorLogSink logging against the integrator's dense output. For each
+/// mode this reports the median wall time of AdvanceTo() and the heap bytes
+/// still held by the recorded result afterwards.
+///
+/// Usage: dense_output_benchmark [repetitions] [--json_output=<path>]
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#include <drake/common/trajectories/piecewise_polynomial.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/primitives/vector_log_sink.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "benchmark_harness/counting_allocator.h"
+#include "dense_output.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace dense_output {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+using drake::systems::VectorLogSink;
+using systems::SimpleContinuousTimeSystem;
+
+constexpr double kX0 = 0.9;
+constexpr double kFinalTime = 10.0;
+constexpr double kLogPeriod = 1.0e-3;
+
+// Records the trajectory with a VectorLogSink.
+void BenchmarkLogging(BenchmarkFixture* fixture, int repetitions) {
+  std::unique_ptr<Diagram<double>> diagram;
+  std::unique_ptr<Simulator<double>> simulator;
+  const VectorLogSink<double>* logger{};
+  int64_t retained_bytes = 0;
+  BenchmarkResult& result = fixture->MeasureRepeated(
+      "logging (1 kHz)", repetitions, 1,
+      [&]() {
+        simulator.reset();
+        DiagramBuilder<double> builder;
+        auto system = builder.AddSystem<SimpleContinuousTimeSystem<double>>();
+        logger = builder.AddSystem<VectorLogSink<double>>(1, kLogPeriod);
+        builder.Connect(system->get_output_port(0), logger->get_input_port());
+        diagram = builder.Build();
+        simulator = std::make_unique<Simulator<double>>(*diagram);
+        simulator->get_mutable_context().get_mutable_continuous_state()[0] =
+            kX0;
+        simulator->Initialize();
+      },
+      [&]() {
+        const int64_t bytes_before = benchmarking::LiveHeapBytes();
+        simulator->AdvanceTo(kFinalTime);
+        retained_bytes = benchmarking::LiveHeapBytes() - bytes_before;
+      });
+  result.values["retained_bytes"] = retained_bytes;
+  result.values["samples"] =
+      logger->FindLog(simulator->get_context()).num_samples();
+  std::cout << "  " << retained_bytes << " bytes retained, "
+            << result.values["samples"] << " samples" << std::endl;
+}
+
+// Records the trajectory as the integrator's dense output.
+void BenchmarkDenseOutput(BenchmarkFixture* fixture, int repetitions) {
+  const SimpleContinuousTimeSystem<double> system;
+  std::unique_ptr<Simulator<double>> simulator;
+  std::unique_ptr<drake::trajectories::PiecewisePolynomial<double>> trajectory;
+  int64_t retained_bytes = 0;
+  BenchmarkResult& result = fixture->MeasureRepeated(
+      "dense output", repetitions, 1,
+      [&]() {
+        trajectory.reset();
+        simulator = std::make_unique<Simulator<double>>(system);
+        simulator->get_mutable_context().get_mutable_continuous_state()[0] =
+            kX0;
+        simulator->Initialize();
+      },
+      [&]() {
+        const int64_t bytes_before = benchmarking::LiveHeapBytes();
+        trajectory = AdvanceToWithDenseOutput(simulator.get(), kFinalTime);
+        retained_bytes = benchmarking::LiveHeapBytes() - bytes_before;
+      });
+  result.values["retained_bytes"] = retained_bytes;
+  result.values["segments"] = trajectory->get_number_of_segments();
+  std::cout << "  " << retained_bytes << " bytes retained, "
+            << result.values["segments"] << " segments" << std::endl;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("dense_output_benchmark", &argc, argv);
+  const int repetitions = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 20;
+  BenchmarkLogging(&fixture, repetitions);
+  BenchmarkDenseOutput(&fixture, repetitions);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace dense_output
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::dense_output::DoMain(argc, argv);
+}
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "crossing_detector.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/primitives/constant_vector_source.h>
+
+#include "particle/particle.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace event_detection {
+namespace {
+
+using drake::systems::ConstantVectorSource;
+using drake::systems::Diagram;
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+using particles::Particle;
+using systems::SimpleContinuousTimeSystem;
+
+// The tolerance on crossing times; the Simulator isolates them to 1% of the
+// context's accuracy.
+constexpr double kAccuracy = 1e-8;
+constexpr double kTimeTolerance = 1e-7;
+
+/// Makes sure the decaying state of the Simple Continuous Time System is
+/// found to fall through the threshold once, when the closed form says.
+TEST(CrossingDetectorTest, SimpleContinuousTimeSystem) {
+  DiagramBuilder<double> builder;
+  auto system = builder.AddSystem<SimpleContinuousTimeSystem<double>>();
+  auto detector = builder.AddSystem<CrossingDetector>(1, 0, 0.5);
+  builder.Connect(system->get_output_port(0), detector->get_input_port(0));
+  const std::unique_ptr<Diagram<double>> diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  const double x0 = 0.9;
+  simulator.get_mutable_context().SetContinuousState(drake::Vector1d(x0));
+  simulator.get_mutable_context().SetAccuracy(kAccuracy);
+  simulator.AdvanceTo(5.0);
+
+  // x(t) = (1 + (1/x₀² - 1) e²ᵗ)^(-1/2) reaches θ at
+  // t = ln((1/θ² - 1) / (1/x₀² - 1)) / 2.
+  const double threshold = detector->threshold();
+  const double expected =
+      0.5 * std::log((1.0 / (threshold * threshold) - 1.0) /
+                     (1.0 / (x0 * x0) - 1.0));
+  const std::vector<Crossing>& crossings = detector->get_crossings(
+      detector->GetMyContextFromRoot(simulator.get_context()));
+  ASSERT_EQ(crossings.size(), 1);
+  EXPECT_FALSE(crossings[0].rising);
+  EXPECT_NEAR(crossings[0].time, expected, kTimeTolerance);
+}
+
+/// Makes sure a Particle thrown upwards is found to rise through and then
+/// fall back through the threshold.
+TEST(CrossingDetectorTest, Particle) {
+  DiagramBuilder<double> builder;
+  auto gravity = builder.AddSystem<ConstantVectorSource<double>>(-1.0);
+  auto particle = builder.AddSystem<Particle<double>>();
+  auto detector = builder.AddSystem<CrossingDetector>(2, 0, 1.2);
+  builder.Connect(gravity->get_output_port(), particle->get_input_port(0));
+  builder.Connect(particle->get_output_port(0), detector->get_input_port(0));
+  const std::unique_ptr<Diagram<double>> diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.get_mutable_context().SetContinuousState(
+      Eigen::Vector2d(1.0, 1.0));
+  simulator.get_mutable_context().SetAccuracy(kAccuracy);
+  simulator.AdvanceTo(3.0);
+
+  // x(t) = 1 + t - t²/2 is 1.2 at t = 1 ± √0.6.
+  const std::vector<Crossing>& crossings = detector->get_crossings(
+      detector->GetMyContextFromRoot(simulator.get_context()));
+  ASSERT_EQ(crossings.size(), 2);
+  EXPECT_TRUE(crossings[0].rising);
+  EXPECT_NEAR(crossings[0].time, 1.0 - std::sqrt(0.6), kTimeTolerance);
+  EXPECT_FALSE(crossings[1].rising);
+  EXPECT_NEAR(crossings[1].time, 1.0 + std::sqrt(0.6), kTimeTolerance);
+}
+
+/// Makes sure an out-of-range index is rejected.
+TEST(CrossingDetectorTest, Throws) {
+  EXPECT_THROW(CrossingDetector(2, 2, 0.0), std::logic_error);
+  EXPECT_THROW(CrossingDetector(2, -1, 0.0), std::logic_error);
+}
+
+}  // namespace
+}  // namespace event_detection
+}  // namespace drake_external_examples
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+
+#include "state_jacobian.h"
+
+namespace drake_external_examples {
+namespace implicit_integration {
+
+/// The implicit Runge-Kutta methods that ImplicitIntegrator implements.
+enum class ImplicitScheme {
+  /// Implicit (backward) Euler: first order, L-stable.
+  kImplicitEuler,
+  /// The two-stage Radau IIA method: third order, L-stable.
+  kRadau3,
+};
+
+/// Options for ImplicitIntegrator.
+struct ImplicitIntegratorOptions {
+  ImplicitScheme scheme{ImplicitScheme::kRadau3};
+
+  /// The fixed step size; the last step of AdvanceTo() may be shorter.
+  double step_size{1e-2};
+
+  /// Newton's iterations on a step stop when the infinity norm of the update
+  /// is at most this tolerance times (1 + |x|∞).
+  double newton_tolerance{1e-10};
+
+  /// A step whose Newton iterations have not converged after this many is
+  /// retried as two half steps.
+  int max_newton_iterations{10};
+};
+
+/// Counts of the work done by an ImplicitIntegrator.
+struct ImplicitIntegratorStatistics {
+  int64_t num_steps{0};
+  /// Steps that were retried as two half steps; each also counts the steps
+  /// that replaced it.
+  int64_t num_step_retries{0};
+  int64_t num_newton_iterations{0};
+  int64_t num_derivative_evaluations{0};
+  int64_t num_jacobian_evaluations{0};
+  int64_t num_factorizations{0};
+};
+
+/// Integrates the continuous state of a system with an implicit Runge-Kutta
+/// method in fixed steps, solving each step by a simplified Newton method
+/// with the system's analytic StateJacobian.
+///
+/// Each step evaluates J once, at its start, and factors the Newton matrix
+/// (I - h J for implicit Euler; I - h A ⊗ J for Radau IIA, where A is the
+/// method's coefficient matrix) once with a sparse LU factorization, whose
+/// ordering is computed only once from the sparsity pattern. Each Newton
+/// iteration then costs one derivative evaluation per stage and a sparse
+/// solve, instead of the n additional evaluations (one per state) a finite
+/// difference Jacobian would take.
+///
+/// The system's discrete state, abstract state, and inputs are held at their
+/// values in the context.
+class ImplicitIntegrator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImplicitIntegrator);
+
+  /// Integrates the system of @p jacobian, which must outlive this.
+  /// @throws std::exception if the options are invalid.
+  explicit ImplicitIntegrator(const StateJacobian& jacobian,
+                              const ImplicitIntegratorOptions& options = {});
+
+  ~ImplicitIntegrator();
+
+  const ImplicitIntegratorOptions& options() const { return options_; }
+
+  const ImplicitIntegratorStatistics& statistics() const { return stats_; }
+
+  /// Advances the time and continuous state in @p context to @p end_time.
+  /// @throws std::exception if a step fails to converge even after being
+  /// halved many times.
+  void AdvanceTo(double end_time,
+                 drake::systems::Context<double>* context);
+
+ private:
+  // Advances by h, halving the step (at most a fixed number of times) when
+  // Newton's method does not converge.
+  void AdvanceBy(double h, int num_halvings,
+                 drake::systems::Context<double>* context);
+
+  // Takes one step of size h from the time and state in context. Returns
+  // false, leaving the context unchanged, if Newton's method does not
+  // converge.
+  bool Step(double h, drake::systems::Context<double>* context);
+
+  // Evaluates f(t, x) into xdot, using context (whose state is overwritten).
+  void CalcDerivatives(double t, const Eigen::VectorXd& x,
+                       drake::systems::Context<double>* context,
+                       Eigen::VectorXd* xdot);
+
+  // Factors the Newton matrix for the step size h and the Jacobian in
+  // jacobian_values_. Returns false if it is singular.
+  bool Factor(double h);
+
+  const StateJacobian& jacobian_;
+  const ImplicitIntegratorOptions options_;
+  const int num_stages_;
+  ImplicitIntegratorStatistics stats_;
+
+  std::unique_ptr<drake::systems::ContinuousState<double>> derivatives_;
+  Eigen::SparseMatrix<double> jacobian_values_;
+  Eigen::SparseMatrix<double> newton_matrix_;
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> lu_;
+  bool pattern_analyzed_{false};
+};
+
+}  // namespace implicit_integration
+}  // namespace drake_external_examples
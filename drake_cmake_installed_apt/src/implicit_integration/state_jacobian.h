@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <Eigen/SparseCore>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/system.h>
+
+#include "particle/particle.h"
+#include "simple_continuous_time_system/simple_continuous_time_system.h"
+
+namespace drake_external_examples {
+namespace implicit_integration {
+
+/// The analytic Jacobian J = ∂f/∂x of a system's time derivatives
+/// ẋ = f(t, x, u, p) with respect to its continuous state x, for implicit
+/// integrators that would otherwise estimate it by finite differences or
+/// automatic differentiation of the whole system.
+///
+/// The Jacobian is sparse, with a sparsity pattern that is the same for all
+/// contexts, so that integrators can analyze it once and then only update
+/// its values. Inputs are held at their values in the context (e.g., fixed
+/// or from other systems held constant), so J excludes any dependence of x
+/// on itself through them.
+class StateJacobian {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(StateJacobian);
+
+  virtual ~StateJacobian();
+
+  /// Returns the system whose Jacobian this is.
+  const drake::systems::System<double>& system() const { return system_; }
+
+  /// Returns the sparsity pattern: a compressed n×n matrix, where n is the
+  /// number of continuous states, whose stored entries are all those that may
+  /// be nonzero in any context (their values are meaningless).
+  const Eigen::SparseMatrix<double>& pattern() const { return pattern_; }
+
+  /// Writes J at the time, state, inputs and parameters in @p context into
+  /// @p jacobian. If @p jacobian does not have the pattern() (e.g., it is
+  /// empty), it is first given it; otherwise only its values are written,
+  /// without allocating.
+  void Calc(const drake::systems::Context<double>& context,
+            Eigen::SparseMatrix<double>* jacobian) const;
+
+ protected:
+  /// Creates the Jacobian of @p system, which must outlive it, with the
+  /// sparsity @p pattern.
+  /// @throws std::exception if @p pattern is not n×n.
+  StateJacobian(const drake::systems::System<double>& system,
+                Eigen::SparseMatrix<double> pattern);
+
+  /// Writes the values of J into the stored entries of @p jacobian, which has
+  /// the pattern(). The stored entries are in compressed column-major order,
+  /// so `jacobian->valuePtr()` may be written directly.
+  virtual void DoCalc(const drake::systems::Context<double>& context,
+                      Eigen::SparseMatrix<double>* jacobian) const = 0;
+
+ private:
+  const drake::systems::System<double>& system_;
+  const Eigen::SparseMatrix<double> pattern_;
+};
+
+/// The Jacobian of a Particle, J = [0 1; 0 0], with its force input held.
+class ParticleStateJacobian final : public StateJacobian {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParticleStateJacobian);
+
+  explicit ParticleStateJacobian(const particles::Particle<double>& system);
+
+ private:
+  void DoCalc(const drake::systems::Context<double>& context,
+              Eigen::SparseMatrix<double>* jacobian) const final;
+};
+
+/// The Jacobian of the Simple Continuous Time System ẋ = -x + x³, which is
+/// J = -1 + 3x².
+class SimpleContinuousTimeSystemStateJacobian final : public StateJacobian {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SimpleContinuousTimeSystemStateJacobian);
+
+  explicit SimpleContinuousTimeSystemStateJacobian(
+      const systems::SimpleContinuousTimeSystem<double>& system);
+
+ private:
+  void DoCalc(const drake::systems::Context<double>& context,
+              Eigen::SparseMatrix<double>* jacobian) const final;
+};
+
+}  // namespace implicit_integration
+}  // namespace drake_external_examples
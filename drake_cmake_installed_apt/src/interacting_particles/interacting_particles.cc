@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "interacting_particles.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <drake/systems/framework/vector_base.h>
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+using drake::systems::BasicVector;
+using drake::systems::Context;
+using drake::systems::ContinuousState;
+
+// The soft repulsion between two particles, with the offset between them
+// passed in so that both the cell-list and all-pairs versions share it.
+class Repulsion {
+ public:
+  explicit Repulsion(const InteractionOptions& options)
+      : cutoff_squared_(options.cutoff_radius * options.cutoff_radius),
+        inverse_cutoff_(1.0 / options.cutoff_radius),
+        stiffness_(options.stiffness) {}
+
+  // Adds the force that a particle at offset (-dx, -dy) exerts on this one to
+  // (*fx, *fy). Coincident particles exert no force, since the direction is
+  // undefined.
+  void Accumulate(double dx, double dy, double* fx, double* fy) const {
+    const double r_squared = dx * dx + dy * dy;
+    if (r_squared < cutoff_squared_ && r_squared > 0.0) {
+      const double r = std::sqrt(r_squared);
+      const double magnitude_over_r =
+          stiffness_ * (1.0 - r * inverse_cutoff_) / r;
+      *fx += magnitude_over_r * dx;
+      *fy += magnitude_over_r * dy;
+    }
+  }
+
+ private:
+  const double cutoff_squared_;
+  const double inverse_cutoff_;
+  const double stiffness_;
+};
+
+// The continuous state and its derivatives are allocated as BasicVectors.
+const Eigen::VectorXd& GetStateValue(const Context<double>& context) {
+  return dynamic_cast<const BasicVector<double>&>(
+             context.get_continuous_state_vector())
+      .value();
+}
+
+}  // namespace
+
+InteractingParticles::InteractingParticles(int num_particles,
+                                           const InteractionOptions& options)
+    : num_particles_(num_particles),
+      options_(options),
+      pool_(std::make_unique<parallel::ThreadPool>(options.num_threads)) {
+  if (num_particles < 0 || !(options.cutoff_radius > 0.0)) {
+    throw std::logic_error("InteractingParticles: invalid arguments");
+  }
+  // All positions, then all velocities.
+  DeclareContinuousState(2 * num_particles, 2 * num_particles, 0);
+  DeclareVectorOutputPort("state", 4 * num_particles,
+                          &InteractingParticles::CopyStateOut,
+                          {all_state_ticket()});
+  cell_list_cache_entry_ = &DeclareCacheEntry(
+      "cell_list", CellList{}, &InteractingParticles::CalcCellList,
+      {q_ticket()});
+}
+
+const CellList& InteractingParticles::EvalCellList(
+    const Context<double>& context) const {
+  return cell_list_cache_entry_->Eval<CellList>(context);
+}
+
+void InteractingParticles::CopyStateOut(const Context<double>& context,
+                                        BasicVector<double>* output) const {
+  output->SetFrom(context.get_continuous_state_vector());
+}
+
+void InteractingParticles::CalcCellList(const Context<double>& context,
+                                        CellList* cell_list) const {
+  const int n = num_particles_;
+  const Eigen::VectorXd& state = GetStateValue(context);
+  cell_list->Rebuild(state.segment(0, n), state.segment(n, n),
+                     options_.cutoff_radius);
+}
+
+void InteractingParticles::DoCalcTimeDerivatives(
+    const Context<double>& context,
+    ContinuousState<double>* derivatives) const {
+  const int n = num_particles_;
+  const Eigen::VectorXd& state = GetStateValue(context);
+  auto derivatives_value =
+      dynamic_cast<BasicVector<double>&>(derivatives->get_mutable_vector())
+          .get_mutable_value();
+  // q̇ = v, and v̇ = F − b v with unit masses; F is added below.
+  derivatives_value.head(2 * n) = state.tail(2 * n);
+  derivatives_value.tail(2 * n) = -options_.damping * state.tail(2 * n);
+
+  const CellList& cells = EvalCellList(context);
+  const std::vector<double>& x = cells.sorted_x();
+  const std::vector<double>& y = cells.sorted_y();
+  const Repulsion repulsion(options_);
+  const auto calc_row = [&](int64_t row_index, int) {
+    const int row = static_cast<int>(row_index);
+    for (int col = 0; col < cells.num_cols(); ++col) {
+      const int cell = cells.cell(row, col);
+      for (int s = cells.cell_begin(cell); s < cells.cell_begin(cell + 1);
+           ++s) {
+        double fx = 0.0;
+        double fy = 0.0;
+        for (int neighbor_row = std::max(row - 1, 0);
+             neighbor_row <= std::min(row + 1, cells.num_rows() - 1);
+             ++neighbor_row) {
+          // The three cells of a neighboring row are contiguous.
+          const int begin = cells.cell_begin(
+              cells.cell(neighbor_row, std::max(col - 1, 0)));
+          const int end = cells.cell_begin(
+              cells.cell(neighbor_row,
+                         std::min(col + 1, cells.num_cols() - 1)) +
+              1);
+          for (int t = begin; t < end; ++t) {
+            repulsion.Accumulate(x[s] - x[t], y[s] - y[t], &fx, &fy);
+          }
+        }
+        const int i = cells.point_index()[s];
+        derivatives_value[2 * n + i] += fx;
+        derivatives_value[3 * n + i] += fy;
+      }
+    }
+  };
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  pool_->ParallelFor(cells.num_rows(), calc_row);
+}
+
+Eigen::VectorXd CalcInteractionForcesAllPairs(
+    const InteractingParticles& system,
+    const Eigen::Ref<const Eigen::VectorXd>& positions) {
+  const int n = system.num_particles();
+  if (positions.size() != 2 * n) {
+    throw std::logic_error(
+        "CalcInteractionForcesAllPairs: wrong number of positions");
+  }
+  const Repulsion repulsion(system.options());
+  Eigen::VectorXd forces = Eigen::VectorXd::Zero(2 * n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = i + 1; j < n; ++j) {
+      double fx = 0.0;
+      double fy = 0.0;
+      repulsion.Accumulate(positions[i] - positions[j],
+                           positions[n + i] - positions[n + j], &fx, &fy);
+      // Equal and opposite.
+      forces[i] += fx;
+      forces[n + i] += fy;
+      forces[j] -= fx;
+      forces[n + j] -= fy;
+    }
+  }
+  return forces;
+}
+
+}  // namespace particles
+}  // namespace drake_external_examples
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures the cost of one time-derivative evaluation of InteractingParticles
+/// from 1k to 1M particles at a fixed density, against the O(N²) all-pairs
+/// force computation.
+///
+/// Each measured evaluation follows a small motion of all particles, as
+/// between the steps of a simulation, so it includes the incremental cell
+/// list rebuild. The all-pairs baseline is only run up to a size where it
+/// finishes in seconds; beyond that its time is extrapolated quadratically.
+///
+/// Usage: interacting_particles_benchmark [num_threads] [max_particles]
+///            [--json_output=<path>]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "interacting_particles.h"
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+
+// The largest size for which the all-pairs baseline is run.
+constexpr int kMaxAllPairs = 20000;
+
+// Positions scattered over a square at a density of about three neighbors
+// per particle, and random velocities.
+Eigen::VectorXd RandomState(int num_particles) {
+  std::mt19937 generator(0);
+  const double side = std::sqrt(num_particles);
+  std::uniform_real_distribution<double> position(0.0, side);
+  std::uniform_real_distribution<double> velocity(-1.0, 1.0);
+  Eigen::VectorXd state(4 * num_particles);
+  for (int i = 0; i < 2 * num_particles; ++i) {
+    state[i] = position(generator);
+    state[2 * num_particles + i] = velocity(generator);
+  }
+  return state;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("interacting_particles_benchmark", &argc, argv);
+  const int num_threads = (argc > 1) ? std::atoi(argv[1]) : 1;
+  const int max_particles = (argc > 2) ? std::atoi(argv[2]) : 1000000;
+
+  InteractionOptions options;
+  options.num_threads = num_threads;
+  double all_pairs_seconds_per_pair = 0.0;
+  for (int n = 1000; n <= max_particles; n *= 10) {
+    const InteractingParticles system(n, options);
+    auto context = system.CreateDefaultContext();
+    auto derivatives = system.AllocateTimeDerivatives();
+    Eigen::VectorXd state = RandomState(n);
+    context->SetContinuousState(state);
+    // The first evaluation sizes the cell list.
+    system.CalcTimeDerivatives(*context, derivatives.get());
+
+    // About 10M particle evaluations per size.
+    const int num_evaluations = std::max(3, 10'000'000 / n);
+    int num_rebucketed = 0;
+    BenchmarkResult& cell_list = fixture.MeasureRepeated(
+        "cell list, " + std::to_string(n) + " particles, " +
+            std::to_string(num_threads) + " threads",
+        num_evaluations, n,
+        [&]() {
+          state.head(2 * n) += 1e-3 * state.tail(2 * n);
+          context->SetContinuousState(state);
+        },
+        [&]() {
+          system.CalcTimeDerivatives(*context, derivatives.get());
+          num_rebucketed +=
+              system.EvalCellList(*context).last_rebuild_rebucketed();
+        });
+    const double cell_list_seconds = cell_list.seconds / num_evaluations;
+    cell_list.values["rebucketed_evaluations"] = num_rebucketed;
+    std::cout << "  " << cell_list_seconds * 1e3
+              << " ms per evaluation, re-bucketed " << num_rebucketed
+              << " of " << num_evaluations << " times" << std::endl;
+
+    const double num_pairs = 0.5 * n * (n - 1.0);
+    double all_pairs_seconds = 0.0;
+    if (n <= kMaxAllPairs) {
+      Eigen::VectorXd forces;
+      const BenchmarkResult& all_pairs = fixture.Measure(
+          "all pairs, " + std::to_string(n) + " particles", n, [&]() {
+            forces = CalcInteractionForcesAllPairs(system, state.head(2 * n));
+          });
+      all_pairs_seconds = all_pairs.seconds;
+      all_pairs_seconds_per_pair = all_pairs_seconds / num_pairs;
+      std::cout << "  |F| = " << forces.norm() << std::endl;
+    } else {
+      all_pairs_seconds = all_pairs_seconds_per_pair * num_pairs;
+      std::cout << "  all pairs would take about " << all_pairs_seconds
+                << " s" << std::endl;
+    }
+    cell_list.values["speedup_over_all_pairs"] =
+        all_pairs_seconds / cell_list_seconds;
+    std::cout << "  cell list is " << all_pairs_seconds / cell_list_seconds
+              << "x faster than all pairs" << std::endl;
+  }
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace particles
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::particles::DoMain(argc, argv);
+}
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures how many times per second a worker can load a model found with
+/// FindResource into a finalized MultibodyPlant, as sweeps that build a plant
+/// per worker or per rollout do, for the pendulum and for a larger Drake
+/// example model, the simple gripper. Each model is loaded:
+///
+/// - by parsing it every time;
+/// - from a ModelCache in memory, which parsed it once; and
+/// - from a new ModelCache on a warm directory every time, as a new worker
+///   process would, which reads the serialized description instead of
+///   parsing.
+///
+/// Usage: model_cache_benchmark [--loads=<count>] [--model=<resource>]...
+///            [--json_output=<path>]
+///
+/// By default, each model is loaded 1000 times. Models given with --model,
+/// as paths to resources of Drake, replace the default ones.
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <drake/common/find_resource.h>
+#include <drake/multibody/parsing/parser.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "model_cache.h"
+
+namespace drake_external_examples {
+namespace model_cache {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+using drake::multibody::MultibodyPlant;
+
+void PrintRate(BenchmarkResult* result, double checksum) {
+  const double rate = result->num_operations / result->seconds;
+  result->values["loads_per_second"] = rate;
+  std::cout << "  " << rate << " loads/s (checksum " << checksum << ")"
+            << std::endl;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("model_cache_benchmark", &argc, argv);
+  int num_loads = 1'000;
+  std::vector<std::string> resources;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--loads=")) {
+      num_loads = std::stoi(std::string(arg.substr(8)));
+    } else if (arg.starts_with("--model=")) {
+      resources.emplace_back(arg.substr(8));
+    } else {
+      throw std::logic_error("Unknown argument " + std::string(arg));
+    }
+  }
+  if (num_loads < 1) {
+    throw std::logic_error("The number of loads must be positive");
+  }
+  if (resources.empty()) {
+    resources = {"drake/examples/pendulum/Pendulum.urdf",
+                 "drake/examples/simple_gripper/simple_gripper.sdf"};
+  }
+
+  const std::filesystem::path directory =
+      std::filesystem::temp_directory_path() /
+      ("model_cache_benchmark_" + std::to_string(getpid()));
+  for (const std::string& resource : resources) {
+    const std::string path = drake::FindResourceOrThrow(resource);
+    const std::string name =
+        std::filesystem::path(resource).filename().string();
+    // Each run adds up the number of positions of the plants it loads.
+    double checksum = 0.0;
+    BenchmarkResult& parsed =
+        fixture.Measure(name + ", parsed", num_loads, [&]() {
+          for (int i = 0; i < num_loads; ++i) {
+            MultibodyPlant<double> plant(0.0);
+            drake::multibody::Parser(&plant).AddModels(path);
+            plant.Finalize();
+            checksum += plant.num_positions();
+          }
+        });
+    PrintRate(&parsed, checksum);
+
+    ModelCache in_memory;
+    in_memory.Load(path);
+    checksum = 0.0;
+    BenchmarkResult& from_memory =
+        fixture.Measure(name + ", memory cache", num_loads, [&]() {
+          for (int i = 0; i < num_loads; ++i) {
+            checksum += in_memory.Load(path)->num_positions();
+          }
+        });
+    PrintRate(&from_memory, checksum);
+
+    ModelCache(directory.string()).Load(path);
+    checksum = 0.0;
+    BenchmarkResult& from_disk =
+        fixture.Measure(name + ", disk cache", num_loads, [&]() {
+          for (int i = 0; i < num_loads; ++i) {
+            ModelCache worker(directory.string());
+            checksum += worker.Load(path)->num_positions();
+          }
+        });
+    PrintRate(&from_disk, checksum);
+  }
+  std::filesystem::remove_all(directory);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace model_cache
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::model_cache::DoMain(argc, argv);
+}
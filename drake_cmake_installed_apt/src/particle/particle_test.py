@@ -1,5 +1,8 @@
 # SPDX-License-Identifier: MIT-0
 
+import os
+import subprocess
+import sys
 import unittest
 
 from particle import Particle
@@ -37,11 +40,11 @@ class TestParticle(unittest.TestCase):
     def test_derivatives(self):
         """
         Makes sure a Particle system state derivatives are consistent with its
-        state and input (velocity and acceleration).
+        state and input (velocity and force over unit mass).
         """
         # Set input.
         input_port = self.dut.get_input_port(0)
-        input_port.FixValue(self.context, 1.0)  # u0 = 1 m/s^2
+        input_port.FixValue(self.context, 1.0)  # u0 = 1 N
         # Set state.
         continuous_state_vector = \
             self.context.get_mutable_continuous_state_vector()
@@ -52,7 +55,40 @@ class TestParticle(unittest.TestCase):
         derivatives_vector = self.derivatives.get_vector()
         # Check results.
         self.assertEqual(derivatives_vector.GetAtIndex(0), 2.0)  # x0dot == x1
-        self.assertEqual(derivatives_vector.GetAtIndex(1), 1.0)  # x1dot == u0
+        self.assertEqual(derivatives_vector.GetAtIndex(1), 1.0)  # x1dot == u0 / m
+
+    def test_mass(self):
+        """
+        Makes sure a Particle system's acceleration is its input force divided
+        by its mass parameter.
+        """
+        self.assertEqual(self.dut.default_mass(), 1.0)
+        self.assertEqual(self.dut.get_mass(self.context), 1.0)
+        self.dut.set_mass(self.context, 4.0)
+        # Set input.
+        self.dut.get_input_port(0).FixValue(self.context, 2.0)  # u0 = 2 N
+        # Compute derivatives.
+        self.dut.CalcTimeDerivatives(self.context, self.derivatives)
+        # Check results.
+        derivatives_vector = self.derivatives.get_vector()
+        self.assertEqual(derivatives_vector.GetAtIndex(1), 0.5)  # u0 / m
+        # A new Particle's contexts start from its mass.
+        heavy = Particle(3.0)
+        self.assertEqual(heavy.default_mass(), 3.0)
+        self.assertEqual(heavy.get_mass(heavy.CreateDefaultContext()), 3.0)
+        with self.assertRaises(ValueError):
+            Particle(0.0)
+
+    def test_lazy_import(self):
+        """
+        Makes sure that importing the particle module alone does not import
+        pydrake.
+        """
+        env = dict(os.environ, PYTHONPATH=os.pathsep.join(sys.path))
+        subprocess.run([
+            sys.executable, "-c",
+            "import sys, particle; assert 'pydrake' not in sys.modules",
+        ], env=env, check=True)
 
 
 if __name__ == '__main__':
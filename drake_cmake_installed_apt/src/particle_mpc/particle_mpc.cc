@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "particle_mpc.h"
+
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include <drake/common/drake_throw.h>
+#include <drake/solvers/choose_best_solver.h>
+
+namespace drake_external_examples {
+namespace particles {
+
+using drake::solvers::MathematicalProgramResult;
+using drake::solvers::SolverId;
+using drake::solvers::SolverInterface;
+using drake::systems::Context;
+using drake::systems::DiscreteValues;
+using drake::systems::EventStatus;
+
+ParticleMpc::ParticleMpc(const MpcOptions& options) : options_(options) {
+  DRAKE_THROW_UNLESS(options.time_step > 0.0);
+  DRAKE_THROW_UNLESS(options.horizon > 0);
+  DRAKE_THROW_UNLESS(options.mass > 0.0);
+  DRAKE_THROW_UNLESS(options.max_force > 0.0);
+  DRAKE_THROW_UNLESS(options.position_weight > 0.0);
+  DRAKE_THROW_UNLESS(options.velocity_weight >= 0.0);
+  DRAKE_THROW_UNLESS(options.force_weight > 0.0);
+  const int n = options.horizon;
+  const double h = options.time_step;
+  // Created in the order of the plan, so that the program's decision
+  // variables are the plan.
+  x_ = prog_.NewContinuousVariables(2 * (n + 1), "x");
+  u_ = prog_.NewContinuousVariables(n, "u");
+  drake::solvers::VectorXDecisionVariable z(plan_size());
+  z << x_, u_;
+
+  // xₖ₊₁ = A xₖ + B uₖ, with the force held over the step.
+  Eigen::Matrix2d a;
+  a << 1.0, h, 0.0, 1.0;
+  const Eigen::Vector2d b(h * h / (2.0 * options.mass), h / options.mass);
+  Eigen::MatrixXd dynamics = Eigen::MatrixXd::Zero(2 * n, plan_size());
+  for (int k = 0; k < n; ++k) {
+    dynamics.block<2, 2>(2 * k, 2 * k) = a;
+    dynamics.block<2, 2>(2 * k, 2 * (k + 1)) = -Eigen::Matrix2d::Identity();
+    dynamics.block<2, 1>(2 * k, 2 * (n + 1) + k) = b;
+  }
+  prog_.AddLinearEqualityConstraint(dynamics, Eigen::VectorXd::Zero(2 * n), z);
+  initial_state_ = prog_.AddBoundingBoxConstraint(
+      Eigen::Vector2d::Zero(), Eigen::Vector2d::Zero(), x_.head(2));
+  prog_.AddBoundingBoxConstraint(
+      Eigen::VectorXd::Constant(n, -options.max_force),
+      Eigen::VectorXd::Constant(n, options.max_force), u_);
+
+  Eigen::VectorXd hessian_diagonal = Eigen::VectorXd::Zero(plan_size());
+  for (int k = 1; k <= n; ++k) {
+    hessian_diagonal[2 * k] = 2.0 * options.position_weight;
+    hessian_diagonal[2 * k + 1] = 2.0 * options.velocity_weight;
+  }
+  hessian_diagonal.tail(n).setConstant(2.0 * options.force_weight);
+  hessian_ = hessian_diagonal.asDiagonal();
+  cost_ = prog_.AddQuadraticCost(hessian_, Eigen::VectorXd::Zero(plan_size()),
+                                 0.0, z, /* is_convex = */ true);
+}
+
+ParticleMpc::~ParticleMpc() = default;
+
+MathematicalProgramResult ParticleMpc::Solve(
+    const SolverInterface& solver,
+    const Eigen::Ref<const Eigen::Vector2d>& state,
+    const Eigen::Ref<const Eigen::VectorXd>& reference,
+    const Eigen::VectorXd* initial_guess) {
+  const int n = options_.horizon;
+  if (reference.size() != n ||
+      (initial_guess != nullptr && initial_guess->size() != plan_size())) {
+    throw std::logic_error("ParticleMpc: wrong reference or guess size");
+  }
+  initial_state_.evaluator()->set_bounds(state, state);
+  // q_p (pₖ − rₖ)² = q_p pₖ² − 2 q_p rₖ pₖ + q_p rₖ².
+  Eigen::VectorXd linear = Eigen::VectorXd::Zero(plan_size());
+  for (int k = 1; k <= n; ++k) {
+    linear[2 * k] = -2.0 * options_.position_weight * reference[k - 1];
+  }
+  cost_.evaluator()->UpdateCoefficients(
+      hessian_, linear, options_.position_weight * reference.squaredNorm(),
+      /* is_hessian_psd = */ true);
+
+  MathematicalProgramResult result;
+  std::optional<Eigen::VectorXd> guess;
+  if (initial_guess != nullptr) {
+    guess = *initial_guess;
+  }
+  solver.Solve(prog_, guess, std::nullopt, &result);
+  return result;
+}
+
+double ParticleMpc::GetForce(const MathematicalProgramResult& result) const {
+  return result.GetSolution(u_[0]);
+}
+
+Eigen::VectorXd ParticleMpc::ShiftPlan(
+    const Eigen::Ref<const Eigen::VectorXd>& plan) const {
+  DRAKE_THROW_UNLESS(plan.size() == plan_size());
+  const int n = options_.horizon;
+  Eigen::VectorXd shifted(plan_size());
+  shifted.head(2 * n) = plan.segment(2, 2 * n);
+  shifted.segment<2>(2 * n) = plan.segment<2>(2 * n);
+  shifted.segment(2 * (n + 1), n - 1) = plan.tail(n - 1);
+  shifted[plan_size() - 1] = plan[plan_size() - 1];
+  return shifted;
+}
+
+ParticleMpcController::ParticleMpcController(const MpcOptions& options,
+                                             const SolverId& solver_id)
+    : mpc_(std::make_unique<ParticleMpc>(options)),
+      solver_(drake::solvers::MakeSolver(solver_id)) {
+  if (!solver_->available() || !solver_->enabled()) {
+    throw std::logic_error("ParticleMpcController: the solver " +
+                           solver_id.name() + " is not available");
+  }
+  DeclareVectorInputPort("state", 2);
+  DeclareVectorInputPort("reference", options.horizon);
+  const auto force_index = DeclareDiscreteState(1);
+  DeclareDiscreteState(Eigen::VectorXd::Constant(
+      mpc_->plan_size(), std::numeric_limits<double>::quiet_NaN()));
+  DeclareStateOutputPort("force", force_index);
+  DeclarePeriodicDiscreteUpdateEvent(options.time_step, 0.0,
+                                     &ParticleMpcController::Tick);
+}
+
+ParticleMpcController::~ParticleMpcController() = default;
+
+EventStatus ParticleMpcController::Tick(
+    const Context<double>& context, DiscreteValues<double>* next_state) const {
+  const Eigen::VectorXd guess =
+      mpc_->ShiftPlan(context.get_discrete_state(1).value());
+  std::lock_guard<std::mutex> lock(mpc_mutex_);
+  const MathematicalProgramResult result =
+      mpc_->Solve(*solver_, get_input_port(0).Eval(context),
+                  get_input_port(1).Eval(context), &guess);
+  if (!result.is_success()) {
+    return EventStatus::Failed(
+        this, "The MPC program failed: " +
+                  drake::solvers::to_string(result.get_solution_result()));
+  }
+  next_state->get_mutable_vector(0).SetAtIndex(0, mpc_->GetForce(result));
+  next_state->get_mutable_vector(1).SetFromVector(result.GetSolution());
+  return EventStatus::Succeeded();
+}
+
+}  // namespace particles
+}  // namespace drake_external_examples
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/common/eigen_types.h>
+#include <drake/solvers/mathematical_program.h>
+#include <drake/solvers/mathematical_program_result.h>
+#include <drake/solvers/solver_id.h>
+#include <drake/solvers/solver_interface.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/discrete_values.h>
+#include <drake/systems/framework/event_status.h>
+#include <drake/systems/framework/leaf_system.h>
+
+namespace drake_external_examples {
+namespace particles {
+
+/// Configures ParticleMpc.
+struct MpcOptions {
+  /// The period of the controller, and of the steps of its plans, in
+  /// @f$ s @f$ units.
+  double time_step{0.05};
+  /// The number of steps planned ahead.
+  int horizon{20};
+  /// The mass of the particle, in @f$ kg @f$ units.
+  double mass{1.0};
+  /// The weights of the squared position error, velocity and force in the
+  /// cost of each step.
+  double position_weight{10.0};
+  double velocity_weight{1.0};
+  double force_weight{0.1};
+  /// The largest force the controller may apply, in @f$ N @f$ units.
+  double max_force{5.0};
+};
+
+/// Model-predictive control of a `Particle` towards a reference position:
+/// each tick solves, from the particle's current state x̂, the sparse quadratic
+/// program over the horizon of N steps
+///
+///   min  Σₖ₌₁ᴺ q_p (pₖ − rₖ)² + q_v vₖ² + Σₖ₌₀ᴺ⁻¹ q_f uₖ²
+///   s.t. xₖ₊₁ = A xₖ + B uₖ,  x₀ = x̂,  |uₖ| ≤ u_max,
+///
+/// where xₖ = [pₖ, vₖ] and A, B are the exact discretization of the
+/// particle's dynamics over a step with the force held, and applies u₀.
+///
+/// The MathematicalProgram is built once. Each tick changes only the bounds
+/// that pin x₀ and the linear and constant terms of the cost that hold the
+/// reference, so that the program's structure (its variables, sparsity and
+/// bindings) is reused across ticks. The decision variables are the plan
+/// z = [x₀, ..., x_N, u₀, ..., u_N₋₁], in that order, and the solvers that
+/// accept an initial guess (e.g., OSQP) can be warm-started from the previous
+/// plan, shifted by a step with ShiftPlan().
+class ParticleMpc {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParticleMpc);
+
+  /// Builds the program.
+  /// @throws std::exception unless the time step, the horizon, the mass, the
+  ///   maximum force, and the position and force weights are positive, and
+  ///   the velocity weight is not negative.
+  explicit ParticleMpc(const MpcOptions& options);
+
+  ~ParticleMpc();
+
+  const MpcOptions& options() const { return options_; }
+  const drake::solvers::MathematicalProgram& prog() const { return prog_; }
+
+  /// Returns the size of a plan, 2 (N + 1) + N.
+  int plan_size() const { return 3 * options_.horizon + 2; }
+
+  /// Solves the program with @p solver, from @p state towards the reference
+  /// positions r₁, ..., r_N in @p reference, starting from @p initial_guess
+  /// if given (NaNs mean no guess for a variable). The result's GetSolution()
+  /// is the plan.
+  /// @throws std::exception if the sizes are wrong.
+  drake::solvers::MathematicalProgramResult Solve(
+      const drake::solvers::SolverInterface& solver,
+      const Eigen::Ref<const Eigen::Vector2d>& state,
+      const Eigen::Ref<const Eigen::VectorXd>& reference,
+      const Eigen::VectorXd* initial_guess = nullptr);
+
+  /// Returns the force to apply now, u₀, from the plan in @p result.
+  double GetForce(const drake::solvers::MathematicalProgramResult& result)
+      const;
+
+  /// Returns @p plan advanced by a step, as a guess for the next tick: each
+  /// state and force moves one step earlier, and the last ones are repeated.
+  Eigen::VectorXd ShiftPlan(const Eigen::Ref<const Eigen::VectorXd>& plan)
+      const;
+
+ private:
+  const MpcOptions options_;
+  drake::solvers::MathematicalProgram prog_;
+  drake::solvers::VectorXDecisionVariable x_;
+  drake::solvers::VectorXDecisionVariable u_;
+  drake::solvers::Binding<drake::solvers::BoundingBoxConstraint>
+      initial_state_;
+  drake::solvers::Binding<drake::solvers::QuadraticCost> cost_;
+  // The cost's Hessian, over the plan, which the reference does not change.
+  Eigen::MatrixXd hessian_;
+};
+
+/// A discrete-time controller system that runs a ParticleMpc every time
+/// step, warm-starting each solve from the previous tick's plan. It can be
+/// described in terms of its:
+///
+/// - Inputs:
+///   - the particle's state [position, velocity] (input index 0).
+///   - the reference positions r₁, ..., r_N for the next N steps (input
+///     index 1).
+/// - Outputs:
+///   - the force to apply (output index 0), held between ticks.
+/// - States:
+///   - the force (discrete state group 0).
+///   - the last plan (discrete state group 1), NaN before the first tick.
+///
+/// The program is shared by all contexts of the system, so ticks in
+/// concurrent simulations take turns; the plans, and so the warm starts, are
+/// kept in each context.
+///
+/// @tparam_double_only
+class ParticleMpcController final : public drake::systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParticleMpcController);
+
+  /// Creates a controller that solves with the solver @p solver_id.
+  /// @throws std::exception as ParticleMpc does, or if the solver is not
+  ///   available in this build of Drake.
+  ParticleMpcController(const MpcOptions& options,
+                        const drake::solvers::SolverId& solver_id);
+
+  ~ParticleMpcController() final;
+
+  const MpcOptions& options() const { return mpc_->options(); }
+  const drake::solvers::SolverInterface& solver() const { return *solver_; }
+
+ private:
+  drake::systems::EventStatus Tick(
+      const drake::systems::Context<double>& context,
+      drake::systems::DiscreteValues<double>* next_state) const;
+
+  const std::unique_ptr<ParticleMpc> mpc_;
+  const std::unique_ptr<drake::solvers::SolverInterface> solver_;
+  mutable std::mutex mpc_mutex_;
+};
+
+}  // namespace particles
+}  // namespace drake_external_examples
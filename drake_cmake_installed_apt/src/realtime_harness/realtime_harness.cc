@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Runs a chain of SimpleAdder stages as a periodic real-time control loop,
+/// the way a signal-processing stage would run inside a controller thread.
+///
+/// Everything that might allocate, lock, or fault in a page is done before the
+/// loop starts: the diagram, its context, and the fixed input are built and
+/// evaluated once; the heap is kept from shrinking; all memory is locked with
+/// mlockall(); and the stack is pre-faulted. The thread is then pinned to one
+/// core and, where permitted, given a SCHED_FIFO priority. Each tick sleeps
+/// until its absolute deadline with clock_nanosleep(), writes the input,
+/// evaluates the output, and records the latency from the deadline to the
+/// completion of the step.
+///
+/// After the run it prints the latency percentiles and the number of ticks
+/// that completed after the start of the next period, and fails if anything
+/// was allocated after warm-up. None of this needs a real-time kernel; on a
+/// stock kernel, expect larger tails, and note that without CAP_IPC_LOCK (or
+/// a sufficient `ulimit -l`) and CAP_SYS_NICE, memory locking and the
+/// real-time priority are skipped with a warning.
+///
+/// Usage: realtime_harness [--rate_hz=1000] [--duration_s=5] [--warmup=1000]
+///                         [--stages=1] [--cpu=<last>] [--priority=80]
+///
+/// Pass --cpu=-1 to skip pinning, and --priority=0 to skip SCHED_FIFO.
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <time.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <drake/common/drake_assert.h>
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/framework/fixed_input_port_value.h>
+
+#include "benchmark_harness/counting_allocator.h"
+#include "latency_histogram.h"
+#include "simple_bindings/simple_adder.h"
+
+namespace drake_external_examples {
+namespace realtime {
+namespace {
+
+constexpr int64_t kNanosecondsPerSecond = 1'000'000'000;
+constexpr double kAdd = 100.0;
+constexpr double kSignalHz = 10.0;
+
+struct Options {
+  double rate_hz{1000.0};
+  double duration_s{5.0};
+  int64_t warmup{1000};
+  int stages{1};
+  int cpu{-2};  // -2 means the last CPU; -1 means do not pin.
+  int priority{80};
+};
+
+Options ParseOptions(int argc, char* argv[]) {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    const std::size_t equals = arg.find('=');
+    const std::string_view name = arg.substr(0, equals);
+    const char* value =
+        (equals == std::string_view::npos) ? "" : argv[i] + equals + 1;
+    if (name == "--rate_hz") {
+      options.rate_hz = std::atof(value);
+    } else if (name == "--duration_s") {
+      options.duration_s = std::atof(value);
+    } else if (name == "--warmup") {
+      options.warmup = std::atoll(value);
+    } else if (name == "--stages") {
+      options.stages = std::atoi(value);
+    } else if (name == "--cpu") {
+      options.cpu = std::atoi(value);
+    } else if (name == "--priority") {
+      options.priority = std::atoi(value);
+    } else {
+      throw std::runtime_error("Unknown argument " + std::string(arg));
+    }
+  }
+  if (!(options.rate_hz > 0.0) || !(options.duration_s > 0.0) ||
+      options.warmup < 0 || options.stages < 1) {
+    throw std::runtime_error("Invalid arguments");
+  }
+  if (options.cpu == -2) {
+    options.cpu = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+  }
+  return options;
+}
+
+int64_t Now() {
+  timespec now{};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * kNanosecondsPerSecond + now.tv_nsec;
+}
+
+void SleepUntil(int64_t deadline) {
+  timespec when{};
+  when.tv_sec = deadline / kNanosecondsPerSecond;
+  when.tv_nsec = deadline % kNanosecondsPerSecond;
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &when, nullptr) ==
+         EINTR) {
+  }
+}
+
+void Warn(const std::string& what, int error) {
+  std::cerr << "warning: " << what << ": " << std::strerror(error)
+            << "; continuing without it" << std::endl;
+}
+
+// Touches enough stack that the loop never faults in a new stack page.
+void PrefaultStack() {
+  constexpr std::size_t kStackSize = 512 * 1024;
+  volatile unsigned char stack[kStackSize];
+  for (std::size_t i = 0; i < kStackSize; i += 4096) {
+    stack[i] = 0;
+  }
+  static_cast<void>(stack[0]);
+}
+
+void PrepareMemory() {
+#ifdef __GLIBC__
+  // Keep freed memory in the heap rather than returning it to the kernel, and
+  // never satisfy allocations with fresh mmap()s.
+  mallopt(M_TRIM_THRESHOLD, -1);
+  mallopt(M_MMAP_MAX, 0);
+#endif
+  if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+    Warn("mlockall", errno);
+  }
+  PrefaultStack();
+}
+
+void PrepareThread(const Options& options) {
+  if (options.cpu >= 0) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(options.cpu, &cpus);
+    const int error =
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    if (error != 0) {
+      Warn("pinning to CPU " + std::to_string(options.cpu), error);
+    }
+  }
+  if (options.priority > 0) {
+    sched_param param{};
+    param.sched_priority = options.priority;
+    const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (error != 0) {
+      Warn("SCHED_FIFO priority " + std::to_string(options.priority), error);
+    }
+  }
+}
+
+std::unique_ptr<drake::systems::Diagram<double>> MakeDiagram(int stages) {
+  drake::systems::DiagramBuilder<double> builder;
+  SimpleAdder<double>* previous = nullptr;
+  for (int i = 0; i < stages; ++i) {
+    auto* adder = builder.AddSystem<SimpleAdder<double>>(kAdd);
+    if (previous == nullptr) {
+      builder.ExportInput(adder->get_input_port(0), "u");
+    } else {
+      builder.Connect(previous->get_output_port(0), adder->get_input_port(0));
+    }
+    previous = adder;
+  }
+  builder.ExportOutput(previous->get_output_port(0), "y");
+  return builder.Build();
+}
+
+int DoMain(int argc, char* argv[]) {
+  const Options options = ParseOptions(argc, argv);
+  const int64_t period = std::llround(kNanosecondsPerSecond / options.rate_hz);
+  const int64_t num_ticks =
+      options.warmup + std::llround(options.duration_s * options.rate_hz);
+
+  // Everything that allocates happens here, before the loop.
+  const auto diagram = MakeDiagram(options.stages);
+  const auto context = diagram->CreateDefaultContext();
+  // Writes go through the FixedInputPortValue, each time, so that they
+  // invalidate the outputs that depend on it.
+  drake::systems::FixedInputPortValue& input =
+      diagram->get_input_port(0).FixValue(context.get(), drake::Vector1d(0.0));
+  const drake::systems::OutputPort<double>& output =
+      diagram->get_output_port(0);
+  output.Eval(*context);
+  LatencyHistogram histogram(10 * period, std::max<int64_t>(period / 1000, 1));
+  PrepareMemory();
+  PrepareThread(options);
+
+  int64_t allocations_at_warmup = 0;
+  int64_t num_misses = 0;
+  double max_error = 0.0;
+  const double expected_offset = kAdd * options.stages;
+  const double omega = 2.0 * std::numbers::pi * kSignalHz / options.rate_hz;
+  int64_t deadline = Now() + period;
+  for (int64_t tick = 0; tick < num_ticks; ++tick, deadline += period) {
+    if (tick == options.warmup) {
+      allocations_at_warmup = benchmarking::NumHeapAllocations();
+      histogram.Clear();
+      num_misses = 0;
+    }
+    SleepUntil(deadline);
+
+    // The real-time step: read a new sample and evaluate the signal chain.
+    const double u = std::sin(omega * static_cast<double>(tick));
+    input.GetMutableVectorData<double>()->SetAtIndex(0, u);
+    const double y = output.Eval(*context)[0];
+
+    const int64_t done = Now();
+    histogram.Record(done - deadline);
+    num_misses += (done > deadline + period) ? 1 : 0;
+    max_error = std::max(max_error, std::abs(y - (u + expected_offset)));
+  }
+  const int64_t allocations =
+      benchmarking::NumHeapAllocations() - allocations_at_warmup;
+
+  std::cout << "ticks: " << histogram.count() << " at " << options.rate_hz
+            << " Hz (" << options.stages << " stages)\n"
+            << "latency from deadline to step completion (us):\n"
+            << "  p50:   " << histogram.Percentile(0.5) * 1e-3 << "\n"
+            << "  p99:   " << histogram.Percentile(0.99) * 1e-3 << "\n"
+            << "  p99.9: " << histogram.Percentile(0.999) * 1e-3 << "\n"
+            << "  max:   " << histogram.max_ns() * 1e-3 << "\n"
+            << "deadline misses: " << num_misses << "\n"
+            << "allocations after warm-up: " << allocations << std::endl;
+  DRAKE_DEMAND(max_error < 1e-9);
+  if (allocations != 0) {
+    std::cerr << "error: the real-time loop allocated memory" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace realtime
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::realtime::DoMain(argc, argv);
+}
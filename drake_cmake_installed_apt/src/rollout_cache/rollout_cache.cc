@@ -0,0 +1,429 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "rollout_cache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <drake/common/nice_type_name.h>
+#include <drake/common/sha256.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/analysis/simulator_config_functions.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/framework_common.h>
+#include <drake/systems/framework/input_port.h>
+#include <drake/systems/framework/output_port.h>
+
+namespace drake_external_examples {
+namespace rollout_cache {
+
+using drake::systems::Context;
+using drake::systems::Diagram;
+using drake::systems::PortDataType;
+using drake::systems::Simulator;
+using drake::systems::System;
+
+namespace {
+
+constexpr char kMagic[8] = {'D', 'E', 'E', 'R', 'O', 'L', 'L', '1'};
+constexpr std::string_view kSuffix = ".rollout";
+
+// The start of a rollout file; see the table in rollout_cache.h.
+struct Header {
+  char magic[8];
+  uint64_t num_states;
+  uint64_t num_samples;
+};
+static_assert(sizeof(Header) == 24);
+
+[[noreturn]] void ThrowErrno(const std::string& what) {
+  throw std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+bool IsKey(std::string_view key) {
+  return key.size() == 64 &&
+         std::all_of(key.begin(), key.end(), [](char c) {
+           return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+         });
+}
+
+int64_t FileBytes(int64_t num_states, int64_t num_samples) {
+  return sizeof(Header) +
+         sizeof(double) * num_samples * (1 + num_states);
+}
+
+void ValidateSpec(const RolloutSpec& spec) {
+  if (!(spec.horizon > 0.0 && std::isfinite(spec.horizon)) ||
+      spec.num_samples < 1) {
+    throw std::logic_error(
+        "A rollout needs a positive, finite horizon and at least one sample");
+  }
+}
+
+const char* DataTypeName(PortDataType type) {
+  return type == PortDataType::kVectorValued ? "vector" : "abstract";
+}
+
+void AppendFingerprint(const System<double>& system, std::ostream* out) {
+  *out << "type " << drake::NiceTypeName::Get(system) << "\n"
+       << "continuous_states " << system.num_continuous_states() << "\n"
+       << "discrete_state_groups " << system.num_discrete_state_groups()
+       << "\n"
+       << "abstract_states " << system.num_abstract_states() << "\n"
+       << "numeric_parameter_groups " << system.num_numeric_parameter_groups()
+       << "\n"
+       << "abstract_parameters " << system.num_abstract_parameters() << "\n";
+  for (int i = 0; i < system.num_input_ports(); ++i) {
+    const auto& port = system.get_input_port(i);
+    *out << "input " << i << " " << DataTypeName(port.get_data_type()) << " "
+         << port.size() << "\n";
+  }
+  for (int i = 0; i < system.num_output_ports(); ++i) {
+    const auto& port = system.get_output_port(i);
+    *out << "output " << i << " " << DataTypeName(port.get_data_type()) << " "
+         << port.size() << "\n";
+  }
+  const auto* diagram = dynamic_cast<const Diagram<double>*>(&system);
+  if (diagram == nullptr) {
+    return;
+  }
+  // Subsystems are identified by their position, not by their names or
+  // addresses, which do not affect the dynamics.
+  const std::vector<const System<double>*> subsystems = diagram->GetSystems();
+  std::map<const System<double>*, int> positions;
+  for (int i = 0; i < static_cast<int>(subsystems.size()); ++i) {
+    positions[subsystems[i]] = i;
+    *out << "subsystem " << i << " {\n";
+    AppendFingerprint(*subsystems[i], out);
+    *out << "}\n";
+  }
+  for (const auto& [input, output] : diagram->connection_map()) {
+    *out << "connection " << positions.at(output.first) << "." << output.second
+         << " -> " << positions.at(input.first) << "." << input.second << "\n";
+  }
+}
+
+// Appends the name, the size, and the bit patterns of the values, so that
+// neither fields nor values can run together.
+void AppendValues(std::string_view name, const double* values, int64_t size,
+                  std::string* out) {
+  out->append(name);
+  out->append(" " + std::to_string(size) + ":");
+  out->append(reinterpret_cast<const char*>(values), sizeof(double) * size);
+  out->push_back('\n');
+}
+
+void AppendValue(std::string_view name, double value, std::string* out) {
+  AppendValues(name, &value, 1, out);
+}
+
+void AppendText(std::string_view name, std::string_view text,
+                std::string* out) {
+  out->append(name);
+  out->append(" " + std::to_string(text.size()) + ":");
+  out->append(text);
+  out->push_back('\n');
+}
+
+}  // namespace
+
+std::string FingerprintSystem(const System<double>& system) {
+  std::ostringstream out;
+  AppendFingerprint(system, &out);
+  return out.str();
+}
+
+std::string ComputeRolloutKey(const System<double>& system,
+                              const Context<double>& context,
+                              const RolloutSpec& spec,
+                              std::string_view system_version) {
+  system.ValidateContext(context);
+  ValidateSpec(spec);
+  if (context.num_abstract_states() > 0 ||
+      context.num_abstract_parameters() > 0) {
+    throw std::logic_error(
+        "Rollouts of systems with abstract state or parameters cannot be "
+        "keyed");
+  }
+
+  std::string blob;
+  AppendText("system", FingerprintSystem(system), &blob);
+  AppendText("version", system_version, &blob);
+  AppendValue("time", context.get_time(), &blob);
+  const Eigen::VectorXd continuous =
+      context.get_continuous_state_vector().CopyToVector();
+  AppendValues("continuous", continuous.data(), continuous.size(), &blob);
+  for (int i = 0; i < context.num_discrete_state_groups(); ++i) {
+    const auto& group = context.get_discrete_state(i).value();
+    AppendValues("discrete", group.data(), group.size(), &blob);
+  }
+  for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+    const auto& group = context.get_numeric_parameter(i).value();
+    AppendValues("parameter", group.data(), group.size(), &blob);
+  }
+  for (int i = 0; i < system.num_input_ports(); ++i) {
+    const auto& port = system.get_input_port(i);
+    if (port.get_data_type() != PortDataType::kVectorValued ||
+        context.MaybeGetFixedInputPortValue(i) == nullptr) {
+      throw std::logic_error("Input port " + port.get_name() +
+                             " must be fixed to a vector value to key a "
+                             "rollout");
+    }
+    const Eigen::VectorXd value = port.Eval(context);
+    AppendValues("input", value.data(), value.size(), &blob);
+  }
+
+  AppendValue("horizon", spec.horizon, &blob);
+  AppendText("samples", std::to_string(spec.num_samples), &blob);
+  const drake::systems::SimulatorConfig& config = spec.simulator_config;
+  AppendText("integrator", config.integrator, &blob);
+  AppendValue("max_step_size", config.max_step_size, &blob);
+  AppendValue("accuracy", config.accuracy, &blob);
+  AppendText("use_error_control", config.use_error_control ? "1" : "0",
+             &blob);
+  AppendText("publish_every_time_step",
+             config.publish_every_time_step ? "1" : "0", &blob);
+  return drake::Sha256::Checksum(blob).to_string();
+}
+
+RolloutSamples SimulateRollout(const System<double>& system,
+                               const Context<double>& context,
+                               const RolloutSpec& spec) {
+  ValidateSpec(spec);
+  Simulator<double> simulator(system, context.Clone());
+  drake::systems::ApplySimulatorConfig(spec.simulator_config, &simulator);
+  const Context<double>& simulated = simulator.get_context();
+  const double start_time = simulated.get_time();
+  RolloutSamples samples;
+  samples.times.resize(spec.num_samples);
+  samples.states.resize(simulated.num_continuous_states(), spec.num_samples);
+  simulator.Initialize();
+  for (int k = 0; k < spec.num_samples; ++k) {
+    const double time = start_time + spec.horizon * (k + 1) / spec.num_samples;
+    simulator.AdvanceTo(time);
+    samples.times[k] = time;
+    samples.states.col(k) =
+        simulated.get_continuous_state_vector().CopyToVector();
+  }
+  return samples;
+}
+
+RolloutCache::RolloutCache(std::string directory, int64_t max_bytes)
+    : directory_(std::move(directory)), max_bytes_(max_bytes) {
+  if (max_bytes <= 0) {
+    throw std::logic_error("The rollout cache size budget must be positive");
+  }
+  std::filesystem::create_directories(directory_);
+
+  // Index the rollouts already cached, most recently used first.
+  struct Found {
+    std::string key;
+    int64_t bytes;
+    int64_t used_ns;
+  };
+  std::vector<Found> found;
+  for (const auto& file : std::filesystem::directory_iterator(directory_)) {
+    const std::string name = file.path().filename().string();
+    if (!name.ends_with(kSuffix)) continue;
+    const std::string key = name.substr(0, name.size() - kSuffix.size());
+    struct stat status {};
+    if (!IsKey(key) || stat(file.path().c_str(), &status) != 0) continue;
+    found.push_back({key, static_cast<int64_t>(status.st_size),
+                     int64_t{status.st_mtim.tv_sec} * 1'000'000'000 +
+                         status.st_mtim.tv_nsec});
+  }
+  std::sort(found.begin(), found.end(), [](const Found& a, const Found& b) {
+    return a.used_ns > b.used_ns;
+  });
+  for (auto it = found.rbegin(); it != found.rend(); ++it) {
+    Remember(it->key, it->bytes);
+    last_use_ns_ = std::max(last_use_ns_, it->used_ns);
+  }
+  EvictBeyond(max_bytes_);
+}
+
+RolloutCache::~RolloutCache() = default;
+
+std::string RolloutCache::PathOf(const std::string& key) const {
+  return directory_ + "/" + key + std::string(kSuffix);
+}
+
+void RolloutCache::Touch(int fd) {
+  const auto now = std::chrono::system_clock::now().time_since_epoch();
+  const int64_t now_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+  last_use_ns_ = std::max(now_ns, last_use_ns_ + 1);
+  const timespec times[2] = {
+      {.tv_sec = 0, .tv_nsec = UTIME_OMIT},
+      {.tv_sec = last_use_ns_ / 1'000'000'000,
+       .tv_nsec = last_use_ns_ % 1'000'000'000}};
+  // Losing the time of a use only makes the rollout look older to caches
+  // opened later.
+  futimens(fd, times);
+}
+
+void RolloutCache::Remember(const std::string& key, int64_t bytes) {
+  Forget(key);
+  lru_.push_front({key, bytes});
+  index_[key] = lru_.begin();
+  num_bytes_ += bytes;
+}
+
+void RolloutCache::Forget(const std::string& key) {
+  const auto found = index_.find(key);
+  if (found == index_.end()) return;
+  num_bytes_ -= found->second->bytes;
+  lru_.erase(found->second);
+  index_.erase(found);
+}
+
+void RolloutCache::EvictBeyond(int64_t max_bytes) {
+  while (num_bytes_ > max_bytes && !lru_.empty()) {
+    const std::string key = lru_.back().key;
+    // Another cache may have removed it already.
+    unlink(PathOf(key).c_str());
+    Forget(key);
+    ++statistics_.evictions;
+  }
+}
+
+std::optional<RolloutSamples> RolloutCache::Find(const std::string& key) {
+  if (!IsKey(key)) {
+    throw std::logic_error("Not a rollout key: " + key);
+  }
+  const std::string path = PathOf(key);
+  const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    Forget(key);
+    ++statistics_.misses;
+    return std::nullopt;
+  }
+  struct stat status {};
+  std::optional<RolloutSamples> samples;
+  if (fstat(fd, &status) == 0 &&
+      status.st_size >= static_cast<off_t>(sizeof(Header))) {
+    const size_t size = static_cast<size_t>(status.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED) {
+      const auto* bytes = static_cast<const uint8_t*>(mapping);
+      Header header;
+      std::memcpy(&header, bytes, sizeof(header));
+      if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+          header.num_states <= (1u << 24) && header.num_samples <= (1u << 30) &&
+          FileBytes(header.num_states, header.num_samples) ==
+              static_cast<int64_t>(size)) {
+        const auto* values =
+            reinterpret_cast<const double*>(bytes + sizeof(Header));
+        const auto n = static_cast<Eigen::Index>(header.num_states);
+        const auto k = static_cast<Eigen::Index>(header.num_samples);
+        samples.emplace();
+        samples->times = Eigen::Map<const Eigen::VectorXd>(values, k);
+        samples->states =
+            Eigen::Map<const Eigen::MatrixXd>(values + k, n, k);
+      }
+      munmap(mapping, size);
+    }
+  }
+  if (!samples) {
+    close(fd);
+    unlink(path.c_str());
+    Forget(key);
+    ++statistics_.misses;
+    return std::nullopt;
+  }
+  Touch(fd);
+  close(fd);
+  Remember(key, status.st_size);
+  ++statistics_.hits;
+  return samples;
+}
+
+void RolloutCache::Insert(const std::string& key,
+                          const RolloutSamples& samples) {
+  if (!IsKey(key)) {
+    throw std::logic_error("Not a rollout key: " + key);
+  }
+  if (samples.times.size() != samples.states.cols()) {
+    throw std::logic_error("Each sample needs a time and a state");
+  }
+  const int64_t bytes = FileBytes(samples.states.rows(), samples.times.size());
+  if (bytes > max_bytes_) {
+    return;
+  }
+
+  const std::string path = PathOf(key);
+  const std::string temporary = path + ".tmp." + std::to_string(getpid()) +
+                                "." + std::to_string(num_temporaries_++);
+  const int fd = open(temporary.c_str(),
+                      O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    ThrowErrno("Could not create " + temporary);
+  }
+  Header header;
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.num_states = static_cast<uint64_t>(samples.states.rows());
+  header.num_samples = static_cast<uint64_t>(samples.times.size());
+  // Columns of the (column-major) states are samples.
+  const std::pair<const void*, size_t> parts[] = {
+      {&header, sizeof(header)},
+      {samples.times.data(), sizeof(double) * samples.times.size()},
+      {samples.states.data(), sizeof(double) * samples.states.size()}};
+  for (const auto& [data, size] : parts) {
+    const auto* remaining = static_cast<const uint8_t*>(data);
+    size_t left = size;
+    while (left > 0) {
+      const ssize_t count = write(fd, remaining, left);
+      if (count < 0) {
+        if (errno == EINTR) continue;
+        const int error = errno;
+        close(fd);
+        unlink(temporary.c_str());
+        errno = error;
+        ThrowErrno("Could not write " + temporary);
+      }
+      remaining += count;
+      left -= static_cast<size_t>(count);
+    }
+  }
+  Touch(fd);
+  if (close(fd) != 0 || rename(temporary.c_str(), path.c_str()) != 0) {
+    const int error = errno;
+    unlink(temporary.c_str());
+    errno = error;
+    ThrowErrno("Could not write " + path);
+  }
+  Remember(key, bytes);
+  ++statistics_.insertions;
+  EvictBeyond(max_bytes_);
+}
+
+RolloutSamples RolloutCache::Simulate(const System<double>& system,
+                                      const Context<double>& context,
+                                      const RolloutSpec& spec,
+                                      std::string_view system_version) {
+  const std::string key =
+      ComputeRolloutKey(system, context, spec, system_version);
+  if (std::optional<RolloutSamples> cached = Find(key)) {
+    return *std::move(cached);
+  }
+  RolloutSamples samples = SimulateRollout(system, context, spec);
+  Insert(key, samples);
+  return samples;
+}
+
+}  // namespace rollout_cache
+}  // namespace drake_external_examples
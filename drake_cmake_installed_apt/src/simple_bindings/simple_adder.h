@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/framework_common.h>
+#include <drake/systems/framework/leaf_system.h>
+#include <drake/systems/framework/system_type_tag.h>
+
+namespace drake_external_examples {
+
+/// Adds a constant to an input.
+///
+/// The constant is a numeric parameter (index 0), so that it may be changed
+/// per context and differentiated with respect to.
+template <typename T>
+class SimpleAdder : public drake::systems::LeafSystem<T> {
+ public:
+  explicit SimpleAdder(double add)
+      : drake::systems::LeafSystem<T>(
+            drake::systems::SystemTypeTag<SimpleAdder>{}),
+        default_add_(add) {
+    this->DeclareInputPort("in", drake::systems::kVectorValued, 1);
+    this->DeclareVectorOutputPort(
+        "out", drake::systems::BasicVector<T>(1), &SimpleAdder::CalcOutput);
+    this->DeclareNumericParameter(
+        drake::systems::BasicVector<T>(drake::Vector1<T>(add)));
+  }
+
+  /// Scalar-converting copy constructor.
+  template <typename U>
+  explicit SimpleAdder(const SimpleAdder<U>& other)
+      : SimpleAdder(other.default_add()) {}
+
+  /// Returns the constant that new contexts are initialized with.
+  double default_add() const { return default_add_; }
+
+ private:
+  void CalcOutput(const drake::systems::Context<T>& context,
+                  drake::systems::BasicVector<T>* output) const {
+    const auto& u = this->get_input_port(0).Eval(context);
+    const T& add = context.get_numeric_parameter(0).GetAtIndex(0);
+    auto&& y = output->get_mutable_value();
+    y.array() = u.array() + add;
+  }
+
+  const double default_add_{};
+};
+
+}  // namespace drake_external_examples
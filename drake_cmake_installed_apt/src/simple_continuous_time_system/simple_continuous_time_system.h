@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/framework/leaf_system.h>
+#include <drake/systems/framework/system_type_tag.h>
+
+namespace drake_external_examples {
+namespace systems {
+
+// Simple Continuous Time System
+//   xdot = -x + x³
+//   y = x
+//
+// Supports scalar conversion to AutoDiffXd and symbolic::Expression, so that
+// its derivatives can be differentiated.
+template <typename T>
+class SimpleContinuousTimeSystem : public drake::systems::LeafSystem<T> {
+ public:
+  SimpleContinuousTimeSystem()
+      : drake::systems::LeafSystem<T>(
+            drake::systems::SystemTypeTag<SimpleContinuousTimeSystem>{}) {
+    this->DeclareVectorOutputPort("y", drake::systems::BasicVector<T>(1),
+                                  &SimpleContinuousTimeSystem::CopyStateOut);
+    this->DeclareContinuousState(1);  // One state variable.
+  }
+
+  // Scalar-converting copy constructor.
+  template <typename U>
+  explicit SimpleContinuousTimeSystem(const SimpleContinuousTimeSystem<U>&)
+      : SimpleContinuousTimeSystem() {}
+
+ private:
+  // xdot = -x + x³
+  void DoCalcTimeDerivatives(
+      const drake::systems::Context<T>& context,
+      drake::systems::ContinuousState<T>* derivatives) const override {
+    const T& x = context.get_continuous_state()[0];
+    const T xdot = -x + x * x * x;
+    (*derivatives)[0] = xdot;
+  }
+
+  // y = x
+  void CopyStateOut(const drake::systems::Context<T>& context,
+                    drake::systems::BasicVector<T>* output) const {
+    const T& x = context.get_continuous_state()[0];
+    (*output)[0] = x;
+  }
+};
+
+}  // namespace systems
+}  // namespace drake_external_examples
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/primitives/constant_vector_source.h>
+
+#include "particle/particle.h"
+#include "rollout_protocol.h"
+#include "simple_bindings/simple_adder.h"
+
+namespace drake_external_examples {
+namespace simulation_server {
+
+/// The prebuilt diagram of one Model, with a pool of warm simulators, each
+/// with its own context, that rollouts reuse instead of creating their own.
+///
+/// Run() is thread-safe: the diagram is shared, read-only, by all threads,
+/// and each rollout takes a simulator from the pool (creating one if the pool
+/// is empty) and returns it when done. The pool thus grows to the largest
+/// number of concurrent rollouts, and no further.
+class RolloutModel {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RolloutModel);
+
+  /// Called with the time and the state of each sample of a rollout.
+  using SampleCallback = std::function<void(
+      double time, const Eigen::Ref<const Eigen::VectorXd>& state)>;
+
+  /// Builds the diagram of @p model, and @p num_warm_simulators simulators
+  /// for it.
+  /// @throws std::logic_error if @p model is unknown, or
+  ///   @p num_warm_simulators is negative.
+  explicit RolloutModel(Model model, int num_warm_simulators = 1);
+
+  ~RolloutModel();
+
+  Model model() const { return model_; }
+  int num_states() const { return num_states_; }
+  int num_parameters() const { return num_parameters_; }
+
+  /// Returns the number of simulators in the pool, i.e., not in use.
+  int num_idle_simulators() const;
+
+  /// Runs @p request, calling @p on_sample with each sample in order.
+  /// @throws std::logic_error if @p request is for another model, has the
+  ///   wrong state or parameter size, a horizon that is not positive and
+  ///   finite, fewer than one sample, or invalid parameters (e.g., a mass
+  ///   that is not positive).
+  /// @throws std::exception if the simulation fails, or @p on_sample throws.
+  void Run(const RolloutRequest& request,
+           const SampleCallback& on_sample) const;
+
+ private:
+  struct WarmSimulator;
+
+  std::unique_ptr<WarmSimulator> MakeWarmSimulator() const;
+  void SetParameters(const Eigen::VectorXd& parameters,
+                     drake::systems::Context<double>* context) const;
+
+  const Model model_;
+  int num_states_{};
+  int num_parameters_{};
+  std::unique_ptr<const drake::systems::Diagram<double>> diagram_;
+  // The subsystems that hold the parameters of kAdderParticle.
+  const drake::systems::ConstantVectorSource<double>* source_{};
+  const SimpleAdder<double>* adder_{};
+  const particles::Particle<double>* particle_{};
+
+  mutable std::mutex mutex_;
+  // Guarded by mutex_.
+  mutable std::vector<std::unique_ptr<WarmSimulator>> idle_;
+};
+
+}  // namespace simulation_server
+}  // namespace drake_external_examples
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace drake_external_examples {
+namespace simulation_server {
+
+/// The prebuilt diagrams that a SimulationServer runs rollouts of.
+enum class Model : uint32_t {
+  /// The Simple Continuous Time System, xdot = -x + x³: one state, and no
+  /// parameters.
+  kSimpleContinuousTimeSystem = 1,
+  /// A constant source u feeding a SimpleAdder (adding c) feeding a Particle
+  /// of mass m: the state [position, velocity], and the parameters [u, c, m].
+  kAdderParticle = 2,
+};
+
+/// A rollout for a SimulationServer to run: simulate @p model from
+/// @p initial_state at time zero, with @p parameters, until @p horizon, and
+/// report the state at @p num_samples times spaced evenly over
+/// (0, @p horizon].
+struct RolloutRequest {
+  Model model{Model::kSimpleContinuousTimeSystem};
+  Eigen::VectorXd initial_state{};
+  Eigen::VectorXd parameters{};
+  double horizon{};
+  int num_samples{1};
+};
+
+/// The samples of a rollout: `states.col(k)` is the state at `times[k]`.
+struct RolloutResult {
+  Eigen::VectorXd times;
+  Eigen::MatrixXd states;
+};
+
+/// The wire format between SimulationClient and SimulationServer, over a
+/// connected Unix domain stream socket. Both ends run on one host, so values
+/// are in native byte order. A client sends requests, each of which the
+/// server answers, in order, before reading the next; either end may close
+/// the connection between rollouts.
+///
+/// A request is:
+///
+/// | offset         | contents                                   |
+/// |----------------|--------------------------------------------|
+/// | 0              | uint32 magic number 0x44525251             |
+/// | 4              | uint32 Model                               |
+/// | 8              | uint32 state size n                        |
+/// | 12             | uint32 parameter count p                   |
+/// | 16             | uint32 number of samples k                 |
+/// | 20             | uint32 zero                                |
+/// | 24             | double horizon                             |
+/// | 32             | double initial_state[n]                    |
+/// | 32 + 8n        | double parameters[p]                       |
+///
+/// The answer is a stream of records, each a uint32 RecordKind and the uint32
+/// size in bytes of the payload that follows:
+///
+/// - kSample: the time and the state, 8(n + 1) bytes, k times, as the server
+///   computes them;
+/// - kDone: no payload, once all samples were sent; or instead, at any point,
+/// - kError: a message, in UTF-8. After an invalid request (e.g., the wrong
+///   state size for the model) or a failed simulation, the connection remains
+///   usable; after a malformed one (e.g., a wrong magic number), the server
+///   closes it.
+namespace protocol {
+
+inline constexpr uint32_t kRequestMagic = 0x44525251;
+
+/// Requests with longer vectors, or more samples, than these are malformed.
+inline constexpr uint32_t kMaxVectorSize = 1 << 16;
+inline constexpr uint32_t kMaxSamples = 1 << 24;
+
+struct RequestHeader {
+  uint32_t magic;
+  uint32_t model;
+  uint32_t state_size;
+  uint32_t parameter_count;
+  uint32_t num_samples;
+  uint32_t zero;
+  double horizon;
+};
+static_assert(sizeof(RequestHeader) == 32);
+
+enum class RecordKind : uint32_t { kSample = 1, kDone = 2, kError = 3 };
+
+struct RecordHeader {
+  RecordKind kind;
+  uint32_t size;
+};
+static_assert(sizeof(RecordHeader) == 8);
+
+/// Writes all @p size bytes at @p data to the socket @p fd, retrying after
+/// interruptions and partial writes.
+/// @throws std::runtime_error if the write fails, e.g., because the peer
+///   closed the connection.
+void WriteAll(int fd, const void* data, size_t size);
+
+/// Reads exactly @p size bytes from the socket @p fd into @p data. Returns
+/// false if the peer closed the connection before sending any of them.
+/// @throws std::runtime_error if the read fails, or the peer closed the
+///   connection partway through.
+bool ReadAll(int fd, void* data, size_t size);
+
+/// Appends @p request, encoded, to @p buffer.
+void AppendRequest(const RolloutRequest& request, std::vector<uint8_t>* buffer);
+
+/// Appends a record of @p kind with the @p size bytes at @p payload to
+/// @p buffer.
+void AppendRecord(RecordKind kind, const void* payload, size_t size,
+                  std::vector<uint8_t>* buffer);
+
+}  // namespace protocol
+}  // namespace simulation_server
+}  // namespace drake_external_examples
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "simulation_client.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace drake_external_examples {
+namespace simulation_server {
+
+using protocol::RecordHeader;
+using protocol::RecordKind;
+
+std::unique_ptr<SimulationClient> SimulationClient::Connect(
+    const std::string& socket_path) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socket_path.empty() || socket_path.size() >= sizeof(address.sun_path)) {
+    throw std::logic_error("The socket path must have between 1 and " +
+                           std::to_string(sizeof(address.sun_path) - 1) +
+                           " characters");
+  }
+  std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size());
+  const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    throw std::runtime_error(
+        std::string("Could not create a simulation client socket: ") +
+        std::strerror(errno));
+  }
+  if (connect(fd, reinterpret_cast<const sockaddr*>(&address),
+              sizeof(address)) != 0) {
+    const int error = errno;
+    close(fd);
+    throw std::runtime_error("Could not connect to the simulation server at " +
+                             socket_path + ": " + std::strerror(error));
+  }
+  return std::make_unique<SimulationClient>(fd);
+}
+
+SimulationClient::SimulationClient(int fd) : fd_(fd) {}
+
+SimulationClient::~SimulationClient() { close(fd_); }
+
+void SimulationClient::Run(const RolloutRequest& request,
+                           const SampleCallback& on_sample) {
+  if (request.num_samples < 1) {
+    throw std::logic_error("A rollout needs at least one sample");
+  }
+  buffer_.clear();
+  protocol::AppendRequest(request, &buffer_);
+  protocol::WriteAll(fd_, buffer_.data(), buffer_.size());
+
+  const auto receive = [this](void* data, size_t size) {
+    if (!protocol::ReadAll(fd_, data, size)) {
+      throw std::runtime_error(
+          "The simulation server closed the connection before answering");
+    }
+  };
+  for (;;) {
+    RecordHeader record{};
+    receive(&record, sizeof(record));
+    switch (record.kind) {
+      case RecordKind::kSample: {
+        if (record.size < sizeof(double) || record.size % sizeof(double) != 0) {
+          throw std::runtime_error("Malformed simulation server sample");
+        }
+        double time{};
+        receive(&time, sizeof(time));
+        state_.resize(record.size / sizeof(double) - 1);
+        receive(state_.data(), record.size - sizeof(time));
+        on_sample(time, state_);
+        break;
+      }
+      case RecordKind::kDone:
+        return;
+      case RecordKind::kError: {
+        std::string message(record.size, '\0');
+        receive(message.data(), message.size());
+        throw std::runtime_error(message);
+      }
+      default:
+        throw std::runtime_error("Malformed simulation server answer");
+    }
+  }
+}
+
+RolloutResult SimulationClient::Run(const RolloutRequest& request) {
+  RolloutResult result;
+  result.times.resize(request.num_samples);
+  result.states.resize(request.initial_state.size(), request.num_samples);
+  int k = 0;
+  Run(request, [&result, &k](double time,
+                             const Eigen::Ref<const Eigen::VectorXd>& state) {
+    if (k == result.times.size() || state.size() != result.states.rows()) {
+      throw std::runtime_error("Unexpected simulation server sample");
+    }
+    result.times[k] = time;
+    result.states.col(k) = state;
+    ++k;
+  });
+  if (k != result.times.size()) {
+    throw std::runtime_error("Missing simulation server samples");
+  }
+  return result;
+}
+
+}  // namespace simulation_server
+}  // namespace drake_external_examples
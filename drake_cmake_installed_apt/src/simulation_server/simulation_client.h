@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <drake/common/drake_copyable.h>
+
+#include "rollout_protocol.h"
+
+namespace drake_external_examples {
+namespace simulation_server {
+
+/// A connection to a SimulationServer, over which rollouts run one at a
+/// time. To run rollouts concurrently, use a client per thread.
+///
+/// Linux only.
+class SimulationClient {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SimulationClient);
+
+  /// Called with the time and the state of each sample of a rollout, as it
+  /// arrives.
+  using SampleCallback = std::function<void(
+      double time, const Eigen::Ref<const Eigen::VectorXd>& state)>;
+
+  /// Connects to the server listening on the Unix domain socket at
+  /// @p socket_path.
+  /// @throws std::logic_error if @p socket_path is too long.
+  /// @throws std::runtime_error if the server cannot be reached.
+  static std::unique_ptr<SimulationClient> Connect(
+      const std::string& socket_path);
+
+  /// Takes ownership of @p fd, a Unix domain stream socket already connected
+  /// to a server (e.g., a `simulation_server --fd` process).
+  explicit SimulationClient(int fd);
+
+  /// Closes the connection.
+  ~SimulationClient();
+
+  /// Runs @p request on the server, calling @p on_sample with each sample as
+  /// it arrives.
+  /// @throws std::logic_error if @p request has fewer than one sample.
+  /// @throws std::runtime_error with the server's message if it rejects the
+  ///   request or the simulation fails, after which the client remains
+  ///   usable; or if the connection fails, after which it does not. Neither
+  ///   is it if @p on_sample throws, which leaves the rest of the answer
+  ///   unread.
+  void Run(const RolloutRequest& request, const SampleCallback& on_sample);
+
+  /// Runs @p request on the server, and returns all of its samples.
+  /// @throws std::exception as the other overload does.
+  RolloutResult Run(const RolloutRequest& request);
+
+ private:
+  int fd_{-1};
+  std::vector<uint8_t> buffer_;
+  Eigen::VectorXd state_;
+};
+
+}  // namespace simulation_server
+}  // namespace drake_external_examples
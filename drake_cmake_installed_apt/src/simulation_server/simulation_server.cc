@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "simulation_server.h"
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace drake_external_examples {
+namespace simulation_server {
+namespace {
+
+using protocol::RecordKind;
+
+// Answers are sent whenever this much of them has been buffered.
+constexpr size_t kFlushBytes = 64 * 1024;
+
+[[noreturn]] void ThrowErrno(const std::string& what) {
+  throw std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+void AppendError(const std::string& message, std::vector<uint8_t>* buffer) {
+  protocol::AppendRecord(RecordKind::kError, message.data(), message.size(),
+                         buffer);
+}
+
+}  // namespace
+
+void ServeConnection(int fd, const ModelFinder& find_model) {
+  RolloutRequest request;
+  std::vector<uint8_t> buffer;
+  for (;;) {
+    protocol::RequestHeader header{};
+    if (!protocol::ReadAll(fd, &header, sizeof(header))) {
+      return;
+    }
+    buffer.clear();
+    if (header.magic != protocol::kRequestMagic || header.zero != 0 ||
+        header.state_size > protocol::kMaxVectorSize ||
+        header.parameter_count > protocol::kMaxVectorSize ||
+        header.num_samples > protocol::kMaxSamples) {
+      AppendError("Malformed rollout request", &buffer);
+      protocol::WriteAll(fd, buffer.data(), buffer.size());
+      return;
+    }
+    request.model = static_cast<Model>(header.model);
+    request.initial_state.resize(header.state_size);
+    request.parameters.resize(header.parameter_count);
+    request.horizon = header.horizon;
+    request.num_samples = static_cast<int>(header.num_samples);
+    for (Eigen::VectorXd* vector :
+         {&request.initial_state, &request.parameters}) {
+      if (vector->size() > 0 &&
+          !protocol::ReadAll(fd, vector->data(),
+                             sizeof(double) * vector->size())) {
+        throw std::runtime_error(
+            "The simulation client closed the connection partway through a "
+            "request");
+      }
+    }
+
+    // Failures to send are the connection's, not the rollout's.
+    bool send_failed = false;
+    const auto flush = [&]() {
+      try {
+        protocol::WriteAll(fd, buffer.data(), buffer.size());
+      } catch (...) {
+        send_failed = true;
+        throw;
+      }
+      buffer.clear();
+    };
+    try {
+      const RolloutModel& model = find_model(request.model);
+      const size_t payload_size = sizeof(double) * (model.num_states() + 1);
+      model.Run(request, [&](double time,
+                             const Eigen::Ref<const Eigen::VectorXd>& state) {
+        const protocol::RecordHeader record{.kind = RecordKind::kSample,
+                                            .size = static_cast<uint32_t>(
+                                                payload_size)};
+        const size_t offset = buffer.size();
+        buffer.resize(offset + sizeof(record) + payload_size);
+        uint8_t* out = buffer.data() + offset;
+        std::memcpy(out, &record, sizeof(record));
+        std::memcpy(out + sizeof(record), &time, sizeof(time));
+        std::memcpy(out + sizeof(record) + sizeof(time), state.data(),
+                    payload_size - sizeof(time));
+        if (buffer.size() >= kFlushBytes) {
+          flush();
+        }
+      });
+      protocol::AppendRecord(RecordKind::kDone, nullptr, 0, &buffer);
+    } catch (const std::exception& e) {
+      if (send_failed) throw;
+      AppendError(e.what(), &buffer);
+    }
+    flush();
+  }
+}
+
+SimulationServer::SimulationServer(std::string socket_path,
+                                   int num_warm_simulators)
+    : socket_path_(std::move(socket_path)) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socket_path_.empty() ||
+      socket_path_.size() >= sizeof(address.sun_path)) {
+    throw std::logic_error("The socket path must have between 1 and " +
+                           std::to_string(sizeof(address.sun_path) - 1) +
+                           " characters");
+  }
+  std::memcpy(address.sun_path, socket_path_.c_str(), socket_path_.size());
+
+  for (const Model model :
+       {Model::kSimpleContinuousTimeSystem, Model::kAdderParticle}) {
+    models_[model] = std::make_unique<RolloutModel>(model, num_warm_simulators);
+  }
+
+  listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (listen_fd_ < 0) {
+    ThrowErrno("Could not create the simulation server socket");
+  }
+  // A socket left behind by a server that did not exit cleanly would make
+  // bind() fail.
+  unlink(socket_path_.c_str());
+  if (bind(listen_fd_, reinterpret_cast<const sockaddr*>(&address),
+           sizeof(address)) != 0 ||
+      listen(listen_fd_, SOMAXCONN) != 0) {
+    const int error = errno;
+    close(listen_fd_);
+    errno = error;
+    ThrowErrno("Could not listen on " + socket_path_);
+  }
+  stop_fd_ = eventfd(0, EFD_CLOEXEC);
+  if (stop_fd_ < 0) {
+    const int error = errno;
+    close(listen_fd_);
+    unlink(socket_path_.c_str());
+    errno = error;
+    ThrowErrno("Could not create the simulation server stop event");
+  }
+}
+
+SimulationServer::~SimulationServer() {
+  CloseAllConnections();
+  close(listen_fd_);
+  close(stop_fd_);
+  unlink(socket_path_.c_str());
+}
+
+const RolloutModel& SimulationServer::get_model(Model model) const {
+  const auto found = models_.find(model);
+  if (found == models_.end()) {
+    throw std::logic_error("Unknown simulation server model " +
+                           std::to_string(static_cast<uint32_t>(model)));
+  }
+  return *found->second;
+}
+
+void SimulationServer::Serve() {
+  for (;;) {
+    pollfd fds[2] = {{listen_fd_, POLLIN, 0}, {stop_fd_, POLLIN, 0}};
+    if (poll(fds, 2, /* timeout = */ -1) < 0) {
+      if (errno == EINTR) continue;
+      ThrowErrno("Could not wait for simulation clients");
+    }
+    if (fds[1].revents != 0) {
+      break;
+    }
+    if (fds[0].revents == 0) {
+      continue;
+    }
+    const int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd < 0) {
+      // The client may have given up before it was accepted.
+      if (errno == EINTR || errno == ECONNABORTED || errno == EAGAIN) {
+        continue;
+      }
+      ThrowErrno("Could not accept a simulation client");
+    }
+    CloseFinishedConnections();
+    Connection& connection = connections_.emplace_back();
+    connection.fd = fd;
+    connection.thread = std::thread([this, &connection]() {
+      try {
+        ServeConnection(connection.fd,
+                        [this](Model model) -> const RolloutModel& {
+                          return get_model(model);
+                        });
+      } catch (const std::exception& e) {
+        std::cerr << "simulation_server: " << e.what() << std::endl;
+      }
+      connection.done.store(true, std::memory_order_release);
+    });
+  }
+  CloseAllConnections();
+}
+
+void SimulationServer::Stop() {
+  // Only write() is used, so that this is async-signal-safe.
+  const uint64_t one = 1;
+  while (write(stop_fd_, &one, sizeof(one)) < 0 && errno == EINTR) {
+  }
+}
+
+void SimulationServer::CloseFinishedConnections() {
+  for (auto it = connections_.begin(); it != connections_.end();) {
+    if (it->done.load(std::memory_order_acquire)) {
+      it->thread.join();
+      close(it->fd);
+      it = connections_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void SimulationServer::CloseAllConnections() {
+  // Shutting the sockets down wakes their threads from blocking reads and
+  // makes their writes fail; the file descriptors stay valid until joined.
+  for (Connection& connection : connections_) {
+    shutdown(connection.fd, SHUT_RDWR);
+  }
+  for (Connection& connection : connections_) {
+    connection.thread.join();
+    close(connection.fd);
+  }
+  connections_.clear();
+}
+
+}  // namespace simulation_server
+}  // namespace drake_external_examples
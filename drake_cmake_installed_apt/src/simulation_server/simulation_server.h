@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <drake/common/drake_copyable.h>
+
+#include "rollout_model.h"
+#include "rollout_protocol.h"
+
+namespace drake_external_examples {
+namespace simulation_server {
+
+/// Returns the RolloutModel to run a request for a Model with, or throws
+/// std::logic_error if there is none.
+using ModelFinder = std::function<const RolloutModel&(Model)>;
+
+/// Answers the rollout requests that arrive on the connected socket @p fd
+/// (see protocol), running them on the models that @p find_model returns,
+/// until the peer closes the connection or sends a malformed request. Samples
+/// are sent as they are computed, in batches of up to 64 KiB. Does not close
+/// @p fd.
+/// @throws std::runtime_error if the connection fails.
+void ServeConnection(int fd, const ModelFinder& find_model);
+
+/// A long-lived local simulation server, which keeps the diagrams of every
+/// Model built and pools of warm simulators for them, so that each rollout
+/// pays for neither process startup, nor loading Drake, nor building a
+/// diagram and its context. Clients (see SimulationClient) connect to it over
+/// a Unix domain socket, and each connection is served on its own thread.
+///
+/// Linux only.
+class SimulationServer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SimulationServer);
+
+  /// Builds every model with @p num_warm_simulators simulators each, and
+  /// listens on a Unix domain socket at @p socket_path, replacing any socket
+  /// already there. Connections are accepted once Serve() is called.
+  /// @throws std::logic_error if @p socket_path is empty or too long for a
+  ///   socket address.
+  /// @throws std::runtime_error if the socket cannot be created.
+  explicit SimulationServer(std::string socket_path,
+                            int num_warm_simulators = 1);
+
+  /// Stops serving, waits for the connections' threads, and removes the
+  /// socket.
+  ~SimulationServer();
+
+  const std::string& socket_path() const { return socket_path_; }
+
+  /// Returns the prebuilt model for @p model.
+  /// @throws std::logic_error if @p model is unknown.
+  const RolloutModel& get_model(Model model) const;
+
+  /// Accepts and serves connections until Stop() is called, then closes them
+  /// (so that rollouts in flight fail to send their samples), and returns once
+  /// their threads have finished.
+  /// @throws std::runtime_error if accepting connections fails.
+  void Serve();
+
+  /// Makes Serve() return, or return at once if it has not been called yet.
+  /// May be called from any thread, and from a signal handler.
+  void Stop();
+
+ private:
+  struct Connection {
+    int fd{-1};
+    std::thread thread;
+    std::atomic<bool> done{false};
+  };
+
+  void CloseFinishedConnections();
+  void CloseAllConnections();
+
+  const std::string socket_path_;
+  std::map<Model, std::unique_ptr<const RolloutModel>> models_;
+  int listen_fd_{-1};
+  int stop_fd_{-1};
+  // Only touched by the thread running Serve().
+  std::list<Connection> connections_;
+};
+
+}  // namespace simulation_server
+}  // namespace drake_external_examples
@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "simulation_server.h"  // IWYU pragma: associated
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/common/eigen_types.h>
+#include <drake/common/temp_directory.h>
+
+#include "simulation_client.h"
+
+namespace drake_external_examples {
+namespace simulation_server {
+namespace {
+
+// The closed form of xdot = -x + x³ from x(0) = x0.
+double SimpleContinuousTimeSystemState(double x0, double t) {
+  return x0 * std::exp(-t) /
+         std::sqrt(x0 * x0 * std::exp(-2.0 * t) + 1.0 - x0 * x0);
+}
+
+RolloutRequest MakeAdderParticleRequest(double x0, double v0, double u,
+                                        double c, double mass) {
+  return RolloutRequest{.model = Model::kAdderParticle,
+                        .initial_state = Eigen::Vector2d(x0, v0),
+                        .parameters = Eigen::Vector3d(u, c, mass),
+                        .horizon = 2.0,
+                        .num_samples = 8};
+}
+
+// Expects @p result to follow x = x0 + v0 t + a t² / 2, v = v0 + a t, which
+// the integrator follows exactly, with a = (u + c) / mass.
+void ExpectAdderParticleResult(const RolloutRequest& request,
+                               const RolloutResult& result) {
+  const double x0 = request.initial_state[0];
+  const double v0 = request.initial_state[1];
+  const double a = (request.parameters[0] + request.parameters[1]) /
+                   request.parameters[2];
+  ASSERT_EQ(result.states.rows(), 2);
+  ASSERT_EQ(result.states.cols(), request.num_samples);
+  for (int k = 0; k < request.num_samples; ++k) {
+    const double t = result.times[k];
+    EXPECT_NEAR(t, request.horizon * (k + 1) / request.num_samples, 1e-15);
+    EXPECT_NEAR(result.states(0, k), x0 + v0 * t + 0.5 * a * t * t, 1e-9);
+    EXPECT_NEAR(result.states(1, k), v0 + a * t, 1e-9);
+  }
+}
+
+// Runs a SimulationServer on a socket in a new temporary directory, on a
+// thread of its own, for the duration of a test.
+class SimulationServerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    server_ = std::make_unique<SimulationServer>(
+        (directory_ / "socket").string(), /* num_warm_simulators = */ 2);
+    serving_ = std::thread([this]() { server_->Serve(); });
+  }
+
+  void TearDown() override {
+    if (server_ != nullptr) {
+      server_->Stop();
+      serving_.join();
+      server_.reset();
+    }
+  }
+
+  std::unique_ptr<SimulationClient> Connect() {
+    return SimulationClient::Connect(server_->socket_path());
+  }
+
+  const std::filesystem::path directory_{drake::temp_directory()};
+  std::unique_ptr<SimulationServer> server_;
+  std::thread serving_;
+};
+
+/// Makes sure rollouts of each model, sent over the socket, come back with
+/// their samples in order, matching the closed forms; and that the warm
+/// simulators are reused instead of new ones being built.
+TEST_F(SimulationServerTest, RoundTripsMatchClosedForms) {
+  auto client = Connect();
+  for (const double x0 : {0.9, -0.5, 0.1}) {
+    const RolloutResult result =
+        client->Run({.model = Model::kSimpleContinuousTimeSystem,
+                     .initial_state = drake::Vector1d(x0),
+                     .horizon = 5.0,
+                     .num_samples = 10});
+    ASSERT_EQ(result.states.rows(), 1);
+    ASSERT_EQ(result.states.cols(), 10);
+    for (int k = 0; k < 10; ++k) {
+      EXPECT_EQ(result.times[k], 0.5 * (k + 1));
+      EXPECT_NEAR(result.states(0, k),
+                  SimpleContinuousTimeSystemState(x0, result.times[k]), 1e-6);
+    }
+  }
+  for (const double mass : {1.0, 0.5}) {
+    const RolloutRequest request =
+        MakeAdderParticleRequest(0.25, -1.0, 1.5, 0.5, mass);
+    ExpectAdderParticleResult(request, client->Run(request));
+  }
+
+  // Samples are streamed one at a time, in order.
+  std::vector<double> times;
+  client->Run(MakeAdderParticleRequest(0.0, 0.0, 1.0, 0.0, 1.0),
+              [&times](double time, const Eigen::Ref<const Eigen::VectorXd>&
+                                        state) {
+                EXPECT_EQ(state.size(), 2);
+                times.push_back(time);
+              });
+  EXPECT_EQ(times, std::vector<double>({0.25, 0.5, 0.75, 1.0, 1.25, 1.5,
+                                        1.75, 2.0}));
+
+  EXPECT_EQ(
+      server_->get_model(Model::kSimpleContinuousTimeSystem)
+          .num_idle_simulators(),
+      2);
+  EXPECT_EQ(server_->get_model(Model::kAdderParticle).num_idle_simulators(),
+            2);
+}
+
+/// Makes sure rollouts on many connections at once, each on its own server
+/// thread, are unaffected by each other, and that the pools grow to serve
+/// them all.
+TEST_F(SimulationServerTest, ServesConcurrentClients) {
+  constexpr int kNumClients = 6;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumClients; ++i) {
+    threads.emplace_back([this, i]() {
+      auto client = Connect();
+      for (int j = 0; j < 20; ++j) {
+        const RolloutRequest request =
+            MakeAdderParticleRequest(0.1 * i, -0.2 * j, 0.5 * i, 0.25 * j, 2.0);
+        ExpectAdderParticleResult(request, client->Run(request));
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  const int idle =
+      server_->get_model(Model::kAdderParticle).num_idle_simulators();
+  EXPECT_GE(idle, 2);
+  EXPECT_LE(idle, kNumClients);
+}
+
+/// Makes sure invalid requests are answered with the reason, after which the
+/// connection remains usable.
+TEST_F(SimulationServerTest, RejectsInvalidRequests) {
+  auto client = Connect();
+  const auto expect_rejected = [&client](const RolloutRequest& request,
+                                         const std::string& reason) {
+    try {
+      client->Run(request);
+      ADD_FAILURE() << "expected the request to be rejected: " << reason;
+    } catch (const std::runtime_error& e) {
+      EXPECT_NE(std::string(e.what()).find(reason), std::string::npos)
+          << e.what();
+    }
+  };
+  RolloutRequest request = MakeAdderParticleRequest(0.0, 0.0, 1.0, 0.0, 1.0);
+  request.model = static_cast<Model>(42);
+  expect_rejected(request, "Unknown simulation server model 42");
+  request = MakeAdderParticleRequest(0.0, 0.0, 1.0, 0.0, 1.0);
+  request.initial_state = Eigen::Vector3d::Zero();
+  expect_rejected(request, "takes 2 states and 3 parameters, not 3 and 3");
+  request = MakeAdderParticleRequest(0.0, 0.0, 1.0, 0.0, 1.0);
+  request.horizon = -1.0;
+  expect_rejected(request, "horizon must be positive");
+  expect_rejected(MakeAdderParticleRequest(0.0, 0.0, 1.0, 0.0, 0.0),
+                  "mass must be positive");
+  request = MakeAdderParticleRequest(0.0, 0.0, 1.0, 0.0, 1.0);
+  request.num_samples = 0;
+  EXPECT_THROW(client->Run(request), std::logic_error);
+
+  request = MakeAdderParticleRequest(1.0, 2.0, 3.0, 4.0, 5.0);
+  ExpectAdderParticleResult(request, client->Run(request));
+}
+
+/// Makes sure ServeConnection() serves a single connection, e.g., on a
+/// socket that a `simulation_server --fd` process inherited, until the peer
+/// closes it.
+TEST(ServeConnectionTest, ServesUntilClosed) {
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds), 0);
+  const RolloutModel model(Model::kAdderParticle);
+  std::thread serving([&model, fd = fds[1]]() {
+    ServeConnection(fd, [&model](Model requested) -> const RolloutModel& {
+      if (requested != model.model()) {
+        throw std::logic_error("Not this model");
+      }
+      return model;
+    });
+  });
+  {
+    SimulationClient client(fds[0]);
+    const RolloutRequest request =
+        MakeAdderParticleRequest(0.5, 0.5, -1.0, 0.5, 1.0);
+    ExpectAdderParticleResult(request, client.Run(request));
+    EXPECT_THROW(client.Run({.model = Model::kSimpleContinuousTimeSystem,
+                             .initial_state = drake::Vector1d(0.5),
+                             .horizon = 1.0}),
+                 std::runtime_error);
+  }
+  serving.join();
+  close(fds[1]);
+}
+
+/// Makes sure stopping the server closes the connections still open, so
+/// that their clients fail instead of hanging, and removes the socket.
+TEST_F(SimulationServerTest, StopClosesConnections) {
+  auto client = Connect();
+  const RolloutRequest request =
+      MakeAdderParticleRequest(0.0, 1.0, 0.0, 0.0, 1.0);
+  ExpectAdderParticleResult(request, client->Run(request));
+  const std::string socket_path = server_->socket_path();
+  server_->Stop();
+  serving_.join();
+  EXPECT_THROW(client->Run(request), std::runtime_error);
+  server_.reset();
+  EXPECT_FALSE(std::filesystem::exists(socket_path));
+  EXPECT_THROW(SimulationClient::Connect(socket_path), std::runtime_error);
+}
+
+/// Makes sure a server cannot be given a socket path that does not fit in a
+/// socket address.
+TEST(SimulationServerConstructionTest, Throws) {
+  EXPECT_THROW(SimulationServer(""), std::logic_error);
+  EXPECT_THROW(SimulationServer(std::string(200, 'x')), std::logic_error);
+  EXPECT_THROW(RolloutModel(static_cast<Model>(0)), std::logic_error);
+  EXPECT_THROW(RolloutModel(Model::kAdderParticle, -1), std::logic_error);
+}
+
+}  // namespace
+}  // namespace simulation_server
+}  // namespace drake_external_examples
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "philox.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+using Counter = Philox4x32::Counter;
+
+/// Makes sure the generator matches the known answers of the Random123
+/// library's Philox4x32-10, even at compile time.
+TEST(Philox4x32Test, MatchesKnownAnswers) {
+  static_assert(Philox4x32::Generate({0, 0, 0, 0}, {0, 0}) ==
+                Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+  EXPECT_EQ(Philox4x32::Generate({0xffffffff, 0xffffffff, 0xffffffff,
+                                  0xffffffff},
+                                 {0xffffffff, 0xffffffff}),
+            (Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(Philox4x32::Generate({0x243f6a88, 0x85a308d3, 0x13198a2e,
+                                  0x03707344},
+                                 {0xa4093822, 0x299f31d0}),
+            (Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+/// Makes sure the normal draws have the moments of a standard normal, both
+/// along one stream and across streams, and differ between seeds.
+TEST(PhiloxNormalTest, HasStandardNormalMoments) {
+  constexpr int kCount = 1'000'000;
+  for (const bool across_streams : {false, true}) {
+    double sum = 0.0;
+    double sum_squares = 0.0;
+    double sum_fourth_powers = 0.0;
+    double sum_lag_products = 0.0;
+    double previous = 0.0;
+    for (int i = 0; i < kCount; ++i) {
+      const double z = across_streams ? PhiloxNormal(7, i, 3)
+                                      : PhiloxNormal(7, 3, i);
+      ASSERT_TRUE(std::isfinite(z));
+      sum += z;
+      sum_squares += z * z;
+      sum_fourth_powers += z * z * z * z;
+      sum_lag_products += z * previous;
+      previous = z;
+    }
+    // Within about five standard errors of 0, 1, 3 and 0.
+    EXPECT_NEAR(sum / kCount, 0.0, 0.005);
+    EXPECT_NEAR(sum_squares / kCount, 1.0, 0.008);
+    EXPECT_NEAR(sum_fourth_powers / kCount, 3.0, 0.05);
+    EXPECT_NEAR(sum_lag_products / kCount, 0.0, 0.005);
+  }
+  EXPECT_EQ(PhiloxNormal(1, 2, 3), PhiloxNormal(1, 2, 3));
+  EXPECT_NE(PhiloxNormal(1, 2, 3), PhiloxNormal(2, 2, 3));
+  EXPECT_NE(PhiloxNormal(1, 2, 3), PhiloxNormal(1, 3, 2));
+  EXPECT_NE(PhiloxNormal(1, 2, 3), PhiloxNormal(1, 2, uint64_t{3} << 32));
+}
+
+}  // namespace
+}  // namespace particles
+}  // namespace drake_external_examples
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/common/eigen_types.h>
+
+#include "philox.h"
+#include "thread_pool/thread_pool.h"
+
+namespace drake_external_examples {
+namespace particles {
+
+/// Returns the standard normal draw that drives the acceleration noise of
+/// rollout @p rollout_id in step @p step, under @p seed. Every rollout of a
+/// stochastic particle, whether simulated alone by a StochasticParticle or
+/// among many in a StochasticParticleEnsemble, draws its noise here.
+inline double StochasticParticleNoise(uint64_t seed, uint64_t rollout_id,
+                                      int64_t step) {
+  return PhiloxNormal(seed, rollout_id, static_cast<uint64_t>(step));
+}
+
+/// Takes one Euler–Maruyama step of length @p h of the stochastic particle
+///
+///   dx = v dt,  dv = a dt + σ dW,
+///
+/// from (@p x, @p v), with @p acceleration a and the noise term
+/// @p noise_scale = σ √h times the standard normal @p noise:
+///
+///   x ← x + h v,  v ← v + h a + σ √h ξ.
+inline void EulerMaruyamaStep(double h, double acceleration,
+                              double noise_scale, double noise, double* x,
+                              double* v) {
+  const double v0 = *v;
+  *v = v0 + h * acceleration + noise_scale * noise;
+  *x += h * v0;
+}
+
+/// Configures StochasticParticleEnsemble.
+struct StochasticEnsembleOptions {
+  /// The fixed step of the Euler–Maruyama integrator, in @f$ s @f$ units.
+  double time_step{1e-3};
+  /// Keys the noise of the whole ensemble.
+  uint64_t seed{};
+  /// The mass of every particle, in @f$ kg @f$ units.
+  double mass{1.0};
+  /// The intensity σ of the white-noise acceleration, in @f$ m/s^{3/2} @f$
+  /// units: the velocity of a free particle diffuses with variance σ² t.
+  double noise_intensity{1.0};
+  /// The number of threads stepping particles; values less than 1 mean all
+  /// cores.
+  int num_threads{1};
+};
+
+/// Many independent rollouts of a stochastic particle, a Particle whose
+/// acceleration f / m has white noise of intensity σ added, advanced in
+/// lockstep by a fixed-step Euler–Maruyama integrator (see
+/// EulerMaruyamaStep()).
+///
+/// Particle i is the rollout first_rollout_id() + i, and draws its noise
+/// from StochasticParticleNoise() by its rollout id and the step, so each
+/// rollout is reproducible bit for bit, regardless of the number of threads
+/// or of the other particles in the ensemble; it matches a StochasticParticle
+/// simulated with that rollout id.
+///
+/// States are stored structure-of-arrays, and stepped in blocks of particles
+/// that fit in the cache, all steps of one block at a time, one block per
+/// task.
+class StochasticParticleEnsemble {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(StochasticParticleEnsemble);
+
+  /// Creates @p num_particles particles at rest at the origin, the rollouts
+  /// @p first_rollout_id onwards, at step zero.
+  /// @throws std::exception if @p num_particles is negative, or the time step
+  ///   or the mass is not positive, or the noise intensity is negative.
+  StochasticParticleEnsemble(int num_particles,
+                             const StochasticEnsembleOptions& options,
+                             uint64_t first_rollout_id = 0);
+
+  ~StochasticParticleEnsemble();
+
+  int num_particles() const { return static_cast<int>(positions_.size()); }
+  const StochasticEnsembleOptions& options() const { return options_; }
+  uint64_t first_rollout_id() const { return first_rollout_id_; }
+
+  /// Returns the number of steps taken, which is the next step's index.
+  int64_t step() const { return step_; }
+  /// Returns the time, step() times the time step.
+  double time() const { return step_ * options_.time_step; }
+
+  const Eigen::VectorXd& positions() const { return positions_; }
+  const Eigen::VectorXd& velocities() const { return velocities_; }
+
+  /// Sets the state of every particle, and the step to continue from.
+  /// @throws std::exception if the sizes differ from num_particles(), or
+  ///   @p step is negative.
+  void SetState(const Eigen::Ref<const Eigen::VectorXd>& positions,
+                const Eigen::Ref<const Eigen::VectorXd>& velocities,
+                int64_t step = 0);
+
+  /// Takes @p num_steps steps, each particle i pushed by the constant
+  /// @p forces[i], in @f$ N @f$ units.
+  /// @throws std::exception if @p forces has the wrong size, or @p num_steps
+  ///   is negative.
+  void Advance(int64_t num_steps,
+               const Eigen::Ref<const Eigen::VectorXd>& forces);
+
+ private:
+  const StochasticEnsembleOptions options_;
+  const uint64_t first_rollout_id_;
+  const std::unique_ptr<parallel::ThreadPool> pool_;
+  Eigen::VectorXd positions_;
+  Eigen::VectorXd velocities_;
+  int64_t step_{};
+};
+
+}  // namespace particles
+}  // namespace drake_external_examples
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "stochastic_ensemble.h"  // IWYU pragma: associated
+
+#include <cmath>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+/// Makes sure the variances of the positions and velocities of free
+/// particles, started at rest, grow as the Euler–Maruyama recursion says,
+///
+///   Var v_n = σ² h n,
+///   Var x_n = σ² h³ (n − 1) n (2n − 1) / 6,
+///   Cov(x_n, v_n) = σ² h² n (n − 1) / 2,
+///
+/// i.e., as σ² t, σ² t³ / 3 and σ² t² / 2 as h → 0; and that the means
+/// follow the constant force.
+TEST(StochasticParticleEnsembleTest, VarianceGrowsAsTheoryPredicts) {
+  constexpr int kNumParticles = 100'000;
+  const StochasticEnsembleOptions options{.time_step = 0.02,
+                                          .seed = 42,
+                                          .mass = 2.0,
+                                          .noise_intensity = 0.5,
+                                          .num_threads = 4};
+  const double h = options.time_step;
+  const double sigma_squared =
+      options.noise_intensity * options.noise_intensity;
+  const double force = 1.0;
+  StochasticParticleEnsemble ensemble(kNumParticles, options);
+  const Eigen::VectorXd forces =
+      Eigen::VectorXd::Constant(kNumParticles, force);
+  // A sample variance of N normal draws has a relative standard error of
+  // about √(2 / N), 0.45%; allow five of them.
+  const double tolerance = 5.0 * std::sqrt(2.0 / kNumParticles);
+  for (const int n : {10, 25, 50}) {
+    ensemble.Advance(n - ensemble.step(), forces);
+    ASSERT_EQ(ensemble.step(), n);
+    const Eigen::ArrayXd x = ensemble.positions().array();
+    const Eigen::ArrayXd v = ensemble.velocities().array();
+    const double x_mean = x.mean();
+    const double v_mean = v.mean();
+    const double x_variance = (x - x_mean).square().mean();
+    const double v_variance = (v - v_mean).square().mean();
+    const double covariance = ((x - x_mean) * (v - v_mean)).mean();
+
+    const double expected_v_variance = sigma_squared * h * n;
+    const double expected_x_variance =
+        sigma_squared * h * h * h * (n - 1) * n * (2 * n - 1) / 6.0;
+    const double expected_covariance = sigma_squared * h * h * n * (n - 1) / 2;
+    EXPECT_NEAR(v_variance / expected_v_variance, 1.0, tolerance) << n;
+    EXPECT_NEAR(x_variance / expected_x_variance, 1.0, tolerance) << n;
+    // The sample covariance's error is bounded the same way, relative to
+    // √(Var x Var v), of which the covariance is a fixed fraction.
+    EXPECT_NEAR(covariance, expected_covariance,
+                tolerance * std::sqrt(expected_x_variance *
+                                      expected_v_variance))
+        << n;
+
+    const double a = force / options.mass;
+    EXPECT_NEAR(v_mean, a * h * n,
+                5.0 * std::sqrt(expected_v_variance / kNumParticles));
+    EXPECT_NEAR(x_mean, a * h * h * n * (n - 1) / 2,
+                5.0 * std::sqrt(expected_x_variance / kNumParticles));
+  }
+}
+
+/// Makes sure each rollout is the same, bit for bit, for any number of
+/// threads, any way the steps are split between calls, and any position in
+/// the ensemble.
+TEST(StochasticParticleEnsembleTest, IsReproducible) {
+  constexpr int kNumParticles = 10'000;
+  StochasticEnsembleOptions options{.time_step = 0.01, .seed = 7};
+  Eigen::VectorXd forces = Eigen::VectorXd::LinSpaced(kNumParticles, -1, 1);
+  StochasticParticleEnsemble reference(kNumParticles, options);
+  reference.Advance(100, forces);
+
+  options.num_threads = 3;
+  StochasticParticleEnsemble threaded(kNumParticles, options);
+  threaded.Advance(30, forces);
+  threaded.Advance(70, forces);
+  EXPECT_EQ(threaded.positions(), reference.positions());
+  EXPECT_EQ(threaded.velocities(), reference.velocities());
+
+  // Rollouts 5000 onwards, alone.
+  StochasticParticleEnsemble tail(kNumParticles - 5000, options, 5000);
+  tail.Advance(100, forces.tail(kNumParticles - 5000));
+  EXPECT_EQ(tail.positions(), reference.positions().tail(5000));
+  EXPECT_EQ(tail.velocities(), reference.velocities().tail(5000));
+
+  // Another seed is another experiment.
+  options.seed = 8;
+  StochasticParticleEnsemble reseeded(kNumParticles, options);
+  reseeded.Advance(100, forces);
+  EXPECT_NE(reseeded.positions(), reference.positions());
+}
+
+/// Makes sure that, without noise, the integrator follows the particle's
+/// deterministic dynamics, from the state and step it is given.
+TEST(StochasticParticleEnsembleTest, FollowsDeterministicDynamics) {
+  StochasticParticleEnsemble ensemble(
+      2, {.time_step = 0.125, .mass = 4.0, .noise_intensity = 0.0});
+  ensemble.SetState(Eigen::Vector2d(1.0, -1.0), Eigen::Vector2d(0.5, 0.0),
+                    /* step = */ 8);
+  EXPECT_EQ(ensemble.time(), 1.0);
+  ensemble.Advance(8, Eigen::Vector2d(0.0, 2.0));
+  EXPECT_EQ(ensemble.step(), 16);
+  // x_n = x_0 + n h v_0 + a h² n (n − 1) / 2, exactly in binary.
+  EXPECT_EQ(ensemble.positions(), Eigen::Vector2d(1.5, -1.0 + 0.4375 / 2));
+  EXPECT_EQ(ensemble.velocities(), Eigen::Vector2d(0.5, 0.5));
+}
+
+/// Makes sure invalid arguments are rejected.
+TEST(StochasticParticleEnsembleTest, Throws) {
+  EXPECT_THROW(StochasticParticleEnsemble(-1, {}), std::logic_error);
+  EXPECT_THROW(StochasticParticleEnsemble(1, {.time_step = 0.0}),
+               std::logic_error);
+  EXPECT_THROW(StochasticParticleEnsemble(1, {.mass = 0.0}), std::logic_error);
+  EXPECT_THROW(StochasticParticleEnsemble(1, {.noise_intensity = -1.0}),
+               std::logic_error);
+  StochasticParticleEnsemble ensemble(2, {});
+  EXPECT_THROW(ensemble.Advance(1, Eigen::VectorXd::Zero(3)),
+               std::logic_error);
+  EXPECT_THROW(ensemble.Advance(-1, Eigen::VectorXd::Zero(2)),
+               std::logic_error);
+  EXPECT_THROW(ensemble.SetState(Eigen::VectorXd::Zero(2),
+                                 Eigen::VectorXd::Zero(2), -1),
+               std::logic_error);
+}
+
+}  // namespace
+}  // namespace particles
+}  // namespace drake_external_examples
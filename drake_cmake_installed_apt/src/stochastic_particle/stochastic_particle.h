@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <cstdint>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/discrete_values.h>
+#include <drake/systems/framework/event_status.h>
+#include <drake/systems/framework/leaf_system.h>
+
+namespace drake_external_examples {
+namespace particles {
+
+/// A linear 1DOF particle, like `Particle`, whose acceleration f / m has
+/// white noise of intensity σ added:
+///
+///   dx = v dt,  dv = (f / m) dt + σ dW,
+///
+/// integrated by fixed Euler–Maruyama steps (see EulerMaruyamaStep()), as
+/// periodic discrete updates, since Drake's integrators are for ordinary
+/// differential equations. It can be described in terms of its:
+///
+/// - Inputs:
+///   - linear force (input index 0), in @f$ N @f$ units.
+/// - States/Outputs:
+///   - linear position (state/output index 0), in @f$ m @f$ units.
+///   - linear velocity (state/output index 1), in @f$ m/s @f$ units.
+///   - the number of steps taken (discrete state group 1), which indexes the
+///     noise.
+/// - Parameters:
+///   - mass (numeric parameter index 0), in @f$ kg @f$ units.
+///   - noise intensity σ (numeric parameter index 1), in @f$ m/s^{3/2} @f$
+///     units.
+///   - rollout id (numeric parameter index 2), an integer.
+///
+/// The noise of step k is StochasticParticleNoise(seed, rollout id, k), so a
+/// rollout is determined by its seed and rollout id alone, bit for bit, no
+/// matter which thread simulates it, and matches the same rollout in a
+/// StochasticParticleEnsemble with the same seed.
+///
+/// @tparam_double_only
+class StochasticParticle final : public drake::systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(StochasticParticle);
+
+  /// Rollout ids are stored as doubles, so must be at most this.
+  static constexpr uint64_t kMaxRolloutId = uint64_t{1} << 53;
+
+  /// Creates a particle stepped every @p time_step seconds, with noise keyed
+  /// by @p seed, whose mass and noise intensity parameters default to
+  /// @p mass and @p noise_intensity, and whose rollout id defaults to zero.
+  /// @throws std::exception unless @p time_step and @p mass are positive and
+  ///   @p noise_intensity is not negative.
+  StochasticParticle(double time_step, uint64_t seed, double mass = 1.0,
+                     double noise_intensity = 1.0);
+
+  double time_step() const { return time_step_; }
+  uint64_t seed() const { return seed_; }
+
+  /// Returns the mass parameter stored in @p context.
+  double get_mass(const drake::systems::Context<double>& context) const;
+
+  /// Sets the mass parameter stored in @p context.
+  void set_mass(drake::systems::Context<double>* context, double mass) const;
+
+  /// Returns the noise intensity parameter stored in @p context.
+  double get_noise_intensity(
+      const drake::systems::Context<double>& context) const;
+
+  /// Sets the noise intensity parameter stored in @p context.
+  void set_noise_intensity(drake::systems::Context<double>* context,
+                           double noise_intensity) const;
+
+  /// Returns the rollout id parameter stored in @p context.
+  uint64_t get_rollout_id(const drake::systems::Context<double>& context) const;
+
+  /// Sets the rollout id parameter stored in @p context.
+  /// @throws std::exception if @p rollout_id exceeds kMaxRolloutId.
+  void set_rollout_id(drake::systems::Context<double>* context,
+                      uint64_t rollout_id) const;
+
+  /// Returns the number of steps taken in @p context.
+  int64_t get_step(const drake::systems::Context<double>& context) const;
+
+ private:
+  drake::systems::EventStatus Step(
+      const drake::systems::Context<double>& context,
+      drake::systems::DiscreteValues<double>* next_state) const;
+
+  const double time_step_;
+  const uint64_t seed_;
+};
+
+}  // namespace particles
+}  // namespace drake_external_examples
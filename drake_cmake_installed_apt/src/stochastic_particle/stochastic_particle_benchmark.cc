@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT-0
+
+/// @file
+/// Measures how many Euler–Maruyama samples (one particle, one step) per
+/// second a stochastic particle runs:
+///
+/// - drawing the Philox normals alone, the floor of every other mode;
+/// - stepping a StochasticParticleEnsemble on one thread;
+/// - stepping it on a thread per core, which yields the same samples; and
+/// - simulating a StochasticParticle, one rollout at a time, in a Drake
+///   Simulator, with a discrete update per step.
+///
+/// Usage: stochastic_particle_benchmark [--particles=<count>]
+///            [--steps=<count>] [--simulated_rollouts=<count>]
+///            [--json_output=<path>]
+///
+/// By default, 100000 particles take 1000 steps each, and 100 rollouts of as
+/// many steps are simulated.
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <drake/systems/analysis/simulator.h>
+
+#include "benchmark_harness/benchmark_fixture.h"
+#include "stochastic_ensemble.h"
+#include "stochastic_particle.h"
+
+namespace drake_external_examples {
+namespace particles {
+namespace {
+
+using benchmarking::BenchmarkFixture;
+using benchmarking::BenchmarkResult;
+
+constexpr double kTimeStep = 1e-3;
+constexpr uint64_t kSeed = 1;
+
+void PrintRate(BenchmarkResult* result, double checksum) {
+  const double rate = result->num_operations / result->seconds;
+  result->values["samples_per_second"] = rate;
+  std::cout << "  " << rate << " samples/s (checksum " << checksum << ")"
+            << std::endl;
+}
+
+int DoMain(int argc, char* argv[]) {
+  BenchmarkFixture fixture("stochastic_particle_benchmark", &argc, argv);
+  int num_particles = 100'000;
+  int num_steps = 1'000;
+  int num_simulated_rollouts = 100;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg.starts_with("--particles=")) {
+      num_particles = std::stoi(std::string(arg.substr(12)));
+    } else if (arg.starts_with("--steps=")) {
+      num_steps = std::stoi(std::string(arg.substr(8)));
+    } else if (arg.starts_with("--simulated_rollouts=")) {
+      num_simulated_rollouts = std::stoi(std::string(arg.substr(21)));
+    } else {
+      throw std::logic_error("Unknown argument " + std::string(arg));
+    }
+  }
+  if (num_particles < 1 || num_steps < 1 || num_simulated_rollouts < 1) {
+    throw std::logic_error(
+        "The numbers of particles, steps and rollouts must be positive");
+  }
+  const int64_t num_samples = int64_t{num_particles} * num_steps;
+
+  double checksum = 0.0;
+  BenchmarkResult& noise = fixture.Measure("noise alone", num_samples, [&]() {
+    for (int step = 0; step < num_steps; ++step) {
+      for (int i = 0; i < num_particles; ++i) {
+        checksum += StochasticParticleNoise(kSeed, i, step);
+      }
+    }
+  });
+  PrintRate(&noise, checksum);
+
+  const Eigen::VectorXd forces = Eigen::VectorXd::Ones(num_particles);
+  const int num_cores =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (const int num_threads : {1, num_cores}) {
+    StochasticParticleEnsemble ensemble(
+        num_particles,
+        {.time_step = kTimeStep, .seed = kSeed, .num_threads = num_threads});
+    BenchmarkResult& stepped = fixture.Measure(
+        "ensemble, " + std::to_string(num_threads) + " threads", num_samples,
+        [&]() { ensemble.Advance(num_steps, forces); });
+    PrintRate(&stepped, ensemble.positions().sum());
+  }
+
+  const StochasticParticle particle(kTimeStep, kSeed);
+  drake::systems::Simulator<double> simulator(particle);
+  auto& context = simulator.get_mutable_context();
+  particle.get_input_port(0).FixValue(&context, 1.0);
+  checksum = 0.0;
+  BenchmarkResult& simulated = fixture.Measure(
+      "simulator", int64_t{num_simulated_rollouts} * num_steps, [&]() {
+        for (int i = 0; i < num_simulated_rollouts; ++i) {
+          context.SetTime(0.0);
+          context.get_mutable_discrete_state(0).SetZero();
+          context.get_mutable_discrete_state(1).SetZero();
+          particle.set_rollout_id(&context, i);
+          simulator.Initialize();
+          // Stop just short of the step at the final time.
+          simulator.AdvanceTo((num_steps - 0.5) * kTimeStep);
+          checksum += context.get_discrete_state(0).GetAtIndex(0);
+        }
+      });
+  PrintRate(&simulated, checksum);
+  return fixture.WriteResults();
+}
+
+}  // namespace
+}  // namespace particles
+}  // namespace drake_external_examples
+
+int main(int argc, char* argv[]) {
+  return drake_external_examples::particles::DoMain(argc, argv);
+}
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <Eigen/Dense>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/continuous_state.h>
+#include <drake/systems/framework/leaf_system.h>
+
+namespace drake_external_examples {
+namespace symbolic_codegen {
+
+/// A system whose time derivatives are computed by the code that
+/// GenerateDerivatives() emitted for another system, e.g., as compiled by the
+/// drake_example_add_generated_derivatives() CMake function or the
+/// drake_example_generated_derivatives() Bazel macro. It has:
+///
+/// - the continuous state x of the original system;
+/// - an input port u, if the original system has any inputs; it concatenates
+///   them in port order;
+/// - a numeric parameter p, if the original system has any; it concatenates
+///   them in group order, and defaults to the original system's defaults;
+/// - an output port y = x.
+///
+/// @tparam Derivatives the generated `Derivatives` struct.
+template <typename Derivatives>
+class GeneratedSystem final : public drake::systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(GeneratedSystem);
+
+  static constexpr int kNumStates = Derivatives::kNumStates;
+  static constexpr int kNumInputs = Derivatives::kNumInputs;
+  static constexpr int kNumParameters = Derivatives::kNumParameters;
+
+  GeneratedSystem() {
+    this->DeclareContinuousState(kNumStates);
+    if constexpr (kNumInputs > 0) {
+      this->DeclareVectorInputPort("u", kNumInputs);
+    }
+    if constexpr (kNumParameters > 0) {
+      this->DeclareNumericParameter(
+          drake::systems::BasicVector<double>(Eigen::VectorXd(
+              Eigen::Map<const Eigen::VectorXd>(
+                  Derivatives::kDefaultParameters.data(), kNumParameters))));
+    }
+    this->DeclareVectorOutputPort("y", kNumStates,
+                                  &GeneratedSystem::CopyStateOut,
+                                  {this->all_state_ticket()});
+  }
+
+  /// Returns the Jacobian ∂f/∂x of the time derivatives with respect to the
+  /// state, at the time, state, input and parameters in @p context.
+  Eigen::Matrix<double, kNumStates, kNumStates> CalcJacobian(
+      const drake::systems::Context<double>& context) const {
+    const StateVector x = GetState(context);
+    Eigen::Matrix<double, kNumStates, kNumStates> dxdot_dx;
+    Derivatives::CalcJacobian(context.get_time(), x.data(), GetInput(context),
+                              GetParameters(context), dxdot_dx.data());
+    return dxdot_dx;
+  }
+
+ private:
+  using StateVector = Eigen::Matrix<double, kNumStates, 1>;
+
+  StateVector GetState(const drake::systems::Context<double>& context) const {
+    StateVector x;
+    context.get_continuous_state_vector().CopyToPreSizedVector(&x);
+    return x;
+  }
+
+  const double* GetInput(const drake::systems::Context<double>& context) const {
+    if constexpr (kNumInputs > 0) {
+      return this->get_input_port(0).Eval(context).data();
+    } else {
+      return nullptr;
+    }
+  }
+
+  const double* GetParameters(
+      const drake::systems::Context<double>& context) const {
+    if constexpr (kNumParameters > 0) {
+      return context.get_numeric_parameter(0).value().data();
+    } else {
+      return nullptr;
+    }
+  }
+
+  void DoCalcTimeDerivatives(
+      const drake::systems::Context<double>& context,
+      drake::systems::ContinuousState<double>* derivatives) const final {
+    const StateVector x = GetState(context);
+    StateVector xdot;
+    Derivatives::Calc(context.get_time(), x.data(), GetInput(context),
+                      GetParameters(context), xdot.data());
+    derivatives->SetFromVector(xdot);
+  }
+
+  void CopyStateOut(const drake::systems::Context<double>& context,
+                    drake::systems::BasicVector<double>* output) const {
+    output->SetFromVector(GetState(context));
+  }
+};
+
+}  // namespace symbolic_codegen
+}  // namespace drake_external_examples
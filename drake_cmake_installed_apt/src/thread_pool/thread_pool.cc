@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "thread_pool.h"
+
+#include <algorithm>
+
+namespace drake_external_examples {
+namespace parallel {
+
+ThreadPool::ThreadPool(int num_threads) {
+  if (num_threads < 1) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  workers_.reserve(num_threads - 1);
+  for (int thread = 1; thread < num_threads; ++thread) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, thread);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  start_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::ParallelFor(
+    int64_t size, const std::function<void(int64_t index, int thread)>& body) {
+  if (size <= 0) {
+    return;
+  }
+  if (workers_.empty() || size == 1) {
+    for (int64_t index = 0; index < size; ++index) {
+      body(index, 0);
+    }
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    body_ = &body;
+    size_ = size;
+    next_index_.store(0);
+    error_ = nullptr;
+    num_busy_ = static_cast<int>(workers_.size());
+    ++generation_;
+  }
+  start_.notify_all();
+  RunLoop(0);
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    finish_.wait(lock, [this] { return num_busy_ == 0; });
+    body_ = nullptr;
+    error = error_;
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void ThreadPool::WorkerLoop(int thread) {
+  int64_t seen_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_.wait(lock, [&] {
+        return stopping_ || generation_ != seen_generation;
+      });
+      if (stopping_) {
+        return;
+      }
+      seen_generation = generation_;
+    }
+    RunLoop(thread);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --num_busy_;
+    }
+    finish_.notify_one();
+  }
+}
+
+void ThreadPool::RunLoop(int thread) {
+  while (true) {
+    const int64_t index = next_index_.fetch_add(1);
+    if (index >= size_) {
+      return;
+    }
+    try {
+      (*body_)(index, thread);
+    } catch (...) {
+      // Stop handing out indices, and keep the first error.
+      next_index_.store(size_);
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+  }
+}
+
+}  // namespace parallel
+}  // namespace drake_external_examples
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <drake/common/drake_copyable.h>
+
+namespace drake_external_examples {
+namespace parallel {
+
+/// A fixed set of worker threads for running data-parallel loops, such as
+/// independent simulations or per-cell force computations, over many cores.
+///
+/// Drake's own parallel-for helpers run serially unless Drake was built with
+/// OpenMP, which the binary releases are not; this pool uses std::thread so
+/// the examples scale the same way with any Drake build.
+///
+/// The calling thread participates in each loop as thread 0, so a pool of
+/// size 1 runs loops inline without any synchronization. Loops must not be
+/// started concurrently, nor from within a loop body.
+class ThreadPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadPool);
+
+  /// Creates a pool that runs loops on @p num_threads threads, including the
+  /// caller's. Values less than 1 mean std::thread::hardware_concurrency().
+  explicit ThreadPool(int num_threads);
+
+  ~ThreadPool();
+
+  int num_threads() const { return static_cast<int>(workers_.size()) + 1; }
+
+  /// Calls `body(index, thread)` for every index in [0, @p size), and returns
+  /// once all calls have finished. Indices are handed out dynamically, one at
+  /// a time, so uneven work balances across threads. `thread`, in
+  /// [0, num_threads()), identifies the calling thread, e.g., to select
+  /// per-thread scratch data. If any call throws, the remaining indices are
+  /// skipped and the first exception is rethrown here.
+  void ParallelFor(int64_t size,
+                   const std::function<void(int64_t index, int thread)>& body);
+
+ private:
+  void WorkerLoop(int thread);
+  void RunLoop(int thread);
+
+  std::vector<std::thread> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable start_;
+  std::condition_variable finish_;
+  // Guarded by mutex_.
+  int64_t generation_{0};
+  int num_busy_{0};
+  bool stopping_{false};
+  std::exception_ptr error_;
+
+  // The current loop; written before a generation starts, so workers may read
+  // them without the lock.
+  const std::function<void(int64_t, int)>* body_{};
+  int64_t size_{};
+  std::atomic<int64_t> next_index_{0};
+};
+
+}  // namespace parallel
+}  // namespace drake_external_examples
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "thread_pool.h"  // IWYU pragma: associated
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake_external_examples {
+namespace parallel {
+namespace {
+
+/// Makes sure every index is visited exactly once, on a valid thread, for
+/// several loops in a row and for pools of several sizes.
+TEST(ThreadPoolTest, VisitsEveryIndexOnce) {
+  for (int num_threads : {1, 2, 7}) {
+    ThreadPool pool(num_threads);
+    EXPECT_EQ(pool.num_threads(), num_threads);
+    for (int64_t size : {0, 1, 5, 1000}) {
+      std::vector<std::atomic<int>> visits(size);
+      std::atomic<bool> bad_thread{false};
+      pool.ParallelFor(size, [&](int64_t index, int thread) {
+        ++visits[index];
+        if (thread < 0 || thread >= num_threads) {
+          bad_thread = true;
+        }
+      });
+      for (int64_t i = 0; i < size; ++i) {
+        EXPECT_EQ(visits[i], 1) << "index " << i;
+      }
+      EXPECT_FALSE(bad_thread);
+    }
+  }
+}
+
+/// Makes sure a pool of size zero uses all cores.
+TEST(ThreadPoolTest, DefaultSize) {
+  const ThreadPool pool(0);
+  EXPECT_GE(pool.num_threads(), 1);
+}
+
+/// Makes sure an exception in a loop body reaches the caller, and that the
+/// pool remains usable afterwards.
+TEST(ThreadPoolTest, PropagatesExceptions) {
+  ThreadPool pool(4);
+  EXPECT_THROW(pool.ParallelFor(100,
+                                [](int64_t index, int) {
+                                  if (index == 42) {
+                                    throw std::runtime_error("42");
+                                  }
+                                }),
+               std::runtime_error);
+  std::atomic<int64_t> sum{0};
+  pool.ParallelFor(100, [&](int64_t index, int) { sum += index; });
+  EXPECT_EQ(sum, 4950);
+}
+
+}  // namespace
+}  // namespace parallel
+}  // namespace drake_external_examples
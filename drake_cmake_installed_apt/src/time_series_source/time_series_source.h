@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <drake/common/drake_copyable.h>
+#include <drake/common/eigen_types.h>
+#include <drake/systems/framework/basic_vector.h>
+#include <drake/systems/framework/context.h>
+#include <drake/systems/framework/leaf_system.h>
+
+namespace drake_external_examples {
+namespace time_series {
+
+/// How a TimeSeriesSource produces values between samples.
+enum class TimeSeriesInterpolation {
+  /// Holds the most recent sample until the next one.
+  kZeroOrderHold,
+  /// Interpolates linearly between neighboring samples.
+  kLinear,
+};
+
+/// A read-only table of time-stamped vector samples, memory-mapped from a
+/// file so that tables much larger than what one would want to parse into
+/// memory (e.g., hours of recordings at kHz rates) cost nothing to open and
+/// are paged in as they are played back.
+///
+/// The file starts with a 40-byte header of native-endian fields:
+///
+/// - `char magic[8]`: "DEETSRC1".
+/// - `uint64_t num_samples`: at least 1.
+/// - `uint64_t num_values`: the size of each sample vector, at least 1.
+/// - `double start_time`: the time of the first sample.
+/// - `double period`: the sample period when it is positive (a uniformly
+///   sampled table); zero when the sample times are stored explicitly.
+///
+/// followed by `num_samples` strictly increasing sample times (only when
+/// `period` is zero) and then the `num_samples * num_values` sample values,
+/// stored sample by sample.
+///
+/// Use WriteTimeSeries() or WriteUniformTimeSeries() to create such files.
+class TimeSeriesTable {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TimeSeriesTable);
+
+  /// Maps the table stored in @p filename.
+  /// @throws std::exception if the file cannot be mapped or is malformed.
+  explicit TimeSeriesTable(const std::string& filename);
+
+  ~TimeSeriesTable();
+
+  int64_t num_samples() const { return num_samples_; }
+
+  int num_values() const { return num_values_; }
+
+  /// Returns true iff the samples are uniformly spaced in time.
+  bool is_uniform() const { return period_ > 0.0; }
+
+  /// Returns the time of sample @p i.
+  double time(int64_t i) const {
+    return is_uniform() ? start_time_ + static_cast<double>(i) * period_
+                        : times_[i];
+  }
+
+  /// Returns the `num_values()` values of sample @p i.
+  Eigen::Map<const Eigen::VectorXd> values(int64_t i) const {
+    return Eigen::Map<const Eigen::VectorXd>(values_ + i * num_values_,
+                                             num_values_);
+  }
+
+  /// Returns the index i of the segment [time(i), time(i + 1)) containing
+  /// @p t, clamped to the first and last segments for times outside the table
+  /// (a single-sample table has the one segment 0).
+  ///
+  /// For uniformly sampled tables this is O(1). Otherwise the search starts
+  /// from @p hint (e.g., the result of the previous call), so that queries at
+  /// monotonically increasing times cost O(1) amortized; a query far from the
+  /// hint costs O(log(distance)), and one before it O(log(num_samples())).
+  int64_t FindSegment(double t, int64_t hint) const;
+
+ private:
+  void* mapping_{};
+  std::size_t mapping_size_{};
+  int64_t num_samples_{};
+  int num_values_{};
+  double start_time_{};
+  double period_{};
+  const double* times_{};
+  const double* values_{};
+};
+
+/// Writes a table in the TimeSeriesTable file format whose sample i is
+/// `values.col(i)` at time `times(i)`.
+/// @throws std::exception if the file cannot be written, or @p times is not
+/// strictly increasing or does not have one entry per column of @p values.
+void WriteTimeSeries(const std::string& filename,
+                     const Eigen::Ref<const Eigen::VectorXd>& times,
+                     const Eigen::Ref<const Eigen::MatrixXd>& values);
+
+/// Writes a uniformly sampled table in the TimeSeriesTable file format whose
+/// sample i is `values.col(i)` at time `start_time + i * period`.
+/// @throws std::exception if the file cannot be written or @p period is not
+/// positive.
+void WriteUniformTimeSeries(const std::string& filename, double start_time,
+                            double period,
+                            const Eigen::Ref<const Eigen::MatrixXd>& values);
+
+/// Plays back a TimeSeriesTable as a vector-valued output (output index 0)
+/// that depends only on time. Before the first sample and after the last one
+/// the output holds the first and last sample values, respectively.
+///
+/// The segment found by each evaluation is remembered as the starting point
+/// for the next one, so playback during a simulation, where time increases
+/// monotonically, does not search the table. The remembered segment is only a
+/// hint: it is shared by all contexts of this system and updated atomically,
+/// so concurrent evaluations on different contexts remain correct (if slower).
+///
+/// @tparam_double_only
+class TimeSeriesSource final : public drake::systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TimeSeriesSource);
+
+  /// Plays back @p table, which must be non-null.
+  TimeSeriesSource(std::shared_ptr<const TimeSeriesTable> table,
+                   TimeSeriesInterpolation interpolation);
+
+  const TimeSeriesTable& table() const { return *table_; }
+
+  TimeSeriesInterpolation interpolation() const { return interpolation_; }
+
+ private:
+  void CalcValue(const drake::systems::Context<double>& context,
+                 drake::systems::BasicVector<double>* output) const;
+
+  const std::shared_ptr<const TimeSeriesTable> table_;
+  const TimeSeriesInterpolation interpolation_;
+  mutable std::atomic<int64_t> hint_{0};
+};
+
+}  // namespace time_series
+}  // namespace drake_external_examples
@@ -0,0 +1,240 @@
+# SPDX-License-Identifier: MIT-0
+
+"""
+Reads and writes trajectory datasets (see trajectory_dataset.h for the
+format) with NumPy, without pydrake.
+
+The dataset is memory-mapped, and reading a column of a run touches only
+that column's chunk. Columns stored raw are returned as read-only views of
+the mapping, without copying; compressed columns are decompressed with
+vectorized NumPy operations.
+"""
+
+import mmap
+
+import numpy as np
+
+RAW = 0
+SHUFFLED_DELTA = 1
+
+_MAGIC = b"DEETRJD2"
+_ZERO_PLANE, _SPARSE_PLANE, _DENSE_PLANE = 0, 1, 2
+_COLUMN = np.dtype([("codec", "u1"), ("padding", "V7"), ("name", "S56")])
+_RUN = np.dtype([("run_id", "<i8"), ("num_samples", "<u8"),
+                 ("start_time", "<f8"), ("end_time", "<f8")])
+_CHUNK = np.dtype([("offset", "<u8"), ("size", "<u8")])
+
+
+class TrajectoryDataset:
+    """A read-only, memory-mapped trajectory dataset."""
+
+    def __init__(self, filename):
+        with open(filename, "rb") as f:
+            self._mmap = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        size = len(self._mmap)
+        if (size < 24 or self._mmap[:8] != _MAGIC
+                or self._mmap[size - 8:] != _MAGIC):
+            raise ValueError(
+                f"{filename}: not a trajectory dataset, or not finished")
+        index_offset = int(np.frombuffer(
+            self._mmap, "<u8", count=1, offset=size - 16)[0])
+        num_columns, num_runs = (int(n) for n in np.frombuffer(
+            self._mmap, "<u8", count=2, offset=index_offset))
+        offset = index_offset + 16
+        columns = np.frombuffer(
+            self._mmap, _COLUMN, count=num_columns, offset=offset)
+        offset += columns.nbytes
+        #: The column names; the time column "time" is first.
+        self.column_names = [name.decode() for name in columns["name"]]
+        self._codecs = columns["codec"].tolist()
+        #: The runs, in the order they were written, as a structured array
+        #: with the fields run_id, num_samples, start_time and end_time.
+        self.runs = np.frombuffer(
+            self._mmap, _RUN, count=num_runs, offset=offset)
+        offset += self.runs.nbytes
+        self._runs_by_id = np.frombuffer(
+            self._mmap, "<u8", count=num_runs, offset=offset)
+        offset += self._runs_by_id.nbytes
+        self._runs_by_start = np.frombuffer(
+            self._mmap, "<u8", count=num_runs, offset=offset)
+        offset += self._runs_by_start.nbytes
+        chunks = np.frombuffer(
+            self._mmap, _CHUNK, count=num_runs * num_columns,
+            offset=offset).reshape(num_runs, num_columns)
+        num_samples = self.runs["num_samples"]
+        # Every chunk takes at least one bit per value, which bounds what
+        # read_column() allocates by the file's size.
+        if (np.any(self._runs_by_id >= num_runs)
+                or np.any(self._runs_by_start >= num_runs)
+                or np.any(num_samples < 1)
+                or np.any((num_samples[:, np.newaxis] + 7) // 8
+                          > chunks["size"])
+                or np.any(chunks["offset"] + chunks["size"] > index_offset)):
+            raise ValueError(f"{filename}: invalid index")
+        self._start_times = self.runs["start_time"][self._runs_by_start]
+        if not np.all(self._start_times[1:] >= self._start_times[:-1]):
+            raise ValueError(f"{filename}: runs not sorted by start time")
+        # The latest end time of the runs up to each position in
+        # _runs_by_start, which never decreases.
+        self._max_end_times = np.maximum.accumulate(
+            self.runs["end_time"][self._runs_by_start])
+        # Python integers are much faster to index and pass to NumPy, one
+        # chunk at a time, than NumPy scalars.
+        self._offsets = chunks["offset"].tolist()
+        self._sizes = chunks["size"].tolist()
+        self._num_samples = self.runs["num_samples"].tolist()
+
+    @property
+    def num_runs(self):
+        return len(self.runs)
+
+    def find_column(self, name):
+        """Returns the index of the column named `name`."""
+        return self.column_names.index(name)
+
+    def find_run(self, run_id):
+        """Returns the index of the run `run_id`, or None if there is
+        none."""
+        ids = self.runs["run_id"][self._runs_by_id]
+        i = np.searchsorted(ids, run_id)
+        if i == len(ids) or ids[i] != run_id:
+            return None
+        return int(self._runs_by_id[i])
+
+    def find_runs(self, start_time, end_time):
+        """Returns the indices of the runs whose time ranges overlap
+        [start_time, end_time]."""
+        # Binary searches skip the runs that start after end_time, and the
+        # earliest starting runs that all end before start_time.
+        last = np.searchsorted(self._start_times, end_time, side="right")
+        first = np.searchsorted(self._max_end_times[:last], start_time)
+        candidates = self._runs_by_start[first:last]
+        return np.sort(candidates[
+            self.runs["end_time"][candidates] >= start_time]).astype(np.intp)
+
+    def read_column(self, run_index, column):
+        """Returns the column `column` (an index or a name) of the run with
+        index `run_index`, as a float64 array; a read-only view of the file
+        if the column is stored raw."""
+        if isinstance(column, str):
+            column = self.find_column(column)
+        offset = self._offsets[run_index][column]
+        size = self._sizes[run_index][column]
+        num_samples = self._num_samples[run_index]
+        if self._codecs[column] == RAW:
+            return np.frombuffer(
+                self._mmap, "<f8", count=num_samples, offset=offset)
+        return _decode_shuffled_delta(
+            np.frombuffer(self._mmap, np.uint8, count=size, offset=offset),
+            num_samples)
+
+    def read_run(self, run_index):
+        """Returns all columns of the run with index `run_index`, as a dict
+        from column name to array."""
+        return {name: self.read_column(run_index, j)
+                for j, name in enumerate(self.column_names)}
+
+
+def _decode_shuffled_delta(data, num_samples):
+    # Byte k of each residual, gathered from plane k.
+    planes = np.zeros((num_samples, 8), np.uint8)
+    bitmap_size = (num_samples + 7) // 8
+    offset = 8
+    if len(data) < 8 or data[0] == _ZERO_PLANE:
+        raise ValueError("invalid chunk")
+    for k, mode in enumerate(data[:8].tolist()):
+        if mode == _DENSE_PLANE:
+            planes[:, k] = data[offset:offset + num_samples]
+            offset += num_samples
+        elif mode == _SPARSE_PLANE:
+            nonzero = np.unpackbits(
+                data[offset:offset + bitmap_size], count=num_samples,
+                bitorder="little").view(bool)
+            offset += bitmap_size
+            count = int(np.count_nonzero(nonzero))
+            planes[nonzero, k] = data[offset:offset + count]
+            offset += count
+        elif mode != _ZERO_PLANE:
+            raise ValueError("invalid chunk")
+    if offset != len(data):
+        raise ValueError("invalid chunk")
+    residuals = planes.view("<u8").ravel()
+    second = (residuals >> np.uint64(1)) ^ (
+        np.uint64(0) - (residuals & np.uint64(1)))
+    return np.cumsum(np.cumsum(second), out=second).view(np.float64)
+
+
+def _encode_shuffled_delta(values):
+    bits = np.ascontiguousarray(values, np.float64).view(np.uint64)
+    first = np.diff(bits, prepend=np.uint64(0))
+    second = np.diff(first, prepend=np.uint64(0))
+    residuals = (second << np.uint64(1)) ^ (
+        np.uint64(0) - (second >> np.uint64(63)))
+    size = len(residuals)
+    bitmap_size = (size + 7) // 8
+    modes = np.zeros(8, np.uint8)
+    parts = [modes]
+    for k in range(8):
+        plane = (residuals >> np.uint64(8 * k)).astype(np.uint8)
+        nonzero = plane != 0
+        count = int(np.count_nonzero(nonzero))
+        # The lowest plane is stored even if it is all zeros, so that the
+        # chunk takes at least one bit per value.
+        if count == 0 and k > 0:
+            continue
+        if bitmap_size + count < size:
+            modes[k] = _SPARSE_PLANE
+            parts += [np.packbits(nonzero, bitorder="little"), plane[nonzero]]
+        else:
+            modes[k] = _DENSE_PLANE
+            parts.append(plane)
+    return np.concatenate(parts).tobytes()
+
+
+def write_dataset(filename, columns, runs, codecs=None):
+    """Writes a trajectory dataset with the value columns named `columns`,
+    compressed with the corresponding `codecs` (by default, all
+    SHUFFLED_DELTA). `runs` yields (run_id, times, values) triples, where
+    `values` has one row per time and one column per value column."""
+    codecs = [SHUFFLED_DELTA] * len(columns) if codecs is None else codecs
+    names = ["time"] + list(columns)
+    codecs = [SHUFFLED_DELTA] + list(codecs)
+    if (len(set(names)) != len(names) or len(codecs) != len(names)
+            or not all(0 < len(name.encode()) < 56 for name in names)):
+        raise ValueError("invalid columns")
+    run_records = []
+    chunks = []
+    with open(filename, "wb") as f:
+        f.write(_MAGIC)
+        for run_id, times, values in runs:
+            times = np.asarray(times, np.float64)
+            values = np.asarray(values, np.float64).reshape(len(times), -1)
+            if (len(times) < 1 or values.shape[1] != len(columns)
+                    or np.any(np.isnan(times))
+                    or np.any(np.diff(times) < 0)):
+                raise ValueError(f"invalid run {run_id}")
+            for codec, column in zip(codecs, [times] + list(values.T)):
+                if codec == RAW:
+                    data = np.ascontiguousarray(column, "<f8").tobytes()
+                else:
+                    data = _encode_shuffled_delta(column)
+                chunks.append((f.tell(), len(data)))
+                f.write(data + bytes(-len(data) % 8))
+            run_records.append((run_id, len(times), times[0], times[-1]))
+        index_offset = f.tell()
+        run_records = np.array(run_records, _RUN)
+        if len(np.unique(run_records["run_id"])) != len(run_records):
+            raise ValueError("repeated run ids")
+        column_records = np.zeros(len(names), _COLUMN)
+        column_records["codec"] = codecs
+        column_records["name"] = [name.encode() for name in names]
+        f.write(np.array([len(names), len(run_records)], "<u8").tobytes())
+        f.write(column_records.tobytes())
+        f.write(run_records.tobytes())
+        f.write(np.argsort(run_records["run_id"], kind="stable")
+                .astype("<u8").tobytes())
+        f.write(np.argsort(run_records["start_time"], kind="stable")
+                .astype("<u8").tobytes())
+        f.write(np.array(chunks, _CHUNK).tobytes())
+        f.write(np.array([index_offset], "<u8").tobytes())
+        f.write(_MAGIC)
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: MIT-0
+
+#include "trajectory_dataset.h"  // IWYU pragma: associated
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <drake/systems/analysis/simulator.h>
+#include <drake/systems/framework/diagram.h>
+#include <drake/systems/framework/diagram_builder.h>
+#include <drake/systems/primitives/sine.h>
+#include <drake/systems/primitives/vector_log_sink.h>
+
+#include "particle/particle.h"
+
+namespace drake_external_examples {
+namespace trajectory_dataset {
+namespace {
+
+using drake::systems::DiagramBuilder;
+using drake::systems::Simulator;
+using drake::systems::Sine;
+using drake::systems::VectorLogSink;
+
+std::string TempFile(const std::string& name) {
+  return ::testing::TempDir() + "/" + name;
+}
+
+/// Returns true iff @p a and @p b have the same bits, so that NaNs and signed
+/// zeros count as well.
+bool BitwiseEqual(const Eigen::VectorXd& a, const Eigen::VectorXd& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (int64_t i = 0; i < a.size(); ++i) {
+    if (std::bit_cast<uint64_t>(a(i)) != std::bit_cast<uint64_t>(b(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Makes sure runs round-trip exactly through both codecs, including values
+/// that do not compress, and can be found by id and by time range.
+TEST(TrajectoryDatasetTest, RoundTrip) {
+  const std::string filename = TempFile("round_trip.trj");
+  std::mt19937_64 generator(0);
+  std::vector<Eigen::VectorXd> times;
+  std::vector<Eigen::MatrixXd> values;
+  {
+    TrajectoryDatasetWriter writer(
+        filename, {{"smooth"}, {"raw", ColumnCodec::kRaw}, {"noise"}});
+    for (int run = 0; run < 3; ++run) {
+      const int size = 1 + 500 * run;
+      times.push_back(
+          Eigen::VectorXd::LinSpaced(size, run, run + 0.001 * (size - 1)));
+      Eigen::MatrixXd run_values(size, 3);
+      for (int i = 0; i < size; ++i) {
+        run_values(i, 0) = std::sin(times.back()(i));
+        run_values(i, 1) = std::cos(times.back()(i));
+        run_values(i, 2) = std::bit_cast<double>(generator());
+      }
+      if (size > 4) {
+        run_values(1, 0) = std::numeric_limits<double>::infinity();
+        run_values(2, 0) = -0.0;
+        run_values(3, 0) = std::numeric_limits<double>::denorm_min();
+      }
+      values.push_back(run_values);
+      // Ids need not be written in order.
+      writer.AddRun(100 - run, times.back(), run_values);
+    }
+    writer.Finish();
+    EXPECT_EQ(writer.num_runs(), 3);
+  }
+
+  const TrajectoryDataset dataset(filename);
+  ASSERT_EQ(dataset.num_columns(), 4);
+  EXPECT_EQ(dataset.column(0).name, "time");
+  EXPECT_EQ(dataset.column(2).codec, ColumnCodec::kRaw);
+  EXPECT_EQ(dataset.FindColumn("noise"), 3);
+  EXPECT_THROW(dataset.FindColumn("missing"), std::exception);
+  ASSERT_EQ(dataset.num_runs(), 3);
+  for (int run = 0; run < 3; ++run) {
+    EXPECT_EQ(dataset.run(run).run_id, 100 - run);
+    EXPECT_EQ(dataset.run(run).num_samples, times[run].size());
+    EXPECT_EQ(dataset.run(run).start_time, times[run](0));
+    EXPECT_TRUE(BitwiseEqual(dataset.ReadColumn(run, 0), times[run]));
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_TRUE(BitwiseEqual(dataset.ReadColumn(run, j + 1),
+                               values[run].col(j)));
+    }
+    const auto mapped = dataset.MapColumn(run, 2);
+    ASSERT_TRUE(mapped.has_value());
+    EXPECT_TRUE(BitwiseEqual(*mapped, values[run].col(1)));
+    EXPECT_FALSE(dataset.MapColumn(run, 1).has_value());
+  }
+
+  EXPECT_EQ(dataset.FindRun(99), 1);
+  EXPECT_EQ(dataset.FindRun(7), std::nullopt);
+  EXPECT_EQ(dataset.FindRuns(0.5, 1.0), std::vector<int>({1}));
+  EXPECT_EQ(dataset.FindRuns(1.2, 2.0), std::vector<int>({1, 2}));
+  EXPECT_EQ(dataset.FindRuns(5.0, 6.0), std::vector<int>());
+  EXPECT_THROW(dataset.ReadColumn(3, 0), std::exception);
+}
+
+/// Makes sure runs found by time range with the sorted index match a scan of
+/// every run, and that a column of zeros still reads back.
+TEST(TrajectoryDatasetTest, FindRuns) {
+  const std::string filename = TempFile("find_runs.trj");
+  std::mt19937_64 generator(1);
+  std::uniform_real_distribution<double> start(0.0, 100.0);
+  std::uniform_real_distribution<double> duration(0.0, 5.0);
+  std::vector<std::pair<double, double>> ranges;
+  {
+    TrajectoryDatasetWriter writer(filename, {{"x"}});
+    for (int run = 0; run < 200; ++run) {
+      const double start_time = start(generator);
+      // A few long runs overlap many others.
+      const double end_time =
+          start_time + (run % 7 == 0 ? 50.0 : duration(generator));
+      writer.AddRun(run, Eigen::Vector2d(start_time, end_time),
+                    Eigen::Vector2d::Zero());
+      ranges.emplace_back(start_time, end_time);
+    }
+    writer.Finish();
+  }
+  const TrajectoryDataset dataset(filename);
+  std::uniform_real_distribution<double> query(-10.0, 160.0);
+  for (int i = 0; i < 500; ++i) {
+    const double start_time = query(generator);
+    const double end_time = start_time + (i % 3) * 10.0;
+    std::vector<int> expected;
+    for (int run = 0; run < 200; ++run) {
+      if (ranges[run].first <= end_time && ranges[run].second >= start_time) {
+        expected.push_back(run);
+      }
+    }
+    EXPECT_EQ(dataset.FindRuns(start_time, end_time), expected);
+  }
+  EXPECT_EQ(dataset.ReadColumn(3, 1), Eigen::Vector2d::Zero());
+}
+
+/// Makes sure a simulated Particle rollout, logged by a VectorLogSink,
+/// compresses well and reads back exactly.
+TEST(TrajectoryDatasetTest, CompressesRollout) {
+  DiagramBuilder<double> builder;
+  auto force = builder.AddSystem<Sine<double>>(2.0, 3.0, 0.5, 1);
+  auto particle = builder.AddSystem<particles::Particle<double>>();
+  auto logger = builder.AddSystem<VectorLogSink<double>>(2, 1.0e-3);
+  builder.Connect(force->get_output_port(0), particle->get_input_port(0));
+  builder.Connect(particle->get_output_port(0), logger->get_input_port());
+  auto diagram = builder.Build();
+  Simulator<double> simulator(*diagram);
+  simulator.AdvanceTo(5.0);
+  const auto& log = logger->FindLog(simulator.get_context());
+
+  const std::string raw_filename = TempFile("raw_rollout.trj");
+  const std::string filename = TempFile("rollout.trj");
+  TrajectoryDatasetWriter raw_writer(
+      raw_filename, {{"x", ColumnCodec::kRaw}, {"v", ColumnCodec::kRaw}});
+  raw_writer.AddRun(0, log);
+  raw_writer.Finish();
+  TrajectoryDatasetWriter writer(filename, {{"x"}, {"v"}});
+  writer.AddRun(0, log);
+  writer.Finish();
+
+  EXPECT_LT(std::filesystem::file_size(filename),
+            0.85 * std::filesystem::file_size(raw_filename));
+  const TrajectoryDataset dataset(filename);
+  EXPECT_TRUE(BitwiseEqual(dataset.ReadColumn(0, 0), log.sample_times()));
+  EXPECT_TRUE(BitwiseEqual(dataset.ReadColumn(0, dataset.FindColumn("v")),
+                           log.data().row(1).transpose()));
+}
+
+/// Makes sure malformed datasets and runs are rejected.
+TEST(TrajectoryDatasetTest, RejectsBadInput) {
+  EXPECT_THROW(TrajectoryDataset(TempFile("no_such_file.trj")),
+               std::exception);
+  const std::string garbage = TempFile("garbage.trj");
+  std::ofstream(garbage) << "this is not a trajectory dataset, not at all";
+  EXPECT_THROW(TrajectoryDataset{garbage}, std::exception);
+
+  EXPECT_THROW(TrajectoryDatasetWriter(TempFile("bad.trj"), {{"time"}}),
+               std::exception);
+  EXPECT_THROW(TrajectoryDatasetWriter(TempFile("bad.trj"), {{"x"}, {"x"}}),
+               std::exception);
+
+  const std::string unfinished = TempFile("unfinished.trj");
+  {
+    TrajectoryDatasetWriter writer(unfinished, {{"x"}});
+    writer.AddRun(1, Eigen::Vector2d(0.0, 1.0), Eigen::Vector2d(2.0, 3.0));
+    EXPECT_THROW(
+        writer.AddRun(1, Eigen::Vector2d(0.0, 1.0), Eigen::Vector2d(2.0, 3.0)),
+        std::exception);
+    EXPECT_THROW(
+        writer.AddRun(2, Eigen::Vector2d(1.0, 0.0), Eigen::Vector2d(2.0, 3.0)),
+        std::exception);
+    EXPECT_THROW(writer.AddRun(3, Eigen::Vector2d(0.0, 1.0),
+                               Eigen::MatrixXd::Zero(2, 2)),
+                 std::exception);
+    EXPECT_THROW(
+        writer.AddRun(4,
+                      Eigen::VectorXd::Constant(
+                          1, std::numeric_limits<double>::quiet_NaN()),
+                      Eigen::VectorXd::Zero(1)),
+        std::exception);
+  }
+  EXPECT_THROW(TrajectoryDataset{unfinished}, std::exception);
+
+  // A run whose number of samples its chunks could not hold is rejected
+  // before anything is allocated for it.
+  const std::string oversized = TempFile("oversized.trj");
+  {
+    TrajectoryDatasetWriter writer(oversized, {{"x"}});
+    writer.AddRun(1, Eigen::Vector2d(0.0, 1.0), Eigen::Vector2d(2.0, 3.0));
+    writer.Finish();
+  }
+  {
+    std::fstream file(oversized,
+                      std::ios::binary | std::ios::in | std::ios::out);
+    uint64_t index_offset = 0;
+    file.seekg(-16, std::ios::end);
+    file.read(reinterpret_cast<char*>(&index_offset), sizeof(index_offset));
+    // After the counts and two column records, the run's num_samples
+    // follows its run_id.
+    const uint64_t num_samples = uint64_t{1} << 40;
+    file.seekp(index_offset + 16 + 2 * 64 + 8);
+    file.write(reinterpret_cast<const char*>(&num_samples),
+               sizeof(num_samples));
+  }
+  EXPECT_THROW(TrajectoryDataset{oversized}, std::exception);
+}
+
+}  // namespace
+}  // namespace trajectory_dataset
+}  // namespace drake_external_examples
@@ -0,0 +1,175 @@
+# SPDX-License-Identifier: MIT-0
+
+"""
+Measures how sweeps of rollouts of the Python Particle scale with the number
+of workers, for SweepRunner's worker processes, and for threads, which the GIL
+serializes.
+
+Usage: python3 sweep_benchmark.py [--rollouts=<count>] [--samples=<count>]
+           [--end-time=<seconds>] [--max-workers=<count>]
+
+Each rollout simulates a Particle under a random constant acceleration from a
+random initial state, sampling it `--samples` times (default 101) over
+`--end-time` (default 1 s). The table reports, for 1, 2, 4, ... up to
+`--max-workers` (default, the number of CPUs) workers, the wall time of a
+sweep of `--rollouts` rollouts (default 1000), the rollouts per second, and
+the speedup and efficiency over one worker:
+- processes: SweepRunner, writing to shared memory; its startup, i.e., forking
+  the workers and building their diagrams, is reported separately;
+- processes, pickled: the same workers, but returning their samples pickled,
+  to be copied into the result by the parent;
+- threads: a thread pool, each thread with its own diagram.
+Only the standard library, NumPy, and pydrake are needed, e.g., as installed
+by pip.
+"""
+
+import argparse
+from concurrent.futures import ThreadPoolExecutor
+import math
+import multiprocessing
+import os
+import threading
+import time
+
+import numpy as np
+
+import sweep_runner
+from sweep_runner import SweepRunner
+
+
+def _run_chunk_pickled(task):
+    """Like sweep_runner's workers, but returns the samples of the chunk."""
+    initial_states, accelerations, num_samples = task
+    samples = np.empty((len(accelerations), num_samples, 2))
+    for i, (initial_state, acceleration) in enumerate(
+            zip(initial_states, accelerations)):
+        sweep_runner._rollout.simulate(initial_state, acceleration, samples[i])
+    return samples
+
+
+def _chunks(initial_states, accelerations, num_workers):
+    """Splits the rollouts into about four chunks per worker, as SweepRunner
+    does by default.
+    """
+    size = max(1, math.ceil(len(accelerations) / (4 * num_workers)))
+    return [(initial_states[start:start + size],
+             accelerations[start:start + size])
+            for start in range(0, len(accelerations), size)]
+
+
+def _measure_processes(args, num_workers, initial_states, accelerations):
+    """Returns the startup and sweep times of a SweepRunner."""
+    start = time.perf_counter()
+    with SweepRunner(args.end_time, args.samples, num_workers) as runner:
+        # A sweep of one rollout per worker waits for the workers to start.
+        runner.run(initial_states[:num_workers], accelerations[:num_workers],
+                   chunk_size=1)
+        startup = time.perf_counter() - start
+        start = time.perf_counter()
+        runner.run(initial_states, accelerations)
+        return startup, time.perf_counter() - start
+
+
+def _measure_pickled(args, num_workers, initial_states, accelerations):
+    context = multiprocessing.get_context(sweep_runner._START_METHOD)
+    with context.Pool(num_workers, initializer=sweep_runner._initialize_worker,
+                      initargs=(args.end_time, args.samples)) as pool:
+        warm_up = [(initial_states[i:i + 1], accelerations[i:i + 1],
+                    args.samples) for i in range(num_workers)]
+        pool.map(_run_chunk_pickled, warm_up, chunksize=1)
+        start = time.perf_counter()
+        samples = np.empty((len(accelerations), args.samples, 2))
+        tasks = [chunk + (args.samples,) for chunk in
+                 _chunks(initial_states, accelerations, num_workers)]
+        row = 0
+        for chunk in pool.imap(_run_chunk_pickled, tasks):
+            samples[row:row + len(chunk)] = chunk
+            row += len(chunk)
+        return time.perf_counter() - start
+
+
+def _measure_threads(args, num_workers, initial_states, accelerations):
+    local = threading.local()
+
+    def run_chunk(chunk, offset, samples):
+        if not hasattr(local, "rollout"):
+            local.rollout = sweep_runner._Rollout(args.end_time, args.samples)
+        for i, (initial_state, acceleration) in enumerate(zip(*chunk)):
+            local.rollout.simulate(initial_state, acceleration,
+                                   samples[offset + i])
+
+    with ThreadPoolExecutor(num_workers) as executor:
+        samples = np.empty((len(accelerations), args.samples, 2))
+        # Build each thread's diagram before the clock starts.
+        list(executor.map(
+            lambda i: run_chunk((initial_states[i:i + 1],
+                                 accelerations[i:i + 1]), 0, samples[i:]),
+            range(num_workers)))
+        chunks = _chunks(initial_states, accelerations, num_workers)
+        offsets = np.cumsum([0] + [len(chunk[1]) for chunk in chunks])
+        start = time.perf_counter()
+        list(executor.map(run_chunk, chunks, offsets,
+                          [samples] * len(chunks)))
+        return time.perf_counter() - start
+
+
+def _print_row(mode, num_workers, seconds, baseline, num_rollouts,
+               startup=None):
+    speedup = baseline / seconds
+    line = (f"{mode:<20}  {num_workers:>7}  {seconds:>9.3f}  "
+            f"{num_rollouts / seconds:>10.1f}  {speedup:>7.2f}  "
+            f"{speedup / num_workers:>10.0%}")
+    if startup is not None:
+        line += f"  {startup:>11.3f}"
+    print(line, flush=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.split("\n\n")[0].strip())
+    parser.add_argument("--rollouts", type=int, default=1000)
+    parser.add_argument("--samples", type=int, default=101)
+    parser.add_argument("--end-time", type=float, default=1.0)
+    parser.add_argument("--max-workers", type=int, default=os.cpu_count())
+    args = parser.parse_args()
+    if args.rollouts < 1 or args.samples < 1 or args.max_workers < 1:
+        parser.error("--rollouts, --samples and --max-workers must be "
+                     "positive")
+    if not args.end_time > 0.0:
+        parser.error("--end-time must be positive")
+
+    generator = np.random.default_rng(seed=0)
+    initial_states = generator.uniform(-1.0, 1.0, size=(args.rollouts, 2))
+    accelerations = generator.uniform(-1.0, 1.0, size=args.rollouts)
+    worker_counts = [2**i for i in range(
+        int(math.log2(args.max_workers)) + 1)]
+    if worker_counts[-1] != args.max_workers:
+        worker_counts.append(args.max_workers)
+
+    print(f"{args.rollouts} rollouts of {args.samples} samples over "
+          f"{args.end_time} s")
+    print(f"{'mode':<20}  {'workers':>7}  {'sweep [s]':>9}  "
+          f"{'rollouts/s':>10}  {'speedup':>7}  {'efficiency':>10}  "
+          f"{'startup [s]':>11}")
+    # The processes are measured first, so that they are forked before this
+    # process imports pydrake for the threads.
+    baseline = None
+    for num_workers in worker_counts:
+        startup, seconds = _measure_processes(
+            args, num_workers, initial_states, accelerations)
+        baseline = baseline or seconds
+        _print_row("processes", num_workers, seconds, baseline,
+                   args.rollouts, startup)
+    for num_workers in worker_counts:
+        seconds = _measure_pickled(
+            args, num_workers, initial_states, accelerations)
+        _print_row("processes, pickled", num_workers, seconds, baseline,
+                   args.rollouts)
+    for num_workers in worker_counts:
+        seconds = _measure_threads(
+            args, num_workers, initial_states, accelerations)
+        _print_row("threads", num_workers, seconds, baseline, args.rollouts)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1 @@
+../../../drake_cmake_external/drake_external_examples/src/simple_continuous_time_system/simple_continuous_time_system.h
\ No newline at end of file
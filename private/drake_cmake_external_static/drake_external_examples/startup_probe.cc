@@ -0,0 +1 @@
+../../../drake_cmake_external/drake_external_examples/src/startup_benchmark/startup_probe.cc
\ No newline at end of file
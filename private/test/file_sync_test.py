@@ -77,6 +77,10 @@ COPIES = (
         f"{example_root}/find_resource_example.py"
         for example_root in PY_EXAMPLE_ROOTS
     ]),
+    tuple([
+        f"{example_root}/import_benchmark.py"
+        for example_root in CMAKE_EXAMPLE_ROOTS + PY_EXAMPLE_ROOTS
+    ]),
     tuple([
         f"{example_root}/find_resource/find_resource_example.cc"
         for example_root in CPP_EXAMPLE_ROOTS
@@ -93,11 +97,16 @@ COPIES = (
         f"{example_root}/simple_continuous_time_system/CMakeLists.txt"
         for example_root in CMAKE_EXAMPLE_ROOTS
     ]),
+) + tuple([
     tuple([
-        f"{example_root}/simple_continuous_time_system/simple_continuous_time_system.cc"
+        f"{example_root}/simple_continuous_time_system/{path}"
         for example_root in CPP_EXAMPLE_ROOTS
-    ]),
-) + tuple([
+    ])
+    for path in [
+        "simple_continuous_time_system.cc",
+        "simple_continuous_time_system.h",
+    ]
+]) + tuple([
     tuple([
         f"{example_root}/../cmake/{path}"
         for example_root in CMAKE_EXAMPLE_ROOTS
@@ -116,15 +125,193 @@ COPIES = (
         "particle.h",
         "particle_test.cc",
     ]
+]) + tuple([
+    tuple([
+        f"{example_root}/symbolic_codegen/{path}"
+        for example_root in CPP_EXAMPLE_ROOTS
+    ])
+    for path in [
+        "derivatives_codegen.cc",
+        "derivatives_codegen.h",
+        "derivatives_codegen_main.cc",
+        "derivatives_codegen_test.cc",
+        "generated_system.h",
+    ]
+]) + tuple([
+    tuple([
+        f"{example_root}/symbolic_codegen/generated_derivatives.bzl"
+        for example_root in BAZEL_EXAMPLE_ROOTS
+    ]),
 ]) + tuple([
     tuple([
         f"{example_root}/simple_bindings/{path}"
         for example_root in CMAKE_EXAMPLE_ROOTS
     ])
     for path in [
+        "simple_adder.h",
         "simple_bindings.cc",
+        "simple_bindings.py",
         "simple_bindings_test.py",
     ]
+]) + tuple([
+    tuple([
+        f"{example_root}/{path}"
+        for example_root in CMAKE_EXAMPLE_ROOTS
+    ])
+    for path in [
+        "adjoint/CMakeLists.txt",
+        "adjoint/adjoint.cc",
+        "adjoint/adjoint.h",
+        "adjoint/adjoint_test.cc",
+        "benchmark_harness/CMakeLists.txt",
+        "benchmark_harness/benchmark_fixture.cc",
+        "benchmark_harness/benchmark_fixture.h",
+        "benchmark_harness/benchmark_fixture_test.cc",
+        "benchmark_harness/example_systems_benchmark.cc",
+        "benchmark_harness/perf_counters.cc",
+        "benchmark_harness/perf_counters.h",
+        "benchmark_harness/perf_counters_test.cc",
+        "cosimulation/CMakeLists.txt",
+        "cosimulation/cosimulation.py",
+        "cosimulation/cosimulation_benchmark.cc",
+        "cosimulation/cosimulation_system.cc",
+        "cosimulation/cosimulation_system.h",
+        "cosimulation/cosimulation_test.cc",
+        "cosimulation/pd_controller.py",
+        "cosimulation/shared_memory_mailbox.cc",
+        "cosimulation/shared_memory_mailbox.h",
+        "context_forking/CMakeLists.txt",
+        "context_forking/context_forker.cc",
+        "context_forking/context_forker.h",
+        "context_forking/context_forker_test.cc",
+        "context_forking/context_forking_benchmark.cc",
+        "context_forking/copy_on_write.h",
+        "context_forking/force_profile.cc",
+        "context_forking/force_profile.h",
+        "arena_allocation/CMakeLists.txt",
+        "arena_allocation/arena.cc",
+        "arena_allocation/arena.h",
+        "arena_allocation/arena_benchmark.cc",
+        "arena_allocation/arena_test.cc",
+        "arena_allocation/batch_simulation.cc",
+        "arena_allocation/batch_simulation.h",
+        "bulk_diagram/CMakeLists.txt",
+        "bulk_diagram/bulk_diagram.cc",
+        "bulk_diagram/bulk_diagram.h",
+        "bulk_diagram/bulk_diagram_benchmark.cc",
+        "bulk_diagram/bulk_diagram_test.cc",
+        "benchmark_harness/counting_allocator.cc",
+        "benchmark_harness/counting_allocator.h",
+        "benchmark_harness/counting_allocator_test.cc",
+        "adjoint/adjoint_benchmark.cc",
+        "dense_output/CMakeLists.txt",
+        "dense_output/dense_output.cc",
+        "dense_output/dense_output.h",
+        "dense_output/dense_output_benchmark.cc",
+        "dense_output/dense_output_test.cc",
+        "event_detection/CMakeLists.txt",
+        "event_detection/bouncing_particle.cc",
+        "event_detection/bouncing_particle.h",
+        "event_detection/bouncing_particle_test.cc",
+        "event_detection/crossing_detector.cc",
+        "event_detection/crossing_detector.h",
+        "event_detection/crossing_detector_test.cc",
+        "event_detection/event_detection_benchmark.cc",
+        "implicit_integration/CMakeLists.txt",
+        "implicit_integration/implicit_integration_benchmark.cc",
+        "implicit_integration/implicit_integrator.cc",
+        "implicit_integration/implicit_integrator.h",
+        "implicit_integration/implicit_integrator_test.cc",
+        "implicit_integration/state_jacobian.cc",
+        "implicit_integration/state_jacobian.h",
+        "implicit_integration/state_jacobian_test.cc",
+        "implicit_integration/stiff_cubic_chain.cc",
+        "implicit_integration/stiff_cubic_chain.h",
+        "interacting_particles/CMakeLists.txt",
+        "interacting_particles/cell_list.cc",
+        "interacting_particles/cell_list.h",
+        "interacting_particles/cell_list_test.cc",
+        "interacting_particles/interacting_particles.cc",
+        "interacting_particles/interacting_particles.h",
+        "interacting_particles/interacting_particles_benchmark.cc",
+        "interacting_particles/interacting_particles_test.cc",
+        "model_cache/CMakeLists.txt",
+        "model_cache/model_cache.cc",
+        "model_cache/model_cache.h",
+        "model_cache/model_cache_benchmark.cc",
+        "model_cache/model_cache_test.cc",
+        "multibody_pendulum/CMakeLists.txt",
+        "multibody_pendulum/multibody_pendulum.cc",
+        "multibody_pendulum/multibody_pendulum.h",
+        "multibody_pendulum/multibody_pendulum_benchmark.cc",
+        "multibody_pendulum/multibody_pendulum_test.cc",
+        "parareal/CMakeLists.txt",
+        "parareal/parareal.cc",
+        "parareal/parareal.h",
+        "parareal/parareal_benchmark.cc",
+        "parareal/parareal_test.cc",
+        "particle_mpc/CMakeLists.txt",
+        "particle_mpc/particle_mpc.cc",
+        "particle_mpc/particle_mpc.h",
+        "particle_mpc/particle_mpc_benchmark.cc",
+        "particle_mpc/particle_mpc_test.cc",
+        "realtime_harness/CMakeLists.txt",
+        "realtime_harness/latency_histogram.cc",
+        "realtime_harness/latency_histogram.h",
+        "realtime_harness/latency_histogram_test.cc",
+        "realtime_harness/realtime_harness.cc",
+        "rollout_cache/CMakeLists.txt",
+        "rollout_cache/rollout_cache.cc",
+        "rollout_cache/rollout_cache.h",
+        "rollout_cache/rollout_cache_benchmark.cc",
+        "rollout_cache/rollout_cache_test.cc",
+        "simulation_server/CMakeLists.txt",
+        "simulation_server/rollout_model.cc",
+        "simulation_server/rollout_model.h",
+        "simulation_server/rollout_protocol.cc",
+        "simulation_server/rollout_protocol.h",
+        "simulation_server/simulation_client.cc",
+        "simulation_server/simulation_client.h",
+        "simulation_server/simulation_server.cc",
+        "simulation_server/simulation_server.h",
+        "simulation_server/simulation_server_benchmark.cc",
+        "simulation_server/simulation_server_main.cc",
+        "simulation_server/simulation_server_test.cc",
+        "startup_benchmark/CMakeLists.txt",
+        "startup_benchmark/startup_benchmark.cc",
+        "startup_benchmark/startup_probe.cc",
+        "stochastic_particle/CMakeLists.txt",
+        "stochastic_particle/philox.h",
+        "stochastic_particle/philox_test.cc",
+        "stochastic_particle/stochastic_ensemble.cc",
+        "stochastic_particle/stochastic_ensemble.h",
+        "stochastic_particle/stochastic_ensemble_test.cc",
+        "stochastic_particle/stochastic_particle.cc",
+        "stochastic_particle/stochastic_particle.h",
+        "stochastic_particle/stochastic_particle_benchmark.cc",
+        "stochastic_particle/stochastic_particle_test.cc",
+        "symbolic_codegen/CMakeLists.txt",
+        "symbolic_codegen/derivatives_codegen_benchmark.cc",
+        "thread_pool/CMakeLists.txt",
+        "thread_pool/thread_pool.cc",
+        "thread_pool/thread_pool.h",
+        "thread_pool/thread_pool_test.cc",
+        "thread_safety/CMakeLists.txt",
+        "thread_safety/thread_safety_benchmark.cc",
+        "thread_safety/thread_safety_test.cc",
+        "time_series_source/CMakeLists.txt",
+        "time_series_source/time_series_source.cc",
+        "time_series_source/time_series_source.h",
+        "time_series_source/time_series_source_benchmark.cc",
+        "time_series_source/time_series_source_test.cc",
+        "trajectory_dataset/CMakeLists.txt",
+        "trajectory_dataset/trajectory_dataset.cc",
+        "trajectory_dataset/trajectory_dataset.h",
+        "trajectory_dataset/trajectory_dataset.py",
+        "trajectory_dataset/trajectory_dataset_benchmark.py",
+        "trajectory_dataset/trajectory_dataset_test.cc",
+        "trajectory_dataset/trajectory_dataset_test.py",
+    ]
 ]) + tuple([
     tuple([
         f"{example_root}/particle/{path}" for example_root in CPP_EXAMPLE_ROOTS
@@ -135,6 +322,18 @@ COPIES = (
         "particle.py",
         "particle_test.py",
     ]
+]) + tuple([
+    tuple([
+        f"{example_root}/particle/{path}"
+        for example_root in CMAKE_EXAMPLE_ROOTS
+    ] + [
+        f"{example_root}/{path}" for example_root in PY_EXAMPLE_ROOTS
+    ])
+    for path in [
+        "sweep_benchmark.py",
+        "sweep_runner.py",
+        "sweep_runner_test.py",
+    ]
 ])
 
 GITHUB_WORKFLOWS = (